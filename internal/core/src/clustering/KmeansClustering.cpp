@@ -19,13 +19,13 @@
 
 #include "common/FastMem.h"
 #include <cstdint>
-#include <ctime>
 #include <numeric>
 #include <random>
 #include <utility>
 
 #include "clustering/KmeansClustering.h"
 #include "clustering/file_utils.h"
+#include "clustering/MiniBatchKmeans.h"
 #include "common/Common.h"
 #include "common/Consts.h"
 #include "common/Types.h"
@@ -79,6 +79,51 @@ CopyFieldDatasToBuf(uint8_t* buf,
     return fetched;
 }
 
+// Segments in the order they are sampled and refined in. The seed is fixed,
+// so a rerun of the same analyze task samples the same segments.
+static std::vector<int64_t>
+ShuffleSegments(const std::vector<int64_t>& segment_ids) {
+    std::vector<int64_t> order(segment_ids.begin(), segment_ids.end());
+    std::mt19937 rng(DEFAULT_KMEANS_SHUFFLE_SEED);
+    std::shuffle(order.begin(), order.end(), rng);
+    return order;
+}
+
+// Insert files of a segment ordered by log id.
+static std::vector<std::string>
+SortInsertFiles(std::vector<std::string> files) {
+    std::sort(files.begin(),
+              files.end(),
+              [](const std::string& a, const std::string& b) {
+                  return std::stol(a.substr(a.find_last_of("/") + 1)) <
+                         std::stol(b.substr(b.find_last_of("/") + 1));
+              });
+    return files;
+}
+
+// Feed the vectors of field_datas to the model in mini-batches of
+// DEFAULT_KMEANS_MINIBATCH_SIZE rows, leaving out the first skip_rows of
+// them, and release each source as it is consumed.
+template <typename T>
+static void
+MiniBatchUpdate(MiniBatchKmeans<T>& minibatch,
+                std::vector<FieldDataPtr>& field_datas,
+                const int64_t dim,
+                int64_t& skip_rows) {
+    for (auto& data : field_datas) {
+        auto rows = int64_t(data->Size()) / (dim * int64_t(sizeof(T)));
+        auto vectors = static_cast<const T*>(data->Data());
+        auto start = std::min(skip_rows, rows);
+        skip_rows -= start;
+        for (; start < rows; start += DEFAULT_KMEANS_MINIBATCH_SIZE) {
+            minibatch.Update(
+                vectors + start * dim,
+                std::min(DEFAULT_KMEANS_MINIBATCH_SIZE, rows - start));
+        }
+        data.reset();
+    }
+}
+
 template <typename T>
 void
 KmeansClustering::FetchDataFiles(uint8_t* buf,
@@ -134,6 +179,89 @@ KmeansClustering::FetchSegmentViaManifest(
                fetched);
 }
 
+template <typename T>
+std::unique_ptr<T[]>
+KmeansClustering::FetchSegmentData(
+    const int64_t segment_id,
+    const std::map<int64_t, std::vector<std::string>>& insert_files,
+    const std::map<int64_t, int64_t>& num_rows,
+    const std::map<int64_t, std::string>& manifest_paths,
+    const Config& base_config,
+    const int64_t dim) {
+    int64_t num_row = num_rows.at(segment_id);
+    std::unique_ptr<T[]> buf = std::make_unique<T[]>(num_row * dim);
+    int64_t offset = 0;
+    int64_t expected = num_row * dim * sizeof(T);
+    auto mit = manifest_paths.find(segment_id);
+    if (mit != manifest_paths.end() && !mit->second.empty()) {
+        FetchSegmentViaManifest<T>(reinterpret_cast<uint8_t*>(buf.get()),
+                                   INT64_MAX,
+                                   expected,
+                                   mit->second,
+                                   base_config,
+                                   offset);
+    } else {
+        FetchDataFiles<T>(reinterpret_cast<uint8_t*>(buf.get()),
+                          INT64_MAX,
+                          expected,
+                          insert_files.at(segment_id),
+                          dim,
+                          offset);
+    }
+    return buf;
+}
+
+template <typename T>
+void
+KmeansClustering::MiniBatchRefine(
+    MiniBatchKmeans<T>& minibatch,
+    const std::vector<int64_t>& segment_ids,
+    const std::map<int64_t, int64_t>& sampled_rows,
+    const std::map<int64_t, std::vector<std::string>>& insert_files,
+    const std::map<int64_t, int64_t>& num_rows,
+    const std::map<int64_t, std::string>& manifest_paths,
+    const Config& base_config,
+    const int64_t dim) {
+    // The sample already went into the seeds, so only the rows it left out
+    // are streamed, in the sampling order: the fully sampled segments are
+    // skipped and the truncated one resumes where the sample stopped.
+    for (auto segment_id : ShuffleSegments(segment_ids)) {
+        int64_t num_row = num_rows.at(segment_id);
+        auto sampled = sampled_rows.find(segment_id);
+        int64_t skip_rows = sampled == sampled_rows.end() ? 0 : sampled->second;
+        if (skip_rows >= num_row) {
+            continue;
+        }
+        auto refined_rows = num_row - skip_rows;
+        auto mit = manifest_paths.find(segment_id);
+        if (mit != manifest_paths.end() && !mit->second.empty()) {
+            Config config = base_config;
+            config[SEGMENT_MANIFEST_KEY] = mit->second;
+            auto field_datas = file_manager_->CacheRawDataToMemory(config);
+            MiniBatchUpdate(minibatch, field_datas, dim, skip_rows);
+        } else {
+            // one bounded group of binlogs resident at a time, as in
+            // FetchDataFiles
+            auto files = SortInsertFiles(insert_files.at(segment_id));
+            auto batch =
+                size_t(DEFAULT_FIELD_MAX_MEMORY_LIMIT / FILE_SLICE_SIZE);
+            for (size_t i = 0; i < files.size(); i += batch) {
+                std::vector<std::string> group_files(
+                    files.begin() + i,
+                    files.begin() + std::min(files.size(), i + batch));
+                Config config;
+                config[INSERT_FILES_KEY] = group_files;
+                auto field_datas = file_manager_->CacheRawDataToMemory(config);
+                MiniBatchUpdate(minibatch, field_datas, dim, skip_rows);
+            }
+        }
+        LOG_INFO(msg_header_ + "mini-batch kmeans refined with segment {}, "
+                               "{} rows",
+                 segment_id,
+                 refined_rows);
+    }
+}
+
 template <typename T>
 void
 KmeansClustering::SampleTrainData(
@@ -145,7 +273,8 @@ KmeansClustering::SampleTrainData(
     const int64_t expected_train_size,
     const int64_t dim,
     const bool random_sample,
-    uint8_t* buf) {
+    uint8_t* buf,
+    std::map<int64_t, int64_t>& sampled_rows) {
     int64_t offset = 0;
 
     // One segment-level sampling loop covers both cases:
@@ -161,11 +290,7 @@ KmeansClustering::SampleTrainData(
     // min(full_segment, remaining_budget) so the size assert inside those
     // readers holds for BOTH a whole read and a truncated last read, and still
     // fires on an empty/short read (fetched = 0 != expected).
-    std::vector<int64_t> order(segment_ids.begin(), segment_ids.end());
-    if (random_sample) {
-        std::mt19937 rng(static_cast<unsigned int>(std::time(nullptr)));
-        std::shuffle(order.begin(), order.end(), rng);
-    }
+    auto order = random_sample ? ShuffleSegments(segment_ids) : segment_ids;
 
     for (auto cur_segment_id : order) {
         if (offset >= expected_train_size) {
@@ -173,6 +298,7 @@ KmeansClustering::SampleTrainData(
         }
         int64_t full = segment_num_rows.at(cur_segment_id) * dim * sizeof(T);
         int64_t expected = std::min(full, expected_train_size - offset);
+        sampled_rows[cur_segment_id] = expected / (dim * sizeof(T));
 
         auto mit = manifest_paths.find(cur_segment_id);
         if (mit != manifest_paths.end() && !mit->second.empty()) {
@@ -184,13 +310,7 @@ KmeansClustering::SampleTrainData(
                                        offset);
             continue;
         }
-        std::vector<std::string> files = segment_file_paths.at(cur_segment_id);
-        std::sort(files.begin(),
-                  files.end(),
-                  [](const std::string& a, const std::string& b) {
-                      return std::stol(a.substr(a.find_last_of("/") + 1)) <
-                             std::stol(b.substr(b.find_last_of("/") + 1));
-                  });
+        auto files = SortInsertFiles(segment_file_paths.at(cur_segment_id));
         FetchDataFiles<T>(
             buf, expected_train_size, expected, files, dim, offset);
     }
@@ -289,7 +409,7 @@ KmeansClustering::IsDataSkew(
 template <typename T>
 void
 KmeansClustering::StreamingAssignandUpload(
-    knowhere::Cluster<knowhere::ClusterNode>& cluster_node,
+    const CentroidAssigner<T>& assigner,
     const milvus::proto::clustering::AnalyzeInfo& config,
     const milvus::proto::clustering::ClusteringCentroidsStats& centroid_stats,
     const std::vector<
@@ -357,41 +477,16 @@ KmeansClustering::StreamingAssignandUpload(
             }
         } else {  // streaming download raw data, assign id mapping, then upload
             int64_t num_row = num_rows.at(segment_id);
-            std::unique_ptr<T[]> buf = std::make_unique<T[]>(num_row * dim);
-            int64_t offset = 0;
-            int64_t expected = num_row * dim * sizeof(T);
-            auto mit = manifest_paths.find(segment_id);
-            if (mit != manifest_paths.end() && !mit->second.empty()) {
-                FetchSegmentViaManifest<T>(
-                    reinterpret_cast<uint8_t*>(buf.get()),
-                    INT64_MAX,
-                    expected,
-                    mit->second,
-                    base_config,
-                    offset);
-            } else {
-                FetchDataFiles<T>(reinterpret_cast<uint8_t*>(buf.get()),
-                                  INT64_MAX,
-                                  expected,
-                                  insert_files.at(segment_id),
-                                  dim,
-                                  offset);
-            }
-            auto dataset = GenDataset(num_row, dim, buf.release());
-            dataset->SetIsOwner(true);
-            auto res = cluster_node.Assign(*dataset);
-            if (!res.has_value()) {
-                ThrowInfo(ErrorCode::UnexpectedError,
-                          fmt::format("failed to kmeans assign: {}: {}",
-                                      KnowhereStatusString(res.error()),
-                                      res.what()));
-            }
-            res.value()->SetIsOwner(true);
-            auto id_mapping =
-                reinterpret_cast<const uint32_t*>(res.value()->GetTensor());
+            auto buf = FetchSegmentData<T>(segment_id,
+                                           insert_files,
+                                           num_rows,
+                                           manifest_paths,
+                                           base_config,
+                                           dim);
+            auto id_mapping = assigner(std::move(buf), num_row);
 
             auto id_mapping_pb = CentroidIdMappingToPB(
-                id_mapping, {segment_id}, 1, num_rows, num_clusters)[0];
+                id_mapping.data(), {segment_id}, 1, num_rows, num_clusters)[0];
             for (int64_t j = 0; j < num_clusters; ++j) {
                 num_vectors_each_centroid[j] +=
                     id_mapping_pb.num_in_centroid(j);
@@ -506,6 +601,7 @@ KmeansClustering::Run(const milvus::proto::clustering::AnalyzeInfo& config) {
              train_size_final / 1024.0 / 1024.0 / 1024.0,
              data_size / 1024.0 / 1024.0 / 1024.0);
     auto buf = std::make_unique<uint8_t[]>(train_size_final);
+    std::map<int64_t, int64_t> sampled_rows;
     SampleTrainData<T>(segment_ids,
                        insert_files,
                        num_rows,
@@ -514,7 +610,8 @@ KmeansClustering::Run(const milvus::proto::clustering::AnalyzeInfo& config) {
                        train_size_final,
                        dim,
                        random_sample,
-                       buf.get());
+                       buf.get(),
+                       sampled_rows);
     rc.RecordSection("sample done");
 
     auto dataset = GenDataset(train_num, dim, buf.release());
@@ -554,6 +651,56 @@ KmeansClustering::Run(const milvus::proto::clustering::AnalyzeInfo& config) {
     auto centroids =
         reinterpret_cast<const T*>(centroids_res.value()->GetTensor());
 
+    // When the data does not fit in the train budget, the sample only seeds
+    // the centroids; in mini-batch mode every segment is then streamed to
+    // refine them, so the clustering quality follows the data size instead of
+    // train_size. The refined model also serves the assign stage.
+    std::unique_ptr<MiniBatchKmeans<T>> minibatch;
+    if (random_sample && KMEANS_MINIBATCH_ENABLED.load()) {
+        std::vector<int64_t> counts(num_clusters, 0);
+        for (size_t i = 0; i < train_num; ++i) {
+            counts[centroid_id_mapping[i]]++;
+        }
+        minibatch = std::make_unique<MiniBatchKmeans<T>>(num_clusters, dim);
+        minibatch->Init(centroids, counts);
+        MiniBatchRefine<T>(*minibatch,
+                           segment_ids,
+                           sampled_rows,
+                           insert_files,
+                           num_rows,
+                           manifest_paths,
+                           base_config,
+                           dim);
+        centroids = minibatch->Centroids().data();
+        rc.RecordSection("mini-batch kmeans refine done");
+    }
+
+    CentroidAssigner<T> assigner;
+    if (minibatch != nullptr) {
+        assigner = [&minibatch](std::unique_ptr<T[]> data, int64_t num_row) {
+            std::vector<uint32_t> id_mapping(num_row);
+            minibatch->Assign(data.get(), num_row, id_mapping.data());
+            return id_mapping;
+        };
+    } else {
+        assigner = [&cluster_node, dim](std::unique_ptr<T[]> data,
+                                        int64_t num_row) {
+            auto dataset = GenDataset(num_row, dim, data.release());
+            dataset->SetIsOwner(true);
+            auto res = cluster_node.Assign(*dataset);
+            if (!res.has_value()) {
+                ThrowInfo(ErrorCode::UnexpectedError,
+                          fmt::format("failed to kmeans assign: {}: {}",
+                                      KnowhereStatusString(res.error()),
+                                      res.what()));
+            }
+            res.value()->SetIsOwner(true);
+            auto id_mapping =
+                reinterpret_cast<const uint32_t*>(res.value()->GetTensor());
+            return std::vector<uint32_t>(id_mapping, id_mapping + num_row);
+        };
+    }
+
     auto centroid_stats = CentroidsToPB<T>(centroids, num_clusters, dim);
     auto id_mapping_stats = CentroidIdMappingToPB(centroid_id_mapping,
                                                   segment_ids,
@@ -561,7 +708,7 @@ KmeansClustering::Run(const milvus::proto::clustering::AnalyzeInfo& config) {
                                                   num_rows,
                                                   num_clusters);
     // upload
-    StreamingAssignandUpload<T>(cluster_node,
+    StreamingAssignandUpload<T>(assigner,
                                 config,
                                 centroid_stats,
                                 id_mapping_stats,
@@ -579,7 +726,7 @@ KmeansClustering::Run(const milvus::proto::clustering::AnalyzeInfo& config) {
 
 template void
 KmeansClustering::StreamingAssignandUpload<float>(
-    knowhere::Cluster<knowhere::ClusterNode>& cluster_node,
+    const CentroidAssigner<float>& assigner,
     const milvus::proto::clustering::AnalyzeInfo& config,
     const milvus::proto::clustering::ClusteringCentroidsStats& centroid_stats,
     const std::vector<
@@ -611,6 +758,26 @@ KmeansClustering::FetchSegmentViaManifest<float>(
     const Config& base_config,
     int64_t& offset);
 
+template std::unique_ptr<float[]>
+KmeansClustering::FetchSegmentData<float>(
+    const int64_t segment_id,
+    const std::map<int64_t, std::vector<std::string>>& insert_files,
+    const std::map<int64_t, int64_t>& num_rows,
+    const std::map<int64_t, std::string>& manifest_paths,
+    const Config& base_config,
+    const int64_t dim);
+
+template void
+KmeansClustering::MiniBatchRefine<float>(
+    MiniBatchKmeans<float>& minibatch,
+    const std::vector<int64_t>& segment_ids,
+    const std::map<int64_t, int64_t>& sampled_rows,
+    const std::map<int64_t, std::vector<std::string>>& insert_files,
+    const std::map<int64_t, int64_t>& num_rows,
+    const std::map<int64_t, std::string>& manifest_paths,
+    const Config& base_config,
+    const int64_t dim);
+
 template void
 KmeansClustering::SampleTrainData<float>(
     const std::vector<int64_t>& segment_ids,
@@ -621,7 +788,8 @@ KmeansClustering::SampleTrainData<float>(
     const int64_t expected_train_size,
     const int64_t dim,
     const bool random_sample,
-    uint8_t* buf);
+    uint8_t* buf,
+    std::map<int64_t, int64_t>& sampled_rows);
 
 template void
 KmeansClustering::Run<float>(
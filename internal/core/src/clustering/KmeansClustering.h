@@ -17,6 +17,7 @@
 #pragma once
 
 #include <stdint.h>
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
@@ -24,6 +25,7 @@
 #include <vector>
 
 #include "boost/filesystem/path.hpp"
+#include "clustering/MiniBatchKmeans.h"
 #include "common/Consts.h"
 #include "common/EasyAssert.h"
 #include "knowhere/cluster/cluster.h"
@@ -44,6 +46,12 @@ struct ClusteringResultMeta {
         id_mappings;  // id mapping result path/size for each segment
 };
 
+// maps the vectors of one segment (num_rows * dim, ownership handed over) to
+// their centroid ids
+template <typename T>
+using CentroidAssigner =
+    std::function<std::vector<uint32_t>(std::unique_ptr<T[]>, int64_t)>;
+
 class KmeansClustering {
  public:
     explicit KmeansClustering(
@@ -112,7 +120,7 @@ class KmeansClustering {
     template <typename T>
     void
     StreamingAssignandUpload(
-        knowhere::Cluster<knowhere::ClusterNode>& cluster_node,
+        const CentroidAssigner<T>& assigner,
         const milvus::proto::clustering::AnalyzeInfo& config,
         const milvus::proto::clustering::ClusteringCentroidsStats&
             centroid_stats,
@@ -148,7 +156,35 @@ class KmeansClustering {
                             const Config& base_config,
                             int64_t& offset);
 
-    // given all possible segments, sample data to buffer
+    // read all vectors of one segment, through its manifest (V3) or its
+    // insert files (V1)
+    template <typename T>
+    std::unique_ptr<T[]>
+    FetchSegmentData(
+        const int64_t segment_id,
+        const std::map<int64_t, std::vector<std::string>>& insert_files,
+        const std::map<int64_t, int64_t>& num_rows,
+        const std::map<int64_t, std::string>& manifest_paths,
+        const Config& base_config,
+        const int64_t dim);
+
+    // stream the rows the sample left out (sampled_rows per segment, see
+    // SampleTrainData) in mini-batches of DEFAULT_KMEANS_MINIBATCH_SIZE rows
+    // to refine seeded centroids
+    template <typename T>
+    void
+    MiniBatchRefine(
+        MiniBatchKmeans<T>& minibatch,
+        const std::vector<int64_t>& segment_ids,
+        const std::map<int64_t, int64_t>& sampled_rows,
+        const std::map<int64_t, std::vector<std::string>>& insert_files,
+        const std::map<int64_t, int64_t>& num_rows,
+        const std::map<int64_t, std::string>& manifest_paths,
+        const Config& base_config,
+        const int64_t dim);
+
+    // given all possible segments, sample data to buffer; sampled_rows gets
+    // the number of leading rows taken from each segment read
     template <typename T>
     void
     SampleTrainData(
@@ -160,7 +196,8 @@ class KmeansClustering {
         const int64_t expected_train_size,
         const int64_t dim,
         const bool random_sample,
-        uint8_t* buf);
+        uint8_t* buf,
+        std::map<int64_t, int64_t>& sampled_rows);
 
     // transform centroids result to PB format for future usage of golang side
     template <typename T>
@@ -27,6 +27,7 @@
 #include "storage/InsertData.h"
 #include "storage/loon_ffi/util.h"
 #include "clustering/KmeansClustering.h"
+#include "common/Common.h"
 #include "storage/LocalChunkManagerSingleton.h"
 #include "test_utils/Constants.h"
 #include "test_utils/ManifestTestUtil.h"
@@ -329,6 +330,27 @@ test_run() {
                                   config["num_clusters"],
                                   true);
     }
+    // need to sample train data, refine the sampled centroids by streaming
+    // the rows left out of the sample in mini-batches
+    {
+        SetDefaultKmeansMiniBatchEnable(true);
+        config["min_cluster_ratio"] = 0.01;
+        config[INSERT_FILES_KEY] = remote_files;
+        config["num_clusters"] = 8;
+        config["train_size"] = 1536L * 1024;  // 1.5MB
+        config["dim"] = dim;
+        config["num_rows"] = num_rows;
+        clusteringJob->Run<T>(transforConfigToPB(config));
+        SetDefaultKmeansMiniBatchEnable(DEFAULT_KMEANS_MINIBATCH_ENABLED);
+        CheckResultCorrectness<T>(clusteringJob,
+                                  cm,
+                                  segment_id,
+                                  segment_id2,
+                                  dim,
+                                  nb,
+                                  config["num_clusters"],
+                                  true);
+    }
     // need to sample train data case2
     {
         config["min_cluster_ratio"] = 0.01;
@@ -0,0 +1,110 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "clustering/MiniBatchKmeans.h"
+
+#include <algorithm>
+
+#include "common/EasyAssert.h"
+#include "common/Utils.h"
+#include "knowhere/comp/brute_force.h"
+#include "knowhere/comp/index_param.h"
+#include "knowhere/config.h"
+#include "knowhere/dataset.h"
+
+namespace milvus::clustering {
+
+template <typename T>
+MiniBatchKmeans<T>::MiniBatchKmeans(int64_t num_clusters, int64_t dim)
+    : num_clusters_(num_clusters), dim_(dim) {
+    AssertInfo(num_clusters > 0, "num clusters must larger than 0");
+    AssertInfo(dim > 0, "dim must larger than 0");
+    centroids_.resize(num_clusters * dim);
+    counts_.resize(num_clusters, 0);
+}
+
+template <typename T>
+void
+MiniBatchKmeans<T>::Init(const T* centroids,
+                         const std::vector<int64_t>& counts) {
+    AssertInfo(counts.size() == static_cast<size_t>(num_clusters_),
+               "centroid counts size {} mismatch num clusters {}",
+               counts.size(),
+               num_clusters_);
+    std::copy(centroids, centroids + num_clusters_ * dim_, centroids_.begin());
+    counts_ = counts;
+}
+
+template <typename T>
+void
+MiniBatchKmeans<T>::Update(const T* data, int64_t num_rows) {
+    if (num_rows <= 0) {
+        return;
+    }
+    // assign the whole batch against the same centroids first, then move
+    // them, so the order of points inside a batch does not bias the step
+    batch_assign_.resize(num_rows);
+    Assign(data, num_rows, batch_assign_.data());
+    for (int64_t i = 0; i < num_rows; ++i) {
+        auto c = batch_assign_[i];
+        counts_[c] += 1;
+        float eta = 1.0f / float(counts_[c]);
+        T* centroid = centroids_.data() + c * dim_;
+        const T* vec = data + i * dim_;
+        for (int64_t d = 0; d < dim_; ++d) {
+            centroid[d] = T((1.0f - eta) * float(centroid[d]) +
+                            eta * float(vec[d]));
+        }
+    }
+}
+
+template <typename T>
+void
+MiniBatchKmeans<T>::Assign(const T* data,
+                           int64_t num_rows,
+                           uint32_t* id_mapping) const {
+    if (num_rows <= 0) {
+        return;
+    }
+    // top-1 L2 brute force search over the centroids, on the same distance
+    // kernels knowhere's kmeans assigns with
+    auto base = knowhere::GenDataSet(num_clusters_, dim_, centroids_.data());
+    auto query = knowhere::GenDataSet(num_rows, dim_, data);
+    knowhere::Json config;
+    config[knowhere::meta::METRIC_TYPE] = knowhere::metric::L2;
+    config[knowhere::meta::TOPK] = 1;
+    std::vector<int64_t> ids(num_rows);
+    std::vector<float> distances(num_rows);
+    auto stat = knowhere::BruteForce::SearchWithBuf<T>(base,
+                                                       query,
+                                                       ids.data(),
+                                                       distances.data(),
+                                                       config,
+                                                       nullptr,
+                                                       nullptr);
+    if (stat != knowhere::Status::success) {
+        ThrowInfo(ErrorCode::KnowhereError,
+                  "failed to assign mini-batch kmeans centroids: {}",
+                  KnowhereStatusString(stat));
+    }
+    for (int64_t i = 0; i < num_rows; ++i) {
+        id_mapping[i] = static_cast<uint32_t>(ids[i]);
+    }
+}
+
+template class MiniBatchKmeans<float>;
+
+}  // namespace milvus::clustering
@@ -0,0 +1,72 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+
+namespace milvus::clustering {
+
+// Mini-batch k-means (Sculley, "Web-Scale K-Means Clustering") over L2.
+//
+// Centroids are refined incrementally from bounded batches, so the whole
+// collection can contribute to training while only one batch is resident.
+// Each centroid moves towards the points assigned to it with a per-centroid
+// learning rate of 1 / (points seen so far), which makes the result converge
+// to the running mean of its members.
+//
+// Not thread safe: one instance is driven by a single analyze task.
+template <typename T>
+class MiniBatchKmeans {
+ public:
+    MiniBatchKmeans(int64_t num_clusters, int64_t dim);
+
+    // Seed the model with initial centroids (num_clusters * dim) and the
+    // number of points each one already represents. Seeding counts with the
+    // training sample sizes keeps the first streamed batches from dragging
+    // well-supported centroids too far.
+    void
+    Init(const T* centroids, const std::vector<int64_t>& counts);
+
+    // One mini-batch step over num_rows contiguous vectors.
+    void
+    Update(const T* data, int64_t num_rows);
+
+    // Nearest centroid for each of num_rows vectors.
+    void
+    Assign(const T* data, int64_t num_rows, uint32_t* id_mapping) const;
+
+    const std::vector<T>&
+    Centroids() const {
+        return centroids_;
+    }
+
+    int64_t
+    NumClusters() const {
+        return num_clusters_;
+    }
+
+ private:
+    int64_t num_clusters_;
+    int64_t dim_;
+    std::vector<T> centroids_;
+    std::vector<int64_t> counts_;
+    // scratch assignment of the current batch
+    std::vector<uint32_t> batch_assign_;
+};
+
+}  // namespace milvus::clustering
@@ -0,0 +1,90 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "clustering/MiniBatchKmeans.h"
+
+using namespace milvus::clustering;
+
+namespace {
+
+// rows drawn around `num_clusters` well separated centers (c * 100, ...)
+std::vector<float>
+GenClusteredData(int64_t num_rows, int64_t dim, int64_t num_clusters) {
+    std::mt19937 rng(42);
+    std::normal_distribution<float> noise(0.0f, 1.0f);
+    std::vector<float> data(num_rows * dim);
+    for (int64_t i = 0; i < num_rows; ++i) {
+        auto center = float((i % num_clusters) * 100);
+        for (int64_t d = 0; d < dim; ++d) {
+            data[i * dim + d] = center + noise(rng);
+        }
+    }
+    return data;
+}
+
+}  // namespace
+
+TEST(MiniBatchKmeansTest, ConvergesFromPoorSeeds) {
+    const int64_t dim = 8;
+    const int64_t num_clusters = 4;
+    const int64_t num_rows = 4000;
+    auto data = GenClusteredData(num_rows, dim, num_clusters);
+
+    // seeds are offset from the true centers by 30 on every dimension
+    std::vector<float> seeds(num_clusters * dim);
+    for (int64_t c = 0; c < num_clusters; ++c) {
+        for (int64_t d = 0; d < dim; ++d) {
+            seeds[c * dim + d] = float(c * 100 + 30);
+        }
+    }
+    MiniBatchKmeans<float> kmeans(num_clusters, dim);
+    kmeans.Init(seeds.data(), std::vector<int64_t>(num_clusters, 1));
+
+    const int64_t batch = 256;
+    for (int64_t start = 0; start < num_rows; start += batch) {
+        kmeans.Update(data.data() + start * dim,
+                      std::min(batch, num_rows - start));
+    }
+
+    const auto& centroids = kmeans.Centroids();
+    for (int64_t c = 0; c < num_clusters; ++c) {
+        for (int64_t d = 0; d < dim; ++d) {
+            EXPECT_NEAR(centroids[c * dim + d], float(c * 100), 2.0f);
+        }
+    }
+
+    std::vector<uint32_t> id_mapping(num_rows);
+    kmeans.Assign(data.data(), num_rows, id_mapping.data());
+    for (int64_t i = 0; i < num_rows; ++i) {
+        ASSERT_EQ(id_mapping[i], i % num_clusters);
+    }
+}
+
+TEST(MiniBatchKmeansTest, InitCountsDampUpdates) {
+    const int64_t dim = 2;
+    const int64_t num_clusters = 1;
+    std::vector<float> seed{0.0f, 0.0f};
+    std::vector<float> point{10.0f, 10.0f};
+
+    // a centroid already backed by 9 points moves by 1/10 of the distance
+    MiniBatchKmeans<float> kmeans(num_clusters, dim);
+    kmeans.Init(seed.data(), {9});
+    kmeans.Update(point.data(), 1);
+    EXPECT_FLOAT_EQ(kmeans.Centroids()[0], 1.0f);
+    EXPECT_FLOAT_EQ(kmeans.Centroids()[1], 1.0f);
+
+    EXPECT_ANY_THROW(kmeans.Init(seed.data(), {1, 2}));
+}
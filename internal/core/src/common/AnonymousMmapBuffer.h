@@ -0,0 +1,129 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "common/EasyAssert.h"
+#include "common/FastMem.h"
+
+namespace milvus {
+
+// Append-only byte buffer backed by an anonymous private mapping.
+//
+// Pages are only committed once written, and on Linux growing the buffer
+// remaps the existing pages instead of copying them, so appending N bytes
+// keeps about N bytes resident no matter how the capacity was reached.
+// Used to concatenate decoded chunks into one contiguous buffer while the
+// chunks are released one by one.
+class AnonymousMmapBuffer {
+ public:
+    AnonymousMmapBuffer() = default;
+
+    explicit AnonymousMmapBuffer(size_t capacity) {
+        Reserve(capacity);
+    }
+
+    AnonymousMmapBuffer(const AnonymousMmapBuffer&) = delete;
+    AnonymousMmapBuffer&
+    operator=(const AnonymousMmapBuffer&) = delete;
+
+    ~AnonymousMmapBuffer() {
+        if (data_ != nullptr) {
+            munmap(data_, capacity_);
+        }
+    }
+
+    void
+    Reserve(size_t capacity) {
+        if (capacity <= capacity_) {
+            return;
+        }
+        static const size_t page_size = sysconf(_SC_PAGESIZE);
+        capacity = (capacity + page_size - 1) / page_size * page_size;
+        void* mapped = MAP_FAILED;
+#ifdef __linux__
+        if (data_ != nullptr) {
+            mapped = mremap(data_, capacity_, capacity, MREMAP_MAYMOVE);
+            AssertInfo(mapped != MAP_FAILED,
+                       "failed to grow anonymous mapping to {} bytes: {}",
+                       capacity,
+                       strerror(errno));
+            data_ = static_cast<uint8_t*>(mapped);
+            capacity_ = capacity;
+            return;
+        }
+#endif
+        mapped = mmap(nullptr,
+                      capacity,
+                      PROT_READ | PROT_WRITE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+                      -1,
+                      0);
+        AssertInfo(mapped != MAP_FAILED,
+                   "failed to map {} anonymous bytes: {}",
+                   capacity,
+                   strerror(errno));
+        if (data_ != nullptr) {
+            milvus::fastmem::FastMemcpy(mapped, data_, size_);
+            munmap(data_, capacity_);
+        }
+        data_ = static_cast<uint8_t*>(mapped);
+        capacity_ = capacity;
+    }
+
+    void
+    Append(const void* src, size_t size) {
+        if (size == 0) {
+            return;
+        }
+        if (size_ + size > capacity_) {
+            Reserve(std::max(size_ + size, capacity_ * 2));
+        }
+        milvus::fastmem::FastMemcpy(data_ + size_, src, size);
+        size_ += size;
+    }
+
+    uint8_t*
+    data() const {
+        return data_;
+    }
+
+    size_t
+    size() const {
+        return size_;
+    }
+
+    size_t
+    capacity() const {
+        return capacity_;
+    }
+
+ private:
+    uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+    size_t capacity_ = 0;
+};
+
+}  // namespace milvus
@@ -0,0 +1,66 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "common/AnonymousMmapBuffer.h"
+
+using namespace milvus;
+
+TEST(AnonymousMmapBuffer, AppendKeepsContentsAcrossGrowth) {
+    AnonymousMmapBuffer buf;
+    EXPECT_EQ(buf.data(), nullptr);
+    EXPECT_EQ(buf.size(), 0);
+
+    std::vector<int32_t> chunk(1000);
+    std::iota(chunk.begin(), chunk.end(), 0);
+    // grows several times, from one page up to a few hundred KB
+    for (int i = 0; i < 100; ++i) {
+        buf.Append(chunk.data(), chunk.size() * sizeof(int32_t));
+    }
+    ASSERT_EQ(buf.size(), 100 * chunk.size() * sizeof(int32_t));
+    EXPECT_GE(buf.capacity(), buf.size());
+    EXPECT_EQ(buf.capacity() % sysconf(_SC_PAGESIZE), 0);
+
+    auto values = reinterpret_cast<const int32_t*>(buf.data());
+    for (size_t i = 0; i < 100 * chunk.size(); ++i) {
+        ASSERT_EQ(values[i], static_cast<int32_t>(i % chunk.size()));
+    }
+}
+
+TEST(AnonymousMmapBuffer, ReserveDoesNotShrink) {
+    AnonymousMmapBuffer buf(10);
+    auto capacity = buf.capacity();
+    EXPECT_GE(capacity, 10);
+    buf.Append("abc", 3);
+    buf.Reserve(1);
+    EXPECT_EQ(buf.capacity(), capacity);
+
+    buf.Reserve(capacity * 3);
+    EXPECT_GE(buf.capacity(), capacity * 3);
+    EXPECT_EQ(buf.size(), 3);
+    EXPECT_EQ(std::string(reinterpret_cast<const char*>(buf.data()), 3),
+              "abc");
+
+    // empty appends are no-ops
+    buf.Append(nullptr, 0);
+    EXPECT_EQ(buf.size(), 3);
+}
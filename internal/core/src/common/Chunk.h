@@ -27,7 +27,9 @@
 
 #include "cachinglayer/Utils.h"
 #include "common/Array.h"
+#include "common/ChunkEncoding.h"
 #include "common/EasyAssert.h"
+#include "common/PersistentChunkFile.h"
 #include "common/Span.h"
 #include "common/TypeTraits.h"
 #include "common/Types.h"
@@ -44,8 +46,19 @@ constexpr uint64_t MMAP_ARRAY_PADDING = 1;
 // Shared mmap region manager for group chunks
 class ChunkMmapGuard {
  public:
-    ChunkMmapGuard(char* mmap_ptr, size_t mmap_size, std::string file_path)
-        : mmap_ptr_(mmap_ptr), mmap_size_(mmap_size), file_path_(file_path) {
+    // A persistent chunk file (see common/PersistentChunkFile.h) outlives
+    // the mapping and is created with unlink_on_release = false.
+    ChunkMmapGuard(char* mmap_ptr,
+                   size_t mmap_size,
+                   std::string file_path,
+                   bool unlink_on_release = true)
+        : mmap_ptr_(mmap_ptr),
+          mmap_size_(mmap_size),
+          file_path_(file_path),
+          unlink_on_release_(unlink_on_release) {
+        if (!file_path_.empty() && !unlink_on_release_) {
+            NotePersistentChunkFileMapped(file_path_);
+        }
     }
 
     ~ChunkMmapGuard() {
@@ -53,7 +66,11 @@ class ChunkMmapGuard {
             munmap(mmap_ptr_, mmap_size_);
         }
         if (!file_path_.empty()) {
-            unlink(file_path_.c_str());
+            if (unlink_on_release_) {
+                unlink(file_path_.c_str());
+            } else {
+                NotePersistentChunkFileUnmapped(file_path_);
+            }
         }
     }
 
@@ -71,6 +88,7 @@ class ChunkMmapGuard {
     char* mmap_ptr_;
     size_t mmap_size_;
     const std::string file_path_;
+    const bool unlink_on_release_;
 };
 
 class Chunk {
@@ -96,14 +114,39 @@ class Chunk {
         return size_;
     }
 
+    bool
+    IsFileBacked() const {
+        return chunk_mmap_guard_ && chunk_mmap_guard_->is_file_backed();
+    }
+
     cachinglayer::ResourceUsage
     CellByteSize() const {
-        if (chunk_mmap_guard_ && chunk_mmap_guard_->is_file_backed()) {
-            return cachinglayer::ResourceUsage(0, static_cast<int64_t>(size_));
+        if (IsFileBacked()) {
+            // only the encoded form is resident, the raw values stay in the
+            // file until a reader touches them
+            const auto encoded_size =
+                encoding_ ? static_cast<int64_t>(encoding_->ByteSize()) : 0;
+            return cachinglayer::ResourceUsage(encoded_size,
+                                               static_cast<int64_t>(size_));
         }
         return cachinglayer::ResourceUsage(static_cast<int64_t>(size_), 0);
     }
 
+    // Lightweight encoding of the chunk values (see common/ChunkEncoding.h),
+    // or nullptr if the chunk is only stored raw. Only file-backed chunks are
+    // encoded: filters then read the encoded form instead of faulting in the
+    // raw pages, while an in-memory chunk would have to keep both. Set once
+    // while the chunk is built, before it is shared.
+    const ChunkEncoding*
+    Encoding() const {
+        return encoding_.get();
+    }
+
+    void
+    SetEncoding(std::shared_ptr<const ChunkEncoding> encoding) {
+        encoding_ = std::move(encoding);
+    }
+
     int64_t
     RowNums() const {
         return row_nums_;
@@ -249,6 +292,7 @@ class Chunk {
     bool nullable_;
 
     std::shared_ptr<ChunkMmapGuard> chunk_mmap_guard_{nullptr};
+    std::shared_ptr<const ChunkEncoding> encoding_{nullptr};
     mutable std::once_flag valid_rank_blocks_once_;
     mutable std::vector<int64_t> valid_rank_blocks_;
 };
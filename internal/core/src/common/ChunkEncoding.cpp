@@ -0,0 +1,586 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include "common/ChunkEncoding.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <type_traits>
+#include <unordered_map>
+
+#include "common/Chunk.h"
+#include "common/EasyAssert.h"
+#include "common/FieldMeta.h"
+
+namespace milvus {
+
+namespace {
+
+// rows unpacked per kernel call
+constexpr int64_t kUnpackBlockSize = 1024;
+
+// a dictionary with more distinct values is rarely small enough to pay off
+constexpr int64_t kMaxDictionaryCardinality = 1 << 16;
+
+// IN lists up to this many codes are evaluated with one compare kernel per
+// code, longer ones with a code lookup table
+constexpr size_t kMaxInCompareCodes = 8;
+
+// Every row compares the same way against a literal outside the value range
+// [min, max] of the chunk.
+bool
+OutOfRangeResult(bitset::CompareOpType op, bool below_min) {
+    switch (op) {
+        case bitset::CompareOpType::EQ:
+            return false;
+        case bitset::CompareOpType::NE:
+            return true;
+        case bitset::CompareOpType::GT:
+        case bitset::CompareOpType::GE:
+            return below_min;
+        case bitset::CompareOpType::LT:
+        case bitset::CompareOpType::LE:
+            return !below_min;
+    }
+    return false;
+}
+
+}  // namespace
+
+template <typename T>
+std::unique_ptr<ForBitPackedEncoding>
+ForBitPackedEncoding::Encode(const T* data, int64_t row_nums) {
+    static_assert(std::is_integral_v<T>);
+    std::unique_ptr<ForBitPackedEncoding> encoding(new ForBitPackedEncoding());
+    encoding->row_nums_ = row_nums;
+    if (row_nums == 0) {
+        return encoding;
+    }
+    auto [min_it, max_it] = std::minmax_element(data, data + row_nums);
+    encoding->min_ = static_cast<int64_t>(*min_it);
+    encoding->max_ = static_cast<int64_t>(*max_it);
+    const auto range = static_cast<uint64_t>(encoding->max_) -
+                       static_cast<uint64_t>(encoding->min_);
+    const int bit_width = range == 0 ? 0 : 64 - std::countl_zero(range);
+    encoding->bit_width_ = bit_width;
+    if (bit_width == 0) {
+        return encoding;
+    }
+
+    auto& words = encoding->words_;
+    words.assign((row_nums * bit_width + 63) / 64, 0);
+    const auto base = static_cast<uint64_t>(encoding->min_);
+    uint64_t bit = 0;
+    for (int64_t i = 0; i < row_nums; ++i, bit += bit_width) {
+        const auto code = static_cast<uint64_t>(data[i]) - base;
+        const auto word = bit >> 6;
+        const auto shift = bit & 63;
+        words[word] |= code << shift;
+        if (shift + bit_width > 64) {
+            words[word + 1] |= code >> (64 - shift);
+        }
+    }
+    return encoding;
+}
+
+template std::unique_ptr<ForBitPackedEncoding>
+ForBitPackedEncoding::Encode<int8_t>(const int8_t*, int64_t);
+template std::unique_ptr<ForBitPackedEncoding>
+ForBitPackedEncoding::Encode<int16_t>(const int16_t*, int64_t);
+template std::unique_ptr<ForBitPackedEncoding>
+ForBitPackedEncoding::Encode<int32_t>(const int32_t*, int64_t);
+template std::unique_ptr<ForBitPackedEncoding>
+ForBitPackedEncoding::Encode<int64_t>(const int64_t*, int64_t);
+
+template <typename CodeT>
+void
+ForBitPackedEncoding::Unpack(int64_t offset, int64_t size, CodeT* codes) const {
+    if (bit_width_ == 0) {
+        std::fill_n(codes, size, CodeT{0});
+        return;
+    }
+    const uint64_t mask =
+        bit_width_ == 64 ? ~uint64_t{0} : (uint64_t{1} << bit_width_) - 1;
+    uint64_t bit = static_cast<uint64_t>(offset) * bit_width_;
+    for (int64_t i = 0; i < size; ++i, bit += bit_width_) {
+        const auto word = bit >> 6;
+        const auto shift = bit & 63;
+        uint64_t code = words_[word] >> shift;
+        if (shift + bit_width_ > 64) {
+            code |= words_[word + 1] << (64 - shift);
+        }
+        codes[i] = static_cast<CodeT>(code & mask);
+    }
+}
+
+int64_t
+ForBitPackedEncoding::ValueAt(int64_t idx) const {
+    AssertInfo(idx >= 0 && idx < row_nums_,
+               "offset {} out of range, row nums {}",
+               idx,
+               row_nums_);
+    uint64_t code = 0;
+    Unpack(idx, 1, &code);
+    return static_cast<int64_t>(static_cast<uint64_t>(min_) + code);
+}
+
+template <typename CodeT>
+void
+ForBitPackedEncoding::CompareCodes(bitset::CompareOpType op,
+                                   CodeT code,
+                                   int64_t offset,
+                                   int64_t size,
+                                   TargetBitmapView res) const {
+    CodeT codes[kUnpackBlockSize];
+    for (int64_t i = 0; i < size; i += kUnpackBlockSize) {
+        const auto n = std::min(kUnpackBlockSize, size - i);
+        Unpack(offset + i, n, codes);
+        res.view(i, n).inplace_compare_val<CodeT>(codes, n, code, op);
+    }
+}
+
+bool
+ForBitPackedEncoding::Compare(bitset::CompareOpType op,
+                              int64_t value,
+                              int64_t offset,
+                              int64_t size,
+                              TargetBitmapView res) const {
+    AssertInfo(offset >= 0 && size >= 0 && offset + size <= row_nums_,
+               "invalid range, offset: {}, size: {}, rows: {}",
+               offset,
+               size,
+               row_nums_);
+    if (value < min_ || value > max_) {
+        res.set(0, size, OutOfRangeResult(op, value < min_));
+        return true;
+    }
+    // codes are non-negative and below 2^bit_width, so they fit the signed
+    // types the bitset kernels are instantiated for
+    const auto code =
+        static_cast<uint64_t>(value) - static_cast<uint64_t>(min_);
+    if (bit_width_ < 8) {
+        CompareCodes<int8_t>(op, code, offset, size, res);
+    } else if (bit_width_ < 16) {
+        CompareCodes<int16_t>(op, code, offset, size, res);
+    } else if (bit_width_ < 32) {
+        CompareCodes<int32_t>(op, code, offset, size, res);
+    } else if (bit_width_ < 64) {
+        CompareCodes<int64_t>(op, code, offset, size, res);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+std::unique_ptr<DictionaryEncoding>
+DictionaryEncoding::Encode(const std::string_view* values,
+                           int64_t row_nums,
+                           int64_t max_cardinality) {
+    std::unordered_map<std::string_view, int64_t> first_seen;
+    std::vector<int64_t> row_ids(row_nums);
+    for (int64_t i = 0; i < row_nums; ++i) {
+        auto [it, inserted] =
+            first_seen.emplace(values[i],
+                               static_cast<int64_t>(first_seen.size()));
+        if (inserted &&
+            static_cast<int64_t>(first_seen.size()) > max_cardinality) {
+            return nullptr;
+        }
+        row_ids[i] = it->second;
+    }
+
+    // sort the distinct values so codes keep the string order
+    std::vector<std::string_view> dict(first_seen.size());
+    for (const auto& [value, id] : first_seen) {
+        dict[id] = value;
+    }
+    std::vector<int64_t> order(dict.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](int64_t a, int64_t b) {
+        return dict[a] < dict[b];
+    });
+    std::vector<int64_t> code_of(dict.size());
+    for (size_t code = 0; code < order.size(); ++code) {
+        code_of[order[code]] = static_cast<int64_t>(code);
+    }
+
+    std::unique_ptr<DictionaryEncoding> encoding(new DictionaryEncoding());
+    encoding->row_nums_ = row_nums;
+    size_t dict_bytes = 0;
+    for (const auto& value : dict) {
+        dict_bytes += value.size();
+    }
+    AssertInfo(dict_bytes <= std::numeric_limits<uint32_t>::max(),
+               "dictionary too large: {} bytes",
+               dict_bytes);
+    encoding->dict_data_.reserve(dict_bytes);
+    encoding->dict_offsets_.reserve(dict.size() + 1);
+    encoding->dict_offsets_.push_back(0);
+    for (auto id : order) {
+        encoding->dict_data_.append(dict[id]);
+        encoding->dict_offsets_.push_back(
+            static_cast<uint32_t>(encoding->dict_data_.size()));
+    }
+
+    const auto cardinality = static_cast<int64_t>(dict.size());
+    encoding->code_bytes_ = cardinality <= std::numeric_limits<int8_t>::max()
+                                ? 1
+                            : cardinality <= std::numeric_limits<int16_t>::max()
+                                ? 2
+                                : 4;
+    encoding->codes_.resize(row_nums * encoding->code_bytes_);
+    auto write_codes = [&](auto* codes) {
+        using CodeT = std::remove_pointer_t<decltype(codes)>;
+        for (int64_t i = 0; i < row_nums; ++i) {
+            codes[i] = static_cast<CodeT>(code_of[row_ids[i]]);
+        }
+    };
+    auto* codes = encoding->codes_.data();
+    if (encoding->code_bytes_ == 1) {
+        write_codes(reinterpret_cast<int8_t*>(codes));
+    } else if (encoding->code_bytes_ == 2) {
+        write_codes(reinterpret_cast<int16_t*>(codes));
+    } else {
+        write_codes(reinterpret_cast<int32_t*>(codes));
+    }
+    return encoding;
+}
+
+int64_t
+DictionaryEncoding::CodeAt(int64_t idx) const {
+    AssertInfo(idx >= 0 && idx < row_nums_,
+               "offset {} out of range, row nums {}",
+               idx,
+               row_nums_);
+    const auto* codes = codes_.data();
+    switch (code_bytes_) {
+        case 1:
+            return reinterpret_cast<const int8_t*>(codes)[idx];
+        case 2:
+            return reinterpret_cast<const int16_t*>(codes)[idx];
+        default:
+            return reinterpret_cast<const int32_t*>(codes)[idx];
+    }
+}
+
+int64_t
+DictionaryEncoding::LowerBound(std::string_view value) const {
+    int64_t left = 0;
+    int64_t right = Cardinality();
+    while (left < right) {
+        auto mid = left + (right - left) / 2;
+        if (DictValue(mid) < value) {
+            left = mid + 1;
+        } else {
+            right = mid;
+        }
+    }
+    return left;
+}
+
+int64_t
+DictionaryEncoding::UpperBound(std::string_view value) const {
+    int64_t left = 0;
+    int64_t right = Cardinality();
+    while (left < right) {
+        auto mid = left + (right - left) / 2;
+        if (DictValue(mid) <= value) {
+            left = mid + 1;
+        } else {
+            right = mid;
+        }
+    }
+    return left;
+}
+
+std::optional<int64_t>
+DictionaryEncoding::Find(std::string_view value) const {
+    auto code = LowerBound(value);
+    if (code < Cardinality() && DictValue(code) == value) {
+        return code;
+    }
+    return std::nullopt;
+}
+
+template <typename CodeT>
+void
+DictionaryEncoding::CompareCodes(bitset::CompareOpType op,
+                                 int64_t code,
+                                 int64_t offset,
+                                 int64_t size,
+                                 TargetBitmapView res) const {
+    const auto* codes = reinterpret_cast<const CodeT*>(codes_.data()) + offset;
+    res.inplace_compare_val<CodeT>(codes, size, static_cast<CodeT>(code), op);
+}
+
+bool
+DictionaryEncoding::Compare(bitset::CompareOpType op,
+                            std::string_view value,
+                            int64_t offset,
+                            int64_t size,
+                            TargetBitmapView res) const {
+    AssertInfo(offset >= 0 && size >= 0 && offset + size <= row_nums_,
+               "invalid range, offset: {}, size: {}, rows: {}",
+               offset,
+               size,
+               row_nums_);
+    // map the string comparison to a comparison against a code
+    int64_t code = 0;
+    switch (op) {
+        case bitset::CompareOpType::EQ:
+        case bitset::CompareOpType::NE: {
+            auto found = Find(value);
+            if (!found.has_value()) {
+                res.set(0, size, op == bitset::CompareOpType::NE);
+                return true;
+            }
+            code = *found;
+            break;
+        }
+        case bitset::CompareOpType::LT:
+        case bitset::CompareOpType::GE:
+            // value(row) < value  <=>  code(row) < lower_bound(value)
+            code = LowerBound(value);
+            break;
+        case bitset::CompareOpType::LE:
+        case bitset::CompareOpType::GT:
+            // value(row) <= value  <=>  code(row) < upper_bound(value)
+            code = UpperBound(value);
+            op = op == bitset::CompareOpType::LE ? bitset::CompareOpType::LT
+                                                 : bitset::CompareOpType::GE;
+            break;
+        default:
+            return false;
+    }
+    if (op == bitset::CompareOpType::LT || op == bitset::CompareOpType::GE) {
+        if (code == 0 || code == Cardinality()) {
+            // every row is below the bound, or none is
+            const bool all_below = code == Cardinality();
+            res.set(0,
+                    size,
+                    op == bitset::CompareOpType::LT ? all_below : !all_below);
+            return true;
+        }
+    }
+    if (code_bytes_ == 1) {
+        CompareCodes<int8_t>(op, code, offset, size, res);
+    } else if (code_bytes_ == 2) {
+        CompareCodes<int16_t>(op, code, offset, size, res);
+    } else {
+        CompareCodes<int32_t>(op, code, offset, size, res);
+    }
+    return true;
+}
+
+template <typename CodeT>
+void
+DictionaryEncoding::InCodes(const std::vector<int64_t>& codes,
+                            int64_t offset,
+                            int64_t size,
+                            TargetBitmapView res) const {
+    const auto* data = reinterpret_cast<const CodeT*>(codes_.data()) + offset;
+    const auto lower = static_cast<CodeT>(codes.front());
+    const auto upper = static_cast<CodeT>(codes.back());
+    if (codes.back() - codes.front() + 1 ==
+        static_cast<int64_t>(codes.size())) {
+        // consecutive codes, e.g. all the values sharing a prefix
+        res.inplace_within_range_val<CodeT>(
+            lower, upper, data, size, bitset::RangeType::IncInc);
+        return;
+    }
+    if (codes.size() <= kMaxInCompareCodes) {
+        res.inplace_compare_val<CodeT>(
+            data, size, lower, bitset::CompareOpType::EQ);
+        TargetBitmap code_res(size);
+        for (size_t i = 1; i < codes.size(); ++i) {
+            code_res.inplace_compare_val<CodeT>(data,
+                                                size,
+                                                static_cast<CodeT>(codes[i]),
+                                                bitset::CompareOpType::EQ);
+            res.inplace_or(code_res, size);
+        }
+        return;
+    }
+    std::vector<uint8_t> hit(Cardinality(), 0);
+    for (auto code : codes) {
+        hit[code] = 1;
+    }
+    for (int64_t i = 0; i < size; ++i) {
+        res[i] = hit[data[i]] != 0;
+    }
+}
+
+bool
+DictionaryEncoding::In(const std::vector<std::string>& values,
+                       int64_t offset,
+                       int64_t size,
+                       TargetBitmapView res) const {
+    AssertInfo(offset >= 0 && size >= 0 && offset + size <= row_nums_,
+               "invalid range, offset: {}, size: {}, rows: {}",
+               offset,
+               size,
+               row_nums_);
+    std::vector<int64_t> codes;
+    codes.reserve(values.size());
+    for (const auto& value : values) {
+        if (auto code = Find(value); code.has_value()) {
+            codes.push_back(*code);
+        }
+    }
+    if (codes.empty()) {
+        res.set(0, size, false);
+        return true;
+    }
+    std::sort(codes.begin(), codes.end());
+    codes.erase(std::unique(codes.begin(), codes.end()), codes.end());
+    if (static_cast<int64_t>(codes.size()) == Cardinality()) {
+        res.set(0, size, true);
+        return true;
+    }
+    if (code_bytes_ == 1) {
+        InCodes<int8_t>(codes, offset, size, res);
+    } else if (code_bytes_ == 2) {
+        InCodes<int16_t>(codes, offset, size, res);
+    } else {
+        InCodes<int32_t>(codes, offset, size, res);
+    }
+    return true;
+}
+
+template <typename GetFunc>
+std::unique_ptr<RunLengthEncoding>
+RunLengthEncoding::EncodeImpl(GetFunc get, int64_t row_nums) {
+    AssertInfo(row_nums <= std::numeric_limits<uint32_t>::max(),
+               "too many rows for run length encoding: {}",
+               row_nums);
+    std::unique_ptr<RunLengthEncoding> encoding(new RunLengthEncoding());
+    encoding->row_nums_ = row_nums;
+    if (row_nums == 0) {
+        return encoding;
+    }
+    encoding->first_value_ = get(0);
+    bool current = encoding->first_value_;
+    for (int64_t i = 1; i < row_nums; ++i) {
+        const bool value = get(i);
+        if (value != current) {
+            encoding->run_ends_.push_back(static_cast<uint32_t>(i));
+            current = value;
+        }
+    }
+    encoding->run_ends_.push_back(static_cast<uint32_t>(row_nums));
+    encoding->run_ends_.shrink_to_fit();
+    return encoding;
+}
+
+std::unique_ptr<RunLengthEncoding>
+RunLengthEncoding::Encode(const bool* values, int64_t row_nums) {
+    return EncodeImpl([values](int64_t i) { return values[i]; }, row_nums);
+}
+
+bool
+RunLengthEncoding::ValueAt(int64_t idx) const {
+    AssertInfo(idx >= 0 && idx < row_nums_,
+               "offset {} out of range, row nums {}",
+               idx,
+               row_nums_);
+    auto run = std::upper_bound(run_ends_.begin(),
+                                run_ends_.end(),
+                                static_cast<uint32_t>(idx)) -
+               run_ends_.begin();
+    return first_value_ ^ ((run & 1) != 0);
+}
+
+bool
+RunLengthEncoding::Compare(bitset::CompareOpType op,
+                           bool value,
+                           int64_t offset,
+                           int64_t size,
+                           TargetBitmapView res) const {
+    AssertInfo(offset >= 0 && size >= 0 && offset + size <= row_nums_,
+               "invalid range, offset: {}, size: {}, rows: {}",
+               offset,
+               size,
+               row_nums_);
+    if (op != bitset::CompareOpType::EQ && op != bitset::CompareOpType::NE) {
+        return false;
+    }
+    const bool target = op == bitset::CompareOpType::EQ ? value : !value;
+    const int64_t end = offset + size;
+    auto run = std::upper_bound(run_ends_.begin(),
+                                run_ends_.end(),
+                                static_cast<uint32_t>(offset)) -
+               run_ends_.begin();
+    int64_t begin = offset;
+    for (; begin < end; ++run) {
+        const int64_t run_end =
+            std::min<int64_t>(run_ends_[run], end);
+        const bool run_value = first_value_ ^ ((run & 1) != 0);
+        res.set(begin - offset, run_end - begin, run_value == target);
+        begin = run_end;
+    }
+    return true;
+}
+
+std::shared_ptr<const ChunkEncoding>
+EncodeChunk(const FieldMeta& field_meta, const Chunk& chunk) {
+    const auto row_nums = chunk.RowNums();
+    if (row_nums == 0) {
+        return nullptr;
+    }
+    std::shared_ptr<const ChunkEncoding> encoding;
+    switch (field_meta.get_data_type()) {
+        case DataType::BOOL:
+            encoding = RunLengthEncoding::Encode(
+                reinterpret_cast<const bool*>(chunk.Data()), row_nums);
+            break;
+        case DataType::INT8:
+            encoding = ForBitPackedEncoding::Encode(
+                reinterpret_cast<const int8_t*>(chunk.Data()), row_nums);
+            break;
+        case DataType::INT16:
+            encoding = ForBitPackedEncoding::Encode(
+                reinterpret_cast<const int16_t*>(chunk.Data()), row_nums);
+            break;
+        case DataType::INT32:
+            encoding = ForBitPackedEncoding::Encode(
+                reinterpret_cast<const int32_t*>(chunk.Data()), row_nums);
+            break;
+        case DataType::INT64:
+        case DataType::TIMESTAMPTZ:
+            encoding = ForBitPackedEncoding::Encode(
+                reinterpret_cast<const int64_t*>(chunk.Data()), row_nums);
+            break;
+        case DataType::VARCHAR:
+        case DataType::STRING: {
+            const auto& string_chunk = static_cast<const StringChunk&>(chunk);
+            std::vector<std::string_view> values(row_nums);
+            for (int64_t i = 0; i < row_nums; ++i) {
+                values[i] = string_chunk[i];
+            }
+            encoding = DictionaryEncoding::Encode(
+                values.data(),
+                row_nums,
+                std::min(row_nums / 2, kMaxDictionaryCardinality));
+            break;
+        }
+        default:
+            return nullptr;
+    }
+    if (encoding == nullptr || encoding->ByteSize() * 2 > chunk.Size()) {
+        return nullptr;
+    }
+    return encoding;
+}
+
+}  // namespace milvus
@@ -0,0 +1,297 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "bitset/common.h"
+#include "common/Types.h"
+
+namespace milvus {
+
+class Chunk;
+class FieldMeta;
+
+// Lightweight encodings kept next to the raw layout of a sealed chunk.
+//
+// The raw layout stays what Span/ValueAt readers see. The encoded form lets
+// filters answer simple predicates by scanning a few bits (or one byte) per
+// row with the bitset comparison kernels, instead of the raw values, and
+// without touching the raw pages of a mmap'd chunk at all. An encoding covers
+// every row of the chunk, null rows included; callers apply the chunk
+// validity themselves.
+enum class ChunkEncodingType : uint8_t {
+    // frame of reference + bit packing, for integers
+    ForBitPacked,
+    // sorted dictionary + fixed width codes, for low cardinality strings
+    Dictionary,
+    // runs of equal values, for booleans
+    RunLength,
+};
+
+class ChunkEncoding {
+ public:
+    virtual ~ChunkEncoding() = default;
+
+    virtual ChunkEncodingType
+    Type() const = 0;
+
+    virtual int64_t
+    RowNums() const = 0;
+
+    virtual size_t
+    ByteSize() const = 0;
+};
+
+// Integers stored as (value - min) in bit_width bits each.
+class ForBitPackedEncoding : public ChunkEncoding {
+ public:
+    template <typename T>
+    static std::unique_ptr<ForBitPackedEncoding>
+    Encode(const T* data, int64_t row_nums);
+
+    ChunkEncodingType
+    Type() const override {
+        return ChunkEncodingType::ForBitPacked;
+    }
+
+    int64_t
+    RowNums() const override {
+        return row_nums_;
+    }
+
+    size_t
+    ByteSize() const override {
+        return sizeof(*this) + words_.size() * sizeof(uint64_t);
+    }
+
+    int64_t
+    Min() const {
+        return min_;
+    }
+
+    int64_t
+    Max() const {
+        return max_;
+    }
+
+    int
+    BitWidth() const {
+        return bit_width_;
+    }
+
+    int64_t
+    ValueAt(int64_t idx) const;
+
+    // res[i] = ValueAt(offset + i) op value, for i in [0, size).
+    // Returns false, leaving res untouched, for an op it can't evaluate.
+    bool
+    Compare(bitset::CompareOpType op,
+            int64_t value,
+            int64_t offset,
+            int64_t size,
+            TargetBitmapView res) const;
+
+ private:
+    ForBitPackedEncoding() = default;
+
+    template <typename CodeT>
+    void
+    Unpack(int64_t offset, int64_t size, CodeT* codes) const;
+
+    template <typename CodeT>
+    void
+    CompareCodes(bitset::CompareOpType op,
+                 CodeT code,
+                 int64_t offset,
+                 int64_t size,
+                 TargetBitmapView res) const;
+
+    int64_t row_nums_ = 0;
+    int64_t min_ = 0;
+    int64_t max_ = 0;
+    int bit_width_ = 0;
+    std::vector<uint64_t> words_;
+};
+
+// Strings stored as codes into a sorted dictionary of the distinct values,
+// so the code order is the string order. Codes are int8/int16/int32
+// depending on the cardinality, which the bitset kernels compare directly.
+class DictionaryEncoding : public ChunkEncoding {
+ public:
+    // Returns nullptr when there are more than max_cardinality distinct
+    // values.
+    static std::unique_ptr<DictionaryEncoding>
+    Encode(const std::string_view* values,
+           int64_t row_nums,
+           int64_t max_cardinality);
+
+    ChunkEncodingType
+    Type() const override {
+        return ChunkEncodingType::Dictionary;
+    }
+
+    int64_t
+    RowNums() const override {
+        return row_nums_;
+    }
+
+    size_t
+    ByteSize() const override {
+        return sizeof(*this) + dict_data_.size() +
+               dict_offsets_.size() * sizeof(uint32_t) + codes_.size();
+    }
+
+    int64_t
+    Cardinality() const {
+        return static_cast<int64_t>(dict_offsets_.size()) - 1;
+    }
+
+    std::string_view
+    DictValue(int64_t code) const {
+        return {dict_data_.data() + dict_offsets_[code],
+                dict_offsets_[code + 1] - dict_offsets_[code]};
+    }
+
+    int64_t
+    CodeAt(int64_t idx) const;
+
+    std::string_view
+    ValueAt(int64_t idx) const {
+        return DictValue(CodeAt(idx));
+    }
+
+    // The code of value, or std::nullopt if the chunk doesn't contain it.
+    std::optional<int64_t>
+    Find(std::string_view value) const;
+
+    // Number of dictionary values < value (or <= value for upper_bound).
+    int64_t
+    LowerBound(std::string_view value) const;
+
+    int64_t
+    UpperBound(std::string_view value) const;
+
+    // res[i] = ValueAt(offset + i) op value, for i in [0, size). The literal
+    // is translated to a code once, a literal absent from the dictionary
+    // short-circuits to a constant result.
+    bool
+    Compare(bitset::CompareOpType op,
+            std::string_view value,
+            int64_t offset,
+            int64_t size,
+            TargetBitmapView res) const;
+
+    // res[i] = ValueAt(offset + i) is one of values, for i in [0, size).
+    // Literals are translated to codes once; when none is in the dictionary
+    // res is all false without scanning the codes.
+    bool
+    In(const std::vector<std::string>& values,
+       int64_t offset,
+       int64_t size,
+       TargetBitmapView res) const;
+
+ private:
+    DictionaryEncoding() = default;
+
+    template <typename CodeT>
+    void
+    CompareCodes(bitset::CompareOpType op,
+                 int64_t code,
+                 int64_t offset,
+                 int64_t size,
+                 TargetBitmapView res) const;
+
+    template <typename CodeT>
+    void
+    InCodes(const std::vector<int64_t>& codes,
+            int64_t offset,
+            int64_t size,
+            TargetBitmapView res) const;
+
+    int64_t row_nums_ = 0;
+    // 1, 2 or 4
+    int code_bytes_ = 1;
+    std::string dict_data_;
+    std::vector<uint32_t> dict_offsets_;
+    std::vector<uint8_t> codes_;
+};
+
+// Booleans stored as runs of equal values. Runs alternate, starting with
+// FirstValue().
+class RunLengthEncoding : public ChunkEncoding {
+ public:
+    static std::unique_ptr<RunLengthEncoding>
+    Encode(const bool* values, int64_t row_nums);
+
+    ChunkEncodingType
+    Type() const override {
+        return ChunkEncodingType::RunLength;
+    }
+
+    int64_t
+    RowNums() const override {
+        return row_nums_;
+    }
+
+    size_t
+    ByteSize() const override {
+        return sizeof(*this) + run_ends_.size() * sizeof(uint32_t);
+    }
+
+    int64_t
+    RunCount() const {
+        return static_cast<int64_t>(run_ends_.size());
+    }
+
+    bool
+    FirstValue() const {
+        return first_value_;
+    }
+
+    bool
+    ValueAt(int64_t idx) const;
+
+    // Only EQ and NE are evaluated.
+    bool
+    Compare(bitset::CompareOpType op,
+            bool value,
+            int64_t offset,
+            int64_t size,
+            TargetBitmapView res) const;
+
+ private:
+    RunLengthEncoding() = default;
+
+    template <typename GetFunc>
+    static std::unique_ptr<RunLengthEncoding>
+    EncodeImpl(GetFunc get, int64_t row_nums);
+
+    int64_t row_nums_ = 0;
+    bool first_value_ = false;
+    // exclusive end row of each run
+    std::vector<uint32_t> run_ends_;
+};
+
+// Encodes the values of a freshly built chunk when the field type has an
+// encoding and the encoded form takes at most half the raw chunk size.
+// Returns nullptr otherwise.
+std::shared_ptr<const ChunkEncoding>
+EncodeChunk(const FieldMeta& field_meta, const Chunk& chunk);
+
+}  // namespace milvus
@@ -0,0 +1,325 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <arrow/api.h>
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "common/Chunk.h"
+#include "common/ChunkEncoding.h"
+#include "common/ChunkWriter.h"
+#include "common/Common.h"
+#include "common/FieldMeta.h"
+#include "common/Types.h"
+#include "test_utils/Constants.h"
+
+using namespace milvus;
+using milvus::bitset::CompareOpType;
+
+namespace {
+
+const CompareOpType kAllOps[] = {CompareOpType::EQ,
+                                 CompareOpType::NE,
+                                 CompareOpType::GT,
+                                 CompareOpType::GE,
+                                 CompareOpType::LT,
+                                 CompareOpType::LE};
+
+template <typename T>
+bool
+Apply(CompareOpType op, const T& left, const T& right) {
+    switch (op) {
+        case CompareOpType::EQ:
+            return left == right;
+        case CompareOpType::NE:
+            return left != right;
+        case CompareOpType::GT:
+            return left > right;
+        case CompareOpType::GE:
+            return left >= right;
+        case CompareOpType::LT:
+            return left < right;
+        case CompareOpType::LE:
+            return left <= right;
+    }
+    return false;
+}
+
+class ChunkEncodingGuard {
+ public:
+    ChunkEncodingGuard() : old_(CHUNK_ENCODING_ENABLED.load()) {
+        CHUNK_ENCODING_ENABLED.store(true);
+    }
+    ~ChunkEncodingGuard() {
+        CHUNK_ENCODING_ENABLED.store(old_);
+    }
+
+ private:
+    bool old_;
+};
+
+}  // namespace
+
+TEST(ChunkEncoding, ForBitPackedMatchesRawValues) {
+    std::mt19937_64 rng(42);
+    for (int bit_width : {0, 1, 5, 9, 17, 31, 33, 40}) {
+        const int64_t n = 3000;
+        const int64_t base = -1234;
+        std::vector<int64_t> values(n);
+        for (auto& v : values) {
+            v = base + (bit_width == 0
+                            ? 0
+                            : static_cast<int64_t>(
+                                  rng() & ((uint64_t{1} << bit_width) - 1)));
+        }
+        auto encoding = ForBitPackedEncoding::Encode(values.data(), n);
+        ASSERT_LE(encoding->BitWidth(), bit_width);
+        for (int64_t i = 0; i < n; ++i) {
+            ASSERT_EQ(encoding->ValueAt(i), values[i]);
+        }
+
+        // literals inside and outside [min, max]
+        std::vector<int64_t> literals = {encoding->Min() - 1,
+                                         encoding->Min(),
+                                         encoding->Max(),
+                                         encoding->Max() + 1,
+                                         values[n / 2]};
+        for (auto literal : literals) {
+            for (auto op : kAllOps) {
+                const int64_t offset = 7;
+                const int64_t size = n - 20;
+                TargetBitmap res(size);
+                ASSERT_TRUE(encoding->Compare(op, literal, offset, size, res));
+                for (int64_t i = 0; i < size; ++i) {
+                    ASSERT_EQ(res[i], Apply(op, values[offset + i], literal))
+                        << "bit width " << bit_width << ", literal "
+                        << literal << ", row " << i;
+                }
+            }
+        }
+    }
+}
+
+TEST(ChunkEncoding, ForBitPackedNarrowTypes) {
+    std::vector<int8_t> values = {-128, 127, 0, -1, 5};
+    auto encoding = ForBitPackedEncoding::Encode(values.data(), values.size());
+    EXPECT_EQ(encoding->BitWidth(), 8);
+    TargetBitmap res(values.size());
+    ASSERT_TRUE(encoding->Compare(CompareOpType::LT, 0, 0, values.size(), res));
+    for (size_t i = 0; i < values.size(); ++i) {
+        EXPECT_EQ(encoding->ValueAt(i), values[i]);
+        EXPECT_EQ(res[i], values[i] < 0);
+    }
+}
+
+TEST(ChunkEncoding, DictionaryComparesOnCodes) {
+    std::vector<std::string> pool = {"a", "b", "bb", "apple", "zeta", "m", ""};
+    std::mt19937 rng(7);
+    const int64_t n = 2000;
+    std::vector<std::string> strings(n);
+    std::vector<std::string_view> views(n);
+    for (int64_t i = 0; i < n; ++i) {
+        strings[i] = pool[rng() % pool.size()];
+    }
+    for (int64_t i = 0; i < n; ++i) {
+        views[i] = strings[i];
+    }
+
+    EXPECT_EQ(DictionaryEncoding::Encode(views.data(), n, 3), nullptr);
+    auto encoding = DictionaryEncoding::Encode(views.data(), n, 100);
+    ASSERT_NE(encoding, nullptr);
+    EXPECT_EQ(encoding->Cardinality(), pool.size());
+    for (int64_t code = 1; code < encoding->Cardinality(); ++code) {
+        EXPECT_LT(encoding->DictValue(code - 1), encoding->DictValue(code));
+    }
+    for (int64_t i = 0; i < n; ++i) {
+        ASSERT_EQ(encoding->ValueAt(i), views[i]);
+    }
+    EXPECT_FALSE(encoding->Find("ba").has_value());
+    EXPECT_TRUE(encoding->Find("apple").has_value());
+
+    // present and absent literals, below, between and above the dictionary
+    for (std::string literal : {"a", "ba", "0", "zz", "", "apple", "zeta"}) {
+        for (auto op : kAllOps) {
+            const int64_t offset = 3;
+            const int64_t size = n - 10;
+            TargetBitmap res(size);
+            ASSERT_TRUE(encoding->Compare(op, literal, offset, size, res));
+            for (int64_t i = 0; i < size; ++i) {
+                ASSERT_EQ(
+                    res[i],
+                    Apply(op, views[offset + i], std::string_view(literal)))
+                    << "literal " << literal << ", row " << i;
+            }
+        }
+    }
+}
+
+TEST(ChunkEncoding, DictionaryIn) {
+    std::mt19937 rng(11);
+    for (int64_t cardinality : {6, 300, 40000}) {
+        const int64_t n = 50000;
+        std::vector<std::string> strings(n);
+        std::vector<std::string_view> views(n);
+        for (int64_t i = 0; i < n; ++i) {
+            strings[i] = "v" + std::to_string(rng() % cardinality);
+        }
+        for (int64_t i = 0; i < n; ++i) {
+            views[i] = strings[i];
+        }
+        auto encoding = DictionaryEncoding::Encode(views.data(), n, 1 << 16);
+        ASSERT_NE(encoding, nullptr);
+
+        // absent only, single, consecutive codes, a few codes, many codes
+        std::vector<std::vector<std::string>> in_lists = {
+            {"x", "y"}, {"v1"}, {"v1", "v10", "v100", "v1000", "missing"}};
+        std::vector<std::string> few;
+        std::vector<std::string> many;
+        for (int64_t i = 0; i < 20; ++i) {
+            few.push_back("v" + std::to_string(rng() % cardinality));
+        }
+        for (int64_t i = 0; i < std::min<int64_t>(cardinality, 1000); ++i) {
+            many.push_back("v" + std::to_string(i));
+        }
+        in_lists.emplace_back(few.begin(), few.begin() + 3);
+        in_lists.push_back(few);
+        in_lists.push_back(many);
+
+        for (const auto& in_list : in_lists) {
+            std::set<std::string_view> expected(in_list.begin(), in_list.end());
+            const int64_t offset = 5;
+            const int64_t size = n - 50;
+            TargetBitmap res(size);
+            ASSERT_TRUE(encoding->In(in_list, offset, size, res));
+            for (int64_t i = 0; i < size; ++i) {
+                ASSERT_EQ(res[i], expected.count(views[offset + i]) > 0)
+                    << "cardinality " << cardinality << ", row " << i;
+            }
+        }
+    }
+}
+
+TEST(ChunkEncoding, RunLength) {
+    const int64_t n = 5000;
+    std::mt19937 rng(3);
+    FixedVector<bool> values(n);
+    bool current = true;
+    int64_t runs = 1;
+    for (int64_t i = 0; i < n; ++i) {
+        if (i > 0 && rng() % 100 == 0) {
+            current = !current;
+            ++runs;
+        }
+        values[i] = current;
+    }
+    auto encoding = RunLengthEncoding::Encode(values.data(), n);
+    EXPECT_TRUE(encoding->FirstValue());
+    EXPECT_EQ(encoding->RunCount(), runs);
+    for (int64_t i = 0; i < n; ++i) {
+        ASSERT_EQ(encoding->ValueAt(i), values[i]);
+    }
+
+    for (bool literal : {true, false}) {
+        for (auto op : {CompareOpType::EQ, CompareOpType::NE}) {
+            const int64_t offset = 11;
+            const int64_t size = n - 30;
+            TargetBitmap res(size);
+            ASSERT_TRUE(encoding->Compare(op, literal, offset, size, res));
+            for (int64_t i = 0; i < size; ++i) {
+                ASSERT_EQ(res[i], Apply(op, bool(values[offset + i]), literal));
+            }
+        }
+    }
+    TargetBitmap res(n);
+    EXPECT_FALSE(encoding->Compare(CompareOpType::GT, false, 0, n, res));
+}
+
+TEST(ChunkEncoding, CreateChunkAttachesEncoding) {
+    ChunkEncodingGuard guard;
+    const int64_t n = 4096;
+
+    arrow::Int64Builder int_builder;
+    arrow::Int64Builder random_builder;
+    std::mt19937_64 rng(5);
+    for (int64_t i = 0; i < n; ++i) {
+        ASSERT_TRUE(int_builder.Append(1000000 + i % 100).ok());
+        ASSERT_TRUE(random_builder.Append(static_cast<int64_t>(rng())).ok());
+    }
+    std::shared_ptr<arrow::Array> small_array;
+    std::shared_ptr<arrow::Array> random_array;
+    ASSERT_TRUE(int_builder.Finish(&small_array).ok());
+    ASSERT_TRUE(random_builder.Finish(&random_array).ok());
+
+    int file_id = 0;
+    auto chunk_file = [&file_id]() {
+        return TestLocalPath + "chunk_encoding_" + std::to_string(file_id++);
+    };
+
+    FieldMeta int_meta(
+        FieldName("a"), FieldId(100), DataType::INT64, false, std::nullopt);
+    // an in-memory chunk keeps its raw values resident, no encoding on top
+    auto mem_chunk = create_chunk(int_meta, {small_array});
+    EXPECT_EQ(mem_chunk->Encoding(), nullptr);
+    EXPECT_EQ(mem_chunk->CellByteSize().memory_bytes,
+              static_cast<int64_t>(mem_chunk->Size()));
+
+    auto chunk = create_chunk(int_meta, {small_array}, true, chunk_file());
+    ASSERT_NE(chunk->Encoding(), nullptr);
+    ASSERT_EQ(chunk->Encoding()->Type(), ChunkEncodingType::ForBitPacked);
+    auto for_encoding =
+        static_cast<const ForBitPackedEncoding*>(chunk->Encoding());
+    EXPECT_EQ(for_encoding->BitWidth(), 7);
+    EXPECT_EQ(for_encoding->ValueAt(4095), 1000000 + 4095 % 100);
+    // only the encoded form is resident, the raw values are on disk
+    EXPECT_EQ(chunk->CellByteSize().memory_bytes,
+              static_cast<int64_t>(chunk->Encoding()->ByteSize()));
+    EXPECT_LT(chunk->CellByteSize().memory_bytes,
+              static_cast<int64_t>(chunk->Size()) / 2);
+    EXPECT_EQ(chunk->CellByteSize().file_bytes,
+              static_cast<int64_t>(chunk->Size()));
+
+    // not worth encoding
+    auto random_chunk =
+        create_chunk(int_meta, {random_array}, true, chunk_file());
+    EXPECT_EQ(random_chunk->Encoding(), nullptr);
+
+    arrow::StringBuilder string_builder;
+    for (int64_t i = 0; i < n; ++i) {
+        ASSERT_TRUE(
+            string_builder.Append("category_" + std::to_string(i % 5)).ok());
+    }
+    std::shared_ptr<arrow::Array> string_array;
+    ASSERT_TRUE(string_builder.Finish(&string_array).ok());
+    FieldMeta string_meta(FieldName("s"),
+                          FieldId(101),
+                          DataType::VARCHAR,
+                          128,
+                          false,
+                          std::nullopt);
+    auto string_chunk =
+        create_chunk(string_meta, {string_array}, true, chunk_file());
+    ASSERT_NE(string_chunk->Encoding(), nullptr);
+    auto dict =
+        static_cast<const DictionaryEncoding*>(string_chunk->Encoding());
+    EXPECT_EQ(dict->Cardinality(), 5);
+    EXPECT_EQ(dict->ValueAt(7), "category_2");
+
+    CHUNK_ENCODING_ENABLED.store(false);
+    EXPECT_EQ(
+        create_chunk(int_meta, {small_array}, true, chunk_file())->Encoding(),
+        nullptr);
+}
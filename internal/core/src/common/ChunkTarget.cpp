@@ -20,9 +20,34 @@
 
 #include "File.h"
 #include "common/EasyAssert.h"
+#include "common/Numa.h"
+#include "storage/Crc32cUtil.h"
 
 const uint32_t SYS_PAGE_SIZE = sysconf(_SC_PAGE_SIZE);
 namespace milvus {
+MemChunkTarget::MemChunkTarget(size_t cap, bool populate) : cap_(cap) {
+    auto numa_node = CurrentNumaNode();
+    auto mmap_flag = MAP_PRIVATE | MAP_ANON;
+    // pages populated by mmap() would be placed before the binding
+    if (populate && numa_node < 0) {
+        mmap_flag |= MAP_POPULATE;
+    }
+    auto m = mmap(nullptr, cap, PROT_READ | PROT_WRITE, mmap_flag, -1, 0);
+    AssertInfo(m != MAP_FAILED,
+               "failed to map: {}, map_size={}",
+               strerror(errno),
+               cap);
+    if (numa_node >= 0 && cap > 0) {
+        BindMemoryToNumaNode(m, cap, numa_node);
+#ifdef MADV_POPULATE_WRITE
+        if (populate) {
+            madvise(m, cap, MADV_POPULATE_WRITE);
+        }
+#endif
+    }
+    data_ = reinterpret_cast<char*>(m);
+}
+
 void
 MemChunkTarget::write(const void* data, size_t size) {
     AssertInfo(size + size_ <= cap_, "can not exceed target capacity");
@@ -59,6 +84,9 @@ MmapChunkTarget::flush() {
 void
 MmapChunkTarget::write(const void* data, size_t size) {
     file_writer_->Write(data, size);
+    if (checksum_) {
+        crc_ = storage::Crc32cUpdate(crc_, data, size);
+    }
     size_ += size;
 }
 
@@ -19,6 +19,7 @@
 #include <sys/types.h>
 #include <unistd.h>
 #include <cstddef>
+#include <cstdint>
 #include <string>
 #include <utility>
 #include "common/EasyAssert.h"
@@ -60,8 +61,12 @@ class MmapChunkTarget : public ChunkTarget {
     explicit MmapChunkTarget(std::string file_path,
                              bool populate,
                              size_t cap,
-                             storage::io::Priority io_prio)
-        : file_path_(std::move(file_path)), cap_(cap), populate_(populate) {
+                             storage::io::Priority io_prio,
+                             bool checksum = false)
+        : file_path_(std::move(file_path)),
+          cap_(cap),
+          populate_(populate),
+          checksum_(checksum) {
         file_writer_ =
             std::make_unique<storage::FileWriter>(file_path_, io_prio);
     }
@@ -75,6 +80,15 @@ class MmapChunkTarget : public ChunkTarget {
     size_t
     tell() override;
 
+    /**
+     * @brief CRC32C of everything written so far
+     * @note only maintained when the target is created with checksum
+     */
+    uint32_t
+    crc() const {
+        return crc_;
+    }
+
  private:
     void
     flush();
@@ -84,22 +98,16 @@ class MmapChunkTarget : public ChunkTarget {
     size_t cap_{0};
     size_t size_{0};
     bool populate_{false};
+    bool checksum_{false};
+    uint32_t crc_{0};
 };
 
 class MemChunkTarget : public ChunkTarget {
  public:
-    explicit MemChunkTarget(size_t cap, bool populate = true) : cap_(cap) {
-        auto mmap_flag = MAP_PRIVATE | MAP_ANON;
-        if (populate) {
-            mmap_flag |= MAP_POPULATE;
-        }
-        auto m = mmap(nullptr, cap, PROT_READ | PROT_WRITE, mmap_flag, -1, 0);
-        AssertInfo(m != MAP_FAILED,
-                   "failed to map: {}, map_size={}",
-                   strerror(errno),
-                   size_);
-        data_ = reinterpret_cast<char*>(m);
-    }
+    /**
+     * @note the memory is placed on CurrentNumaNode() if there is one
+     */
+    explicit MemChunkTarget(size_t cap, bool populate = true);
 
     void
     write(const void* data, size_t size) override;
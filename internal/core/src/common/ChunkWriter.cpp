@@ -11,9 +11,16 @@
 
 #include "common/ChunkWriter.h"
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <atomic>
 #include <cstdint>
+#include <filesystem>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <string>
 #include <tuple>
 #include <utility>
@@ -27,14 +34,18 @@
 #include "common/Array.h"
 #include "common/ColumnarArrayChunk.h"
 #include "common/Chunk.h"
+#include "common/ChunkEncoding.h"
+#include "common/Common.h"
 #include "common/EasyAssert.h"
 #include "common/FieldMeta.h"
+#include "common/PersistentChunkFile.h"
 #include "common/Types.h"
 #include "glog/logging.h"
 #include "knowhere/operands.h"
 #include "log/Log.h"
 #include "simdjson/base.h"
 #include "simdjson/padded_string.h"
+#include "storage/Crc32cUtil.h"
 #include "storage/FileWriter.h"
 
 namespace milvus {
@@ -782,6 +793,18 @@ make_chunk(const FieldMeta& field_meta,
     }
 }
 
+// Attach the lightweight encoding of the chunk values, see
+// common/ChunkEncoding.h. In-memory chunks keep their raw values resident
+// for every other reader, an encoding next to them would only add memory.
+static inline void
+encode_chunk(const FieldMeta& field_meta, Chunk& chunk) {
+    if (!CHUNK_ENCODING_ENABLED.load(std::memory_order_relaxed) ||
+        !chunk.IsFileBacked()) {
+        return;
+    }
+    chunk.SetEncoding(EncodeChunk(field_meta, chunk));
+}
+
 ChunkBuffer
 create_chunk_buffer(const FieldMeta& field_meta,
                     const arrow::ArrayVector& array_vec,
@@ -826,8 +849,10 @@ make_chunk_from_buffer(const FieldMeta& field_meta,
                        size_t row_nums_override) {
     auto row_nums =
         row_nums_override == 0 ? buffer.row_nums : row_nums_override;
-    return make_chunk(
+    auto chunk = make_chunk(
         field_meta, row_nums, buffer.data, buffer.size, buffer.guard);
+    encode_chunk(field_meta, *chunk);
+    return chunk;
 }
 
 std::unique_ptr<Chunk>
@@ -841,13 +866,19 @@ create_chunk(const FieldMeta& field_meta,
     return make_chunk_from_buffer(field_meta, buffer, 0);
 }
 
-std::unordered_map<FieldId, std::shared_ptr<Chunk>>
-create_group_chunk(const std::vector<FieldId>& field_ids,
-                   const std::vector<FieldMeta>& field_metas,
-                   const std::vector<arrow::ArrayVector>& array_vec,
-                   bool mmap_populate,
-                   const std::string& file_path,
-                   proto::common::LoadPriority load_priority) {
+// Write the chunks of `field_metas` back to back into one target, each at an
+// aligned offset, and return them in field order. With `persist_key`,
+// `file_path` is the final path of a persistent chunk file: the file is
+// written under a temporary name with its trailer appended and renamed into
+// place once complete.
+static std::vector<std::unique_ptr<Chunk>>
+write_group_chunk(const std::vector<FieldId>& field_ids,
+                  const std::vector<FieldMeta>& field_metas,
+                  const std::vector<arrow::ArrayVector>& array_vec,
+                  bool mmap_populate,
+                  const std::string& file_path,
+                  proto::common::LoadPriority load_priority,
+                  const PersistentChunkKey* persist_key) {
     std::vector<std::shared_ptr<ChunkWriterBase>> cws;
     cws.reserve(field_ids.size());
     size_t total_aligned_size = 0, final_row_nums = 0;
@@ -880,15 +911,27 @@ create_group_chunk(const std::vector<FieldId>& field_ids,
         }
     }
     std::shared_ptr<ChunkTarget> target;
+    std::shared_ptr<MmapChunkTarget> mmap_target;
+    std::string target_path = file_path;
+    if (persist_key != nullptr) {
+        static std::atomic<uint64_t> temp_file_generation{0};
+        target_path = fmt::format(
+            "{}.{}.{}.tmp",
+            file_path,
+            getpid(),
+            temp_file_generation.fetch_add(1, std::memory_order_relaxed));
+    }
     if (file_path.empty()) {
         target =
             std::make_shared<MemChunkTarget>(total_aligned_size, mmap_populate);
     } else {
-        target = std::make_shared<MmapChunkTarget>(
-            file_path,
+        mmap_target = std::make_shared<MmapChunkTarget>(
+            target_path,
             mmap_populate,
             total_aligned_size,
-            storage::io::GetPriorityFromLoadPriority(load_priority));
+            storage::io::GetPriorityFromLoadPriority(load_priority),
+            /* checksum */ persist_key != nullptr);
+        target = mmap_target;
     }
     for (size_t i = 0; i < field_ids.size(); i++) {
         auto start_off = target->tell();
@@ -918,11 +961,44 @@ create_group_chunk(const std::vector<FieldId>& field_ids,
         cws[i].reset();
     }
 
+    if (persist_key != nullptr) {
+        // the trailer lands past the mapped capacity
+        std::vector<PersistentChunkEntry> entries;
+        entries.reserve(field_ids.size());
+        for (size_t i = 0; i < field_ids.size(); i++) {
+            entries.push_back({field_ids[i].get(), chunk_sizes[i]});
+        }
+        auto trailer =
+            EncodePersistentChunkTrailer(*persist_key,
+                                         PersistentChunkSchemaHash(field_metas),
+                                         entries,
+                                         total_aligned_size,
+                                         final_row_nums,
+                                         mmap_target->crc());
+        target->write(trailer.data(), trailer.size());
+    }
+
     auto data = target->release();
 
     // For mmap mode, create a shared mmap region manager
     std::shared_ptr<ChunkMmapGuard> chunk_mmap_guard = nullptr;
-    if (!file_path.empty()) {
+    if (persist_key != nullptr) {
+        std::error_code ec;
+        std::filesystem::rename(target_path, file_path, ec);
+        if (ec) {
+            // serve the data anyway, just don't keep the file
+            LOG_WARN("rename persistent chunk file {} failed: {}",
+                     target_path,
+                     ec.message());
+            chunk_mmap_guard = std::make_shared<ChunkMmapGuard>(
+                data, total_aligned_size, target_path);
+        } else {
+            chunk_mmap_guard = std::make_shared<ChunkMmapGuard>(
+                data, total_aligned_size, file_path, false);
+            NotePersistentChunkFileWritten(
+                file_path, static_cast<int64_t>(mmap_target->tell()));
+        }
+    } else if (!file_path.empty()) {
         chunk_mmap_guard = std::make_shared<ChunkMmapGuard>(
             data, total_aligned_size, file_path);
     } else {
@@ -930,13 +1006,16 @@ create_group_chunk(const std::vector<FieldId>& field_ids,
             std::make_shared<ChunkMmapGuard>(data, total_aligned_size, "");
     }
 
-    std::unordered_map<FieldId, std::shared_ptr<Chunk>> chunks;
+    std::vector<std::unique_ptr<Chunk>> chunks;
+    chunks.reserve(field_ids.size());
     for (size_t i = 0; i < field_ids.size(); i++) {
-        chunks[field_ids[i]] = make_chunk(field_metas[i],
-                                          final_row_nums,
-                                          data + chunk_offsets[i],
-                                          chunk_sizes[i],
-                                          chunk_mmap_guard);
+        auto chunk = make_chunk(field_metas[i],
+                                final_row_nums,
+                                data + chunk_offsets[i],
+                                chunk_sizes[i],
+                                chunk_mmap_guard);
+        encode_chunk(field_metas[i], *chunk);
+        chunks.push_back(std::move(chunk));
         LOG_INFO(
             "created chunk for field {} with chunk offset: {}, chunk "
             "size: {}, file path: {}",
@@ -949,6 +1028,212 @@ create_group_chunk(const std::vector<FieldId>& field_ids,
     return chunks;
 }
 
+// Map the persistent chunk file of `key` and return its chunks with their
+// field ids, or std::nullopt if there is no such file or it doesn't fit
+// `field_metas`. A file that doesn't fit is removed, the cell is then loaded
+// and written again.
+static std::optional<std::vector<std::pair<FieldId, std::unique_ptr<Chunk>>>>
+open_persistent_chunk_file(
+    const std::unordered_map<FieldId, FieldMeta>& field_metas,
+    bool mmap_populate,
+    const std::string& dir,
+    const PersistentChunkKey& key) {
+    auto path = PersistentChunkFilePath(dir, key);
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        if (errno != ENOENT) {
+            LOG_WARN("open persistent chunk file {} failed: {}",
+                     path,
+                     strerror(errno));
+        }
+        return std::nullopt;
+    }
+    auto reject = [&](const std::string& reason) {
+        if (fd >= 0) {
+            ::close(fd);
+        }
+        LOG_WARN("discard persistent chunk file {}: {}", path, reason);
+        RemovePersistentChunkFile(path);
+        return std::nullopt;
+    };
+
+    std::string error;
+    auto layout = ReadPersistentChunkLayout(fd, key, error);
+    if (!layout.has_value()) {
+        return reject(error);
+    }
+    const auto& trailer = layout->trailer;
+    std::vector<FieldMeta> metas;
+    std::vector<size_t> offsets;
+    metas.reserve(layout->entries.size());
+    offsets.reserve(layout->entries.size());
+    uint64_t payload_size = 0;
+    for (const auto& entry : layout->entries) {
+        auto it = field_metas.find(FieldId(entry.field_id));
+        if (it == field_metas.end()) {
+            return reject(
+                fmt::format("field {} is not in the schema", entry.field_id));
+        }
+        metas.push_back(it->second);
+        offsets.push_back(payload_size);
+        payload_size += (entry.size + ChunkTarget::ALIGNED_SIZE - 1) &
+                        ~(ChunkTarget::ALIGNED_SIZE - 1);
+    }
+    if (payload_size != trailer.payload_size || payload_size == 0) {
+        return reject(fmt::format("chunks take {} bytes but payload has {}",
+                                  payload_size,
+                                  trailer.payload_size));
+    }
+    if (PersistentChunkSchemaHash(metas) != trailer.schema_hash) {
+        return reject("schema changed");
+    }
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+        return reject(fmt::format("fstat failed: {}", strerror(errno)));
+    }
+    auto verified = IsPersistentChunkPayloadVerified(path, st);
+
+    auto mmap_flag = MAP_SHARED;
+    if (mmap_populate) {
+        mmap_flag |= MAP_POPULATE;
+    }
+    auto m = mmap(nullptr, payload_size, PROT_READ, mmap_flag, fd, 0);
+    if (m == MAP_FAILED) {
+        return reject(fmt::format("mmap failed: {}", strerror(errno)));
+    }
+    ::close(fd);
+    fd = -1;
+    auto data = static_cast<char*>(m);
+    if (!verified) {
+        // a reload after eviction skips this, the file is renamed into place
+        // and never written again
+        if (storage::Crc32cValue(data, payload_size) != trailer.payload_crc) {
+            munmap(m, payload_size);
+            return reject("payload checksum mismatch");
+        }
+        MarkPersistentChunkPayloadVerified(path, st);
+    }
+
+    // refresh the file for the least recently used pruning
+    std::error_code ec;
+    std::filesystem::last_write_time(
+        path, std::filesystem::file_time_type::clock::now(), ec);
+
+    auto chunk_mmap_guard =
+        std::make_shared<ChunkMmapGuard>(data, payload_size, path, false);
+    std::vector<std::pair<FieldId, std::unique_ptr<Chunk>>> chunks;
+    chunks.reserve(metas.size());
+    for (size_t i = 0; i < metas.size(); i++) {
+        auto chunk = make_chunk(metas[i],
+                                trailer.row_nums,
+                                data + offsets[i],
+                                layout->entries[i].size,
+                                chunk_mmap_guard);
+        encode_chunk(metas[i], *chunk);
+        chunks.emplace_back(metas[i].get_id(), std::move(chunk));
+    }
+    LOG_INFO("mapped {} chunks of {} rows from persistent chunk file {}",
+             chunks.size(),
+             trailer.row_nums,
+             path);
+    return chunks;
+}
+
+std::unordered_map<FieldId, std::shared_ptr<Chunk>>
+create_group_chunk(const std::vector<FieldId>& field_ids,
+                   const std::vector<FieldMeta>& field_metas,
+                   const std::vector<arrow::ArrayVector>& array_vec,
+                   bool mmap_populate,
+                   const std::string& file_path,
+                   proto::common::LoadPriority load_priority) {
+    auto written = write_group_chunk(field_ids,
+                                     field_metas,
+                                     array_vec,
+                                     mmap_populate,
+                                     file_path,
+                                     load_priority,
+                                     nullptr);
+    std::unordered_map<FieldId, std::shared_ptr<Chunk>> chunks;
+    for (size_t i = 0; i < field_ids.size(); i++) {
+        chunks[field_ids[i]] = std::move(written[i]);
+    }
+    return chunks;
+}
+
+std::unique_ptr<Chunk>
+create_persistent_chunk(const FieldMeta& field_meta,
+                        const arrow::ArrayVector& array_vec,
+                        bool mmap_populate,
+                        const std::string& dir,
+                        const PersistentChunkKey& key,
+                        proto::common::LoadPriority load_priority) {
+    auto chunks = write_group_chunk({field_meta.get_id()},
+                                    {field_meta},
+                                    {array_vec},
+                                    mmap_populate,
+                                    PersistentChunkFilePath(dir, key),
+                                    load_priority,
+                                    &key);
+    return std::move(chunks[0]);
+}
+
+std::unique_ptr<Chunk>
+open_persistent_chunk(const FieldMeta& field_meta,
+                      bool mmap_populate,
+                      const std::string& dir,
+                      const PersistentChunkKey& key) {
+    auto chunks = open_persistent_chunk_file(
+        {{field_meta.get_id(), field_meta}}, mmap_populate, dir, key);
+    if (!chunks.has_value()) {
+        return nullptr;
+    }
+    AssertInfo(chunks->size() == 1,
+               "persistent chunk file of field {} holds {} chunks",
+               field_meta.get_id().get(),
+               chunks->size());
+    return std::move(chunks->front().second);
+}
+
+std::unordered_map<FieldId, std::shared_ptr<Chunk>>
+create_persistent_group_chunk(const std::vector<FieldId>& field_ids,
+                              const std::vector<FieldMeta>& field_metas,
+                              const std::vector<arrow::ArrayVector>& array_vec,
+                              bool mmap_populate,
+                              const std::string& dir,
+                              const PersistentChunkKey& key,
+                              proto::common::LoadPriority load_priority) {
+    auto written = write_group_chunk(field_ids,
+                                     field_metas,
+                                     array_vec,
+                                     mmap_populate,
+                                     PersistentChunkFilePath(dir, key),
+                                     load_priority,
+                                     &key);
+    std::unordered_map<FieldId, std::shared_ptr<Chunk>> chunks;
+    for (size_t i = 0; i < field_ids.size(); i++) {
+        chunks[field_ids[i]] = std::move(written[i]);
+    }
+    return chunks;
+}
+
+std::optional<std::unordered_map<FieldId, std::shared_ptr<Chunk>>>
+open_persistent_group_chunk(
+    const std::unordered_map<FieldId, FieldMeta>& field_metas,
+    bool mmap_populate,
+    const std::string& dir,
+    const PersistentChunkKey& key) {
+    auto opened =
+        open_persistent_chunk_file(field_metas, mmap_populate, dir, key);
+    if (!opened.has_value()) {
+        return std::nullopt;
+    }
+    std::unordered_map<FieldId, std::shared_ptr<Chunk>> chunks;
+    for (auto& [field_id, chunk] : *opened) {
+        chunks[field_id] = std::move(chunk);
+    }
+    return chunks;
+}
+
 arrow::ArrayVector
 read_single_column_batches(std::shared_ptr<arrow::RecordBatchReader> reader) {
     arrow::ArrayVector array_vec;
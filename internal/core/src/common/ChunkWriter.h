@@ -14,6 +14,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <tuple>
@@ -32,6 +33,7 @@
 #include "common/EasyAssert.h"
 #include "common/FieldMeta.h"
 #include "common/Json.h"
+#include "common/PersistentChunkFile.h"
 #include "common/Types.h"
 #include "pb/common.pb.h"
 #include "pb/schema.pb.h"
@@ -397,6 +399,45 @@ create_group_chunk(const std::vector<FieldId>& field_ids,
                    proto::common::LoadPriority load_priority =
                        proto::common::LoadPriority::HIGH);
 
+// Persistent chunk files, see common/PersistentChunkFile.h. `dir` is a
+// directory returned by PersistentChunkDir().
+
+std::unique_ptr<Chunk>
+create_persistent_chunk(const FieldMeta& field_meta,
+                        const arrow::ArrayVector& array_vec,
+                        bool mmap_populate,
+                        const std::string& dir,
+                        const PersistentChunkKey& key,
+                        proto::common::LoadPriority load_priority =
+                            proto::common::LoadPriority::HIGH);
+
+// Map the persistent chunk file of `key`, or return nullptr if there is no
+// valid file for `field_meta`.
+std::unique_ptr<Chunk>
+open_persistent_chunk(const FieldMeta& field_meta,
+                      bool mmap_populate,
+                      const std::string& dir,
+                      const PersistentChunkKey& key);
+
+std::unordered_map<FieldId, std::shared_ptr<Chunk>>
+create_persistent_group_chunk(const std::vector<FieldId>& field_ids,
+                              const std::vector<FieldMeta>& field_metas,
+                              const std::vector<arrow::ArrayVector>& array_vec,
+                              bool mmap_populate,
+                              const std::string& dir,
+                              const PersistentChunkKey& key,
+                              proto::common::LoadPriority load_priority =
+                                  proto::common::LoadPriority::HIGH);
+
+// Map the persistent chunk file of `key`, or return std::nullopt if there is
+// no valid file whose fields are all in `field_metas`.
+std::optional<std::unordered_map<FieldId, std::shared_ptr<Chunk>>>
+open_persistent_group_chunk(
+    const std::unordered_map<FieldId, FieldMeta>& field_metas,
+    bool mmap_populate,
+    const std::string& dir,
+    const PersistentChunkKey& key);
+
 arrow::ArrayVector
 read_single_column_batches(std::shared_ptr<arrow::RecordBatchReader> reader);
 
@@ -28,6 +28,8 @@
 namespace milvus {
 
 std::atomic<int64_t> FILE_SLICE_SIZE(DEFAULT_INDEX_FILE_SLICE_SIZE);
+std::atomic<int64_t> RAW_DATA_CACHE_INFLIGHT_BYTES(
+    DEFAULT_RAW_DATA_CACHE_INFLIGHT_BYTES);
 std::atomic<int64_t> EXEC_EVAL_EXPR_BATCH_SIZE(
     DEFAULT_EXEC_EVAL_EXPR_BATCH_SIZE);
 std::atomic<int64_t> DELETE_DUMP_BATCH_SIZE(DEFAULT_DELETE_DUMP_BATCH_SIZE);
@@ -44,6 +46,18 @@ std::atomic<bool> CONFIG_PARAM_TYPE_CHECK_ENABLED(
     DEFAULT_CONFIG_PARAM_TYPE_CHECK_ENABLED);
 std::atomic<bool> ENABLE_PARQUET_STATS_SKIP_INDEX(
     DEFAULT_ENABLE_PARQUET_STATS_SKIP_INDEX);
+std::atomic<bool> KMEANS_MINIBATCH_ENABLED(DEFAULT_KMEANS_MINIBATCH_ENABLED);
+std::atomic<bool> CHUNK_ENCODING_ENABLED(DEFAULT_CHUNK_ENCODING_ENABLED);
+std::atomic<bool> PERSISTENT_CHUNK_FILE_ENABLED(
+    DEFAULT_PERSISTENT_CHUNK_FILE_ENABLED);
+std::atomic<int64_t> PERSISTENT_CHUNK_FILE_DISK_LIMIT(
+    DEFAULT_PERSISTENT_CHUNK_FILE_DISK_LIMIT);
+std::atomic<bool> NUMA_AWARE_EXECUTOR_ENABLED(
+    DEFAULT_NUMA_AWARE_EXECUTOR_ENABLED);
+std::atomic<bool> FUSED_RANGE_CONJUNCT_ENABLED(
+    DEFAULT_FUSED_RANGE_CONJUNCT_ENABLED);
+std::atomic<int64_t> PREPARED_GEOMETRY_CACHE_CAPACITY(
+    DEFAULT_PREPARED_GEOMETRY_CACHE_CAPACITY);
 
 void
 SetIndexSliceSize(const int64_t size) {
@@ -62,6 +76,16 @@ SetLoadTransientBudgetBytes(int64_t bytes) {
     LOG_INFO("set load transient budget bytes: {}", bytes);
 }
 
+void
+SetRawDataCacheInflightBytes(int64_t bytes) {
+    if (bytes <= 0) {
+        LOG_WARN("ignore invalid raw data cache inflight bytes: {}", bytes);
+        return;
+    }
+    RAW_DATA_CACHE_INFLIGHT_BYTES.store(bytes);
+    LOG_INFO("set raw data cache inflight bytes: {}", bytes);
+}
+
 void
 SetDefaultExecEvalExprBatchSize(int64_t val) {
     EXEC_EVAL_EXPR_BATCH_SIZE.store(val);
@@ -118,6 +142,63 @@ SetDefaultEnableParquetStatsSkipIndex(bool val) {
              ENABLE_PARQUET_STATS_SKIP_INDEX.load());
 }
 
+void
+SetDefaultKmeansMiniBatchEnable(bool val) {
+    KMEANS_MINIBATCH_ENABLED.store(val);
+    LOG_INFO("set default kmeans mini-batch enabled: {}",
+             KMEANS_MINIBATCH_ENABLED.load());
+}
+
+void
+SetDefaultChunkEncodingEnable(bool val) {
+    CHUNK_ENCODING_ENABLED.store(val);
+    LOG_INFO("set default chunk encoding enabled: {}",
+             CHUNK_ENCODING_ENABLED.load());
+}
+
+void
+SetDefaultPersistentChunkFileEnable(bool val) {
+    PERSISTENT_CHUNK_FILE_ENABLED.store(val);
+    LOG_INFO("set default persistent chunk file enabled: {}",
+             PERSISTENT_CHUNK_FILE_ENABLED.load());
+}
+
+void
+SetPersistentChunkFileDiskLimit(int64_t bytes) {
+    if (bytes < 0) {
+        LOG_WARN("ignore invalid persistent chunk file disk limit: {}", bytes);
+        return;
+    }
+    PERSISTENT_CHUNK_FILE_DISK_LIMIT.store(bytes);
+    LOG_INFO("set persistent chunk file disk limit (byte): {}",
+             PERSISTENT_CHUNK_FILE_DISK_LIMIT.load());
+}
+
+void
+SetDefaultNumaAwareExecutorEnable(bool val) {
+    NUMA_AWARE_EXECUTOR_ENABLED.store(val);
+    LOG_INFO("set default numa aware executor enabled: {}",
+             NUMA_AWARE_EXECUTOR_ENABLED.load());
+}
+
+void
+SetDefaultFusedRangeConjunctEnable(bool val) {
+    FUSED_RANGE_CONJUNCT_ENABLED.store(val);
+    LOG_INFO("set default fused range conjunct enabled: {}",
+             FUSED_RANGE_CONJUNCT_ENABLED.load());
+}
+
+void
+SetPreparedGeometryCacheCapacity(int64_t capacity) {
+    if (capacity <= 0) {
+        LOG_WARN("ignore invalid prepared geometry cache capacity: {}",
+                 capacity);
+        return;
+    }
+    PREPARED_GEOMETRY_CACHE_CAPACITY.store(capacity);
+    LOG_INFO("set prepared geometry cache capacity: {}", capacity);
+}
+
 void
 SetEnableLatestDeleteSnapshotOptimization(bool val) {
     ENABLE_LATEST_DELETE_SNAPSHOT_OPTIMIZATION.store(val);
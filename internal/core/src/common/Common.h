@@ -26,6 +26,7 @@
 namespace milvus {
 
 extern std::atomic<int64_t> FILE_SLICE_SIZE;
+extern std::atomic<int64_t> RAW_DATA_CACHE_INFLIGHT_BYTES;
 extern std::atomic<int64_t> EXEC_EVAL_EXPR_BATCH_SIZE;
 extern std::atomic<int64_t> DELETE_DUMP_BATCH_SIZE;
 extern std::atomic<bool> ENABLE_LATEST_DELETE_SNAPSHOT_OPTIMIZATION;
@@ -35,6 +36,13 @@ extern std::atomic<bool> JSON_KEY_STATS_ENABLED;
 extern std::atomic<bool> GROWING_JSON_KEY_STATS_ENABLED;
 extern std::atomic<bool> CONFIG_PARAM_TYPE_CHECK_ENABLED;
 extern std::atomic<bool> ENABLE_PARQUET_STATS_SKIP_INDEX;
+extern std::atomic<bool> KMEANS_MINIBATCH_ENABLED;
+extern std::atomic<bool> CHUNK_ENCODING_ENABLED;
+extern std::atomic<bool> PERSISTENT_CHUNK_FILE_ENABLED;
+extern std::atomic<int64_t> PERSISTENT_CHUNK_FILE_DISK_LIMIT;
+extern std::atomic<bool> NUMA_AWARE_EXECUTOR_ENABLED;
+extern std::atomic<bool> FUSED_RANGE_CONJUNCT_ENABLED;
+extern std::atomic<int64_t> PREPARED_GEOMETRY_CACHE_CAPACITY;
 
 void
 SetIndexSliceSize(const int64_t size);
@@ -42,6 +50,9 @@ SetIndexSliceSize(const int64_t size);
 void
 SetLoadTransientBudgetBytes(int64_t bytes);
 
+void
+SetRawDataCacheInflightBytes(int64_t bytes);
+
 void
 SetDefaultExecEvalExprBatchSize(int64_t val);
 
@@ -66,6 +77,27 @@ SetDefaultConfigParamTypeCheck(bool val);
 void
 SetDefaultEnableParquetStatsSkipIndex(bool val);
 
+void
+SetDefaultKmeansMiniBatchEnable(bool val);
+
+void
+SetDefaultChunkEncodingEnable(bool val);
+
+void
+SetDefaultPersistentChunkFileEnable(bool val);
+
+void
+SetPersistentChunkFileDiskLimit(int64_t bytes);
+
+void
+SetDefaultNumaAwareExecutorEnable(bool val);
+
+void
+SetDefaultFusedRangeConjunctEnable(bool val);
+
+void
+SetPreparedGeometryCacheCapacity(int64_t capacity);
+
 void
 SetEnableLatestDeleteSnapshotOptimization(bool val);
 
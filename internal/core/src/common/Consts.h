@@ -87,6 +87,11 @@ const int64_t DEFAULT_FIELD_MAX_MEMORY_LIMIT = 128 << 20;  // bytes
 
 const int64_t DEFAULT_INDEX_FILE_SLICE_SIZE = 16 << 20;  // bytes
 
+// decoded binlog bytes held when raw data is cached to local disk for disk
+// index builds: the binlog being written plus the downloads ahead of it
+const int64_t DEFAULT_RAW_DATA_CACHE_INFLIGHT_BYTES =
+    DEFAULT_FIELD_MAX_MEMORY_LIMIT;
+
 const int64_t DEFAULT_EXEC_EVAL_EXPR_BATCH_SIZE = 8192;
 
 const int64_t DEFAULT_DELETE_DUMP_BATCH_SIZE = 10000;
@@ -119,6 +124,17 @@ const bool DEFAULT_JSON_KEY_STATS_ENABLED = true;
 const bool DEFAULT_GROWING_JSON_KEY_STATS_ENABLED = false;
 const bool DEFAULT_CONFIG_PARAM_TYPE_CHECK_ENABLED = true;
 const bool DEFAULT_ENABLE_PARQUET_STATS_SKIP_INDEX = false;
+const bool DEFAULT_KMEANS_MINIBATCH_ENABLED = false;
+const bool DEFAULT_CHUNK_ENCODING_ENABLED = false;
+const bool DEFAULT_PERSISTENT_CHUNK_FILE_ENABLED = false;
+const int64_t DEFAULT_PERSISTENT_CHUNK_FILE_DISK_LIMIT = 64LL << 30;  // 64GB
+const bool DEFAULT_NUMA_AWARE_EXECUTOR_ENABLED = false;
+const bool DEFAULT_FUSED_RANGE_CONJUNCT_ENABLED = true;
+const int64_t DEFAULT_KMEANS_MINIBATCH_SIZE = 8192;  // rows per update
+const uint32_t DEFAULT_KMEANS_SHUFFLE_SEED = 42;
+// prepared query geometries kept per thread, GIS workloads commonly filter
+// with around a thousand distinct polygons
+const int64_t DEFAULT_PREPARED_GEOMETRY_CACHE_CAPACITY = 2048;
 
 // skipindex stats related
 const double DEFAULT_BLOOM_FILTER_FALSE_POSITIVE_RATE = 0.01;
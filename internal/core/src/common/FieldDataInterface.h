@@ -271,6 +271,20 @@ class FieldBitsetImpl : public FieldDataBase {
         return false;
     }
 
+    // Give up the bitmap storage, leaving this field empty. Used to recycle
+    // the buffers of consumed batch results.
+    TargetBitmap
+    TakeBitmap() {
+        static_assert(std::is_same_v<Type, uint8_t>,
+                      "only byte-backed bitsets can be taken as TargetBitmap");
+        std::unique_lock cap_lck(cap_mutex_);
+        std::unique_lock length_lck(length_mutex_);
+        auto length = length_;
+        length_ = 0;
+        cap_ = 0;
+        return TargetBitmap(std::move(data_), length);
+    }
+
     void
     Reserve(size_t cap) override {
         std::lock_guard lck(cap_mutex_);
@@ -15,6 +15,7 @@
 #include <chrono>
 #include <memory>
 #include <cmath>
+#include <limits>
 #include <new>
 #include <string>
 #include "common/EasyAssert.h"
@@ -222,6 +223,51 @@ GetThreadLocalGEOSContext() {
     return tls.ctx;
 }
 
+// Axis-aligned bounding box of a geometry, used as a cheap prefilter before
+// an exact GEOS predicate. A default-constructed envelope is empty and
+// intersects nothing.
+struct GeometryEnvelope {
+    double min_x = std::numeric_limits<double>::infinity();
+    double min_y = std::numeric_limits<double>::infinity();
+    double max_x = -std::numeric_limits<double>::infinity();
+    double max_y = -std::numeric_limits<double>::infinity();
+
+    bool
+    IsEmpty() const {
+        return !(min_x <= max_x && min_y <= max_y);
+    }
+
+    // Closed intervals: boxes that only share an edge or a corner intersect,
+    // so a touching geometry is never filtered out.
+    bool
+    Intersects(const GeometryEnvelope& other) const {
+        return min_x <= other.max_x && other.min_x <= max_x &&
+               min_y <= other.max_y && other.min_y <= max_y;
+    }
+};
+
+// Envelope of `geom`, or an empty envelope for a null/empty geometry or when
+// GEOS fails to compute it.
+inline GeometryEnvelope
+ComputeEnvelope(GEOSContextHandle_t ctx, const GEOSGeometry* geom) {
+    GeometryEnvelope envelope;
+    if (geom == nullptr) {
+        return envelope;
+    }
+    double min_x, min_y, max_x, max_y;
+    if (GEOSGeom_getXMin_r(ctx, geom, &min_x) == 0 ||
+        GEOSGeom_getXMax_r(ctx, geom, &max_x) == 0 ||
+        GEOSGeom_getYMin_r(ctx, geom, &min_y) == 0 ||
+        GEOSGeom_getYMax_r(ctx, geom, &max_y) == 0) {
+        return envelope;
+    }
+    envelope.min_x = min_x;
+    envelope.min_y = min_y;
+    envelope.max_x = max_x;
+    envelope.max_y = max_y;
+    return envelope;
+}
+
 class Geometry {
  public:
     // Default constructor creates invalid geometry
@@ -11,7 +11,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <atomic>
+#include <cstdint>
 #include <memory>
 #include <mutex>
 #include <shared_mutex>
@@ -129,7 +131,9 @@ class SimpleGeometryCache {
             // somehow reaches one skips the row, and the owning batch's
             // (re)write fills it in place.
             geometries_.resize(absolute_offset + 1);
+            ResizeEnvelopes(absolute_offset + 1);
         }
+        SetEnvelope(absolute_offset, GeometryEnvelope());
 
         if (size == 0 || wkb_data == nullptr) {
             // Null/empty geometry - store an invalid entry
@@ -152,6 +156,8 @@ class SimpleGeometryCache {
             geometries_[absolute_offset] = Geometry();
             return;
         }
+        SetEnvelope(absolute_offset,
+                    ComputeEnvelope(ctx_, geometry.GetGeometry()));
         geometries_[absolute_offset] = std::move(geometry);
     }
 
@@ -182,6 +188,38 @@ class SimpleGeometryCache {
         return geometry.IsValid() ? &geometry : nullptr;
     }
 
+    // Bounding-box prefilter over a batch of rows (use with AcquireReadLock):
+    // out[i] = 1 when the envelope of the row at offsets[i] intersects
+    // `query`, 0 otherwise. Invalid and out-of-range rows get 0, the same
+    // answer GetByOffsetUnsafe gives them. The envelopes are kept in separate
+    // flat arrays and the loop is branch free, so a batch of points is
+    // rejected without touching a single GEOS geometry.
+    template <typename OffsetT>
+    void
+    FilterByEnvelopeUnsafe(const OffsetT* offsets,
+                           size_t n,
+                           const GeometryEnvelope& query,
+                           uint8_t* out) const {
+        const size_t count = geometries_.size();
+        if (count == 0) {
+            std::fill(out, out + n, uint8_t{0});
+            return;
+        }
+        const double* min_x = min_x_.data();
+        const double* min_y = min_y_.data();
+        const double* max_x = max_x_.data();
+        const double* max_y = max_y_.data();
+        for (size_t i = 0; i < n; ++i) {
+            const size_t offset = static_cast<size_t>(offsets[i]);
+            const bool in_range = offset < count;
+            // clamp instead of branching, the in_range bit masks the result
+            const size_t j = in_range ? offset : 0;
+            out[i] = in_range & (min_x[j] <= query.max_x) &
+                     (query.min_x <= max_x[j]) & (min_y[j] <= query.max_y) &
+                     (query.min_y <= max_y[j]);
+        }
+    }
+
     // Get Geometry by offset (thread-safe read for filtering)
     const Geometry*
     GetByOffset(size_t offset) const {
@@ -222,9 +260,39 @@ class SimpleGeometryCache {
     GEOSContextHandle_t ctx_{nullptr};  // Context owned by this cache
     mutable std::shared_mutex mutex_;   // For read/write operations
     std::vector<Geometry> geometries_;  // Direct storage of Geometry objects
+    // Per-row envelopes, parallel to geometries_. Invalid rows hold an empty
+    // envelope (+inf/-inf), which fails every comparison.
+    std::vector<double> min_x_;
+    std::vector<double> min_y_;
+    std::vector<double> max_x_;
+    std::vector<double> max_y_;
+
+    void
+    ResizeEnvelopes(size_t size) {
+        const GeometryEnvelope empty;
+        min_x_.resize(size, empty.min_x);
+        min_y_.resize(size, empty.min_y);
+        max_x_.resize(size, empty.max_x);
+        max_y_.resize(size, empty.max_y);
+    }
+
+    void
+    SetEnvelope(size_t offset, const GeometryEnvelope& envelope) {
+        min_x_[offset] = envelope.min_x;
+        min_y_[offset] = envelope.min_y;
+        max_x_[offset] = envelope.max_x;
+        max_y_[offset] = envelope.max_y;
+    }
 };
 
-// Global cache instance per segment+field
+// Global cache instance per segment+field.
+//
+// Every GIS filter batch looks its cache up here, from every query thread,
+// while the map itself only changes on segment load/release. The map is
+// therefore published as an immutable copy-on-write snapshot: readers load
+// the current snapshot atomically and never take a lock, writers serialize
+// on mutex_, copy the map, modify the copy and publish it. Copying is cheap
+// because the values are shared_ptrs and a node holds a handful of fields.
 class SimpleGeometryCacheManager {
  public:
     static SimpleGeometryCacheManager&
@@ -233,7 +301,9 @@ class SimpleGeometryCacheManager {
         return instance;
     }
 
-    SimpleGeometryCacheManager() = default;
+    SimpleGeometryCacheManager()
+        : caches_(std::make_shared<const CacheMap>()) {
+    }
 
     // Returns a shared_ptr so callers keep the cache alive for the duration of
     // their use even if RemoveCache/RemoveSegmentCaches drops it concurrently.
@@ -241,26 +311,30 @@ class SimpleGeometryCacheManager {
     GetOrCreateCache(uint64_t segment_instance_uid,
                      int64_t segment_id,
                      FieldId field_id) {
-        std::lock_guard<std::mutex> lock(mutex_);
         auto key = MakeCacheKey(segment_instance_uid, segment_id, field_id);
-        auto it = caches_.find(key);
-        if (it != caches_.end()) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto current = std::atomic_load(&caches_);
+        auto it = current->find(key);
+        if (it != current->end()) {
             return it->second;
         }
 
         auto cache = std::make_shared<SimpleGeometryCache>();
-        caches_.emplace(key, cache);
+        auto next = std::make_shared<CacheMap>(*current);
+        next->emplace(std::move(key), cache);
+        std::atomic_store(&caches_, std::shared_ptr<const CacheMap>(next));
         return cache;
     }
 
+    // Lock-free: this is on the per-batch query path.
     std::shared_ptr<SimpleGeometryCache>
     GetCache(uint64_t segment_instance_uid,
              int64_t segment_id,
-             FieldId field_id) {
-        std::lock_guard<std::mutex> lock(mutex_);
-        auto key = MakeCacheKey(segment_instance_uid, segment_id, field_id);
-        auto it = caches_.find(key);
-        if (it != caches_.end()) {
+             FieldId field_id) const {
+        auto current = std::atomic_load(&caches_);
+        auto it = current->find(
+            MakeCacheKey(segment_instance_uid, segment_id, field_id));
+        if (it != current->end()) {
             return it->second;
         }
         return nullptr;
@@ -270,8 +344,15 @@ class SimpleGeometryCacheManager {
     RemoveCache(uint64_t segment_instance_uid,
                 int64_t segment_id,
                 FieldId field_id) {
+        auto key = MakeCacheKey(segment_instance_uid, segment_id, field_id);
         std::lock_guard<std::mutex> lock(mutex_);
-        caches_.erase(MakeCacheKey(segment_instance_uid, segment_id, field_id));
+        auto current = std::atomic_load(&caches_);
+        if (current->find(key) == current->end()) {
+            return;
+        }
+        auto next = std::make_shared<CacheMap>(*current);
+        next->erase(key);
+        std::atomic_store(&caches_, std::shared_ptr<const CacheMap>(next));
     }
 
     // Remove all caches owned by one segment OBJECT -- called from that
@@ -280,18 +361,20 @@ class SimpleGeometryCacheManager {
     // or an older/newer version of the same sealed segment).
     void
     RemoveSegmentCaches(uint64_t segment_instance_uid, int64_t segment_id) {
-        std::lock_guard<std::mutex> lock(mutex_);
         auto segment_prefix =
             MakeSegmentCachePrefix(segment_instance_uid, segment_id);
-        auto it = caches_.begin();
-        while (it != caches_.end()) {
-            if (it->first.substr(0, segment_prefix.length()) ==
-                segment_prefix) {
-                it = caches_.erase(it);
-            } else {
-                ++it;
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto current = std::atomic_load(&caches_);
+        auto next = std::make_shared<CacheMap>();
+        for (const auto& [key, cache] : *current) {
+            if (key.compare(0, segment_prefix.length(), segment_prefix) != 0) {
+                next->emplace(key, cache);
             }
         }
+        if (next->size() == current->size()) {
+            return;
+        }
+        std::atomic_store(&caches_, std::shared_ptr<const CacheMap>(next));
     }
 
     // Get cache statistics for monitoring
@@ -303,10 +386,10 @@ class SimpleGeometryCacheManager {
 
     CacheStats
     GetStats() const {
-        std::lock_guard<std::mutex> lock(mutex_);
+        auto current = std::atomic_load(&caches_);
         CacheStats stats;
-        stats.total_caches = caches_.size();
-        for (const auto& [key, cache] : caches_) {
+        stats.total_caches = current->size();
+        for (const auto& [key, cache] : *current) {
             if (cache->IsLoaded()) {
                 stats.loaded_caches++;
                 stats.total_geometries += cache->Size();
@@ -316,13 +399,16 @@ class SimpleGeometryCacheManager {
     }
 
  private:
+    using CacheMap =
+        std::unordered_map<std::string, std::shared_ptr<SimpleGeometryCache>>;
+
     SimpleGeometryCacheManager(const SimpleGeometryCacheManager&) = delete;
     SimpleGeometryCacheManager&
     operator=(const SimpleGeometryCacheManager&) = delete;
 
-    mutable std::mutex mutex_;
-    std::unordered_map<std::string, std::shared_ptr<SimpleGeometryCache>>
-        caches_;
+    // serializes writers only, readers go through the snapshot
+    std::mutex mutex_;
+    std::shared_ptr<const CacheMap> caches_;
 };
 
 }  // namespace exec
@@ -418,4 +418,89 @@ TEST(GeometryCacheLifetime, OutOfRangeOffsetReturnsNullptrNotThrow) {
     EXPECT_EQ(cache->GetByOffsetUnsafe(1000000), nullptr);
 }
 
+// The bounding-box prefilter must keep every row whose envelope touches the
+// query box (closed intervals) and reject invalid, empty and out-of-range rows
+// exactly like GetByOffsetUnsafe does.
+TEST(GeometryCacheEnvelope, FilterByEnvelope) {
+    milvus::exec::SimpleGeometryCache cache;
+    const std::string inside = MakePointWkb(5.0, 5.0);
+    const std::string outside = MakePointWkb(20.0, 20.0);
+    const std::string on_edge = MakePointWkb(10.0, 3.0);
+    const std::string line = MakeWkbFromWkt("LINESTRING (-5 -5, 1 1)");
+    const std::string corrupt = "not a wkb";
+
+    cache.AppendDataAt(0, inside.data(), inside.size());
+    cache.AppendDataAt(1, outside.data(), outside.size());
+    cache.AppendDataAt(2, on_edge.data(), on_edge.size());
+    cache.AppendDataAt(3, line.data(), line.size());
+    cache.AppendDataAt(4, corrupt.data(), corrupt.size());
+    cache.AppendDataAt(5, nullptr, 0);
+
+    auto ctx = GEOS_init_r();
+    milvus::GeometryEnvelope query;
+    {
+        Geometry box(ctx, "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))");
+        query = milvus::ComputeEnvelope(ctx, box.GetGeometry());
+    }
+    GEOS_finish_r(ctx);
+    ASSERT_FALSE(query.IsEmpty());
+
+    std::vector<int64_t> offsets{0, 1, 2, 3, 4, 5, 6, 1000};
+    std::vector<uint8_t> out(offsets.size(), 7);
+    {
+        auto lock = cache.AcquireReadLock();
+        cache.FilterByEnvelopeUnsafe(
+            offsets.data(), offsets.size(), query, out.data());
+    }
+    std::vector<uint8_t> expected{1, 0, 1, 1, 0, 0, 0, 0};
+    EXPECT_EQ(out, expected);
+
+    // an empty query box matches nothing
+    std::vector<uint8_t> none(offsets.size(), 7);
+    {
+        auto lock = cache.AcquireReadLock();
+        cache.FilterByEnvelopeUnsafe(offsets.data(),
+                                     offsets.size(),
+                                     milvus::GeometryEnvelope(),
+                                     none.data());
+    }
+    EXPECT_EQ(none, std::vector<uint8_t>(offsets.size(), 0));
+}
+
+// Readers go through the published snapshot without the writers' lock:
+// lookups racing with creation and removal of other entries must always see
+// their own, stable entry.
+TEST(GeometryCacheLifetime, SnapshotReadsRaceWithWriters) {
+    auto& mgr = SimpleGeometryCacheManager::Instance();
+    const int64_t seg_id = 900000011;
+    const FieldId field_id(31);
+    auto cache = mgr.GetOrCreateCache(kInstanceA, seg_id, field_id);
+
+    std::atomic<bool> stop{false};
+    std::atomic<int64_t> misses{0};
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([&]() {
+            while (!stop.load()) {
+                if (mgr.GetCache(kInstanceA, seg_id, field_id) != cache) {
+                    misses.fetch_add(1);
+                }
+            }
+        });
+    }
+    for (int i = 0; i < 200; ++i) {
+        const int64_t other_seg = seg_id + 1 + i;
+        mgr.GetOrCreateCache(kInstanceB, other_seg, field_id);
+        mgr.RemoveSegmentCaches(kInstanceB, other_seg);
+    }
+    stop.store(true);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    EXPECT_EQ(misses.load(), 0);
+
+    mgr.RemoveCache(kInstanceA, seg_id, field_id);
+    EXPECT_EQ(mgr.GetCache(kInstanceA, seg_id, field_id), nullptr);
+}
+
 }  // namespace
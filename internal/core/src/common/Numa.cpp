@@ -0,0 +1,244 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/Numa.h"
+
+#ifdef __linux__
+#include <linux/mempolicy.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <unordered_set>
+
+#include "common/Common.h"
+#include "fmt/core.h"
+#include "fmt/ranges.h"
+#include "log/Log.h"
+
+namespace milvus {
+
+namespace {
+
+thread_local int current_numa_node = -1;
+
+std::vector<int>
+AllowedCpus() {
+    std::vector<int> cpus;
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+            if (CPU_ISSET(cpu, &set)) {
+                cpus.push_back(cpu);
+            }
+        }
+    }
+#endif
+    return cpus;
+}
+
+}  // namespace
+
+std::vector<int>
+ParseCpuList(const std::string& cpu_list) {
+    std::vector<int> cpus;
+    std::stringstream ss(cpu_list);
+    std::string range;
+    while (std::getline(ss, range, ',')) {
+        range.erase(std::remove_if(range.begin(), range.end(), ::isspace),
+                    range.end());
+        if (range.empty()) {
+            continue;
+        }
+        try {
+            auto dash = range.find('-');
+            if (dash == std::string::npos) {
+                cpus.push_back(std::stoi(range));
+                continue;
+            }
+            auto first = std::stoi(range.substr(0, dash));
+            auto last = std::stoi(range.substr(dash + 1));
+            for (auto cpu = first; cpu <= last; cpu++) {
+                cpus.push_back(cpu);
+            }
+        } catch (const std::exception&) {
+            LOG_WARN(
+                "ignore malformed cpu range '{}' in '{}'", range, cpu_list);
+        }
+    }
+    return cpus;
+}
+
+NumaTopology
+NumaTopology::Load(const std::string& sysfs_node_dir,
+                   const std::vector<int>& allowed_cpus) {
+    namespace fs = std::filesystem;
+    std::unordered_set<int> allowed(allowed_cpus.begin(), allowed_cpus.end());
+    std::vector<NumaNode> nodes;
+    std::error_code ec;
+    for (fs::directory_iterator it(sysfs_node_dir, ec), end; !ec && it != end;
+         it.increment(ec)) {
+        auto name = it->path().filename().string();
+        if (name.size() <= 4 || name.compare(0, 4, "node") != 0 ||
+            !std::all_of(name.begin() + 4, name.end(), ::isdigit)) {
+            continue;
+        }
+        std::ifstream file(it->path() / "cpulist");
+        std::string cpu_list;
+        if (!std::getline(file, cpu_list)) {
+            continue;
+        }
+        NumaNode node{std::stoi(name.substr(4)), {}};
+        for (auto cpu : ParseCpuList(cpu_list)) {
+            if (allowed.empty() || allowed.count(cpu) > 0) {
+                node.cpus.push_back(cpu);
+            }
+        }
+        // memory only nodes, or nodes outside our cpuset, run no workers
+        if (!node.cpus.empty()) {
+            nodes.push_back(std::move(node));
+        }
+    }
+    std::sort(nodes.begin(), nodes.end(), [](const auto& a, const auto& b) {
+        return a.id < b.id;
+    });
+    return NumaTopology(std::move(nodes));
+}
+
+const NumaTopology&
+NumaTopology::GetInstance() {
+    static const NumaTopology topology = [] {
+        auto topology = Load("/sys/devices/system/node", AllowedCpus());
+        for (int i = 0; i < topology.num_nodes(); i++) {
+            LOG_INFO("numa node {} has cpus [{}]",
+                     topology.node(i).id,
+                     fmt::join(topology.node(i).cpus, ","));
+        }
+        return topology;
+    }();
+    return topology;
+}
+
+int
+NumaTopology::HomeNode(int64_t segment_id) const {
+    if (!multi_node()) {
+        return -1;
+    }
+    // segment ids are allocated in ascending blocks, mix them before taking
+    // the remainder
+    auto x = static_cast<uint64_t>(segment_id);
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    return static_cast<int>(x % nodes_.size());
+}
+
+int
+HomeNumaNode(int64_t segment_id) {
+    if (!NUMA_AWARE_EXECUTOR_ENABLED.load(std::memory_order_relaxed)) {
+        return -1;
+    }
+    return NumaTopology::GetInstance().HomeNode(segment_id);
+}
+
+int
+CurrentNumaNode() {
+    return current_numa_node;
+}
+
+NumaNodeScope::NumaNodeScope(int node)
+    : prev_node_(current_numa_node), active_(node >= 0) {
+    if (active_) {
+        current_numa_node = node;
+    }
+}
+
+NumaNodeScope::~NumaNodeScope() {
+    if (active_) {
+        current_numa_node = prev_node_;
+    }
+}
+
+bool
+BindMemoryToNumaNode(void* addr, size_t size, int node) {
+#ifdef __linux__
+    const auto& topology = NumaTopology::GetInstance();
+    if (node < 0 || node >= topology.num_nodes()) {
+        return false;
+    }
+    constexpr size_t kBitsPerWord = sizeof(unsigned long) * 8;
+    auto id = static_cast<size_t>(topology.node(node).id);
+    std::vector<unsigned long> mask(id / kBitsPerWord + 1, 0);
+    mask[id / kBitsPerWord] |= 1UL << (id % kBitsPerWord);
+    // the kernel reads one bit less than maxnode
+    if (syscall(SYS_mbind,
+                addr,
+                size,
+                MPOL_PREFERRED,
+                mask.data(),
+                mask.size() * kBitsPerWord + 1,
+                0) != 0) {
+        LOG_WARN("failed to bind {} bytes to numa node {}: {}",
+                 size,
+                 topology.node(node).id,
+                 strerror(errno));
+        return false;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+bool
+PinThreadToNumaNode(int node) {
+#ifdef __linux__
+    const auto& topology = NumaTopology::GetInstance();
+    if (node < 0 || node >= topology.num_nodes()) {
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (auto cpu : topology.node(node).cpus) {
+        if (cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &set);
+        }
+    }
+    auto ret = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    if (ret != 0) {
+        LOG_WARN("failed to pin thread to numa node {}: {}",
+                 topology.node(node).id,
+                 strerror(ret));
+        return false;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+}  // namespace milvus
@@ -0,0 +1,124 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace milvus {
+
+// NUMA placement of sealed segments.
+//
+// With NUMA_AWARE_EXECUTOR_ENABLED on a machine with more than one NUMA node,
+// every sealed segment gets a home node (see HomeNumaNode()): its chunks are
+// allocated on that node, and the search and load work on the segment runs on
+// executors pinned to the node's CPUs. On a single node machine, or with the
+// flag off, HomeNumaNode() is -1 and nothing is placed.
+//
+// A node below is the index of the node in NumaTopology, not the kernel node
+// id, which may have gaps.
+
+struct NumaNode {
+    // kernel node id
+    int id;
+    // CPUs of the node this process may run on
+    std::vector<int> cpus;
+};
+
+class NumaTopology {
+ public:
+    // Topology of this machine, read once from sysfs.
+    static const NumaTopology&
+    GetInstance();
+
+    // Read the nodes under `sysfs_node_dir`, keeping the nodes with a CPU in
+    // `allowed_cpus`. An empty `allowed_cpus` allows every CPU.
+    static NumaTopology
+    Load(const std::string& sysfs_node_dir,
+         const std::vector<int>& allowed_cpus);
+
+    explicit NumaTopology(std::vector<NumaNode> nodes)
+        : nodes_(std::move(nodes)) {
+    }
+
+    int
+    num_nodes() const {
+        return static_cast<int>(nodes_.size());
+    }
+
+    const NumaNode&
+    node(int node) const {
+        return nodes_.at(node);
+    }
+
+    bool
+    multi_node() const {
+        return nodes_.size() > 1;
+    }
+
+    // Home node of a segment, or -1 on a single node machine.
+    int
+    HomeNode(int64_t segment_id) const;
+
+ private:
+    std::vector<NumaNode> nodes_;
+};
+
+// Parse a sysfs cpu list like "0-3,8,10-11".
+std::vector<int>
+ParseCpuList(const std::string& cpu_list);
+
+// Home node of a segment, or -1 when NUMA placement is off.
+int
+HomeNumaNode(int64_t segment_id);
+
+// Node the allocations of this thread are placed on, or -1 for the default
+// policy. See NumaNodeScope.
+int
+CurrentNumaNode();
+
+// Place the allocations of this thread on `node` while in scope. A negative
+// node leaves the placement unchanged.
+class NumaNodeScope {
+ public:
+    explicit NumaNodeScope(int node);
+
+    ~NumaNodeScope();
+
+    NumaNodeScope(const NumaNodeScope&) = delete;
+    NumaNodeScope&
+    operator=(const NumaNodeScope&) = delete;
+
+ private:
+    int prev_node_;
+    bool active_;
+};
+
+// Prefer `node` for the pages of [addr, addr + size) not faulted in yet. The
+// range must be page aligned. Returns false when the kernel refused, in which
+// case the default policy applies.
+bool
+BindMemoryToNumaNode(void* addr, size_t size, int node);
+
+// Restrict the calling thread to the CPUs of `node`.
+bool
+PinThreadToNumaNode(int node);
+
+}  // namespace milvus
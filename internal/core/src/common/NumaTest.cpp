@@ -0,0 +1,125 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/Numa.h"
+
+#include <gtest/gtest.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "common/ChunkTarget.h"
+
+namespace milvus {
+
+namespace {
+
+namespace fs = std::filesystem;
+
+void
+WriteNode(const fs::path& root, const std::string& name, const char* cpus) {
+    fs::create_directories(root / name);
+    std::ofstream(root / name / "cpulist") << cpus << "\n";
+}
+
+}  // namespace
+
+TEST(Numa, ParseCpuList) {
+    EXPECT_EQ(ParseCpuList("0-3,8,10-11"),
+              (std::vector<int>{0, 1, 2, 3, 8, 10, 11}));
+    EXPECT_EQ(ParseCpuList("5"), (std::vector<int>{5}));
+    EXPECT_TRUE(ParseCpuList("").empty());
+    // a memory only node has an empty list
+    EXPECT_TRUE(ParseCpuList("\n").empty());
+    EXPECT_EQ(ParseCpuList("x,2"), (std::vector<int>{2}));
+}
+
+TEST(Numa, LoadTopology) {
+    auto root = fs::temp_directory_path() /
+                ("numa_test_" + std::to_string(getpid()));
+    fs::remove_all(root);
+    WriteNode(root, "node0", "0-3");
+    WriteNode(root, "node2", "4-7");
+    WriteNode(root, "node3", "");
+    fs::create_directories(root / "power");
+
+    auto topology = NumaTopology::Load(root.string(), {});
+    ASSERT_EQ(topology.num_nodes(), 2);
+    EXPECT_TRUE(topology.multi_node());
+    EXPECT_EQ(topology.node(0).id, 0);
+    EXPECT_EQ(topology.node(1).id, 2);
+    EXPECT_EQ(topology.node(1).cpus, (std::vector<int>{4, 5, 6, 7}));
+
+    // a cpuset inside one node leaves a single node machine
+    auto restricted = NumaTopology::Load(root.string(), {1, 2});
+    ASSERT_EQ(restricted.num_nodes(), 1);
+    EXPECT_EQ(restricted.node(0).cpus, (std::vector<int>{1, 2}));
+    EXPECT_FALSE(restricted.multi_node());
+    EXPECT_EQ(restricted.HomeNode(42), -1);
+
+    EXPECT_EQ(NumaTopology::Load((root / "missing").string(), {}).num_nodes(),
+              0);
+    fs::remove_all(root);
+}
+
+TEST(Numa, HomeNodeSpreadsSegments) {
+    NumaTopology topology({{0, {0, 1}}, {1, {2, 3}}});
+    std::vector<int> segments_per_node(2, 0);
+    // consecutive ids, as allocated for the segments of one collection
+    for (int64_t segment_id = 1000; segment_id < 1400; segment_id++) {
+        auto node = topology.HomeNode(segment_id);
+        ASSERT_TRUE(node == 0 || node == 1);
+        EXPECT_EQ(node, topology.HomeNode(segment_id));
+        segments_per_node[node]++;
+    }
+    EXPECT_GT(segments_per_node[0], 150);
+    EXPECT_GT(segments_per_node[1], 150);
+}
+
+TEST(Numa, NodeScopeNests) {
+    EXPECT_EQ(CurrentNumaNode(), -1);
+    {
+        NumaNodeScope outer(1);
+        EXPECT_EQ(CurrentNumaNode(), 1);
+        {
+            NumaNodeScope keep(-1);
+            EXPECT_EQ(CurrentNumaNode(), 1);
+            NumaNodeScope inner(0);
+            EXPECT_EQ(CurrentNumaNode(), 0);
+        }
+        EXPECT_EQ(CurrentNumaNode(), 1);
+    }
+    EXPECT_EQ(CurrentNumaNode(), -1);
+}
+
+TEST(Numa, MemChunkTargetOnNode) {
+    // binding is best effort, the target works whatever the machine
+    NumaNodeScope scope(0);
+    const size_t cap = 3 * 4096;
+    MemChunkTarget target(cap);
+    std::vector<char> data(cap, 'x');
+    target.write(data.data(), data.size());
+    auto buf = target.release();
+    EXPECT_EQ(std::memcmp(buf, data.data(), cap), 0);
+    munmap(buf, cap);
+}
+
+}  // namespace milvus
@@ -0,0 +1,495 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/PersistentChunkFile.h"
+
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <mutex>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#include "cachinglayer/Manager.h"
+#include "common/Common.h"
+#include "fmt/core.h"
+#include "log/Log.h"
+#include "storage/Crc32cUtil.h"
+#include "xxhash.h"
+
+namespace milvus {
+
+namespace {
+
+constexpr const char* kPersistentChunkDirName = "persistent_chunks";
+constexpr const char* kChunkFileSuffix = ".chunk";
+constexpr const char* kTempFileSuffix = ".tmp";
+// A temporary file untouched for this long belongs to a dead writer.
+constexpr auto kStaleTempFileAge = std::chrono::minutes(10);
+
+uint32_t
+TrailerCrc(const PersistentChunkEntry* entries,
+           size_t num_entries,
+           const PersistentChunkTrailer& trailer) {
+    auto crc = storage::Crc32cValue(entries,
+                                    num_entries * sizeof(PersistentChunkEntry));
+    return storage::Crc32cUpdate(
+        crc, &trailer, offsetof(PersistentChunkTrailer, trailer_crc));
+}
+
+bool
+PreadFully(int fd, void* buf, size_t size, off_t offset) {
+    auto out = static_cast<char*>(buf);
+    while (size > 0) {
+        auto n = ::pread(fd, out, size, offset);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        out += n;
+        size -= n;
+        offset += n;
+    }
+    return true;
+}
+
+bool
+EndsWith(const std::string& s, const char* suffix) {
+    auto n = std::strlen(suffix);
+    return s.size() >= n && s.compare(s.size() - n, n, suffix) == 0;
+}
+
+// What this process knows about a chunk file.
+struct PersistentChunkFileState {
+    // live mmap guards of the file
+    int mappings = 0;
+    // charged to the caching layer while no guard maps the file
+    int64_t idle_bytes = 0;
+    // identity of the file when its payload CRC was checked
+    bool verified = false;
+    ino_t verified_ino = 0;
+    off_t verified_size = 0;
+};
+
+struct PersistentChunkFiles {
+    std::mutex mutex;
+    std::unordered_map<std::string, PersistentChunkFileState> states;
+};
+
+// leaked, mmap guards may outlive static destruction
+PersistentChunkFiles&
+Files() {
+    static auto* files = new PersistentChunkFiles();
+    return *files;
+}
+
+void
+ChargeIdleBytes(int64_t delta) {
+    if (delta > 0) {
+        cachinglayer::Manager::GetInstance().ChargeLoadedResource(
+            cachinglayer::ResourceUsage{0, delta});
+    } else if (delta < 0) {
+        cachinglayer::Manager::GetInstance().RefundLoadedResource(
+            cachinglayer::ResourceUsage{0, -delta});
+    }
+}
+
+// Unlink `path` and drop its state, returns whether the file was removed.
+bool
+RemoveFile(const std::string& path) {
+    auto removed = ::unlink(path.c_str()) == 0;
+    int64_t refund = 0;
+    {
+        auto& files = Files();
+        std::lock_guard<std::mutex> lock(files.mutex);
+        auto it = files.states.find(path);
+        if (it != files.states.end()) {
+            refund = it->second.idle_bytes;
+            if (it->second.mappings > 0) {
+                it->second.idle_bytes = 0;
+                it->second.verified = false;
+            } else {
+                files.states.erase(it);
+            }
+        }
+    }
+    ChargeIdleBytes(-refund);
+    return removed;
+}
+
+// Charge a file no guard of this process has mapped yet, e.g. one left by an
+// earlier process.
+void
+AdoptIdleFile(const std::string& path, uint64_t size) {
+    {
+        auto& files = Files();
+        std::lock_guard<std::mutex> lock(files.mutex);
+        auto [it, inserted] = files.states.try_emplace(path);
+        if (!inserted) {
+            return;
+        }
+        it->second.idle_bytes = static_cast<int64_t>(size);
+    }
+    ChargeIdleBytes(static_cast<int64_t>(size));
+}
+
+}  // namespace
+
+uint64_t
+PersistentChunkSchemaHash(const std::vector<FieldMeta>& field_metas) {
+    std::vector<int64_t> words;
+    words.reserve(field_metas.size() * 5);
+    for (const auto& field_meta : field_metas) {
+        auto data_type = field_meta.get_data_type();
+        words.push_back(field_meta.get_id().get());
+        words.push_back(static_cast<int64_t>(data_type));
+        words.push_back(static_cast<int64_t>(field_meta.get_element_type()));
+        words.push_back(field_meta.is_nullable());
+        words.push_back(IsVectorDataType(data_type) &&
+                                !IsSparseFloatVectorDataType(data_type)
+                            ? field_meta.get_dim()
+                            : 0);
+    }
+    return XXH64(words.data(), words.size() * sizeof(int64_t), 0);
+}
+
+uint64_t
+PersistentChunkSourceHash(const std::vector<std::string>& parts) {
+    std::string joined;
+    for (const auto& part : parts) {
+        // the terminator keeps {"ab", "c"} apart from {"a", "bc"}
+        joined.append(part);
+        joined.push_back('\0');
+    }
+    return XXH64(joined.data(), joined.size(), 0);
+}
+
+std::string
+PersistentChunkDir(const std::string& mmap_dir) {
+    auto dir = (std::filesystem::path(mmap_dir) / kPersistentChunkDirName)
+                   .string();
+    std::filesystem::create_directories(dir);
+
+    static std::mutex mutex;
+    static std::unordered_set<std::string> pruned;
+    bool first_use = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        first_use = pruned.insert(dir).second;
+    }
+    if (first_use) {
+        // drop the files a previous process left beyond the limit
+        PrunePersistentChunkFiles(dir, PERSISTENT_CHUNK_FILE_DISK_LIMIT.load());
+    }
+    return dir;
+}
+
+std::string
+PersistentChunkFilePath(const std::string& dir, const PersistentChunkKey& key) {
+    return (std::filesystem::path(dir) /
+            fmt::format("seg_{}_fid_{}_{}_{:016x}{}",
+                        key.segment_id,
+                        key.field_id,
+                        key.cell_id,
+                        key.source_hash,
+                        kChunkFileSuffix))
+        .string();
+}
+
+std::string
+EncodePersistentChunkTrailer(const PersistentChunkKey& key,
+                             uint64_t schema_hash,
+                             const std::vector<PersistentChunkEntry>& entries,
+                             uint64_t payload_size,
+                             uint64_t row_nums,
+                             uint32_t payload_crc) {
+    PersistentChunkTrailer trailer{};
+    trailer.magic = PersistentChunkTrailer::kMagic;
+    trailer.layout_version = kPersistentChunkLayoutVersion;
+    trailer.num_entries = static_cast<uint32_t>(entries.size());
+    trailer.schema_hash = schema_hash;
+    trailer.segment_id = key.segment_id;
+    trailer.field_id = key.field_id;
+    trailer.cell_id = key.cell_id;
+    trailer.source_hash = key.source_hash;
+    trailer.payload_size = payload_size;
+    trailer.row_nums = row_nums;
+    trailer.payload_crc = payload_crc;
+    trailer.trailer_crc = TrailerCrc(entries.data(), entries.size(), trailer);
+
+    std::string out;
+    auto entries_bytes = entries.size() * sizeof(PersistentChunkEntry);
+    out.resize(entries_bytes + sizeof(trailer));
+    std::memcpy(out.data(), entries.data(), entries_bytes);
+    std::memcpy(out.data() + entries_bytes, &trailer, sizeof(trailer));
+    return out;
+}
+
+std::optional<PersistentChunkLayout>
+ReadPersistentChunkLayout(int fd,
+                          const PersistentChunkKey& key,
+                          std::string& error) {
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+        error = fmt::format("fstat failed: {}", strerror(errno));
+        return std::nullopt;
+    }
+    auto file_size = static_cast<uint64_t>(st.st_size);
+    PersistentChunkLayout layout;
+    auto& trailer = layout.trailer;
+    if (file_size < sizeof(trailer) ||
+        !PreadFully(
+            fd, &trailer, sizeof(trailer), file_size - sizeof(trailer))) {
+        error = "truncated trailer";
+        return std::nullopt;
+    }
+    if (trailer.magic != PersistentChunkTrailer::kMagic) {
+        error = "bad magic";
+        return std::nullopt;
+    }
+    if (trailer.layout_version != kPersistentChunkLayoutVersion) {
+        error = fmt::format("layout version {} but expected {}",
+                            trailer.layout_version,
+                            kPersistentChunkLayoutVersion);
+        return std::nullopt;
+    }
+    auto entries_bytes = static_cast<uint64_t>(trailer.num_entries) *
+                         sizeof(PersistentChunkEntry);
+    if (trailer.payload_size > file_size ||
+        file_size - trailer.payload_size != entries_bytes + sizeof(trailer)) {
+        error = fmt::format(
+            "file size {} doesn't match payload {} and {} entries",
+            file_size,
+            trailer.payload_size,
+            trailer.num_entries);
+        return std::nullopt;
+    }
+    layout.entries.resize(trailer.num_entries);
+    if (!PreadFully(
+            fd, layout.entries.data(), entries_bytes, trailer.payload_size)) {
+        error = "truncated entries";
+        return std::nullopt;
+    }
+    if (TrailerCrc(layout.entries.data(), layout.entries.size(), trailer) !=
+        trailer.trailer_crc) {
+        error = "trailer checksum mismatch";
+        return std::nullopt;
+    }
+    if (trailer.segment_id != key.segment_id ||
+        trailer.field_id != key.field_id || trailer.cell_id != key.cell_id ||
+        trailer.source_hash != key.source_hash) {
+        error = fmt::format(
+            "written for segment {} field {} cell {} source {:016x}",
+            trailer.segment_id,
+            trailer.field_id,
+            trailer.cell_id,
+            trailer.source_hash);
+        return std::nullopt;
+    }
+    return layout;
+}
+
+bool
+IsPersistentChunkPayloadVerified(const std::string& path,
+                                 const struct stat& st) {
+    auto& files = Files();
+    std::lock_guard<std::mutex> lock(files.mutex);
+    auto it = files.states.find(path);
+    return it != files.states.end() && it->second.verified &&
+           it->second.verified_ino == st.st_ino &&
+           it->second.verified_size == st.st_size;
+}
+
+void
+MarkPersistentChunkPayloadVerified(const std::string& path,
+                                   const struct stat& st) {
+    auto& files = Files();
+    std::lock_guard<std::mutex> lock(files.mutex);
+    auto& state = files.states[path];
+    state.verified = true;
+    state.verified_ino = st.st_ino;
+    state.verified_size = st.st_size;
+}
+
+void
+NotePersistentChunkFileMapped(const std::string& path) {
+    int64_t refund = 0;
+    {
+        auto& files = Files();
+        std::lock_guard<std::mutex> lock(files.mutex);
+        auto& state = files.states[path];
+        state.mappings++;
+        refund = std::exchange(state.idle_bytes, 0);
+    }
+    ChargeIdleBytes(-refund);
+}
+
+void
+NotePersistentChunkFileUnmapped(const std::string& path) {
+    int64_t charge = 0;
+    {
+        auto& files = Files();
+        std::lock_guard<std::mutex> lock(files.mutex);
+        auto it = files.states.find(path);
+        if (it == files.states.end() || --it->second.mappings > 0) {
+            return;
+        }
+        struct stat st;
+        if (::stat(path.c_str(), &st) != 0) {
+            // removed while mapped
+            files.states.erase(it);
+            return;
+        }
+        charge = st.st_size;
+        it->second.idle_bytes = charge;
+    }
+    ChargeIdleBytes(charge);
+}
+
+void
+RemovePersistentChunkFile(const std::string& path) {
+    RemoveFile(path);
+}
+
+void
+RemoveSegmentPersistentChunkFiles(const std::string& mmap_dir,
+                                  int64_t segment_id) {
+    namespace fs = std::filesystem;
+    auto dir = fs::path(mmap_dir) / kPersistentChunkDirName;
+    auto prefix = fmt::format("seg_{}_fid_", segment_id);
+    std::vector<std::string> paths;
+    std::error_code ec;
+    for (fs::directory_iterator it(dir, ec), end; !ec && it != end;
+         it.increment(ec)) {
+        auto name = it->path().filename().string();
+        if (name.compare(0, prefix.size(), prefix) == 0 &&
+            EndsWith(name, kChunkFileSuffix)) {
+            paths.push_back(it->path().string());
+        }
+    }
+    size_t removed = 0;
+    for (const auto& path : paths) {
+        removed += RemoveFile(path);
+    }
+    if (removed > 0) {
+        LOG_INFO("removed {} persistent chunk files of segment {} under {}",
+                 removed,
+                 segment_id,
+                 dir.string());
+    }
+}
+
+void
+NotePersistentChunkFileWritten(const std::string& path, int64_t bytes) {
+    {
+        auto& files = Files();
+        std::lock_guard<std::mutex> lock(files.mutex);
+        auto it = files.states.find(path);
+        if (it != files.states.end()) {
+            it->second.verified = false;
+        }
+    }
+    auto dir = std::filesystem::path(path).parent_path().string();
+    static std::mutex mutex;
+    static std::unordered_map<std::string, int64_t> written_since_prune;
+    auto limit = PERSISTENT_CHUNK_FILE_DISK_LIMIT.load();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto& written = written_since_prune[dir];
+        written += bytes;
+        if (written < std::max<int64_t>(limit / 8, 1)) {
+            return;
+        }
+        written = 0;
+    }
+    PrunePersistentChunkFiles(dir, limit);
+}
+
+void
+PrunePersistentChunkFiles(const std::string& dir, int64_t limit_bytes) {
+    namespace fs = std::filesystem;
+    // (last write, size, path) of every chunk file
+    std::vector<std::tuple<fs::file_time_type, uint64_t, fs::path>>
+        chunk_files;
+    uint64_t total_bytes = 0;
+    auto now = fs::file_time_type::clock::now();
+    std::error_code ec;
+    for (fs::directory_iterator it(dir, ec), end; !ec && it != end;
+         it.increment(ec)) {
+        std::error_code entry_ec;
+        if (!it->is_regular_file(entry_ec)) {
+            continue;
+        }
+        auto name = it->path().filename().string();
+        auto mtime = it->last_write_time(entry_ec);
+        if (entry_ec) {
+            continue;
+        }
+        if (EndsWith(name, kTempFileSuffix)) {
+            if (now - mtime > kStaleTempFileAge) {
+                fs::remove(it->path(), entry_ec);
+            }
+            continue;
+        }
+        if (!EndsWith(name, kChunkFileSuffix)) {
+            continue;
+        }
+        auto size = it->file_size(entry_ec);
+        if (entry_ec) {
+            continue;
+        }
+        chunk_files.emplace_back(mtime, size, it->path());
+        total_bytes += size;
+    }
+    if (ec) {
+        LOG_WARN("list persistent chunk files under {} failed: {}",
+                 dir,
+                 ec.message());
+        return;
+    }
+
+    auto limit = static_cast<uint64_t>(std::max<int64_t>(limit_bytes, 0));
+    std::sort(chunk_files.begin(), chunk_files.end());
+    size_t removed = 0;
+    uint64_t removed_bytes = 0;
+    for (const auto& [mtime, size, path] : chunk_files) {
+        if (total_bytes - removed_bytes > limit && RemoveFile(path.string())) {
+            removed++;
+            removed_bytes += size;
+        } else {
+            AdoptIdleFile(path.string(), size);
+        }
+    }
+    if (removed == 0) {
+        return;
+    }
+    LOG_INFO(
+        "pruned {} persistent chunk files of {} bytes under {}, {} bytes left",
+        removed,
+        removed_bytes,
+        dir,
+        total_bytes - removed_bytes);
+}
+
+}  // namespace milvus
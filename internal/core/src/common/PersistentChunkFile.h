@@ -0,0 +1,178 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <sys/stat.h>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "common/FieldMeta.h"
+
+namespace milvus {
+
+// Persistent chunk files.
+//
+// A file-backed chunk is a scratch file of the loading process: it is written
+// when a cache cell loads and unlinked when the cell is released, so a
+// restarted node fetches and decodes every binlog again. With
+// PERSISTENT_CHUNK_FILE_ENABLED, sealed chunk cells are written to files that
+// describe what they hold instead, and a later load of the same cell, in a
+// restarted process or after the cell was evicted, validates the file and maps
+// it directly.
+//
+// A file is laid out as
+//
+//   [payload][PersistentChunkEntry]*[PersistentChunkTrailer]
+//
+// The payload holds the chunks of the cell exactly like a regular mmap chunk
+// file, every chunk starting at a ChunkTarget::ALIGNED_SIZE boundary. The
+// entries list field id and raw size of each chunk in payload order. The
+// trailer goes last so the payload maps at offset 0 whatever the page size of
+// the reading process. Files are written under a temporary name and renamed
+// into place, so a reader never sees a partial file and a file is never
+// truncated under a live mapping.
+//
+// The files of a segment are removed when the node releases the segment, not
+// when it shuts down, see RemoveSegmentPersistentChunkFiles(). A file no cell
+// maps is charged to the disk resource of the caching layer, a mapped one is
+// already part of the disk usage of its cell.
+
+// Bump whenever a chunk writer changes the byte layout of its chunks.
+constexpr uint32_t kPersistentChunkLayoutVersion = 1;
+
+// A file is only reused when every member matches.
+struct PersistentChunkKey {
+    int64_t segment_id = 0;
+    // field id, or column group id for group chunks
+    int64_t field_id = 0;
+    int64_t cell_id = 0;
+    // identity of the data the cell is decoded from, see
+    // PersistentChunkSourceHash()
+    uint64_t source_hash = 0;
+};
+
+struct PersistentChunkEntry {
+    int64_t field_id;
+    uint64_t size;
+};
+static_assert(sizeof(PersistentChunkEntry) == 16);
+
+struct PersistentChunkTrailer {
+    static constexpr uint64_t kMagic = 0x4b4e4843534c564dULL;  // "MVLSCHNK"
+
+    uint64_t magic;
+    uint32_t layout_version;
+    uint32_t num_entries;
+    uint64_t schema_hash;
+    int64_t segment_id;
+    int64_t field_id;
+    int64_t cell_id;
+    uint64_t source_hash;
+    uint64_t payload_size;
+    uint64_t row_nums;
+    // CRC32C of the payload
+    uint32_t payload_crc;
+    // CRC32C of the entries and of the trailer up to this member
+    uint32_t trailer_crc;
+};
+static_assert(sizeof(PersistentChunkTrailer) == 80);
+
+struct PersistentChunkLayout {
+    PersistentChunkTrailer trailer;
+    std::vector<PersistentChunkEntry> entries;
+};
+
+// Hash of the field properties that decide the byte layout of their chunks.
+uint64_t
+PersistentChunkSchemaHash(const std::vector<FieldMeta>& field_metas);
+
+// Hash of the strings naming the source of a cell, e.g. its binlog paths and
+// row group range.
+uint64_t
+PersistentChunkSourceHash(const std::vector<std::string>& parts);
+
+// Directory of the persistent chunk files under `mmap_dir`. It is created on
+// demand, and pruned to PERSISTENT_CHUNK_FILE_DISK_LIMIT on its first use in
+// this process.
+std::string
+PersistentChunkDir(const std::string& mmap_dir);
+
+std::string
+PersistentChunkFilePath(const std::string& dir, const PersistentChunkKey& key);
+
+// Entries and trailer to append to a payload.
+std::string
+EncodePersistentChunkTrailer(const PersistentChunkKey& key,
+                             uint64_t schema_hash,
+                             const std::vector<PersistentChunkEntry>& entries,
+                             uint64_t payload_size,
+                             uint64_t row_nums,
+                             uint32_t payload_crc);
+
+// Read and check the entries and trailer of the file open as `fd` against
+// `key`. Returns std::nullopt with the reason in `error` when the file can't
+// be reused; the payload CRC is left to the caller, which maps the payload
+// anyway.
+std::optional<PersistentChunkLayout>
+ReadPersistentChunkLayout(int fd,
+                          const PersistentChunkKey& key,
+                          std::string& error);
+
+// Whether this process already checked the payload CRC of the file at `path`,
+// identified by `st`. The payload of a file is checked on its first open in a
+// process only, later loads of the cell just map it.
+bool
+IsPersistentChunkPayloadVerified(const std::string& path,
+                                 const struct stat& st);
+
+void
+MarkPersistentChunkPayloadVerified(const std::string& path,
+                                   const struct stat& st);
+
+// Called by the mmap guard of a persistent chunk file. While no mapping of a
+// file is left, its size is charged to the disk resource of the caching layer.
+void
+NotePersistentChunkFileMapped(const std::string& path);
+
+void
+NotePersistentChunkFileUnmapped(const std::string& path);
+
+// Unlink the file at `path` and forget about it.
+void
+RemovePersistentChunkFile(const std::string& path);
+
+// Remove the persistent chunk files of `segment_id` under `mmap_dir`, if any.
+void
+RemoveSegmentPersistentChunkFiles(const std::string& mmap_dir,
+                                  int64_t segment_id);
+
+// Account the `bytes` of the file just renamed to `path`, and prune its
+// directory once an eighth of the disk limit was written since the last prune.
+// The payload of the new file is checked again on its next open.
+void
+NotePersistentChunkFileWritten(const std::string& path, int64_t bytes);
+
+// Remove stale temporary files under `dir`, then the least recently used chunk
+// files until the rest fits `limit_bytes`. Removing a mapped file is safe, the
+// mapping keeps the data until it is released. Files left by an earlier process
+// are charged to the caching layer like any other file no cell maps.
+void
+PrunePersistentChunkFiles(const std::string& dir, int64_t limit_bytes);
+
+}  // namespace milvus
@@ -0,0 +1,270 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "common/PersistentChunkFile.h"
+
+#include <arrow/api.h>
+#include <gtest/gtest.h>
+#include <unistd.h>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common/Chunk.h"
+#include "common/ChunkWriter.h"
+#include "common/FieldMeta.h"
+#include "common/Types.h"
+
+namespace milvus {
+namespace {
+
+namespace fs = std::filesystem;
+
+const PersistentChunkKey kKey{1, 100, 3, 0xfeed};
+
+FieldMeta
+Int64Field(int64_t id, bool nullable = false) {
+    return FieldMeta(FieldName("f" + std::to_string(id)),
+                     FieldId(id),
+                     DataType::INT64,
+                     nullable,
+                     std::nullopt);
+}
+
+arrow::ArrayVector
+Int64Values(int64_t begin, int64_t end) {
+    arrow::Int64Builder builder;
+    for (auto v = begin; v < end; v++) {
+        EXPECT_TRUE(builder.Append(v).ok());
+    }
+    return {*builder.Finish()};
+}
+
+void
+ExpectValues(const Chunk& chunk, int64_t begin, int64_t end) {
+    auto span = static_cast<const FixedWidthChunk&>(chunk).Span();
+    ASSERT_EQ(span.row_count(), end - begin);
+    auto data = static_cast<const int64_t*>(span.data());
+    for (auto v = begin; v < end; v++) {
+        EXPECT_EQ(data[v - begin], v);
+    }
+}
+
+class PersistentChunkFileTest : public testing::Test {
+ protected:
+    void
+    SetUp() override {
+        dir_ = (fs::temp_directory_path() /
+                ("persistent_chunk_test_" + std::to_string(getpid())))
+                   .string();
+        fs::remove_all(dir_);
+        fs::create_directories(dir_);
+        field_metas_.emplace(FieldId(100), Int64Field(100));
+        field_metas_.emplace(FieldId(101), Int64Field(101));
+    }
+
+    void
+    TearDown() override {
+        fs::remove_all(dir_);
+    }
+
+    void
+    WriteGroup(const PersistentChunkKey& key) {
+        create_persistent_group_chunk(
+            {FieldId(100), FieldId(101)},
+            {Int64Field(100), Int64Field(101)},
+            {Int64Values(0, 1000), Int64Values(5, 1005)},
+            false,
+            dir_,
+            key);
+    }
+
+    std::string dir_;
+    std::unordered_map<FieldId, FieldMeta> field_metas_;
+};
+
+}  // namespace
+
+TEST_F(PersistentChunkFileTest, GroupChunkOutlivesItsMapping) {
+    {
+        auto chunks = create_persistent_group_chunk(
+            {FieldId(100), FieldId(101)},
+            {Int64Field(100), Int64Field(101)},
+            {Int64Values(0, 1000), Int64Values(5, 1005)},
+            false,
+            dir_,
+            kKey);
+        ASSERT_EQ(chunks.size(), 2);
+        ExpectValues(*chunks.at(FieldId(100)), 0, 1000);
+    }
+    ASSERT_TRUE(fs::exists(PersistentChunkFilePath(dir_, kKey)));
+
+    auto opened = open_persistent_group_chunk(field_metas_, false, dir_, kKey);
+    ASSERT_TRUE(opened.has_value());
+    ASSERT_EQ(opened->size(), 2);
+    ExpectValues(*opened->at(FieldId(100)), 0, 1000);
+    ExpectValues(*opened->at(FieldId(101)), 5, 1005);
+
+    // another cell or source has no file
+    auto other = kKey;
+    other.source_hash++;
+    EXPECT_FALSE(
+        open_persistent_group_chunk(field_metas_, false, dir_, other)
+            .has_value());
+}
+
+TEST_F(PersistentChunkFileTest, SingleChunkRoundTrip) {
+    auto field = Int64Field(100);
+    create_persistent_chunk(field, Int64Values(7, 17), false, dir_, kKey);
+
+    auto chunk = open_persistent_chunk(field, false, dir_, kKey);
+    ASSERT_NE(chunk, nullptr);
+    ExpectValues(*chunk, 7, 17);
+}
+
+TEST_F(PersistentChunkFileTest, SchemaChangeDiscardsFile) {
+    WriteGroup(kKey);
+    auto path = PersistentChunkFilePath(dir_, kKey);
+
+    std::unordered_map<FieldId, FieldMeta> nullable;
+    nullable.emplace(FieldId(100), Int64Field(100));
+    nullable.emplace(FieldId(101), Int64Field(101, true));
+    EXPECT_FALSE(
+        open_persistent_group_chunk(nullable, false, dir_, kKey).has_value());
+    EXPECT_FALSE(fs::exists(path));
+
+    // a field dropped from the schema discards the file as well
+    WriteGroup(kKey);
+    std::unordered_map<FieldId, FieldMeta> dropped;
+    dropped.emplace(FieldId(101), Int64Field(101));
+    EXPECT_FALSE(
+        open_persistent_group_chunk(dropped, false, dir_, kKey).has_value());
+    EXPECT_FALSE(fs::exists(path));
+}
+
+TEST_F(PersistentChunkFileTest, CorruptionDiscardsFile) {
+    auto path = PersistentChunkFilePath(dir_, kKey);
+
+    // flip a payload byte
+    WriteGroup(kKey);
+    {
+        std::fstream file(path,
+                          std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(8);
+        file.put('\x7f');
+    }
+    EXPECT_FALSE(open_persistent_group_chunk(field_metas_, false, dir_, kKey)
+                     .has_value());
+    EXPECT_FALSE(fs::exists(path));
+
+    // cut the trailer
+    WriteGroup(kKey);
+    fs::resize_file(path, fs::file_size(path) - 1);
+    EXPECT_FALSE(open_persistent_group_chunk(field_metas_, false, dir_, kKey)
+                     .has_value());
+    EXPECT_FALSE(fs::exists(path));
+}
+
+TEST_F(PersistentChunkFileTest, ReloadSkipsVerifiedPayload) {
+    WriteGroup(kKey);
+    auto path = PersistentChunkFilePath(dir_, kKey);
+    ASSERT_TRUE(open_persistent_group_chunk(field_metas_, false, dir_, kKey)
+                    .has_value());
+
+    // the payload was checked on the first open, a reload maps it as is
+    {
+        std::fstream file(path,
+                          std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(8);
+        file.put('\x7f');
+    }
+    EXPECT_TRUE(open_persistent_group_chunk(field_metas_, false, dir_, kKey)
+                    .has_value());
+
+    // a file written again is checked again
+    RemovePersistentChunkFile(path);
+    WriteGroup(kKey);
+    {
+        std::fstream file(path,
+                          std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(8);
+        file.put('\x7f');
+    }
+    EXPECT_FALSE(open_persistent_group_chunk(field_metas_, false, dir_, kKey)
+                     .has_value());
+}
+
+TEST_F(PersistentChunkFileTest, ReleasedSegmentRemovesItsFiles) {
+    auto dir = PersistentChunkDir(dir_);
+    auto other = kKey;
+    other.segment_id = 12;
+    for (const auto& key : {kKey, other}) {
+        create_persistent_group_chunk(
+            {FieldId(100), FieldId(101)},
+            {Int64Field(100), Int64Field(101)},
+            {Int64Values(0, 1000), Int64Values(5, 1005)},
+            false,
+            dir,
+            key);
+    }
+
+    RemoveSegmentPersistentChunkFiles(dir_, kKey.segment_id);
+    EXPECT_FALSE(fs::exists(PersistentChunkFilePath(dir, kKey)));
+    EXPECT_TRUE(fs::exists(PersistentChunkFilePath(dir, other)));
+}
+
+TEST_F(PersistentChunkFileTest, PruneDropsLeastRecentlyUsed) {
+    auto now = fs::file_time_type::clock::now();
+    std::vector<std::string> paths;
+    for (int64_t cell = 0; cell < 3; cell++) {
+        auto key = kKey;
+        key.cell_id = cell;
+        WriteGroup(key);
+        paths.push_back(PersistentChunkFilePath(dir_, key));
+        fs::last_write_time(paths.back(), now - std::chrono::hours(3 - cell));
+    }
+    auto stale_temp = dir_ + "/stale.tmp";
+    auto fresh_temp = dir_ + "/fresh.tmp";
+    std::ofstream(stale_temp) << "x";
+    std::ofstream(fresh_temp) << "x";
+    fs::last_write_time(stale_temp, now - std::chrono::hours(1));
+
+    auto file_size = fs::file_size(paths[0]);
+    PrunePersistentChunkFiles(dir_, file_size * 2);
+
+    EXPECT_FALSE(fs::exists(paths[0]));
+    EXPECT_TRUE(fs::exists(paths[1]));
+    EXPECT_TRUE(fs::exists(paths[2]));
+    EXPECT_FALSE(fs::exists(stale_temp));
+    EXPECT_TRUE(fs::exists(fresh_temp));
+}
+
+TEST(PersistentChunkFile, HashesSeparateParts) {
+    EXPECT_NE(PersistentChunkSourceHash({"ab", "c"}),
+              PersistentChunkSourceHash({"a", "bc"}));
+    EXPECT_EQ(PersistentChunkSourceHash({"a", "bc"}),
+              PersistentChunkSourceHash({"a", "bc"}));
+    EXPECT_NE(PersistentChunkSchemaHash({Int64Field(100)}),
+              PersistentChunkSchemaHash({Int64Field(100, true)}));
+}
+
+}  // namespace milvus
@@ -0,0 +1,161 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "common/Common.h"
+#include "common/Geometry.h"
+#include "common/PreparedGeometry.h"
+
+namespace milvus {
+
+// A parsed and prepared query geometry, ready to be tested against rows.
+// `prepared` references `geometry`, so the members are declared (and thus
+// destroyed in reverse) in this order.
+struct PreparedQueryGeometry {
+    PreparedQueryGeometry(GEOSContextHandle_t ctx, const std::string& wkt)
+        : geometry(ctx, wkt.c_str()),
+          prepared(ctx, geometry),
+          envelope(ComputeEnvelope(ctx, geometry.GetGeometry())) {
+    }
+
+    Geometry geometry;
+    PreparedGeometry prepared;
+    GeometryEnvelope envelope;
+};
+
+// LRU of prepared query geometries keyed by the query WKT literal.
+//
+// Parsing the literal and building the GEOS prepared index (for a polygon,
+// an interval tree over its edges) used to be redone by every GIS filter on
+// every segment, although a search fans the same literal out to all segments
+// and dashboards tend to repeat the same shapes. The cache lets all of those
+// evaluations share one preparation.
+//
+// GEOS prepared geometries and GEOS contexts are not thread-safe, so there is
+// one cache per thread (Local()), bound to the thread-local GEOS context;
+// entries are shared across segments and queries executed by that thread.
+// Callers must not keep an entry beyond the evaluation that fetched it or
+// hand it to another thread.
+//
+// The capacity of the per-thread caches follows
+// PREPARED_GEOMETRY_CACHE_CAPACITY, it should cover the distinct geometries
+// of the workload or the LRU keeps evicting them.
+class PreparedGeometryCache {
+ public:
+    static constexpr size_t kDefaultCapacity =
+        DEFAULT_PREPARED_GEOMETRY_CACHE_CAPACITY;
+
+    explicit PreparedGeometryCache(GEOSContextHandle_t ctx,
+                                   size_t capacity = kDefaultCapacity)
+        : ctx_(ctx), capacity_(capacity) {
+    }
+
+    PreparedGeometryCache(const PreparedGeometryCache&) = delete;
+    PreparedGeometryCache&
+    operator=(const PreparedGeometryCache&) = delete;
+
+    // The calling thread's cache, working on GetThreadLocalGEOSContext().
+    static PreparedGeometryCache&
+    Local() {
+        // fetch the context first: thread_local objects are destroyed in
+        // reverse order of construction, so the cached geometries go away
+        // while their context is still alive
+        auto ctx = GetThreadLocalGEOSContext();
+        thread_local PreparedGeometryCache cache(ctx);
+        cache.SetCapacity(static_cast<size_t>(
+            PREPARED_GEOMETRY_CACHE_CAPACITY.load(std::memory_order_relaxed)));
+        return cache;
+    }
+
+    // Throws on an unparseable literal, like constructing the Geometry
+    // directly would.
+    std::shared_ptr<const PreparedQueryGeometry>
+    GetOrCreate(const std::string& wkt) {
+        auto it = index_.find(wkt);
+        if (it != index_.end()) {
+            entries_.splice(entries_.begin(), entries_, it->second);
+            ++hits_;
+            return it->second->second;
+        }
+        ++misses_;
+        auto entry = std::make_shared<const PreparedQueryGeometry>(ctx_, wkt);
+        entries_.emplace_front(wkt, entry);
+        index_.emplace(wkt, entries_.begin());
+        Shrink();
+        return entry;
+    }
+
+    size_t
+    Capacity() const {
+        return capacity_;
+    }
+
+    // A smaller capacity evicts the least recently used entries right away.
+    void
+    SetCapacity(size_t capacity) {
+        if (capacity == capacity_) {
+            return;
+        }
+        capacity_ = capacity;
+        Shrink();
+    }
+
+    size_t
+    Size() const {
+        return entries_.size();
+    }
+
+    size_t
+    Hits() const {
+        return hits_;
+    }
+
+    size_t
+    Misses() const {
+        return misses_;
+    }
+
+    void
+    Clear() {
+        index_.clear();
+        entries_.clear();
+    }
+
+ private:
+    using Entry =
+        std::pair<std::string, std::shared_ptr<const PreparedQueryGeometry>>;
+
+    void
+    Shrink() {
+        while (entries_.size() > capacity_) {
+            index_.erase(entries_.back().first);
+            entries_.pop_back();
+        }
+    }
+
+    GEOSContextHandle_t ctx_;
+    size_t capacity_;
+    // most recently used first
+    std::list<Entry> entries_;
+    std::unordered_map<std::string, std::list<Entry>::iterator> index_;
+    size_t hits_ = 0;
+    size_t misses_ = 0;
+};
+
+}  // namespace milvus
@@ -0,0 +1,132 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common/Common.h"
+#include "common/Geometry.h"
+#include "common/PreparedGeometryCache.h"
+#include "geos_c.h"
+
+namespace milvus {
+namespace {
+
+const char* kSquare = "POLYGON ((0 0, 10 0, 10 10, 0 10, 0 0))";
+
+TEST(PreparedGeometryCacheTest, ReusesPreparedGeometry) {
+    auto ctx = GetThreadLocalGEOSContext();
+    PreparedGeometryCache cache(ctx);
+
+    auto first = cache.GetOrCreate(kSquare);
+    auto second = cache.GetOrCreate(kSquare);
+    EXPECT_EQ(first.get(), second.get());
+    EXPECT_EQ(cache.Size(), 1);
+    EXPECT_EQ(cache.Hits(), 1);
+    EXPECT_EQ(cache.Misses(), 1);
+
+    ASSERT_TRUE(first->prepared.IsValid());
+    EXPECT_DOUBLE_EQ(first->envelope.min_x, 0.0);
+    EXPECT_DOUBLE_EQ(first->envelope.min_y, 0.0);
+    EXPECT_DOUBLE_EQ(first->envelope.max_x, 10.0);
+    EXPECT_DOUBLE_EQ(first->envelope.max_y, 10.0);
+
+    Geometry inside(ctx, "POINT (5 5)");
+    Geometry outside(ctx, "POINT (15 5)");
+    EXPECT_TRUE(first->prepared.contains(inside));
+    EXPECT_FALSE(first->prepared.contains(outside));
+}
+
+TEST(PreparedGeometryCacheTest, EvictsLeastRecentlyUsed) {
+    PreparedGeometryCache cache(GetThreadLocalGEOSContext(), 2);
+
+    auto a = cache.GetOrCreate("POINT (1 1)");
+    cache.GetOrCreate("POINT (2 2)");
+    // touch a, so the next insert evicts the second point
+    cache.GetOrCreate("POINT (1 1)");
+    cache.GetOrCreate("POINT (3 3)");
+    EXPECT_EQ(cache.Size(), 2);
+
+    auto misses = cache.Misses();
+    EXPECT_EQ(cache.GetOrCreate("POINT (1 1)").get(), a.get());
+    EXPECT_EQ(cache.Misses(), misses);
+    cache.GetOrCreate("POINT (2 2)");
+    EXPECT_EQ(cache.Misses(), misses + 1);
+
+    // an evicted entry still held by a caller stays usable
+    cache.Clear();
+    EXPECT_EQ(cache.Size(), 0);
+    ASSERT_TRUE(a->geometry.IsValid());
+    EXPECT_DOUBLE_EQ(a->envelope.min_x, 1.0);
+}
+
+TEST(PreparedGeometryCacheTest, InvalidLiteralThrows) {
+    PreparedGeometryCache cache(GetThreadLocalGEOSContext());
+    EXPECT_ANY_THROW(cache.GetOrCreate("POLYGON ((0 0, 1"));
+    EXPECT_EQ(cache.Size(), 0);
+}
+
+TEST(PreparedGeometryCacheTest, LocalIsPerThread) {
+    auto* main_cache = &PreparedGeometryCache::Local();
+    auto main_entry = main_cache->GetOrCreate(kSquare);
+    EXPECT_EQ(&PreparedGeometryCache::Local(), main_cache);
+
+    bool distinct_cache = false;
+    bool distinct_entry = false;
+    std::thread worker([&]() {
+        auto& other_cache = PreparedGeometryCache::Local();
+        distinct_cache = &other_cache != main_cache;
+        distinct_entry =
+            other_cache.GetOrCreate(kSquare).get() != main_entry.get();
+    });
+    worker.join();
+    EXPECT_TRUE(distinct_cache);
+    EXPECT_TRUE(distinct_entry);
+}
+
+// A workload filtering with ~1000 distinct polygons, e.g. one per delivery
+// zone: after the first round every evaluation must hit the cache.
+TEST(PreparedGeometryCacheTest, KeepsThousandDistinctPolygons) {
+    constexpr int kPolygons = 1000;
+    std::vector<std::string> polygons;
+    polygons.reserve(kPolygons);
+    for (int i = 0; i < kPolygons; i++) {
+        auto x = std::to_string(i * 20);
+        auto x1 = std::to_string(i * 20 + 10);
+        polygons.push_back("POLYGON ((" + x + " 0, " + x1 + " 0, " + x1 +
+                           " 10, " + x + " 10, " + x + " 0))");
+    }
+
+    std::thread worker([&]() {
+        auto& cache = PreparedGeometryCache::Local();
+        ASSERT_GE(cache.Capacity(), kPolygons);
+        for (int round = 0; round < 3; round++) {
+            for (const auto& wkt : polygons) {
+                cache.GetOrCreate(wkt);
+            }
+        }
+        EXPECT_EQ(cache.Misses(), kPolygons);
+        EXPECT_EQ(cache.Hits(), 2 * kPolygons);
+
+        // a smaller configured capacity applies to the thread's cache on
+        // its next use
+        SetPreparedGeometryCacheCapacity(100);
+        EXPECT_EQ(PreparedGeometryCache::Local().Size(), 100);
+        SetPreparedGeometryCacheCapacity(
+            DEFAULT_PREPARED_GEOMETRY_CACHE_CAPACITY);
+    });
+    worker.join();
+}
+
+}  // namespace
+}  // namespace milvus
@@ -234,6 +234,40 @@ class ColumnVector final : public SimpleVector {
         return is_bitmap_;
     }
 
+    // Move the result and validity bitmaps out of a bitmap column vector so
+    // that their buffers can be reused; the vector is left empty.
+    std::pair<TargetBitmap, TargetBitmap>
+    TakeBitmaps() {
+        AssertInfo(is_bitmap_,
+                   "TakeBitmaps only supported for bitmap column vector");
+        auto bitset = std::dynamic_pointer_cast<FieldBitsetImpl<uint8_t>>(
+            std::move(values_));
+        AssertInfo(bitset != nullptr,
+                   "bitmap column vector should be backed by FieldBitsetImpl");
+        auto data = bitset->TakeBitmap();
+        length_ = 0;
+        null_count_ = std::nullopt;
+        return {std::move(data), std::move(valid_values_)};
+    }
+
+    // The pool that handed out the bitmaps of this vector, and the bytes it
+    // counts as live for them, see exec::QueryMemoryPool.
+    void
+    SetBitmapPool(const void* pool, int64_t bytes) {
+        bitmap_pool_ = pool;
+        bitmap_pool_bytes_ = bytes;
+    }
+
+    const void*
+    BitmapPool() const {
+        return bitmap_pool_;
+    }
+
+    int64_t
+    BitmapPoolBytes() const {
+        return bitmap_pool_bytes_;
+    }
+
     void
     resize(vector_size_t new_size, bool setNotNull = true) override {
         AssertInfo(!is_bitmap_, "Cannot resize bitmap column vector");
@@ -415,6 +449,8 @@ class ColumnVector final : public SimpleVector {
     bool is_bitmap_;  // TODO: remove the field after implementing BitmapVector
     FieldDataPtr values_;
     TargetBitmap valid_values_;  // false means the value is null
+    const void* bitmap_pool_ = nullptr;
+    int64_t bitmap_pool_bytes_ = 0;
 };
 
 using ColumnVectorPtr = std::shared_ptr<ColumnVector>;
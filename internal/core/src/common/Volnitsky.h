@@ -62,20 +62,26 @@ class VolnitskySearcher {
     /// Returns true if haystack contains needle as a substring.
     bool
     contains(std::string_view haystack) const {
+        return find(haystack) != std::string_view::npos;
+    }
+
+    /// Returns the byte offset of an occurrence of needle in haystack, or
+    /// npos. The occurrence is not necessarily the leftmost one, but no
+    /// occurrence ends before the returned one starts, so restarting the
+    /// search one byte after it visits every occurrence.
+    size_t
+    find(std::string_view haystack) const {
         if (needle_size_ == 0)
-            return true;
+            return 0;
         if (haystack.size() < needle_size_)
-            return false;
+            return std::string_view::npos;
 
+        const auto* h = reinterpret_cast<const uint8_t*>(haystack.data());
+        const auto* h_end = h + haystack.size();
         if (!use_volnitsky_) {
-            return fallbackSearch(
-                       reinterpret_cast<const uint8_t*>(haystack.data()),
-                       reinterpret_cast<const uint8_t*>(haystack.data()) +
-                           haystack.size()) != nullptr;
+            return toOffset(h, fallbackSearch(h, h_end));
         }
 
-        const auto* h = reinterpret_cast<const uint8_t*>(haystack.data());
-        const auto* h_end = h + haystack.size();
         const auto* n = reinterpret_cast<const uint8_t*>(needle_);
 
         // Main Volnitsky loop: pos points to where we read the bigram,
@@ -92,7 +98,7 @@ class VolnitskySearcher {
                 const auto* candidate = pos - (hash_[cell] - 1);
                 if (candidate >= h && candidate + needle_size_ <= h_end &&
                     fastCompare(candidate, n, needle_size_)) {
-                    return true;
+                    return candidate - h;
                 }
             }
         }
@@ -102,8 +108,13 @@ class VolnitskySearcher {
         const auto* tail_start = pos - step_ + 1;
         if (tail_start < h + needle_size_ - 2)
             tail_start = h + needle_size_ - 2;
-        return fallbackSearch(tail_start - (needle_size_ - 2), h_end) !=
-               nullptr;
+        return toOffset(h,
+                        fallbackSearch(tail_start - (needle_size_ - 2), h_end));
+    }
+
+    size_t
+    needle_size() const {
+        return needle_size_;
     }
 
  private:
@@ -121,6 +132,11 @@ class VolnitskySearcher {
         hash_[cell] = offset;
     }
 
+    static inline size_t
+    toOffset(const uint8_t* haystack, const uint8_t* found) {
+        return found == nullptr ? std::string_view::npos : found - haystack;
+    }
+
     /// Fast comparison: check first 8 bytes with word compare, then
     /// full memcmp.  Avoids function call overhead for mismatches.
     static inline bool
@@ -56,6 +56,11 @@ SetLoadTransientBudgetBytes(int64_t bytes) {
     milvus::SetLoadTransientBudgetBytes(bytes);
 }
 
+void
+SetRawDataCacheInflightBytes(int64_t bytes) {
+    milvus::SetRawDataCacheInflightBytes(bytes);
+}
+
 void
 SetHighPriorityThreadCoreCoefficient(const float value) {
     milvus::SetHighPriorityThreadCoreCoefficient(value);
@@ -116,6 +121,41 @@ SetDefaultEnableParquetStatsSkipIndex(bool val) {
     milvus::SetDefaultEnableParquetStatsSkipIndex(val);
 }
 
+void
+SetDefaultKmeansMiniBatchEnable(bool val) {
+    milvus::SetDefaultKmeansMiniBatchEnable(val);
+}
+
+void
+SetDefaultChunkEncodingEnable(bool val) {
+    milvus::SetDefaultChunkEncodingEnable(val);
+}
+
+void
+SetDefaultPersistentChunkFileEnable(bool val) {
+    milvus::SetDefaultPersistentChunkFileEnable(val);
+}
+
+void
+SetPersistentChunkFileDiskLimit(int64_t bytes) {
+    milvus::SetPersistentChunkFileDiskLimit(bytes);
+}
+
+void
+SetDefaultNumaAwareExecutorEnable(bool val) {
+    milvus::SetDefaultNumaAwareExecutorEnable(val);
+}
+
+void
+SetDefaultFusedRangeConjunctEnable(bool val) {
+    milvus::SetDefaultFusedRangeConjunctEnable(val);
+}
+
+void
+SetPreparedGeometryCacheCapacity(int64_t capacity) {
+    milvus::SetPreparedGeometryCacheCapacity(capacity);
+}
+
 void
 SetEnableLatestDeleteSnapshotOptimization(bool val) {
     milvus::SetEnableLatestDeleteSnapshotOptimization(val);
@@ -34,6 +34,9 @@ SetIndexSliceSize(const int64_t);
 void
 SetLoadTransientBudgetBytes(int64_t bytes);
 
+void
+SetRawDataCacheInflightBytes(int64_t bytes);
+
 void
 SetHighPriorityThreadCoreCoefficient(const float);
 
@@ -70,6 +73,27 @@ SetDefaultConfigParamTypeCheck(bool val);
 void
 SetDefaultEnableParquetStatsSkipIndex(bool val);
 
+void
+SetDefaultKmeansMiniBatchEnable(bool val);
+
+void
+SetDefaultChunkEncodingEnable(bool val);
+
+void
+SetDefaultPersistentChunkFileEnable(bool val);
+
+void
+SetPersistentChunkFileDiskLimit(int64_t bytes);
+
+void
+SetDefaultNumaAwareExecutorEnable(bool val);
+
+void
+SetDefaultFusedRangeConjunctEnable(bool val);
+
+void
+SetPreparedGeometryCacheCapacity(int64_t capacity);
+
 void
 SetEnableLatestDeleteSnapshotOptimization(bool val);
 
@@ -116,8 +116,24 @@ DriverFactory::CreateDriver(
                        std::dynamic_pointer_cast<const plan::ProjectNode>(
                            plannode)) {
             tracer::AddEvent("create_operator: ProjectNode");
-            operators.push_back(
-                std::make_shared<PhyProjectNode>(id, ctx.get(), projectNode));
+            auto project =
+                std::make_shared<PhyProjectNode>(id, ctx.get(), projectNode);
+            auto aggregationNode =
+                i + 1 < plannodes_.size()
+                    ? std::dynamic_pointer_cast<const plan::AggregationNode>(
+                          plannodes_[i + 1])
+                    : nullptr;
+            if (aggregationNode != nullptr &&
+                PhyAggregationNode::MayAnswerFromIndex(*aggregationNode)) {
+                // the aggregation reads the filter bitmap and only runs the
+                // projection when the scalar indexes can't answer it
+                tracer::AddEvent("create_operator: AggregationNode");
+                operators.push_back(std::make_shared<PhyAggregationNode>(
+                    id, ctx.get(), aggregationNode, std::move(project)));
+                ++i;
+            } else {
+                operators.push_back(std::move(project));
+            }
         } else if (auto orderByNode =
                        std::dynamic_pointer_cast<const plan::OrderByNode>(
                            plannode)) {
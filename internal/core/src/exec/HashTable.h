@@ -25,6 +25,7 @@
 #include <cstring>
 #include <iosfwd>
 #include <memory>
+#include <memory_resource>
 #include <utility>
 #include <vector>
 
@@ -179,14 +180,16 @@ class HashTable : public BaseHashTable {
     HashTable(
         std::vector<std::unique_ptr<VectorHasher>>&& hashers,
         const std::vector<Accumulator>& accumulators,
-        int64_t maxNumGroups = segcore::SegcoreConfig::kDefaultMaxGroupByGroups)
+        int64_t maxNumGroups = segcore::SegcoreConfig::kDefaultMaxGroupByGroups,
+        std::pmr::memory_resource* resource = std::pmr::new_delete_resource())
         : BaseHashTable(std::move(hashers)), maxNumGroups_(maxNumGroups) {
         std::vector<DataType> keyTypes;
         for (auto& hasher : hashers_) {
             keyTypes.push_back(hasher->ChannelDataType());
         }
         hashMode_ = HashMode::kHash;
-        rows_ = std::make_unique<RowContainer>(keyTypes, accumulators);
+        rows_ =
+            std::make_unique<RowContainer>(keyTypes, accumulators, resource);
     };
 
     ~HashTable() override {
@@ -30,6 +30,7 @@
 #include "common/Exception.h"
 #include "common/ArrayOffsets.h"
 #include "common/OpContext.h"
+#include "exec/QueryMemoryPool.h"
 #include "segcore/SegmentInterface.h"
 #include "segcore/Utils.h"
 
@@ -204,7 +205,8 @@ class QueryContext : public Context {
           query_config_(query_config),
           executor_(executor),
           consistency_level_(consistency_level),
-          plan_options_(plan_options) {
+          plan_options_(plan_options),
+          memory_pool_(std::make_unique<QueryMemoryPool>()) {
     }
 
     folly::Executor*
@@ -408,6 +410,12 @@ class QueryContext : public Context {
         return enable_sub_expr_cache_write_;
     }
 
+    // Scratch memory of this query, see QueryMemoryPool.
+    QueryMemoryPool*
+    memory_pool() const {
+        return memory_pool_.get();
+    }
+
  private:
     folly::Executor* executor_;
     //folly::Executor::KeepAlive<> executor_keepalive_;
@@ -459,10 +467,12 @@ class QueryContext : public Context {
     // avoid duplicating the cached full-filter bitmap with cached child
     // bitmaps in the same request path.
     bool enable_sub_expr_cache_write_ = true;
+
+    // per-query scratch memory, released together with the query
+    std::unique_ptr<QueryMemoryPool> memory_pool_;
 };
 
 // Represent the state of one thread of query execution.
-// TODO: add more class member such as memory pool
 class ExecContext : public Context {
  public:
     explicit ExecContext(QueryContext* query_context)
@@ -479,6 +489,12 @@ class ExecContext : public Context {
         return query_context_->query_config();
     }
 
+    QueryMemoryPool*
+    memory_pool() const {
+        return query_context_ == nullptr ? nullptr
+                                         : query_context_->memory_pool();
+    }
+
  private:
     QueryContext* query_context_;
 };
@@ -0,0 +1,170 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/QueryMemoryPool.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "cachinglayer/Manager.h"
+#include "monitor/Monitor.h"
+
+namespace milvus::exec {
+
+void*
+QueryMemoryPool::TrackingResource::do_allocate(size_t bytes,
+                                               size_t alignment) {
+    auto p = std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    pool_->TrackLive(static_cast<int64_t>(bytes));
+    return p;
+}
+
+void
+QueryMemoryPool::TrackingResource::do_deallocate(void* p,
+                                                 size_t bytes,
+                                                 size_t alignment) {
+    std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    pool_->TrackLive(-static_cast<int64_t>(bytes));
+}
+
+QueryMemoryPool::QueryMemoryPool() : upstream_(this), arena_(&upstream_) {
+    free_bitmaps_.reserve(kMaxPooledBitmaps);
+}
+
+QueryMemoryPool::~QueryMemoryPool() {
+    {
+        std::lock_guard<std::mutex> lock(bitmaps_mutex_);
+        free_bitmaps_.clear();
+    }
+    arena_.release();
+    auto reserved = reserved_bytes_.load(std::memory_order_acquire);
+    if (reserved > 0) {
+        cachinglayer::Manager::GetInstance().RefundLoadedResource(
+            cachinglayer::ResourceUsage{reserved, 0});
+    }
+    auto peak = PeakBytes();
+    if (peak > 0) {
+        monitor::internal_core_query_memory_bytes_peak.Observe(peak);
+    }
+}
+
+void
+QueryMemoryPool::TrackLive(int64_t delta) {
+    auto live = live_bytes_.fetch_add(delta, std::memory_order_relaxed) + delta;
+    if (delta > 0) {
+        OnGrow(live + pooled_bytes_.load(std::memory_order_relaxed));
+    }
+}
+
+void
+QueryMemoryPool::TrackPooled(int64_t delta) {
+    auto pooled =
+        pooled_bytes_.fetch_add(delta, std::memory_order_relaxed) + delta;
+    if (delta > 0) {
+        OnGrow(pooled + live_bytes_.load(std::memory_order_relaxed));
+    }
+}
+
+void
+QueryMemoryPool::OnGrow(int64_t current) {
+    auto peak = peak_bytes_.load(std::memory_order_relaxed);
+    while (current > peak && !peak_bytes_.compare_exchange_weak(
+                                 peak, current, std::memory_order_relaxed)) {
+    }
+    if (current <= reserved_bytes_.load(std::memory_order_acquire)) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(reservation_mutex_);
+    auto reserved = reserved_bytes_.load(std::memory_order_relaxed);
+    if (current <= reserved) {
+        return;
+    }
+    auto target = std::max({current, reserved * 2, kMinReservationBytes});
+    cachinglayer::Manager::GetInstance().ChargeLoadedResource(
+        cachinglayer::ResourceUsage{target - reserved, 0});
+    reserved_bytes_.store(target, std::memory_order_release);
+}
+
+int64_t
+QueryMemoryPool::BitmapBytes(const TargetBitmap& bitmap) {
+    return static_cast<int64_t>(bitmap.size_in_bytes());
+}
+
+TargetBitmap
+QueryMemoryPool::AcquireBitmap(size_t size, bool init) {
+    TargetBitmap bitmap;
+    {
+        std::lock_guard<std::mutex> lock(bitmaps_mutex_);
+        if (!free_bitmaps_.empty()) {
+            bitmap = std::move(free_bitmaps_.back());
+            free_bitmaps_.pop_back();
+            TrackPooled(-BitmapBytes(bitmap));
+            reused_bitmaps_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    // clear() keeps the buffer, so resizing to a batch size seen before does
+    // not touch the allocator
+    bitmap.clear();
+    bitmap.resize(size, init);
+    return bitmap;
+}
+
+void
+QueryMemoryPool::PoolBitmap(TargetBitmap&& bitmap) {
+    if (bitmap.empty()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(bitmaps_mutex_);
+    if (free_bitmaps_.size() < kMaxPooledBitmaps) {
+        TrackPooled(BitmapBytes(bitmap));
+        free_bitmaps_.emplace_back(std::move(bitmap));
+    }
+}
+
+ColumnVectorPtr
+QueryMemoryPool::MakeBitmapColumn(size_t size, bool init, bool valid) {
+    auto data = AcquireBitmap(size, init);
+    auto valid_data = AcquireBitmap(size, valid);
+    auto bytes = BitmapBytes(data) + BitmapBytes(valid_data);
+    TrackLive(bytes);
+    auto col =
+        std::make_shared<ColumnVector>(std::move(data), std::move(valid_data));
+    col->SetBitmapPool(this, bytes);
+    return col;
+}
+
+void
+QueryMemoryPool::Recycle(VectorPtr&& vec) {
+    auto owned = std::move(vec);
+    if (owned == nullptr || owned.use_count() != 1) {
+        return;
+    }
+    auto col = std::dynamic_pointer_cast<ColumnVector>(owned);
+    if (col == nullptr || !col->IsBitmap()) {
+        return;
+    }
+    // only the columns this pool made were counted as live, expressions
+    // also hand back bitmaps they allocated themselves
+    auto live_bytes = col->BitmapPool() == this ? col->BitmapPoolBytes() : 0;
+    auto [data, valid] = col->TakeBitmaps();
+    // counted as pooled before they stop being live, the peak must not miss
+    // the buffers in between
+    PoolBitmap(std::move(data));
+    PoolBitmap(std::move(valid));
+    TrackLive(-live_bytes);
+}
+
+}  // namespace milvus::exec
@@ -0,0 +1,176 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <mutex>
+#include <vector>
+
+#include "common/Types.h"
+#include "common/Vector.h"
+
+namespace milvus::exec {
+
+// Per-query memory pool, owned by QueryContext and released wholesale when
+// the query ends.
+//
+// It serves two kinds of short-lived allocations of the execution pipeline:
+//  - arena(): a pooling std::pmr resource for the scratch of operators and
+//    expressions, e.g. the group rows of aggregations and sorts. Freed
+//    blocks are kept for the next allocation of the same size class and
+//    everything is given back together with the pool.
+//  - MakeBitmapColumn()/Recycle(): batch result bitmaps of expressions. Bitmaps
+//    of consumed batches are put on a bounded free list and handed out again
+//    for the next batch, so evaluating N batches allocates about once
+//    instead of N times.
+// Both are thread safe.
+//
+// Live bytes (arena blocks and bitmaps handed out) plus pooled bytes are
+// covered by a reservation on the caching layer's resource accounting. The
+// reservation grows geometrically, so a query charges the caching layer a
+// few times at most instead of on every allocation, and it is refunded as a
+// whole when the pool is destroyed. The peak of live plus pooled bytes is
+// reported to the query memory metric and the query profile.
+class QueryMemoryPool {
+ public:
+    QueryMemoryPool();
+
+    ~QueryMemoryPool();
+
+    QueryMemoryPool(const QueryMemoryPool&) = delete;
+    QueryMemoryPool&
+    operator=(const QueryMemoryPool&) = delete;
+
+    std::pmr::memory_resource*
+    arena() {
+        return &arena_;
+    }
+
+    // A bitmap ColumnVector as produced by filter expressions for one batch.
+    ColumnVectorPtr
+    MakeBitmapColumn(size_t size, bool init = false, bool valid = true);
+
+    // Hand back a consumed batch result. Only bitmap column vectors that are
+    // not shared with anyone else are recycled, anything else is just
+    // dropped. The buffers of a bitmap column the pool didn't make are pooled
+    // as well, but were never counted as live.
+    void
+    Recycle(VectorPtr&& vec);
+
+    // Bytes of bitmap columns handed out and not handed back yet, plus arena
+    // blocks.
+    int64_t
+    LiveBytes() const {
+        return live_bytes_.load(std::memory_order_relaxed);
+    }
+
+    // Bytes of bitmaps kept on the free list.
+    int64_t
+    PooledBytes() const {
+        return pooled_bytes_.load(std::memory_order_relaxed);
+    }
+
+    int64_t
+    CurrentBytes() const {
+        return LiveBytes() + PooledBytes();
+    }
+
+    int64_t
+    PeakBytes() const {
+        return peak_bytes_.load(std::memory_order_relaxed);
+    }
+
+    // Bytes charged to the caching layer for this query.
+    int64_t
+    ReservedBytes() const {
+        return reserved_bytes_.load(std::memory_order_acquire);
+    }
+
+    int64_t
+    ReusedBitmapCount() const {
+        return reused_bitmaps_.load(std::memory_order_relaxed);
+    }
+
+ private:
+    // Upstream of the arena: counts every block it allocates as live.
+    class TrackingResource : public std::pmr::memory_resource {
+     public:
+        explicit TrackingResource(QueryMemoryPool* pool) : pool_(pool) {
+        }
+
+     private:
+        void*
+        do_allocate(size_t bytes, size_t alignment) override;
+
+        void
+        do_deallocate(void* p, size_t bytes, size_t alignment) override;
+
+        bool
+        do_is_equal(const std::pmr::memory_resource& other)
+            const noexcept override {
+            return this == &other;
+        }
+
+        QueryMemoryPool* pool_;
+    };
+
+    void
+    TrackLive(int64_t delta);
+
+    void
+    TrackPooled(int64_t delta);
+
+    // Updates the peak and grows the reservation if 'current' exceeds it.
+    void
+    OnGrow(int64_t current);
+
+    static int64_t
+    BitmapBytes(const TargetBitmap& bitmap);
+
+    // A bitmap of `size` bits, all set to `init`, reusing a pooled buffer
+    // when one is available. Not counted as live yet.
+    TargetBitmap
+    AcquireBitmap(size_t size, bool init);
+
+    // Put the buffer of a consumed bitmap on the free list if there is room.
+    void
+    PoolBitmap(TargetBitmap&& bitmap);
+
+    // a query rarely has more than a handful of result bitmaps in flight,
+    // more than this is kept around for nothing
+    static constexpr size_t kMaxPooledBitmaps = 16;
+    static constexpr int64_t kMinReservationBytes = 1 << 20;
+
+    TrackingResource upstream_;
+    std::pmr::synchronized_pool_resource arena_;
+
+    std::mutex bitmaps_mutex_;
+    std::vector<TargetBitmap> free_bitmaps_;
+
+    std::atomic<int64_t> live_bytes_{0};
+    std::atomic<int64_t> pooled_bytes_{0};
+    std::atomic<int64_t> peak_bytes_{0};
+
+    std::mutex reservation_mutex_;
+    std::atomic<int64_t> reserved_bytes_{0};
+    std::atomic<int64_t> reused_bitmaps_{0};
+};
+
+}  // namespace milvus::exec
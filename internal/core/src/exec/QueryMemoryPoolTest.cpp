@@ -0,0 +1,139 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <memory>
+#include <memory_resource>
+#include <vector>
+
+#include "common/Types.h"
+#include "common/Vector.h"
+#include "exec/QueryMemoryPool.h"
+#include "exec/operator/query-agg/RowContainer.h"
+
+using namespace milvus;
+using namespace milvus::exec;
+
+TEST(QueryMemoryPool, RecycleBitmapColumn) {
+    QueryMemoryPool pool;
+
+    auto col = pool.MakeBitmapColumn(1000);
+    ASSERT_TRUE(col->IsBitmap());
+    ASSERT_EQ(col->size(), 1000);
+    TargetBitmapView view(col->GetRawData(), 1000);
+    TargetBitmapView valid_view(col->GetValidRawData(), 1000);
+    EXPECT_TRUE(view.none());
+    EXPECT_TRUE(valid_view.all());
+    view.set();
+    auto* raw = col->GetRawData();
+
+    auto live = pool.LiveBytes();
+    EXPECT_GT(live, 0);
+
+    pool.Recycle(std::move(col));
+    EXPECT_EQ(col, nullptr);
+    EXPECT_EQ(pool.LiveBytes(), 0);
+    EXPECT_EQ(pool.PooledBytes(), live);
+
+    // the next batch gets the same buffer back, reset to its initial value
+    auto next = pool.MakeBitmapColumn(1000);
+    EXPECT_EQ(pool.ReusedBitmapCount(), 2);
+    EXPECT_EQ(pool.PooledBytes(), 0);
+    EXPECT_EQ(pool.LiveBytes(), live);
+    EXPECT_GE(pool.PeakBytes(), live);
+    TargetBitmapView next_view(next->GetRawData(), 1000);
+    EXPECT_TRUE(next_view.none());
+    EXPECT_TRUE(next->GetRawData() == raw ||
+                next->GetValidRawData() == raw);
+}
+
+TEST(QueryMemoryPool, SharedVectorIsNotRecycled) {
+    QueryMemoryPool pool;
+
+    auto col = pool.MakeBitmapColumn(64);
+    VectorPtr held = col;
+    pool.Recycle(std::move(col));
+    EXPECT_EQ(pool.PooledBytes(), 0);
+    ASSERT_NE(held, nullptr);
+    EXPECT_EQ(held->size(), 64);
+
+    // a non bitmap column is dropped as well
+    auto field = std::make_shared<ColumnVector>(DataType::INT64, 64);
+    pool.Recycle(std::move(field));
+    EXPECT_EQ(pool.PooledBytes(), 0);
+    EXPECT_EQ(pool.ReusedBitmapCount(), 0);
+}
+
+TEST(QueryMemoryPool, ForeignBitmapIsNotCountedLive) {
+    QueryMemoryPool pool;
+
+    auto col = pool.MakeBitmapColumn(1000);
+    auto live = pool.LiveBytes();
+    ASSERT_GT(live, 0);
+
+    // a result an expression allocated itself is pooled, but doesn't take
+    // from the bytes of the column still in use
+    auto foreign = std::make_shared<ColumnVector>(TargetBitmap(8192),
+                                                  TargetBitmap(8192));
+    pool.Recycle(std::move(foreign));
+    EXPECT_EQ(pool.LiveBytes(), live);
+    EXPECT_GT(pool.PooledBytes(), 0);
+
+    pool.Recycle(std::move(col));
+    EXPECT_EQ(pool.LiveBytes(), 0);
+}
+
+TEST(QueryMemoryPool, ArenaTracksPeak) {
+    QueryMemoryPool pool;
+    const int64_t bytes = 100000 * sizeof(int64_t);
+    {
+        std::pmr::vector<int64_t> rows(pool.arena());
+        rows.resize(100000);
+        EXPECT_GE(pool.LiveBytes(), bytes);
+    }
+    EXPECT_GE(pool.PeakBytes(), bytes);
+    EXPECT_GE(pool.ReservedBytes(), pool.PeakBytes());
+}
+
+TEST(QueryMemoryPool, ReservationIsNotChargedPerBatch) {
+    QueryMemoryPool pool;
+    EXPECT_EQ(pool.ReservedBytes(), 0);
+
+    pool.Recycle(pool.MakeBitmapColumn(8192));
+    auto reserved = pool.ReservedBytes();
+    EXPECT_GE(reserved, pool.PeakBytes());
+
+    // batches of the same size stay within the first reservation
+    for (int i = 0; i < 1000; i++) {
+        auto col = pool.MakeBitmapColumn(8192);
+        pool.Recycle(std::move(col));
+    }
+    EXPECT_EQ(pool.ReservedBytes(), reserved);
+    EXPECT_EQ(pool.LiveBytes(), 0);
+}
+
+TEST(QueryMemoryPool, RowContainerAllocatesFromArena) {
+    QueryMemoryPool pool;
+    {
+        RowContainer rows({DataType::INT64, DataType::INT32}, {}, pool.arena());
+        for (int i = 0; i < 10000; i++) {
+            rows.newRow();
+        }
+        EXPECT_GT(pool.LiveBytes(), 0);
+        EXPECT_EQ(rows.allRows().size(), 10000);
+    }
+    EXPECT_GT(pool.PeakBytes(), 0);
+}
@@ -27,7 +27,8 @@ namespace exec {
 
 SortBuffer::SortBuffer(const std::vector<DataType>& column_types,
                        const std::vector<SortKeyInfo>& sort_keys,
-                       int64_t limit)
+                       int64_t limit,
+                       std::pmr::memory_resource* resource)
     : column_types_(column_types), sort_keys_(sort_keys), limit_(limit) {
     AssertInfo(!sort_keys_.empty(),
                "SortBuffer requires at least one sort key");
@@ -46,7 +47,8 @@ SortBuffer::SortBuffer(const std::vector<DataType>& column_types,
 
     // Create RowContainer with no accumulators (pure data storage)
     std::vector<Accumulator> empty_accumulators;
-    data_ = std::make_unique<RowContainer>(column_types_, empty_accumulators);
+    data_ = std::make_unique<RowContainer>(
+        column_types_, empty_accumulators, resource);
 }
 
 void
@@ -19,6 +19,7 @@
 #include <algorithm>
 #include <cstdint>
 #include <memory>
+#include <memory_resource>
 #include <string_view>
 #include <vector>
 
@@ -82,10 +83,13 @@ class SortBuffer {
      * @note Offset is NOT supported at segment level. In distributed queries,
      *       offset must be applied at the proxy reduce level after k-way merge.
      *       Segments should use (offset + limit) as the limit parameter.
+     * @param resource Allocates the buffered rows, must outlive the buffer
      */
     SortBuffer(const std::vector<DataType>& column_types,
                const std::vector<SortKeyInfo>& sort_keys,
-               int64_t limit = -1);
+               int64_t limit = -1,
+               std::pmr::memory_resource* resource =
+                   std::pmr::new_delete_resource());
 
     ~SortBuffer() = default;
 
@@ -216,9 +216,7 @@ PhyBloomFilterExpr::ExecVisitorImpl(EvalCtx& context) {
                bitmap_input.size(),
                real_batch_size);
 
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                       TargetBitmap(real_batch_size, true));
+    auto res_vec = MakeBitmapResult(context, real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
 
@@ -290,9 +288,7 @@ PhyBloomFilterExpr::ExecVisitorImplForIndex(EvalCtx& context) {
     }
     auto real_batch_size = *next_batch_size;
 
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                       TargetBitmap(real_batch_size, true));
+    auto res_vec = MakeBitmapResult(context, real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
 
@@ -397,9 +393,7 @@ PhyBloomFilterExpr::ExecVisitorImplJson(EvalCtx& context) {
                bitmap_input.size(),
                real_batch_size);
 
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                       TargetBitmap(real_batch_size, true));
+    auto res_vec = MakeBitmapResult(context, real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
 
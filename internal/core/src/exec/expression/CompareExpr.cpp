@@ -37,43 +37,10 @@ PhyCompareFilterExpr::IsStringExpr() {
 
 bool
 PhyCompareFilterExpr::CanUseBothDataFastPath() {
-    if (is_left_indexed_ || is_right_indexed_ || IsStringExpr()) {
-        return false;
-    }
-
-    // Offset-input path resolves each field's chunk from the row offset
-    // independently, so it does not require left/right chunk boundaries to
-    // align.
-    if (has_offset_input_) {
-        return true;
-    }
-
-    if (can_use_both_data_sequential_fast_path_.has_value()) {
-        return can_use_both_data_sequential_fast_path_.value();
-    }
-
-    auto segment = segment_chunk_reader_.segment_;
-    if (!segment->is_chunked() || segment->type() == SegmentType::Growing) {
-        can_use_both_data_sequential_fast_path_ = true;
-        return true;
-    }
-
-    auto left_chunks = segment->num_chunk_data(left_field_);
-    auto right_chunks = segment->num_chunk_data(right_field_);
-    if (left_chunks <= 0 || right_chunks <= 0 || left_chunks != right_chunks) {
-        can_use_both_data_sequential_fast_path_ = false;
-        return false;
-    }
-
-    for (int64_t i = 0; i <= left_chunks; ++i) {
-        if (segment->num_rows_until_chunk(left_field_, i) !=
-            segment->num_rows_until_chunk(right_field_, i)) {
-            can_use_both_data_sequential_fast_path_ = false;
-            return false;
-        }
-    }
-    can_use_both_data_sequential_fast_path_ = true;
-    return true;
+    // Chunk boundaries of the two columns need not line up: the offset-input
+    // path resolves each field's chunk per row and the sequential path walks
+    // the intersection of both chunkings.
+    return !is_left_indexed_ && !is_right_indexed_ && !IsStringExpr();
 }
 
 int64_t
@@ -96,9 +63,7 @@ PhyCompareFilterExpr::ExecCompareExprDispatcher(OpType op, EvalCtx& context) {
             return nullptr;
         }
 
-        auto res_vec =
-            std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                           TargetBitmap(real_batch_size, true));
+        auto res_vec = MakeBitmapResult(context, real_batch_size);
         TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
         TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
 
@@ -389,9 +354,7 @@ PhyCompareFilterExpr::ExecCompareRightType(EvalCtx& context) {
     }
 
     const auto& bitmap_input = context.get_bitmap_input();
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                       TargetBitmap(real_batch_size, true));
+    auto res_vec = MakeBitmapResult(context, real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
 
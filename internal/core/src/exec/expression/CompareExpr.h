@@ -17,11 +17,13 @@
 #pragma once
 
 #include <fmt/core.h>
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <optional>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -47,6 +49,68 @@
 namespace milvus {
 namespace exec {
 
+template <proto::plan::OpType op>
+constexpr milvus::bitset::CompareOpType
+ToBitsetCompareOp() {
+    if constexpr (op == proto::plan::OpType::Equal) {
+        return milvus::bitset::CompareOpType::EQ;
+    } else if constexpr (op == proto::plan::OpType::NotEqual) {
+        return milvus::bitset::CompareOpType::NE;
+    } else if constexpr (op == proto::plan::OpType::GreaterThan) {
+        return milvus::bitset::CompareOpType::GT;
+    } else if constexpr (op == proto::plan::OpType::LessThan) {
+        return milvus::bitset::CompareOpType::LT;
+    } else if constexpr (op == proto::plan::OpType::GreaterEqual) {
+        return milvus::bitset::CompareOpType::GE;
+    } else {
+        static_assert(op == proto::plan::OpType::LessEqual,
+                      "unsupported op_type for column compare");
+        return milvus::bitset::CompareOpType::LE;
+    }
+}
+
+// The bitset library only has SIMD column kernels for same-typed columns,
+// a mixed pair such as int32 vs int64 or int64 vs double would be compared
+// element by element. Both sides are converted block-wise to their common
+// type instead, which is exactly the conversion the builtin comparison
+// operators apply, so results are identical.
+template <typename T, typename U>
+constexpr bool kCompareColumnNeedsUpcast =
+    !std::is_same_v<T, U> && !std::is_same_v<T, bool> &&
+    !std::is_same_v<U, bool>;
+
+template <typename T, typename U, proto::plan::OpType op>
+void
+CompareColumnUpcast(const T* left,
+                    const U* right,
+                    size_t size,
+                    TargetBitmapView res) {
+    using C = std::common_type_t<T, U>;
+    constexpr size_t kBlockSize = 1024;
+    alignas(64) C left_block[kBlockSize];
+    alignas(64) C right_block[kBlockSize];
+    for (size_t i = 0; i < size; i += kBlockSize) {
+        const auto n = std::min(kBlockSize, size - i);
+        const C* l = nullptr;
+        const C* r = nullptr;
+        if constexpr (std::is_same_v<T, C>) {
+            l = left + i;
+        } else {
+            std::copy(left + i, left + i + n, left_block);
+            l = left_block;
+        }
+        if constexpr (std::is_same_v<U, C>) {
+            r = right + i;
+        } else {
+            std::copy(right + i, right + i + n, right_block);
+            r = right_block;
+        }
+        (res + i)
+            .template inplace_compare_column<C, C, ToBitsetCompareOp<op>()>(
+                l, r, n);
+    }
+}
+
 template <typename T,
           typename U,
           proto::plan::OpType op,
@@ -116,7 +180,9 @@ struct CompareElementFunc {
             return;
         }
 
-        if constexpr (op == proto::plan::OpType::Equal) {
+        if constexpr (kCompareColumnNeedsUpcast<T, U>) {
+            CompareColumnUpcast<T, U, op>(left, right, size, res);
+        } else if constexpr (op == proto::plan::OpType::Equal) {
             res.inplace_compare_column<T, U, milvus::bitset::CompareOpType::EQ>(
                 left, right, size);
         } else if constexpr (op == proto::plan::OpType::NotEqual) {
@@ -517,70 +583,91 @@ class PhyCompareFilterExpr : public Expr {
         return processed_size;
     }
 
+    // Left and right columns may be chunked differently (e.g. they live in
+    // different column groups), so walk the intersection of both chunk
+    // boundaries: every step covers a run that lies within one chunk of each
+    // side and is evaluated with the column kernel in one call.
     template <typename T, typename U, typename FUNC, typename... ValTypes>
     int64_t
     ProcessBothDataChunksForMultipleChunk(FUNC func,
                                           TargetBitmapView res,
                                           TargetBitmapView valid_res,
                                           const ValTypes&... values) {
-        int64_t processed_size = 0;
-
-        // only call this function when left and right are not indexed, so they have the same number of chunks
-        for (size_t i = left_current_chunk_id_; i < left_num_chunk_; i++) {
-            auto pw_left = segment_chunk_reader_.segment_->chunk_data<T>(
-                op_ctx_, left_field_, i);
-            auto left_chunk = pw_left.get();
-            auto pw_right = segment_chunk_reader_.segment_->chunk_data<U>(
-                op_ctx_, right_field_, i);
-            auto right_chunk = pw_right.get();
-            auto data_pos =
-                (i == left_current_chunk_id_) ? left_current_chunk_pos_ : 0;
-            auto size = 0;
-            if (segment_chunk_reader_.segment_->type() ==
-                SegmentType::Growing) {
-                size =
-                    (i == (left_num_chunk_ - 1))
-                        ? (segment_chunk_reader_.active_count_ %
-                                       segment_chunk_reader_.SizePerChunk() ==
-                                   0
-                               ? segment_chunk_reader_.SizePerChunk() - data_pos
-                               : segment_chunk_reader_.active_count_ %
-                                         segment_chunk_reader_.SizePerChunk() -
-                                     data_pos)
-                        : segment_chunk_reader_.SizePerChunk() - data_pos;
-            } else {
-                size =
-                    segment_chunk_reader_.segment_->chunk_size(left_field_, i) -
-                    data_pos;
+        auto segment = segment_chunk_reader_.segment_;
+        const bool is_growing = segment->type() == SegmentType::Growing;
+        auto chunk_rows = [&](FieldId field, int64_t chunk_id) -> int64_t {
+            if (is_growing) {
+                int64_t size_per_chunk = segment_chunk_reader_.SizePerChunk();
+                return std::min(
+                    size_per_chunk,
+                    segment_chunk_reader_.active_count_ -
+                        chunk_id * size_per_chunk);
             }
+            return segment->chunk_size(field, chunk_id);
+        };
 
-            if (processed_size + size >= batch_size_) {
-                size = batch_size_ - processed_size;
+        int64_t processed_size = 0;
+        int64_t pinned_left_chunk_id = -1;
+        int64_t pinned_right_chunk_id = -1;
+        std::optional<PinWrapper<Span<T>>> pw_left;
+        std::optional<PinWrapper<Span<U>>> pw_right;
+        while (processed_size < batch_size_ &&
+               left_current_chunk_id_ < left_num_chunk_ &&
+               right_current_chunk_id_ < right_num_chunk_) {
+            auto left_remain = chunk_rows(left_field_, left_current_chunk_id_) -
+                               left_current_chunk_pos_;
+            if (left_remain <= 0) {
+                left_current_chunk_id_++;
+                left_current_chunk_pos_ = 0;
+                continue;
+            }
+            auto right_remain =
+                chunk_rows(right_field_, right_current_chunk_id_) -
+                right_current_chunk_pos_;
+            if (right_remain <= 0) {
+                right_current_chunk_id_++;
+                right_current_chunk_pos_ = 0;
+                continue;
+            }
+            auto size = std::min({left_remain,
+                                  right_remain,
+                                  batch_size_ - processed_size});
+
+            if (pinned_left_chunk_id != left_current_chunk_id_) {
+                pw_left.emplace(segment->chunk_data<T>(
+                    op_ctx_, left_field_, left_current_chunk_id_));
+                pinned_left_chunk_id = left_current_chunk_id_;
             }
+            if (pinned_right_chunk_id != right_current_chunk_id_) {
+                pw_right.emplace(segment->chunk_data<U>(
+                    op_ctx_, right_field_, right_current_chunk_id_));
+                pinned_right_chunk_id = right_current_chunk_id_;
+            }
+            auto left_chunk = pw_left->get();
+            auto right_chunk = pw_right->get();
 
-            const T* left_data = left_chunk.data() + data_pos;
-            const U* right_data = right_chunk.data() + data_pos;
+            const T* left_data = left_chunk.data() + left_current_chunk_pos_;
+            const U* right_data =
+                right_chunk.data() + right_current_chunk_pos_;
             func(left_data,
                  right_data,
                  nullptr,
                  size,
                  res + processed_size,
                  values...);
-            ApplyValidMask(left_chunk.validity().Subview(data_pos),
-                           res + processed_size,
-                           valid_res + processed_size,
-                           size);
-            ApplyValidMask(right_chunk.validity().Subview(data_pos),
-                           res + processed_size,
-                           valid_res + processed_size,
-                           size);
+            ApplyValidMask(
+                left_chunk.validity().Subview(left_current_chunk_pos_),
+                res + processed_size,
+                valid_res + processed_size,
+                size);
+            ApplyValidMask(
+                right_chunk.validity().Subview(right_current_chunk_pos_),
+                res + processed_size,
+                valid_res + processed_size,
+                size);
             processed_size += size;
-
-            if (processed_size >= batch_size_) {
-                left_current_chunk_id_ = i;
-                left_current_chunk_pos_ = data_pos + size;
-                break;
-            }
+            left_current_chunk_pos_ += size;
+            right_current_chunk_pos_ += size;
         }
 
         return processed_size;
@@ -620,7 +707,6 @@ class PhyCompareFilterExpr : public Expr {
     int64_t right_current_chunk_pos_{0};
     int64_t current_chunk_id_{0};
     int64_t current_chunk_pos_{0};
-    std::optional<bool> can_use_both_data_sequential_fast_path_;
 
     const segcore::SegmentChunkReader segment_chunk_reader_;
     int64_t batch_size_;
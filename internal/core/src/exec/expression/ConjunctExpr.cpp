@@ -188,6 +188,10 @@ PhyConjunctFilterExpr::Eval(EvalCtx& context, VectorPtr& result) {
                                                input_flat_result);
             }
         }
+        // merged into result already, only the first input is kept
+        if (auto* pool = context.memory_pool(); pool != nullptr) {
+            pool->Recycle(std::move(input_result));
+        }
 
         // The last evaluated expression needs neither a skip decision nor a
         // bitmap input for a successor.
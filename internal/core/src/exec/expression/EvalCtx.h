@@ -48,6 +48,11 @@ class EvalCtx {
         return exec_ctx_->get_query_config();
     }
 
+    QueryMemoryPool*
+    memory_pool() {
+        return exec_ctx_ == nullptr ? nullptr : exec_ctx_->memory_pool();
+    }
+
     inline OffsetVector*
     get_offset_input() {
         return offset_input_;
@@ -34,6 +34,7 @@
 #include "exec/expression/CompareExpr.h"
 #include "exec/expression/ConjunctExpr.h"
 #include "exec/expression/ExistsExpr.h"
+#include "exec/expression/FusedRangeConjunctExpr.h"
 #include "exec/expression/GISConjunctExpr.h"
 #include "exec/expression/GISFunctionFilterExpr.h"
 #include "exec/expression/JsonContainsExpr.h"
@@ -700,6 +701,44 @@ SplitFuseGISConjunct(std::shared_ptr<milvus::exec::PhyConjunctFilterExpr>& expr,
     expr->RebuildInputs(std::move(rebuilt));
 }
 
+// Replace the comparisons of an AND conjunction that scan fixed-width columns
+// with one PhyFusedRangeConjunctExpr, which compares them all in a single
+// pass. Gated by FUSED_RANGE_CONJUNCT_ENABLED.
+static void
+FuseRangeConjunct(std::shared_ptr<milvus::exec::PhyConjunctFilterExpr>& expr,
+                  ExecContext* context) {
+    if (!FUSED_RANGE_CONJUNCT_ENABLED.load() || !expr->IsAnd()) {
+        return;
+    }
+    auto* qc = context->get_query_context();
+    auto* segment = qc->get_segment();
+    if (!segment) {
+        return;
+    }
+
+    std::vector<std::shared_ptr<PhyUnaryRangeFilterExpr>> fused;
+    std::vector<std::shared_ptr<Expr>> kept;
+    for (const auto& input : expr->GetInputsRef()) {
+        if (auto unary = PhyFusedRangeConjunctExpr::AsFusable(input, segment)) {
+            fused.push_back(std::move(unary));
+        } else {
+            kept.push_back(input);
+        }
+    }
+    // a single comparison has nothing to share its pass with
+    if (fused.size() < 2) {
+        return;
+    }
+    kept.push_back(std::make_shared<PhyFusedRangeConjunctExpr>(
+        std::move(fused),
+        qc->get_op_context(),
+        segment,
+        qc->get_active_count(),
+        qc->query_config()->get_expr_batch_size(),
+        qc->memory_pool() != nullptr ? qc->memory_pool()->arena() : nullptr));
+    expr->RebuildInputs(std::move(kept));
+}
+
 void
 ReorderConjunctExpr(std::shared_ptr<milvus::exec::PhyConjunctFilterExpr>& expr,
                     ExecContext* context,
@@ -711,6 +750,9 @@ ReorderConjunctExpr(std::shared_ptr<milvus::exec::PhyConjunctFilterExpr>& expr,
     // Rewrite same-column geometry predicates into Coarse + Refine nodes before
     // bucketing, so the buckets below schedule coarse early / refine last.
     SplitFuseGISConjunct(expr, context);
+    // Fuse the fixed-width comparisons before bucketing too, the fused node
+    // goes with the numeric expressions.
+    FuseRangeConjunct(expr, context);
     auto schema = segment->get_schema_snapshot();
     auto namespace_field_id = schema->get_namespace_field_id();
     std::vector<size_t> reorder;
@@ -750,6 +792,12 @@ ReorderConjunctExpr(std::shared_ptr<milvus::exec::PhyConjunctFilterExpr>& expr,
             continue;
         }
 
+        // Fused comparisons of numeric columns.
+        if (input->name() == "PhyFusedRangeConjunctExpr") {
+            numeric_expr.push_back(i);
+            continue;
+        }
+
         if (namespace_field_id.has_value() &&
             input->name() == "PhyUnaryRangeFilterExpr") {
             auto unary =
@@ -28,6 +28,7 @@
 
 #include "common/Array.h"
 #include "common/ArrayOffsets.h"
+#include "common/ChunkEncoding.h"
 #include "common/FieldDataInterface.h"
 #include "common/Json.h"
 #include "common/OpContext.h"
@@ -167,6 +168,17 @@ ApplyValidMask(ValidityView validity,
     }
 }
 
+// Result vector of one filter batch: all false, all valid. Buffers come from
+// the query's memory pool so bitmaps of consumed batches get reused.
+inline ColumnVectorPtr
+MakeBitmapResult(EvalCtx& context, int64_t size) {
+    if (auto* pool = context.memory_pool(); pool != nullptr) {
+        return pool->MakeBitmapColumn(size);
+    }
+    return std::make_shared<ColumnVector>(TargetBitmap(size, false),
+                                          TargetBitmap(size, true));
+}
+
 class Expr : public std::enable_shared_from_this<Expr> {
  public:
     Expr(DataType type,
@@ -353,6 +365,7 @@ class SegmentExpr : public Expr {
         auto schema = segment_->get_schema_snapshot();
         auto& field_meta = (*schema)[field_id_];
         field_type_ = field_meta.get_data_type();
+        field_nullable_ = field_meta.is_nullable();
 
         if (schema->get_primary_field_id().has_value() &&
             schema->get_primary_field_id().value() == field_id_ &&
@@ -511,6 +524,34 @@ class SegmentExpr : public Expr {
         ApplyValidMask(validity, res, valid_res, size);
     }
 
+    // Evaluates the predicate for rows [offset, offset + size) of a chunk
+    // from its encoded form (see common/ChunkEncoding.h) into res. Returns
+    // false when the encoding can't answer it; the raw chunk data is scanned
+    // instead.
+    using EncodedChunkFunc = std::function<bool(const ChunkEncoding& encoding,
+                                                int64_t offset,
+                                                int64_t size,
+                                                TargetBitmapView res)>;
+
+    // Returns true if the rows were answered by encoded_func, with the chunk
+    // validity applied.
+    bool
+    ProcessEncodedChunk(const EncodedChunkFunc& encoded_func,
+                        int64_t chunk_id,
+                        int64_t data_pos,
+                        int64_t size,
+                        TargetBitmapView res,
+                        TargetBitmapView valid_res) {
+        auto pw = segment_->encoded_chunk(op_ctx_, field_id_, chunk_id);
+        const auto* chunk = pw.get();
+        if (chunk == nullptr ||
+            !encoded_func(*chunk->Encoding(), data_pos, size, res)) {
+            return false;
+        }
+        ApplyValidData(chunk->Validity(data_pos), res, valid_res, size);
+        return true;
+    }
+
     // Try to load the full bitset from ExprResCache.
     // Returns true if cache hit (cached_index_chunk_res_ populated).
     // Call at the top of ByStats / ByIndex methods to skip computation.
@@ -1780,6 +1821,7 @@ class SegmentExpr : public Expr {
               typename... ValTypes>
     int64_t
     ProcessDataChunksForMultipleChunk(
+        const EncodedChunkFunc& encoded_func,
         FUNC func,
         std::function<bool(const milvus::SkipIndex&, FieldId, int)> skip_func,
         TargetBitmapView res,
@@ -1791,7 +1833,13 @@ class SegmentExpr : public Expr {
         if (!prefetched_) {
             std::vector<int64_t> pf_chunk_ids;
             pf_chunk_ids.reserve(num_data_chunk_ - current_data_chunk_);
+            auto pf_skip_index = segment_->GetSkipIndex();
             for (size_t i = current_data_chunk_; i < num_data_chunk_; i++) {
+                // chunks the skip index rules out are never read
+                if (!field_nullable_ && skip_func &&
+                    skip_func(*pf_skip_index, field_id_, i)) {
+                    continue;
+                }
                 pf_chunk_ids.push_back(i);
             }
             segment_->prefetch_chunks(op_ctx_, field_id_, pf_chunk_ids);
@@ -1826,7 +1874,32 @@ class SegmentExpr : public Expr {
                 }
             }
             auto skip_index = segment_->GetSkipIndex();
-            if (!skip_func || !skip_func(*skip_index, field_id_, i)) {
+            const bool skipped =
+                skip_func && skip_func(*skip_index, field_id_, i);
+            bool encoded = false;
+            if constexpr (!NeedSegmentOffsets) {
+                if (!skipped && encoded_func &&
+                    ProcessEncodedChunk(encoded_func,
+                                        i,
+                                        data_pos,
+                                        size,
+                                        res + processed_size,
+                                        valid_res + processed_size)) {
+                    // Answered from the encoded form. Call func with nullptr
+                    // to update internal cursors, like for a skipped chunk.
+                    func(nullptr,
+                         ValidityView{},
+                         nullptr,
+                         size,
+                         res + processed_size,
+                         valid_res + processed_size,
+                         values...);
+                    encoded = true;
+                }
+            }
+            if (encoded) {
+                // nothing left to do for this chunk
+            } else if (!skipped) {
                 bool is_seal = false;
                 if constexpr (std::is_same_v<T, std::string_view> ||
                               std::is_same_v<T, Json> ||
@@ -1901,23 +1974,28 @@ class SegmentExpr : public Expr {
                 // 1. Apply valid_data to handle nullable fields
                 // 2. Call func with nullptr to update internal cursors
                 //    (e.g., processed_cursor for bitmap_input indexing)
-                if constexpr (std::is_same_v<T, std::string_view> ||
-                              std::is_same_v<T, Json> ||
-                              std::is_same_v<T, ArrayView> ||
-                              std::is_same_v<T, VectorArrayView>) {
-                    auto pw = segment_->get_batch_views<T>(
-                        op_ctx_, field_id_, i, data_pos, size);
-                    ApplyValidData(pw.get().second,
-                                   res + processed_size,
-                                   valid_res + processed_size,
-                                   size);
-                } else {
-                    auto pw = segment_->chunk_data<T>(op_ctx_, field_id_, i);
-                    auto chunk = pw.get();
-                    ApplyValidData(chunk.validity().Subview(data_pos),
-                                   res + processed_size,
-                                   valid_res + processed_size,
-                                   size);
+                // A non-nullable field carries no validity, so the chunk is
+                // not pinned at all and a cold chunk is never fetched.
+                if (field_nullable_) {
+                    if constexpr (std::is_same_v<T, std::string_view> ||
+                                  std::is_same_v<T, Json> ||
+                                  std::is_same_v<T, ArrayView> ||
+                                  std::is_same_v<T, VectorArrayView>) {
+                        auto pw = segment_->get_batch_views<T>(
+                            op_ctx_, field_id_, i, data_pos, size);
+                        ApplyValidData(pw.get().second,
+                                       res + processed_size,
+                                       valid_res + processed_size,
+                                       size);
+                    } else {
+                        auto pw =
+                            segment_->chunk_data<T>(op_ctx_, field_id_, i);
+                        auto chunk = pw.get();
+                        ApplyValidData(chunk.validity().Subview(data_pos),
+                                       res + processed_size,
+                                       valid_res + processed_size,
+                                       size);
+                    }
                 }
                 // Call func with nullptr to update internal cursors
                 if constexpr (NeedSegmentOffsets) {
@@ -1965,13 +2043,32 @@ class SegmentExpr : public Expr {
         const ValTypes&... values) {
         if (segment_->is_chunked()) {
             return ProcessDataChunksForMultipleChunk<T, NeedSegmentOffsets>(
-                func, skip_func, res, valid_res, values...);
+                EncodedChunkFunc{}, func, skip_func, res, valid_res, values...);
         } else {
             return ProcessDataChunksForSingleChunk<T, NeedSegmentOffsets>(
                 func, skip_func, res, valid_res, values...);
         }
     }
 
+    // Same as ProcessDataChunks, but lets encoded_func answer chunks of a
+    // sealed segment that carry an encoding before their raw data is read.
+    template <typename T, typename FUNC, typename... ValTypes>
+    int64_t
+    ProcessEncodedDataChunks(
+        const EncodedChunkFunc& encoded_func,
+        FUNC func,
+        std::function<bool(const milvus::SkipIndex&, FieldId, int)> skip_func,
+        TargetBitmapView res,
+        TargetBitmapView valid_res,
+        const ValTypes&... values) {
+        if (segment_->is_chunked()) {
+            return ProcessDataChunksForMultipleChunk<T>(
+                encoded_func, func, skip_func, res, valid_res, values...);
+        }
+        return ProcessDataChunksForSingleChunk<T>(
+            func, skip_func, res, valid_res, values...);
+    }
+
     // Specialized method for ngram post-filter: processes data in a specific range
     // - Starts from segment_offset (global offset across all chunks)
     // - Processes exactly 'size' rows
@@ -3077,6 +3174,7 @@ class SegmentExpr : public Expr {
 
     std::vector<std::string> nested_path_;
     DataType field_type_;
+    bool field_nullable_{false};
     DataType value_type_;
     bool allow_any_json_cast_type_{false};
     bool is_json_contains_{false};
@@ -0,0 +1,262 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/Common.h"
+#include "common/Schema.h"
+#include "common/Types.h"
+#include "expr/ITypeExpr.h"
+#include "knowhere/comp/index_param.h"
+#include "pb/plan.pb.h"
+#include "plan/PlanNode.h"
+#include "query/ExecPlanNodeVisitor.h"
+#include "test_utils/DataGen.h"
+#include "test_utils/storage_test_utils.h"
+
+using namespace milvus;
+using namespace milvus::query;
+using namespace milvus::segcore;
+
+namespace {
+
+class ChunkEncodingGuard {
+ public:
+    explicit ChunkEncodingGuard(bool enabled)
+        : old_(CHUNK_ENCODING_ENABLED.load()) {
+        CHUNK_ENCODING_ENABLED.store(enabled);
+    }
+    ~ChunkEncodingGuard() {
+        CHUNK_ENCODING_ENABLED.store(old_);
+    }
+
+ private:
+    bool old_;
+};
+
+std::unique_ptr<SegmentSealed>
+LoadSegment(SchemaPtr schema, const GeneratedData& raw_data, bool encoded) {
+    ChunkEncodingGuard guard(encoded);
+    // only mmap'd chunks are encoded
+    return CreateSealedWithFieldDataLoaded(schema, raw_data, true);
+}
+
+BitsetType
+Execute(const SegmentSealed* segment,
+        FieldId field_id,
+        DataType data_type,
+        proto::plan::OpType op,
+        const proto::plan::GenericValue& value,
+        int64_t row_nums) {
+    auto expr = std::make_shared<expr::UnaryRangeFilterExpr>(
+        expr::ColumnInfo(field_id, data_type, std::vector<std::string>()),
+        op,
+        value,
+        std::vector<proto::plan::GenericValue>{});
+    auto plan =
+        std::make_shared<plan::FilterBitsNode>(DEFAULT_PLANNODE_ID, expr);
+    return ExecuteQueryExpr(plan, segment, row_nums, MAX_TIMESTAMP);
+}
+
+}  // namespace
+
+TEST(ExprChunkEncoding, UnaryRangeOnEncodedChunks) {
+    const int64_t N = 4000;
+    auto schema = std::make_shared<Schema>();
+    schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, 16, knowhere::metric::L2);
+    auto pk_fid = schema->AddDebugField("id", DataType::INT64);
+    schema->set_primary_field_id(pk_fid);
+    auto int_fid = schema->AddDebugField("int32", DataType::INT32);
+    auto nullable_fid =
+        schema->AddDebugField("nullable_int32", DataType::INT32, true);
+    auto bool_fid = schema->AddDebugField("flag", DataType::BOOL);
+
+    auto raw_data = DataGen(schema, N);
+    for (auto& field_data : *raw_data.raw_->mutable_fields_data()) {
+        auto field_id = FieldId(field_data.field_id());
+        if (field_id == int_fid || field_id == nullable_fid) {
+            auto values = field_data.mutable_scalars()
+                              ->mutable_int_data()
+                              ->mutable_data();
+            for (int64_t i = 0; i < N; ++i) {
+                values->Set(i, i % 13);
+            }
+        } else if (field_id == bool_fid) {
+            auto values = field_data.mutable_scalars()
+                              ->mutable_bool_data()
+                              ->mutable_data();
+            for (int64_t i = 0; i < N; ++i) {
+                values->Set(i, i < 300);
+            }
+        }
+    }
+
+    auto raw_segment = LoadSegment(schema, raw_data, false);
+    auto encoded_segment = LoadSegment(schema, raw_data, true);
+
+    ChunkEncodingGuard guard(true);
+    for (auto field_id : {int_fid, nullable_fid, bool_fid}) {
+        EXPECT_EQ(raw_segment->encoded_chunk(nullptr, field_id, 0).get(),
+                  nullptr);
+        EXPECT_NE(encoded_segment->encoded_chunk(nullptr, field_id, 0).get(),
+                  nullptr);
+    }
+
+    const proto::plan::OpType ops[] = {proto::plan::OpType::Equal,
+                                       proto::plan::OpType::NotEqual,
+                                       proto::plan::OpType::GreaterThan,
+                                       proto::plan::OpType::GreaterEqual,
+                                       proto::plan::OpType::LessThan,
+                                       proto::plan::OpType::LessEqual};
+    for (auto op : ops) {
+        for (int64_t literal : {-1, 0, 5, 12, 13, 100}) {
+            proto::plan::GenericValue value;
+            value.set_int64_val(literal);
+            for (auto field_id : {int_fid, nullable_fid}) {
+                auto expected = Execute(raw_segment.get(),
+                                        field_id,
+                                        DataType::INT32,
+                                        op,
+                                        value,
+                                        N);
+                auto actual = Execute(encoded_segment.get(),
+                                      field_id,
+                                      DataType::INT32,
+                                      op,
+                                      value,
+                                      N);
+                ASSERT_EQ(expected.size(), actual.size());
+                for (int64_t i = 0; i < N; ++i) {
+                    ASSERT_EQ(expected[i], actual[i])
+                        << "op " << op << ", literal " << literal << ", row "
+                        << i;
+                }
+            }
+        }
+    }
+
+    for (auto op :
+         {proto::plan::OpType::Equal, proto::plan::OpType::NotEqual}) {
+        for (bool literal : {true, false}) {
+            proto::plan::GenericValue value;
+            value.set_bool_val(literal);
+            auto expected = Execute(
+                raw_segment.get(), bool_fid, DataType::BOOL, op, value, N);
+            auto actual = Execute(
+                encoded_segment.get(), bool_fid, DataType::BOOL, op, value, N);
+            for (int64_t i = 0; i < N; ++i) {
+                ASSERT_EQ(expected[i], actual[i]);
+                ASSERT_EQ(actual[i],
+                          op == proto::plan::OpType::Equal
+                              ? (i < 300) == literal
+                              : (i < 300) != literal);
+            }
+        }
+    }
+}
+
+TEST(ExprChunkEncoding, StringPredicatesOnDictionaryCodes) {
+    const int64_t N = 4000;
+    const std::vector<std::string> categories = {
+        "active", "archived", "banned", "deleted", "pending", "suspended"};
+    auto schema = std::make_shared<Schema>();
+    schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, 16, knowhere::metric::L2);
+    auto pk_fid = schema->AddDebugField("id", DataType::INT64);
+    schema->set_primary_field_id(pk_fid);
+    auto str_fid = schema->AddDebugField("status", DataType::VARCHAR);
+    auto nullable_fid =
+        schema->AddDebugField("nullable_status", DataType::VARCHAR, true);
+
+    auto raw_data = DataGen(schema, N);
+    for (auto& field_data : *raw_data.raw_->mutable_fields_data()) {
+        auto field_id = FieldId(field_data.field_id());
+        if (field_id == str_fid || field_id == nullable_fid) {
+            auto values = field_data.mutable_scalars()
+                              ->mutable_string_data()
+                              ->mutable_data();
+            for (int64_t i = 0; i < N; ++i) {
+                *values->Mutable(i) = categories[(i / 7) % categories.size()];
+            }
+        }
+    }
+
+    auto raw_segment = LoadSegment(schema, raw_data, false);
+    auto encoded_segment = LoadSegment(schema, raw_data, true);
+
+    ChunkEncodingGuard guard(true);
+    for (auto field_id : {str_fid, nullable_fid}) {
+        EXPECT_NE(encoded_segment->encoded_chunk(nullptr, field_id, 0).get(),
+                  nullptr);
+    }
+
+    auto expect_same = [&](const expr::TypedExprPtr& expr,
+                           const std::string& name) {
+        auto plan =
+            std::make_shared<plan::FilterBitsNode>(DEFAULT_PLANNODE_ID, expr);
+        auto expected =
+            ExecuteQueryExpr(plan, raw_segment.get(), N, MAX_TIMESTAMP);
+        auto actual =
+            ExecuteQueryExpr(plan, encoded_segment.get(), N, MAX_TIMESTAMP);
+        ASSERT_EQ(expected.size(), actual.size());
+        for (int64_t i = 0; i < N; ++i) {
+            ASSERT_EQ(expected[i], actual[i]) << name << ", row " << i;
+        }
+    };
+
+    // present literals, absent ones inside and outside the dictionary range
+    const std::vector<std::string> literals = {
+        "active", "pending", "suspended", "b", "zzz", "", "unknown"};
+    const proto::plan::OpType ops[] = {proto::plan::OpType::Equal,
+                                       proto::plan::OpType::NotEqual,
+                                       proto::plan::OpType::GreaterThan,
+                                       proto::plan::OpType::GreaterEqual,
+                                       proto::plan::OpType::LessThan,
+                                       proto::plan::OpType::LessEqual};
+    for (auto field_id : {str_fid, nullable_fid}) {
+        expr::ColumnInfo column(
+            field_id, DataType::VARCHAR, std::vector<std::string>());
+        for (const auto& literal : literals) {
+            proto::plan::GenericValue value;
+            value.set_string_val(literal);
+            for (auto op : ops) {
+                expect_same(std::make_shared<expr::UnaryRangeFilterExpr>(
+                                column, op, value),
+                            "unary " + literal);
+            }
+        }
+
+        const std::vector<std::vector<std::string>> in_lists = {
+            {"unknown"},
+            {"banned"},
+            {"active", "archived", "banned"},
+            {"active", "deleted", "missing", "suspended"},
+            {"active", "archived", "banned", "deleted", "pending", "suspended"},
+        };
+        for (const auto& in_list : in_lists) {
+            std::vector<proto::plan::GenericValue> values;
+            std::string name = "in";
+            for (const auto& literal : in_list) {
+                proto::plan::GenericValue value;
+                value.set_string_val(literal);
+                values.push_back(value);
+                name += " " + literal;
+            }
+            expect_same(std::make_shared<expr::TermFilterExpr>(column, values),
+                        name);
+        }
+    }
+}
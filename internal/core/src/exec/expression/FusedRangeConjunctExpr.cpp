@@ -0,0 +1,470 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "exec/expression/FusedRangeConjunctExpr.h"
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+
+#include "bitset/common.h"
+#include "common/Common.h"
+#include "common/EasyAssert.h"
+#include "common/Tracer.h"
+#include "common/Utils.h"
+#include "common/ValueOp.h"
+#include "exec/expression/EvalCtx.h"
+#include "exec/expression/UnaryExpr.h"
+#include "exec/expression/Utils.h"
+#include "index/SkipIndex.h"
+#include "query/Utils.h"
+
+namespace milvus {
+namespace exec {
+
+// One comparison of the fused conjunction, with a cursor over the chunks of
+// its column.
+class FusedRangeTerm {
+ public:
+    virtual ~FusedRangeTerm() = default;
+
+    // Rows left in the current chunk, moving on to the next chunk when the
+    // current one is done. `skipped` tells whether the skip index rules the
+    // chunk out.
+    virtual int64_t
+    Seek(bool& skipped) = 0;
+
+    // Pin the current chunk for Compare.
+    virtual void
+    Pin() = 0;
+
+    // Compare `size` (at most 64) rows, starting `offset` rows after the
+    // cursor. Bit k of the result is the k-th row.
+    virtual uint64_t
+    Compare(int64_t offset, int size) const = 0;
+
+    // Move the cursor `size` rows ahead, across chunks if need be.
+    virtual void
+    Advance(int64_t size) = 0;
+};
+
+namespace {
+
+template <typename T, milvus::bitset::CompareOpType Op>
+uint64_t
+CompareBlock(const T* data, int size, T value) {
+    using Operator = milvus::bitset::CompareOperator<Op>;
+    uint64_t mask = 0;
+    if (size == 64) {
+        // the fixed trip count lets the compare and the packing vectorize
+        for (int k = 0; k < 64; ++k) {
+            mask |= uint64_t(Operator::compare(data[k], value)) << k;
+        }
+        return mask;
+    }
+    for (int k = 0; k < size; ++k) {
+        mask |= uint64_t(Operator::compare(data[k], value)) << k;
+    }
+    return mask;
+}
+
+template <typename T>
+using CompareBlockFunc = uint64_t (*)(const T*, int, T);
+
+template <typename T>
+CompareBlockFunc<T>
+PickCompareBlock(proto::plan::OpType op) {
+    using milvus::bitset::CompareOpType;
+    switch (op) {
+        case proto::plan::GreaterThan:
+            return &CompareBlock<T, CompareOpType::GT>;
+        case proto::plan::GreaterEqual:
+            return &CompareBlock<T, CompareOpType::GE>;
+        case proto::plan::LessThan:
+            return &CompareBlock<T, CompareOpType::LT>;
+        case proto::plan::LessEqual:
+            return &CompareBlock<T, CompareOpType::LE>;
+        case proto::plan::Equal:
+            return &CompareBlock<T, CompareOpType::EQ>;
+        case proto::plan::NotEqual:
+            return &CompareBlock<T, CompareOpType::NE>;
+        default:
+            ThrowInfo(OpTypeInvalid,
+                      "unsupported op {} for fused range conjunct",
+                      op);
+    }
+}
+
+template <typename T>
+class TypedFusedRangeTerm : public FusedRangeTerm {
+ public:
+    TypedFusedRangeTerm(const segcore::SegmentInternalInterface* segment,
+                        milvus::OpContext* op_ctx,
+                        const expr::UnaryRangeFilterExpr& expr,
+                        int64_t active_count)
+        : segment_(segment),
+          op_ctx_(op_ctx),
+          field_id_(expr.column_.field_id_),
+          op_(expr.op_type_),
+          value_(GetValueFromProto<T>(expr.val_)),
+          compare_(PickCompareBlock<T>(expr.op_type_)),
+          active_count_(active_count),
+          size_per_chunk_(segment->size_per_chunk()) {
+        num_chunk_ = segment->is_chunked()
+                         ? segment->num_chunk_data(field_id_)
+                         : upper_div(active_count_, size_per_chunk_);
+    }
+
+    int64_t
+    Seek(bool& skipped) override {
+        while (chunk_pos_ == ChunkRows(chunk_id_)) {
+            NextChunk();
+        }
+        if (!skip_checked_) {
+            chunk_skipped_ =
+                segment_->GetSkipIndex()->template CanSkipUnaryRange<T>(
+                    op_ctx_, field_id_, chunk_id_, op_, value_);
+            skip_checked_ = true;
+        }
+        skipped = chunk_skipped_;
+        return ChunkRows(chunk_id_) - chunk_pos_;
+    }
+
+    void
+    Pin() override {
+        if (!pw_.has_value()) {
+            pw_.emplace(
+                segment_->chunk_data<T>(op_ctx_, field_id_, chunk_id_));
+        }
+    }
+
+    uint64_t
+    Compare(int64_t offset, int size) const override {
+        return compare_(
+            pw_->get().data() + chunk_pos_ + offset, size, value_);
+    }
+
+    void
+    Advance(int64_t size) override {
+        while (size > 0) {
+            auto step = std::min(size, ChunkRows(chunk_id_) - chunk_pos_);
+            if (step == 0) {
+                NextChunk();
+                continue;
+            }
+            chunk_pos_ += step;
+            size -= step;
+        }
+    }
+
+ private:
+    // Non-chunked segments are growing ones, chunked at size_per_chunk_ rows
+    // with only the rows before active_count_ visible.
+    int64_t
+    ChunkRows(int64_t chunk_id) const {
+        if (segment_->is_chunked()) {
+            return segment_->chunk_size(field_id_, chunk_id);
+        }
+        return std::min(size_per_chunk_,
+                        active_count_ - chunk_id * size_per_chunk_);
+    }
+
+    void
+    NextChunk() {
+        AssertInfo(chunk_id_ + 1 < num_chunk_,
+                   "fused range conjunct ran past the last chunk {} of "
+                   "field {}",
+                   num_chunk_,
+                   field_id_.get());
+        chunk_id_++;
+        chunk_pos_ = 0;
+        pw_.reset();
+        skip_checked_ = false;
+    }
+
+    const segcore::SegmentInternalInterface* segment_;
+    milvus::OpContext* op_ctx_;
+    const FieldId field_id_;
+    const proto::plan::OpType op_;
+    const T value_;
+    const CompareBlockFunc<T> compare_;
+    const int64_t active_count_;
+    const int64_t size_per_chunk_;
+    int64_t num_chunk_{0};
+
+    int64_t chunk_id_{0};
+    int64_t chunk_pos_{0};
+    std::optional<PinWrapper<Span<T>>> pw_;
+    bool skip_checked_{false};
+    bool chunk_skipped_{false};
+};
+
+template <typename T>
+bool
+ValueFitsColumn(const proto::plan::GenericValue& value) {
+    if constexpr (std::is_integral_v<T>) {
+        // an out of range constant is answered by the unfused comparison
+        // without reading the column
+        return value.val_case() == proto::plan::GenericValue::kInt64Val &&
+               !milvus::query::out_of_range<T>(value.int64_val());
+    } else {
+        return value.val_case() == proto::plan::GenericValue::kFloatVal;
+    }
+}
+
+std::unique_ptr<FusedRangeTerm>
+MakeTerm(const segcore::SegmentInternalInterface* segment,
+         milvus::OpContext* op_ctx,
+         const expr::UnaryRangeFilterExpr& expr,
+         int64_t active_count) {
+    switch (expr.column_.data_type_) {
+        case DataType::INT8:
+            return std::make_unique<TypedFusedRangeTerm<int8_t>>(
+                segment, op_ctx, expr, active_count);
+        case DataType::INT16:
+            return std::make_unique<TypedFusedRangeTerm<int16_t>>(
+                segment, op_ctx, expr, active_count);
+        case DataType::INT32:
+            return std::make_unique<TypedFusedRangeTerm<int32_t>>(
+                segment, op_ctx, expr, active_count);
+        case DataType::INT64:
+            return std::make_unique<TypedFusedRangeTerm<int64_t>>(
+                segment, op_ctx, expr, active_count);
+        case DataType::FLOAT:
+            return std::make_unique<TypedFusedRangeTerm<float>>(
+                segment, op_ctx, expr, active_count);
+        case DataType::DOUBLE:
+            return std::make_unique<TypedFusedRangeTerm<double>>(
+                segment, op_ctx, expr, active_count);
+        default:
+            ThrowInfo(DataTypeInvalid,
+                      "unsupported data type {} for fused range conjunct",
+                      expr.column_.data_type_);
+    }
+}
+
+}  // namespace
+
+PhyFusedRangeConjunctExpr::PhyFusedRangeConjunctExpr(
+    std::vector<std::shared_ptr<PhyUnaryRangeFilterExpr>> exprs,
+    milvus::OpContext* op_ctx,
+    const segcore::SegmentInternalInterface* segment,
+    int64_t active_count,
+    int64_t batch_size,
+    std::pmr::memory_resource* scratch)
+    : Expr(DataType::BOOL,
+           std::vector<ExprPtr>(exprs.begin(), exprs.end()),
+           "PhyFusedRangeConjunctExpr",
+           op_ctx),
+      words_(scratch != nullptr ? scratch : std::pmr::get_default_resource()),
+      active_count_(active_count),
+      batch_size_(batch_size) {
+    AssertInfo(batch_size_ > 0,
+               "expr batch size should greater than zero, but now: {}",
+               batch_size_);
+    terms_.reserve(exprs.size());
+    for (const auto& expr : exprs) {
+        terms_.push_back(
+            MakeTerm(segment, op_ctx, *expr->GetLogicalExpr(), active_count));
+    }
+}
+
+PhyFusedRangeConjunctExpr::~PhyFusedRangeConjunctExpr() = default;
+
+std::shared_ptr<PhyUnaryRangeFilterExpr>
+PhyFusedRangeConjunctExpr::AsFusable(
+    const ExprPtr& expr, const segcore::SegmentInternalInterface* segment) {
+    if (expr->name() != "PhyUnaryRangeFilterExpr") {
+        return nullptr;
+    }
+    auto unary = std::dynamic_pointer_cast<PhyUnaryRangeFilterExpr>(expr);
+    if (!unary) {
+        return nullptr;
+    }
+    const auto& logical = *unary->GetLogicalExpr();
+    const auto& column = logical.column_;
+    if (!column.nested_path_.empty() || column.element_level_) {
+        return nullptr;
+    }
+    switch (logical.op_type_) {
+        case proto::plan::GreaterThan:
+        case proto::plan::GreaterEqual:
+        case proto::plan::LessThan:
+        case proto::plan::LessEqual:
+        case proto::plan::Equal:
+        case proto::plan::NotEqual:
+            break;
+        default:
+            return nullptr;
+    }
+    bool fits = false;
+    switch (column.data_type_) {
+        case DataType::INT8:
+            fits = ValueFitsColumn<int8_t>(logical.val_);
+            break;
+        case DataType::INT16:
+            fits = ValueFitsColumn<int16_t>(logical.val_);
+            break;
+        case DataType::INT32:
+            fits = ValueFitsColumn<int32_t>(logical.val_);
+            break;
+        case DataType::INT64:
+            fits = ValueFitsColumn<int64_t>(logical.val_);
+            break;
+        case DataType::FLOAT:
+            fits = ValueFitsColumn<float>(logical.val_);
+            break;
+        case DataType::DOUBLE:
+            fits = ValueFitsColumn<double>(logical.val_);
+            break;
+        default:
+            return nullptr;
+    }
+    if (!fits) {
+        return nullptr;
+    }
+
+    auto schema = segment->get_schema_snapshot();
+    auto field_id = column.field_id_;
+    if ((*schema)[field_id].is_nullable() ||
+        schema->get_primary_field_id() == field_id ||
+        schema->get_namespace_field_id() == field_id) {
+        return nullptr;
+    }
+    if (!segment->HasFieldData(field_id) || segment->HasIndex(field_id)) {
+        return nullptr;
+    }
+    // encoded integer chunks are compared on their codes by the unfused
+    // comparison
+    if (IsIntegerDataType(column.data_type_) &&
+        segment->type() == SegmentType::Sealed &&
+        CHUNK_ENCODING_ENABLED.load(std::memory_order_relaxed)) {
+        return nullptr;
+    }
+    return unary;
+}
+
+int64_t
+PhyFusedRangeConjunctExpr::GetNextBatchSize() const {
+    return std::min(batch_size_, active_count_ - current_pos_);
+}
+
+void
+PhyFusedRangeConjunctExpr::MoveCursor() {
+    if (has_offset_input_) {
+        return;
+    }
+    auto size = GetNextBatchSize();
+    for (auto& term : terms_) {
+        term->Advance(size);
+    }
+    current_pos_ += size;
+}
+
+std::string
+PhyFusedRangeConjunctExpr::ToString() const {
+    std::vector<std::string> inputs;
+    inputs.reserve(inputs_.size());
+    for (const auto& input : inputs_) {
+        inputs.push_back(input->ToString());
+    }
+    return fmt::format("[FusedRangeConjunctExpr:{}]", Join(inputs, " && "));
+}
+
+void
+PhyFusedRangeConjunctExpr::Eval(EvalCtx& context, VectorPtr& result) {
+    WaitPrefetch();
+    tracer::AutoSpan span(
+        "PhyFusedRangeConjunctExpr::Eval", tracer::GetRootSpan(), true);
+    span.GetSpan()->SetAttribute("num_terms",
+                                 static_cast<int>(terms_.size()));
+
+    SetHasOffsetInput(context.get_offset_input() != nullptr);
+    if (has_offset_input_) {
+        EvalInputs(context, result);
+        return;
+    }
+
+    auto real_batch_size = GetNextBatchSize();
+    if (real_batch_size <= 0) {
+        result = nullptr;
+        return;
+    }
+    auto res_vec = MakeBitmapResult(context, real_batch_size);
+    TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
+
+    int64_t processed = 0;
+    while (processed < real_batch_size) {
+        auto size = real_batch_size - processed;
+        bool skipped = false;
+        for (auto& term : terms_) {
+            bool term_skipped = false;
+            size = std::min(size, term->Seek(term_skipped));
+            skipped |= term_skipped;
+        }
+        // a chunk the skip index rules out leaves its rows false
+        if (!skipped) {
+            for (auto& term : terms_) {
+                term->Pin();
+            }
+            EvalSlice(res + processed, size);
+        }
+        for (auto& term : terms_) {
+            term->Advance(size);
+        }
+        processed += size;
+    }
+    current_pos_ += real_batch_size;
+    result = std::move(res_vec);
+}
+
+void
+PhyFusedRangeConjunctExpr::EvalSlice(TargetBitmapView res, int64_t size) {
+    words_.resize(upper_div(size, 64));
+    for (int64_t begin = 0; begin < size; begin += 64) {
+        const int block = static_cast<int>(std::min<int64_t>(64, size - begin));
+        uint64_t mask = block == 64 ? ~uint64_t{0} : (uint64_t{1} << block) - 1;
+        for (const auto& term : terms_) {
+            mask &= term->Compare(begin, block);
+            if (mask == 0) {
+                break;
+            }
+        }
+        words_[begin / 64] = mask;
+    }
+    res.inplace_or(TargetBitmapView(words_.data(), size), size);
+}
+
+void
+PhyFusedRangeConjunctExpr::EvalInputs(EvalCtx& context, VectorPtr& result) {
+    result = nullptr;
+    for (auto& input : inputs_) {
+        VectorPtr input_result;
+        input->Eval(context, input_result);
+        if (result == nullptr) {
+            result = std::move(input_result);
+            continue;
+        }
+        common::ThreeValuedLogicOp::And(GetColumnVector(result),
+                                        GetColumnVector(input_result));
+        if (auto* pool = context.memory_pool(); pool != nullptr) {
+            pool->Recycle(std::move(input_result));
+        }
+    }
+}
+
+}  // namespace exec
+}  // namespace milvus
@@ -0,0 +1,102 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "common/OpContext.h"
+#include "exec/expression/Expr.h"
+#include "segcore/SegmentInterface.h"
+
+namespace milvus {
+namespace exec {
+
+class FusedRangeTerm;
+class PhyUnaryRangeFilterExpr;
+
+// PhyFusedRangeConjunctExpr evaluates an AND of comparisons of fixed-width
+// columns against constants, like `a > 10 && b < 5 && c == 3`, in a single
+// pass instead of one bitmap per comparison. Rows are compared 64 at a time:
+// every comparison ANDs its bits into one word, the following comparisons are
+// skipped once the word is empty, and the word is written to the result once.
+// Each comparison walks the chunks of its own column, so columns chunked at
+// different rows are compared in the slices they have in common.
+//
+// With an offset input the original comparisons are evaluated instead.
+class PhyFusedRangeConjunctExpr : public Expr {
+ public:
+    PhyFusedRangeConjunctExpr(
+        std::vector<std::shared_ptr<PhyUnaryRangeFilterExpr>> exprs,
+        milvus::OpContext* op_ctx,
+        const segcore::SegmentInternalInterface* segment,
+        int64_t active_count,
+        int64_t batch_size,
+        std::pmr::memory_resource* scratch = nullptr);
+
+    ~PhyFusedRangeConjunctExpr() override;
+
+    // `expr` if it compares a non-nullable numeric column that has raw data
+    // and no index to a constant, nullptr otherwise. The primary key and the
+    // namespace field are left alone, they have paths of their own.
+    static std::shared_ptr<PhyUnaryRangeFilterExpr>
+    AsFusable(const ExprPtr& expr,
+              const segcore::SegmentInternalInterface* segment);
+
+    void
+    Eval(EvalCtx& context, VectorPtr& result) override;
+
+    void
+    MoveCursor() override;
+
+    std::string
+    ToString() const override;
+
+    std::optional<milvus::expr::ColumnInfo>
+    GetColumnInfo() const override {
+        return std::nullopt;
+    }
+
+ private:
+    int64_t
+    GetNextBatchSize() const;
+
+    // AND the comparisons of the `size` rows after the term cursors into
+    // res.
+    void
+    EvalSlice(TargetBitmapView res, int64_t size);
+
+    // AND the results of the original comparisons.
+    void
+    EvalInputs(EvalCtx& context, VectorPtr& result);
+
+    std::vector<std::unique_ptr<FusedRangeTerm>> terms_;
+    // result words of the slice being compared, kept in the query's arena
+    // when there is one
+    std::pmr::vector<uint64_t> words_;
+
+    int64_t active_count_{0};
+    int64_t batch_size_{0};
+    int64_t current_pos_{0};
+};
+
+}  // namespace exec
+}  // namespace milvus
@@ -0,0 +1,564 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/Common.h"
+#include "common/IndexMeta.h"
+#include "common/Schema.h"
+#include "common/Types.h"
+#include "exec/QueryContext.h"
+#include "exec/expression/Expr.h"
+#include "expr/ITypeExpr.h"
+#include "knowhere/comp/index_param.h"
+#include "pb/plan.pb.h"
+#include "plan/PlanNode.h"
+#include "query/ExecPlanNodeVisitor.h"
+#include "segcore/SegcoreConfig.h"
+#include "segcore/SegmentGrowingImpl.h"
+#include "segcore/SegmentSealed.h"
+#include "test_utils/DataGen.h"
+#include "test_utils/GenExprProto.h"
+#include "test_utils/storage_test_utils.h"
+
+using namespace milvus;
+using namespace milvus::query;
+using namespace milvus::segcore;
+
+namespace {
+
+class FusedRangeConjunctGuard {
+ public:
+    explicit FusedRangeConjunctGuard(bool enabled)
+        : old_(FUSED_RANGE_CONJUNCT_ENABLED.load()) {
+        FUSED_RANGE_CONJUNCT_ENABLED.store(enabled);
+    }
+    ~FusedRangeConjunctGuard() {
+        FUSED_RANGE_CONJUNCT_ENABLED.store(old_);
+    }
+
+ private:
+    bool old_;
+};
+
+// A batch size that is no multiple of 64, so batches start inside result
+// words.
+class BatchSizeGuard {
+ public:
+    explicit BatchSizeGuard(int64_t batch_size)
+        : old_(EXEC_EVAL_EXPR_BATCH_SIZE.load()) {
+        EXEC_EVAL_EXPR_BATCH_SIZE.store(batch_size);
+    }
+    ~BatchSizeGuard() {
+        EXEC_EVAL_EXPR_BATCH_SIZE.store(old_);
+    }
+
+ private:
+    int64_t old_;
+};
+
+// SegcoreConfig keeps chunk_rows in a static, every segment reads it. Declare
+// the guard before the segments it is for.
+class ChunkRowsGuard {
+ public:
+    explicit ChunkRowsGuard(int64_t chunk_rows)
+        : old_(SegcoreConfig::default_config().get_chunk_rows()) {
+        SegcoreConfig::default_config().set_chunk_rows(chunk_rows);
+    }
+    ~ChunkRowsGuard() {
+        SegcoreConfig::default_config().set_chunk_rows(old_);
+    }
+
+ private:
+    int64_t old_;
+};
+
+// Rows [begin, end) of a generated field.
+DataArray
+SliceRows(const DataArray& data, int64_t begin, int64_t end, int64_t dim) {
+    auto slice = data;
+    auto keep = [](auto* values, int64_t from, int64_t to) {
+        auto all = *values;
+        values->Clear();
+        for (auto i = from; i < to; ++i) {
+            values->Add(all.Get(i));
+        }
+    };
+    if (slice.has_scalars()) {
+        auto* scalars = slice.mutable_scalars();
+        if (scalars->has_int_data()) {
+            keep(scalars->mutable_int_data()->mutable_data(), begin, end);
+        } else if (scalars->has_long_data()) {
+            keep(scalars->mutable_long_data()->mutable_data(), begin, end);
+        } else if (scalars->has_float_data()) {
+            keep(scalars->mutable_float_data()->mutable_data(), begin, end);
+        } else if (scalars->has_double_data()) {
+            keep(scalars->mutable_double_data()->mutable_data(), begin, end);
+        }
+        if (scalars->valid_data_size() > 0) {
+            keep(scalars->mutable_valid_data(), begin, end);
+        }
+    } else if (slice.vectors().has_float_vector()) {
+        keep(slice.mutable_vectors()->mutable_float_vector()->mutable_data(),
+             begin * dim,
+             end * dim);
+    }
+    if (slice.valid_data_size() > 0) {
+        keep(slice.mutable_valid_data(), begin, end);
+    }
+    return slice;
+}
+
+struct Predicate {
+    FieldId field_id;
+    DataType data_type;
+    proto::plan::OpType op;
+    proto::plan::GenericValue value;
+    std::function<bool(int64_t)> matches;
+};
+
+proto::plan::GenericValue
+IntValue(int64_t v) {
+    proto::plan::GenericValue value;
+    value.set_int64_val(v);
+    return value;
+}
+
+proto::plan::GenericValue
+FloatValue(double v) {
+    proto::plan::GenericValue value;
+    value.set_float_val(v);
+    return value;
+}
+
+expr::TypedExprPtr
+MakeConjunction(const std::vector<Predicate>& predicates) {
+    expr::TypedExprPtr conjunction;
+    for (const auto& predicate : predicates) {
+        auto unary = std::make_shared<expr::UnaryRangeFilterExpr>(
+            expr::ColumnInfo(predicate.field_id,
+                             predicate.data_type,
+                             std::vector<std::string>()),
+            predicate.op,
+            predicate.value,
+            std::vector<proto::plan::GenericValue>{});
+        conjunction =
+            conjunction == nullptr
+                ? expr::TypedExprPtr(unary)
+                : std::make_shared<expr::LogicalBinaryExpr>(
+                      expr::LogicalBinaryExpr::OpType::And, conjunction, unary);
+    }
+    return conjunction;
+}
+
+// Names of the inputs of the compiled conjunction, and the number of
+// comparisons fused.
+std::vector<std::string>
+CompiledInputs(const SegmentInternalInterface* segment,
+               const expr::TypedExprPtr& conjunction,
+               int64_t row_count,
+               size_t& num_fused) {
+    auto query_context = std::make_shared<exec::QueryContext>(
+        DEAFULT_QUERY_ID, segment, row_count, MAX_TIMESTAMP);
+    exec::ExecContext exec_context(query_context.get());
+    exec::ExprSet expr_set({conjunction}, &exec_context);
+    auto compiled = expr_set.exprs()[0];
+    std::vector<std::string> names;
+    num_fused = 0;
+    for (auto& input : compiled->GetInputsRef()) {
+        names.push_back(input->name());
+        if (input->name() == "PhyFusedRangeConjunctExpr") {
+            num_fused = input->GetInputsRef().size();
+        }
+    }
+    return names;
+}
+
+class FusedRangeConjunctExprTest : public testing::Test {
+ protected:
+    static constexpr int64_t N = 10000;
+
+    void
+    SetUp() override {
+        schema_ = std::make_shared<Schema>();
+        schema_->AddDebugField(
+            "fakevec", DataType::VECTOR_FLOAT, 16, knowhere::metric::L2);
+        pk_fid_ = schema_->AddDebugField("id", DataType::INT64);
+        schema_->set_primary_field_id(pk_fid_);
+        i8_fid_ = schema_->AddDebugField("i8", DataType::INT8);
+        i16_fid_ = schema_->AddDebugField("i16", DataType::INT16);
+        i32_fid_ = schema_->AddDebugField("i32", DataType::INT32);
+        i64_fid_ = schema_->AddDebugField("i64", DataType::INT64);
+        float_fid_ = schema_->AddDebugField("f", DataType::FLOAT);
+        double_fid_ = schema_->AddDebugField("d", DataType::DOUBLE);
+        nullable_fid_ =
+            schema_->AddDebugField("nullable_i32", DataType::INT32, true);
+
+        raw_data_ = DataGen(schema_, N);
+        nullable_valid_.assign(N, true);
+        for (auto& field_data : *raw_data_.raw_->mutable_fields_data()) {
+            auto field_id = FieldId(field_data.field_id());
+            auto* scalars = field_data.mutable_scalars();
+            for (int64_t i = 0; i < N; ++i) {
+                if (field_id == pk_fid_) {
+                    scalars->mutable_long_data()->set_data(i, i);
+                } else if (field_id == i8_fid_) {
+                    scalars->mutable_int_data()->set_data(i, I8(i));
+                } else if (field_id == i16_fid_) {
+                    scalars->mutable_int_data()->set_data(i, I16(i));
+                } else if (field_id == i32_fid_) {
+                    scalars->mutable_int_data()->set_data(i, I32(i));
+                } else if (field_id == i64_fid_) {
+                    scalars->mutable_long_data()->set_data(i, I64(i));
+                } else if (field_id == float_fid_) {
+                    scalars->mutable_float_data()->set_data(i, F(i));
+                } else if (field_id == double_fid_) {
+                    scalars->mutable_double_data()->set_data(i, D(i));
+                } else if (field_id == nullable_fid_) {
+                    scalars->mutable_int_data()->set_data(i, I32(i));
+                    nullable_valid_[i] = field_data.valid_data(i);
+                }
+            }
+        }
+
+        sealed_ = CreateSealedWithFieldDataLoaded(schema_, raw_data_);
+        growing_ = CreateGrowingSegment(schema_, empty_index_meta);
+        growing_->PreInsert(N);
+        growing_->Insert(0,
+                         N,
+                         raw_data_.row_ids_.data(),
+                         raw_data_.timestamps_.data(),
+                         raw_data_.raw_);
+    }
+
+    static int64_t
+    I8(int64_t i) {
+        return i % 200 - 100;
+    }
+    static int64_t
+    I16(int64_t i) {
+        return i * 7 % 1000;
+    }
+    static int64_t
+    I32(int64_t i) {
+        return i % 97;
+    }
+    static int64_t
+    I64(int64_t i) {
+        return i * 3;
+    }
+    static float
+    F(int64_t i) {
+        return static_cast<float>(i % 50) * 0.5f;
+    }
+    static double
+    D(int64_t i) {
+        return static_cast<double>(i % 31) * 1.25;
+    }
+
+    // The filters checked, each against the row predicate it stands for.
+    std::vector<std::vector<Predicate>>
+    Filters() const {
+        using proto::plan::OpType;
+        const auto& valid = nullable_valid_;
+        return {
+            // i8 > -50 && i16 < 600 && i32 == 7
+            {{i8_fid_,
+              DataType::INT8,
+              OpType::GreaterThan,
+              IntValue(-50),
+              [](int64_t i) { return I8(i) > -50; }},
+             {i16_fid_,
+              DataType::INT16,
+              OpType::LessThan,
+              IntValue(600),
+              [](int64_t i) { return I16(i) < 600; }},
+             {i32_fid_,
+              DataType::INT32,
+              OpType::Equal,
+              IntValue(7),
+              [](int64_t i) { return I32(i) == 7; }}},
+            // i64 >= 300 && i64 <= 21000 && f != 3.0 && d < 20.0
+            {{i64_fid_,
+              DataType::INT64,
+              OpType::GreaterEqual,
+              IntValue(300),
+              [](int64_t i) { return I64(i) >= 300; }},
+             {i64_fid_,
+              DataType::INT64,
+              OpType::LessEqual,
+              IntValue(21000),
+              [](int64_t i) { return I64(i) <= 21000; }},
+             {float_fid_,
+              DataType::FLOAT,
+              OpType::NotEqual,
+              FloatValue(3.0),
+              [](int64_t i) { return F(i) != 3.0f; }},
+             {double_fid_,
+              DataType::DOUBLE,
+              OpType::LessThan,
+              FloatValue(20.0),
+              [](int64_t i) { return D(i) < 20.0; }}},
+            // i32 != 5 && f <= 10.0 && nullable_i32 > 3, the nullable column
+            // stays unfused
+            {{i32_fid_,
+              DataType::INT32,
+              OpType::NotEqual,
+              IntValue(5),
+              [](int64_t i) { return I32(i) != 5; }},
+             {float_fid_,
+              DataType::FLOAT,
+              OpType::LessEqual,
+              FloatValue(10.0),
+              [](int64_t i) { return F(i) <= 10.0f; }},
+             {nullable_fid_,
+              DataType::INT32,
+              OpType::GreaterThan,
+              IntValue(3),
+              [&valid](int64_t i) { return valid[i] && I32(i) > 3; }}},
+            // i8 < 1000 overflows the column and stays unfused, as does the
+            // primary key comparison
+            {{i8_fid_,
+              DataType::INT8,
+              OpType::LessThan,
+              IntValue(1000),
+              [](int64_t) { return true; }},
+             {pk_fid_,
+              DataType::INT64,
+              OpType::GreaterThan,
+              IntValue(100),
+              [](int64_t i) { return i > 100; }},
+             {i16_fid_,
+              DataType::INT16,
+              OpType::GreaterEqual,
+              IntValue(10),
+              [](int64_t i) { return I16(i) >= 10; }},
+             {double_fid_,
+              DataType::DOUBLE,
+              OpType::GreaterEqual,
+              FloatValue(5.0),
+              [](int64_t i) { return D(i) >= 5.0; }}},
+            // nothing matches
+            {{i32_fid_,
+              DataType::INT32,
+              OpType::GreaterThan,
+              IntValue(96),
+              [](int64_t) { return false; }},
+             {i16_fid_,
+              DataType::INT16,
+              OpType::LessThan,
+              IntValue(500),
+              [](int64_t i) { return I16(i) < 500; }}},
+        };
+    }
+
+    // A sealed segment with chunk boundaries of its own for every field, so
+    // the chunks of the fused columns never line up.
+    SegmentSealedUPtr
+    CreateMisalignedSealed() const {
+        auto segment = CreateSealedSegment(schema_, empty_index_meta);
+        auto cm = storage::RemoteChunkManagerSingleton::GetInstance()
+                      .GetRemoteChunkManager();
+        int64_t k = 0;
+        auto load = [&](FieldId field_id,
+                        const std::function<FieldDataPtr(int64_t, int64_t)>&
+                            rows) {
+            std::vector<int64_t> bounds = {
+                0, 1500 + 211 * k, 4100 + 97 * k, 7777 - 53 * k, N};
+            k++;
+            std::vector<FieldDataPtr> chunks;
+            for (size_t c = 0; c + 1 < bounds.size(); ++c) {
+                chunks.push_back(rows(bounds[c], bounds[c + 1]));
+            }
+            auto load_info = PrepareSingleFieldInsertBinlog(kCollectionID,
+                                                            kPartitionID,
+                                                            kSegmentID,
+                                                            field_id.get(),
+                                                            chunks,
+                                                            cm);
+            segment->LoadFieldData(load_info);
+        };
+
+        load(TimestampFieldID, [this](int64_t begin, int64_t end) {
+            auto field_data =
+                std::make_shared<FieldData<int64_t>>(DataType::INT64, false);
+            field_data->FillFieldData(raw_data_.timestamps_.data() + begin,
+                                      end - begin);
+            return field_data;
+        });
+        for (const auto& data : raw_data_.raw_->fields_data()) {
+            const auto& field_meta = (*schema_)[FieldId(data.field_id())];
+            auto dim = IsVectorDataType(field_meta.get_data_type())
+                           ? field_meta.get_dim()
+                           : 1;
+            load(field_meta.get_id(), [&](int64_t begin, int64_t end) {
+                auto slice = SliceRows(data, begin, end, dim);
+                return CreateFieldDataFromDataArray(
+                    end - begin, &slice, field_meta);
+            });
+        }
+        return segment;
+    }
+
+    void
+    ExpectMatchesUnfused(
+        const std::vector<const SegmentInternalInterface*>& segments) const {
+        auto filters = Filters();
+        for (size_t f = 0; f < filters.size(); ++f) {
+            auto conjunction = MakeConjunction(filters[f]);
+            for (auto* segment : segments) {
+                BitsetType unfused;
+                {
+                    FusedRangeConjunctGuard guard(false);
+                    unfused = Execute(segment, conjunction);
+                }
+                FusedRangeConjunctGuard guard(true);
+                auto fused = Execute(segment, conjunction);
+                ASSERT_EQ(fused.size(), N);
+                for (int64_t i = 0; i < N; ++i) {
+                    bool expected = true;
+                    for (const auto& predicate : filters[f]) {
+                        expected = expected && predicate.matches(i);
+                    }
+                    ASSERT_EQ(fused[i], expected)
+                        << "filter " << f << ", row " << i;
+                    ASSERT_EQ(unfused[i], expected)
+                        << "filter " << f << ", row " << i;
+                }
+            }
+        }
+    }
+
+    static BitsetType
+    Execute(const SegmentInternalInterface* segment,
+            const expr::TypedExprPtr& conjunction) {
+        auto plan = std::make_shared<plan::FilterBitsNode>(DEFAULT_PLANNODE_ID,
+                                                           conjunction);
+        return ExecuteQueryExpr(plan, segment, N, MAX_TIMESTAMP);
+    }
+
+    SchemaPtr schema_;
+    FieldId pk_fid_;
+    FieldId i8_fid_;
+    FieldId i16_fid_;
+    FieldId i32_fid_;
+    FieldId i64_fid_;
+    FieldId float_fid_;
+    FieldId double_fid_;
+    FieldId nullable_fid_;
+    GeneratedData raw_data_;
+    std::vector<bool> nullable_valid_;
+    std::unique_ptr<SegmentSealed> sealed_;
+    SegmentGrowingPtr growing_;
+};
+
+}  // namespace
+
+TEST_F(FusedRangeConjunctExprTest, FusesFixedWidthComparisons) {
+    auto filters = Filters();
+    size_t num_fused = 0;
+    {
+        FusedRangeConjunctGuard guard(true);
+        auto names = CompiledInputs(
+            sealed_.get(), MakeConjunction(filters[0]), N, num_fused);
+        EXPECT_EQ(names,
+                  std::vector<std::string>{"PhyFusedRangeConjunctExpr"});
+        EXPECT_EQ(num_fused, 3);
+
+        // the nullable column is left to its own comparison
+        names = CompiledInputs(
+            sealed_.get(), MakeConjunction(filters[2]), N, num_fused);
+        EXPECT_EQ(names.size(), 2);
+        EXPECT_EQ(num_fused, 2);
+
+        // so are the overflowing constant and the primary key
+        names = CompiledInputs(
+            sealed_.get(), MakeConjunction(filters[3]), N, num_fused);
+        EXPECT_EQ(names.size(), 3);
+        EXPECT_EQ(num_fused, 2);
+
+        names = CompiledInputs(
+            growing_.get(), MakeConjunction(filters[1]), N, num_fused);
+        EXPECT_EQ(num_fused, 4);
+    }
+    {
+        FusedRangeConjunctGuard guard(false);
+        auto names = CompiledInputs(
+            sealed_.get(), MakeConjunction(filters[0]), N, num_fused);
+        EXPECT_EQ(names.size(), 3);
+        EXPECT_EQ(num_fused, 0);
+    }
+}
+
+TEST_F(FusedRangeConjunctExprTest, MatchesUnfusedResults) {
+    BatchSizeGuard batch_size(1000);
+    ExpectMatchesUnfused({sealed_.get(), growing_.get()});
+}
+
+TEST_F(FusedRangeConjunctExprTest, MatchesUnfusedResultsAcrossChunks) {
+    BatchSizeGuard batch_size(1000);
+    // growing chunks of 777 rows, so batches end inside chunks and chunks
+    // inside result words
+    ChunkRowsGuard chunk_rows(777);
+    auto growing = CreateGrowingSegment(schema_, empty_index_meta);
+    growing->PreInsert(N);
+    growing->Insert(0,
+                    N,
+                    raw_data_.row_ids_.data(),
+                    raw_data_.timestamps_.data(),
+                    raw_data_.raw_);
+    ASSERT_EQ(growing->size_per_chunk(), 777);
+
+    auto sealed = CreateMisalignedSealed();
+    ASSERT_EQ(sealed->num_chunk_data(i64_fid_), 4);
+    ASSERT_NE(sealed->chunk_size(i64_fid_, 0), sealed->chunk_size(i8_fid_, 0));
+    // i64 is above 21000 in the whole last chunk, the skip index rules it
+    // out for the second filter
+    ASSERT_TRUE(sealed->GetSkipIndex()->CanSkipUnaryRange<int64_t>(
+        i64_fid_, 3, proto::plan::OpType::LessEqual, int64_t{21000}));
+
+    ExpectMatchesUnfused({sealed.get(), growing.get()});
+}
+
+TEST_F(FusedRangeConjunctExprTest, OffsetInputUsesOriginalComparisons) {
+    FusedRangeConjunctGuard guard(true);
+    auto filters = Filters();
+    FixedVector<int32_t> offsets;
+    for (int32_t i = 0; i < N; i += 37) {
+        offsets.push_back(i);
+    }
+    for (size_t f = 0; f < filters.size(); ++f) {
+        auto plan = std::make_shared<plan::FilterBitsNode>(
+            DEFAULT_PLANNODE_ID, MakeConjunction(filters[f]));
+        auto col_vec = milvus::test::gen_filter_res(
+            plan.get(), sealed_.get(), N, MAX_TIMESTAMP, &offsets);
+        BitsetTypeView view(col_vec->GetRawData(), col_vec->size());
+        ASSERT_EQ(view.size(), offsets.size());
+        for (size_t k = 0; k < offsets.size(); ++k) {
+            bool expected = true;
+            for (const auto& predicate : filters[f]) {
+                expected = expected && predicate.matches(offsets[k]);
+            }
+            ASSERT_EQ(view[k], expected)
+                << "filter " << f << ", row " << offsets[k];
+        }
+    }
+}
@@ -12,6 +12,7 @@
 #include "exec/expression/GISConjunctExpr.h"
 
 #include <atomic>
+#include <memory>
 #include <mutex>
 #include <utility>
 #include <vector>
@@ -20,6 +21,7 @@
 #include "common/Geometry.h"
 #include "common/GeometryCache.h"
 #include "common/OpContext.h"
+#include "common/PreparedGeometryCache.h"
 #include "common/Types.h"
 #include "common/Utils.h"
 #include "exec/expression/GISFunctionFilterExpr.h"
@@ -423,23 +425,24 @@ PhyGISRefineConjunctExpr::Eval(EvalCtx& context, VectorPtr& result) {
     }
 
     if (!survivors.none()) {
-        // Build per-thread query geometries + prepared forms ONCE per batch.
-        // qgeoms is reserved so it never reallocates (prepared references it).
+        // Per-thread query geometries + prepared forms, shared with every
+        // other batch and segment evaluating the same literals.
         GEOSContextHandle_t qctx = GetThreadLocalGEOSContext();
-        std::vector<Geometry> qgeoms;
-        std::vector<PreparedGeometry> preps;
-        qgeoms.reserve(st_->preds.size());
-        preps.reserve(st_->preds.size());
+        auto& prepared_cache = PreparedGeometryCache::Local();
+        std::vector<std::shared_ptr<const PreparedQueryGeometry>> queries;
+        queries.reserve(st_->preds.size());
         for (auto& p : st_->preds) {
-            qgeoms.emplace_back(qctx, p.query_wkt.c_str());
-            preps.emplace_back(qctx, qgeoms.back());
+            queries.emplace_back(prepared_cache.GetOrCreate(p.query_wkt));
         }
 
         auto eval_all = [&](const Geometry& left) -> bool {
             bool bit = st_->is_and;
             for (size_t j = 0; j < st_->preds.size(); ++j) {
-                bool r = EvalPrepared(
-                    st_->preds[j].op, preps[j], qgeoms[j], left, qctx);
+                bool r = EvalPrepared(st_->preds[j].op,
+                                      queries[j]->prepared,
+                                      queries[j]->geometry,
+                                      left,
+                                      qctx);
                 bit = st_->is_and ? (bit && r) : (bit || r);
                 if (st_->is_and != bit) {
                     break;  // short-circuit
@@ -26,6 +26,7 @@
 #include "common/GeometryCache.h"
 #include "common/OpContext.h"
 #include "common/PreparedGeometry.h"
+#include "common/PreparedGeometryCache.h"
 #include "common/Types.h"
 #include "common/Utils.h"
 #include "geos_c.h"
@@ -42,137 +43,6 @@
 namespace milvus {
 namespace exec {
 
-#define GEOMETRY_EXECUTE_SUB_BATCH_WITH_COMPARISON(_DataType, method)            \
-    auto execute_sub_batch = [this](const _DataType* data,                       \
-                                    ValidityView valid_data,                     \
-                                    const int32_t* offsets,                      \
-                                    const int32_t* segment_offsets,              \
-                                    const int size,                              \
-                                    TargetBitmapView res,                        \
-                                    TargetBitmapView valid_res,                  \
-                                    const Geometry& right_source) {              \
-        AssertInfo(segment_offsets != nullptr,                                   \
-                   "segment_offsets should not be nullptr");                     \
-        auto geometry_cache = this->segment_->GetGeometryCache(field_id_);       \
-        if (geometry_cache) {                                                    \
-            auto cache_lock = geometry_cache->AcquireReadLock();                 \
-            /* Cache-owned geometries share one GEOS context; drive the        \
-             * predicate on a per-thread context so concurrent read-locked      \
-             * queries never touch the same non-thread-safe context. */ \
-            GEOSContextHandle_t tls_ctx = GetThreadLocalGEOSContext();           \
-            for (int i = 0; i < size; ++i) {                                     \
-                if (valid_data && !valid_data[i]) {                              \
-                    res[i] = valid_res[i] = false;                               \
-                    continue;                                                    \
-                }                                                                \
-                auto absolute_offset = segment_offsets[i];                       \
-                auto cached_geometry =                                           \
-                    geometry_cache->GetByOffsetUnsafe(absolute_offset);          \
-                /* nullptr = empty/corrupt placeholder row (the write paths    \
-                 * keep such rows, see SimpleGeometryCache::AppendDataAt); it   \
-                 * can never satisfy the predicate, so evaluate it to false     \
-                 * instead of failing the whole query. */ \
-                if (cached_geometry == nullptr) {                                \
-                    res[i] = false;                                              \
-                    continue;                                                    \
-                }                                                                \
-                res[i] = cached_geometry->method(right_source, tls_ctx);         \
-            }                                                                    \
-        } else {                                                                 \
-            /* Thread-local context: a throwing row can no longer leak a       \
-             * per-batch GEOS_init_r context. TryParseFromWkb throws only on    \
-             * pre-parse allocation failure; a corrupt/placeholder WKB row --   \
-             * or a GEOS-swallowed parse-time OOM, indistinguishable from it    \
-             * (see the KNOWN LIMIT note on TryParseFromWkb) -- evaluates to    \
-             * false, matching the cache branch above. */ \
-            GEOSContextHandle_t tls_ctx = GetThreadLocalGEOSContext();           \
-            for (int i = 0; i < size; ++i) {                                     \
-                if (valid_data && !valid_data[i]) {                              \
-                    res[i] = valid_res[i] = false;                               \
-                    continue;                                                    \
-                }                                                                \
-                Geometry left;                                                   \
-                if (!left.TryParseFromWkb(                                       \
-                        tls_ctx, data[i].data(), data[i].size())) {              \
-                    res[i] = false;                                              \
-                    continue;                                                    \
-                }                                                                \
-                res[i] = left.method(right_source, tls_ctx);                     \
-            }                                                                    \
-        }                                                                        \
-    };                                                                           \
-    int64_t processed_size = ProcessDataChunks<_DataType, true>(                 \
-        execute_sub_batch, std::nullptr_t{}, res, valid_res, right_source);      \
-    AssertInfo(processed_size == real_batch_size,                                \
-               "internal error: expr processed rows {} not equal "               \
-               "expect batch size {}",                                           \
-               processed_size,                                                   \
-               real_batch_size);                                                 \
-    return res_vec;
-// Specialized macro for distance-based operations (ST_DWITHIN)
-#define GEOMETRY_EXECUTE_SUB_BATCH_WITH_COMPARISON_DISTANCE(_DataType, method)   \
-    auto execute_sub_batch = [this](const _DataType* data,                       \
-                                    ValidityView valid_data,                     \
-                                    const int32_t* offsets,                      \
-                                    const int32_t* segment_offsets,              \
-                                    const int size,                              \
-                                    TargetBitmapView res,                        \
-                                    TargetBitmapView valid_res,                  \
-                                    const Geometry& right_source) {              \
-        AssertInfo(segment_offsets != nullptr,                                   \
-                   "segment_offsets should not be nullptr");                     \
-        auto geometry_cache = this->segment_->GetGeometryCache(field_id_);       \
-        if (geometry_cache) {                                                    \
-            auto cache_lock = geometry_cache->AcquireReadLock();                 \
-            /* Cache-owned geometries share one GEOS context; drive the        \
-             * predicate on a per-thread context so concurrent read-locked      \
-             * queries never touch the same non-thread-safe context. */ \
-            GEOSContextHandle_t tls_ctx = GetThreadLocalGEOSContext();           \
-            for (int i = 0; i < size; ++i) {                                     \
-                if (valid_data && !valid_data[i]) {                              \
-                    res[i] = valid_res[i] = false;                               \
-                    continue;                                                    \
-                }                                                                \
-                auto absolute_offset = segment_offsets[i];                       \
-                auto cached_geometry =                                           \
-                    geometry_cache->GetByOffsetUnsafe(absolute_offset);          \
-                /* nullptr = empty/corrupt placeholder row: evaluate to false  \
-                 * instead of failing the query (see the comparison macro). */ \
-                if (cached_geometry == nullptr) {                                \
-                    res[i] = false;                                              \
-                    continue;                                                    \
-                }                                                                \
-                res[i] = cached_geometry->method(                                \
-                    right_source, expr_->distance_, tls_ctx);                    \
-            }                                                                    \
-        } else {                                                                 \
-            /* Thread-local context + non-throwing parse: no context leak,     \
-             * corrupt rows evaluate to false (see the comparison macro). */ \
-            GEOSContextHandle_t tls_ctx = GetThreadLocalGEOSContext();           \
-            for (int i = 0; i < size; ++i) {                                     \
-                if (valid_data && !valid_data[i]) {                              \
-                    res[i] = valid_res[i] = false;                               \
-                    continue;                                                    \
-                }                                                                \
-                Geometry left;                                                   \
-                if (!left.TryParseFromWkb(                                       \
-                        tls_ctx, data[i].data(), data[i].size())) {              \
-                    res[i] = false;                                              \
-                    continue;                                                    \
-                }                                                                \
-                res[i] = left.method(right_source, expr_->distance_, tls_ctx);   \
-            }                                                                    \
-        }                                                                        \
-    };                                                                           \
-    int64_t processed_size = ProcessDataChunks<_DataType, true>(                 \
-        execute_sub_batch, std::nullptr_t{}, res, valid_res, right_source);      \
-    AssertInfo(processed_size == real_batch_size,                                \
-               "internal error: expr processed rows {} not equal "               \
-               "expect batch size {}",                                           \
-               processed_size,                                                   \
-               real_batch_size);                                                 \
-    return res_vec;
-
 // Macro for unary operations (like IsValid) that don't need a right_source
 #define GEOMETRY_EXECUTE_SUB_BATCH_UNARY(_DataType, method)                      \
     auto execute_sub_batch = [this](const _DataType* data,                       \
@@ -200,8 +70,8 @@ namespace exec {
                 auto cached_geometry =                                           \
                     geometry_cache->GetByOffsetUnsafe(absolute_offset);          \
                 /* nullptr = empty/corrupt placeholder row: it is not a valid  \
-                 * geometry, so the unary predicate is false (see the           \
-                 * comparison macro). */ \
+                 * geometry, so the unary predicate is false (see               \
+                 * EvalPreparedOnData). */ \
                 if (cached_geometry == nullptr) {                                \
                     res[i] = false;                                              \
                     continue;                                                    \
@@ -210,7 +80,7 @@ namespace exec {
             }                                                                    \
         } else {                                                                 \
             /* Thread-local context + non-throwing parse: no context leak,     \
-             * corrupt rows evaluate to false (see the comparison macro). */ \
+             * corrupt rows evaluate to false (see EvalPreparedOnData). */ \
             GEOSContextHandle_t tls_ctx = GetThreadLocalGEOSContext();           \
             for (int i = 0; i < size; ++i) {                                     \
                 if (valid_data && !valid_data[i]) {                              \
@@ -236,6 +106,25 @@ namespace exec {
                real_batch_size);                                                 \
     return res_vec;
 
+// Ops whose result is false unless the row's bounding box intersects the
+// query's, so rows can be rejected on their envelopes alone. Equals is left
+// out because GEOS considers two empty geometries equal, and DWithin looks
+// beyond the query's own envelope.
+static bool
+GISOpSupportsEnvelopeFilter(proto::plan::GISFunctionFilterExpr_GISOp op) {
+    switch (op) {
+        case proto::plan::GISFunctionFilterExpr_GISOp_Intersects:
+        case proto::plan::GISFunctionFilterExpr_GISOp_Touches:
+        case proto::plan::GISFunctionFilterExpr_GISOp_Overlaps:
+        case proto::plan::GISFunctionFilterExpr_GISOp_Crosses:
+        case proto::plan::GISFunctionFilterExpr_GISOp_Contains:
+        case proto::plan::GISFunctionFilterExpr_GISOp_Within:
+            return true;
+        default:
+            return false;
+    }
+}
+
 void
 PhyGISFunctionFilterExpr::DetermineExecPath() {
     SegmentExpr::DetermineExecPath();
@@ -285,116 +174,139 @@ PhyGISFunctionFilterExpr::EvalForDataSegment() {
         return res_vec;
     }
 
-    auto right_source =
-        Geometry(GetThreadLocalGEOSContext(), expr_->geometry_wkt_.c_str());
-
-    // Choose underlying data type according to segment type to avoid element
-    // size mismatch: Sealed segments and growing segments with mmap use std::string_view;
-    // Growing segments without mmap use std::string.
     switch (expr_->op_) {
-        case proto::plan::GISFunctionFilterExpr_GISOp_Equals: {
-            if (segment_->type() == SegmentType::Growing &&
-                !storage::MmapManager::GetInstance()
-                     .GetMmapConfig()
-                     .growing_enable_mmap) {
-                GEOMETRY_EXECUTE_SUB_BATCH_WITH_COMPARISON(std::string, equals);
-            } else {
-                GEOMETRY_EXECUTE_SUB_BATCH_WITH_COMPARISON(std::string_view,
-                                                           equals);
-            }
-        }
-        case proto::plan::GISFunctionFilterExpr_GISOp_Touches: {
-            if (segment_->type() == SegmentType::Growing &&
-                !storage::MmapManager::GetInstance()
-                     .GetMmapConfig()
-                     .growing_enable_mmap) {
-                GEOMETRY_EXECUTE_SUB_BATCH_WITH_COMPARISON(std::string,
-                                                           touches);
-            } else {
-                GEOMETRY_EXECUTE_SUB_BATCH_WITH_COMPARISON(std::string_view,
-                                                           touches);
-            }
-        }
-        case proto::plan::GISFunctionFilterExpr_GISOp_Overlaps: {
-            if (segment_->type() == SegmentType::Growing &&
-                !storage::MmapManager::GetInstance()
-                     .GetMmapConfig()
-                     .growing_enable_mmap) {
-                GEOMETRY_EXECUTE_SUB_BATCH_WITH_COMPARISON(std::string,
-                                                           overlaps);
-            } else {
-                GEOMETRY_EXECUTE_SUB_BATCH_WITH_COMPARISON(std::string_view,
-                                                           overlaps);
-            }
-        }
-        case proto::plan::GISFunctionFilterExpr_GISOp_Crosses: {
-            if (segment_->type() == SegmentType::Growing &&
-                !storage::MmapManager::GetInstance()
-                     .GetMmapConfig()
-                     .growing_enable_mmap) {
-                GEOMETRY_EXECUTE_SUB_BATCH_WITH_COMPARISON(std::string,
-                                                           crosses);
-            } else {
-                GEOMETRY_EXECUTE_SUB_BATCH_WITH_COMPARISON(std::string_view,
-                                                           crosses);
-            }
-        }
-        case proto::plan::GISFunctionFilterExpr_GISOp_Contains: {
-            if (segment_->type() == SegmentType::Growing &&
-                !storage::MmapManager::GetInstance()
-                     .GetMmapConfig()
-                     .growing_enable_mmap) {
-                GEOMETRY_EXECUTE_SUB_BATCH_WITH_COMPARISON(std::string,
-                                                           contains);
-            } else {
-                GEOMETRY_EXECUTE_SUB_BATCH_WITH_COMPARISON(std::string_view,
-                                                           contains);
-            }
-        }
-        case proto::plan::GISFunctionFilterExpr_GISOp_Intersects: {
-            if (segment_->type() == SegmentType::Growing &&
-                !storage::MmapManager::GetInstance()
-                     .GetMmapConfig()
-                     .growing_enable_mmap) {
-                GEOMETRY_EXECUTE_SUB_BATCH_WITH_COMPARISON(std::string,
-                                                           intersects);
-            } else {
-                GEOMETRY_EXECUTE_SUB_BATCH_WITH_COMPARISON(std::string_view,
-                                                           intersects);
-            }
-        }
-        case proto::plan::GISFunctionFilterExpr_GISOp_Within: {
-            if (segment_->type() == SegmentType::Growing &&
-                !storage::MmapManager::GetInstance()
-                     .GetMmapConfig()
-                     .growing_enable_mmap) {
-                GEOMETRY_EXECUTE_SUB_BATCH_WITH_COMPARISON(std::string, within);
-            } else {
-                GEOMETRY_EXECUTE_SUB_BATCH_WITH_COMPARISON(std::string_view,
-                                                           within);
-            }
-        }
-        case proto::plan::GISFunctionFilterExpr_GISOp_DWithin: {
-            if (segment_->type() == SegmentType::Growing &&
-                !storage::MmapManager::GetInstance()
-                     .GetMmapConfig()
-                     .growing_enable_mmap) {
-                GEOMETRY_EXECUTE_SUB_BATCH_WITH_COMPARISON_DISTANCE(std::string,
-                                                                    dwithin);
-            } else {
-                GEOMETRY_EXECUTE_SUB_BATCH_WITH_COMPARISON_DISTANCE(
-                    std::string_view, dwithin);
-            }
-        }
+        case proto::plan::GISFunctionFilterExpr_GISOp_Equals:
+        case proto::plan::GISFunctionFilterExpr_GISOp_Touches:
+        case proto::plan::GISFunctionFilterExpr_GISOp_Overlaps:
+        case proto::plan::GISFunctionFilterExpr_GISOp_Crosses:
+        case proto::plan::GISFunctionFilterExpr_GISOp_Contains:
+        case proto::plan::GISFunctionFilterExpr_GISOp_Intersects:
+        case proto::plan::GISFunctionFilterExpr_GISOp_Within:
+        case proto::plan::GISFunctionFilterExpr_GISOp_DWithin:
+            break;
         default: {
             ThrowInfo(NotImplemented,
                       "internal error: unknown GIS op : {}",
                       static_cast<int>(expr_->op_));
         }
     }
+
+    // Parsed and prepared once per thread, then shared by every batch and
+    // segment evaluating the same literal.
+    auto query =
+        PreparedGeometryCache::Local().GetOrCreate(expr_->geometry_wkt_);
+
+    // Choose underlying data type according to segment type to avoid element
+    // size mismatch: Sealed segments and growing segments with mmap use std::string_view;
+    // Growing segments without mmap use std::string.
+    if (segment_->type() == SegmentType::Growing &&
+        !storage::MmapManager::GetInstance()
+             .GetMmapConfig()
+             .growing_enable_mmap) {
+        EvalPreparedOnData<std::string>(
+            *query, res, valid_res, real_batch_size);
+    } else {
+        EvalPreparedOnData<std::string_view>(
+            *query, res, valid_res, real_batch_size);
+    }
     return res_vec;
 }
 
+template <typename T>
+void
+PhyGISFunctionFilterExpr::EvalPreparedOnData(
+    const PreparedQueryGeometry& query,
+    TargetBitmapView res,
+    TargetBitmapView valid_res,
+    int64_t real_batch_size) {
+    const bool use_envelope = GISOpSupportsEnvelopeFilter(expr_->op_) &&
+                              !query.envelope.IsEmpty();
+    std::vector<uint8_t> candidates;
+    auto execute_sub_batch = [this, &query, use_envelope, &candidates](
+                                 const T* data,
+                                 ValidityView valid_data,
+                                 const int32_t* offsets,
+                                 const int32_t* segment_offsets,
+                                 const int size,
+                                 TargetBitmapView res,
+                                 TargetBitmapView valid_res) {
+        AssertInfo(segment_offsets != nullptr,
+                   "segment_offsets should not be nullptr");
+        // Cache-owned geometries share one GEOS context; the unprepared
+        // fallbacks of EvaluateGISPreparedOp run on the per-thread context so
+        // concurrent read-locked queries never touch the same context.
+        GEOSContextHandle_t tls_ctx = GetThreadLocalGEOSContext();
+        auto geometry_cache = this->segment_->GetGeometryCache(field_id_);
+        if (geometry_cache) {
+            auto cache_lock = geometry_cache->AcquireReadLock();
+            // reject the whole sub batch by bounding box first, only the
+            // survivors reach GEOS
+            if (use_envelope) {
+                candidates.resize(size);
+                geometry_cache->FilterByEnvelopeUnsafe(
+                    segment_offsets, size, query.envelope, candidates.data());
+            }
+            for (int i = 0; i < size; ++i) {
+                if (valid_data && !valid_data[i]) {
+                    res[i] = valid_res[i] = false;
+                    continue;
+                }
+                if (use_envelope && !candidates[i]) {
+                    res[i] = false;
+                    continue;
+                }
+                auto cached_geometry =
+                    geometry_cache->GetByOffsetUnsafe(segment_offsets[i]);
+                // nullptr = empty/corrupt placeholder row (the write paths
+                // keep such rows, see SimpleGeometryCache::AppendDataAt); it
+                // can never satisfy the predicate, so evaluate it to false
+                // instead of failing the whole query.
+                if (cached_geometry == nullptr) {
+                    res[i] = false;
+                    continue;
+                }
+                res[i] = EvaluateGISPreparedOp(expr_->op_,
+                                               query.prepared,
+                                               query.geometry,
+                                               *cached_geometry,
+                                               expr_->distance_,
+                                               tls_ctx);
+            }
+        } else {
+            // TryParseFromWkb throws only on pre-parse allocation failure; a
+            // corrupt/placeholder WKB row -- or a GEOS-swallowed parse-time
+            // OOM, indistinguishable from it (see the KNOWN LIMIT note on
+            // TryParseFromWkb) -- evaluates to false, matching the cache
+            // branch above.
+            for (int i = 0; i < size; ++i) {
+                if (valid_data && !valid_data[i]) {
+                    res[i] = valid_res[i] = false;
+                    continue;
+                }
+                Geometry left;
+                if (!left.TryParseFromWkb(
+                        tls_ctx, data[i].data(), data[i].size())) {
+                    res[i] = false;
+                    continue;
+                }
+                res[i] = EvaluateGISPreparedOp(expr_->op_,
+                                               query.prepared,
+                                               query.geometry,
+                                               left,
+                                               expr_->distance_,
+                                               tls_ctx);
+            }
+        }
+    };
+    int64_t processed_size = ProcessDataChunks<T, true>(
+        execute_sub_batch, std::nullptr_t{}, res, valid_res);
+    AssertInfo(processed_size == real_batch_size,
+               "internal error: expr processed rows {} not equal "
+               "expect batch size {}",
+               processed_size,
+               real_batch_size);
+}
+
 // Helper function to calculate bounding box for range_within query optimization
 // Creates a rectangular bounding box around a query point with given distance in meters
 static Geometry
@@ -455,10 +367,12 @@ PhyGISFunctionFilterExpr::EvalForIndexSegment() {
     // and not safe for concurrent access from multiple query threads
     GEOSContextHandle_t ctx = GetThreadLocalGEOSContext();
 
-    Geometry query_geometry = Geometry(ctx, expr_->geometry_wkt_.c_str());
-
-    // Prepare the query geometry once for accelerated repeated predicate evaluation.
-    PreparedGeometry prepared_query(ctx, query_geometry);
+    // The query geometry is parsed and prepared once per thread and shared
+    // with every other segment and query evaluating the same literal.
+    auto query =
+        PreparedGeometryCache::Local().GetOrCreate(expr_->geometry_wkt_);
+    const Geometry& query_geometry = query->geometry;
+    const PreparedGeometry& prepared_query = query->prepared;
 
     /* ------------------------------------------------------------------
      * Prefetch: if coarse results are not cached yet, run a single R-Tree
@@ -612,20 +526,46 @@ PhyGISFunctionFilterExpr::EvalForIndexSegment() {
             auto geometry_cache = segment_->GetGeometryCache(field_id_);
             if (geometry_cache) {
                 auto cache_lock = geometry_cache->AcquireReadLock();
-                for (size_t i = 0; i < hit_offsets.size(); ++i) {
-                    const auto pos = hit_offsets[i];
-
-                    auto cached_geometry =
-                        geometry_cache->GetByOffsetUnsafe(pos);
-                    // skip invalid geometry
-                    if (cached_geometry == nullptr) {
-                        continue;
+                // The R-Tree only answers for the query's bounding box
+                // against each row's, DWithin even for an enlarged box, so
+                // re-check the candidates' exact envelopes in groups before
+                // handing the survivors to GEOS.
+                const bool use_envelope =
+                    GISOpSupportsEnvelopeFilter(expr_->op_) &&
+                    !query->envelope.IsEmpty();
+                const size_t group_rows = static_cast<size_t>(batch_size_);
+                std::vector<uint8_t> candidates;
+                for (size_t begin = 0; begin < hit_offsets.size();
+                     begin += group_rows) {
+                    const size_t count =
+                        std::min(group_rows, hit_offsets.size() - begin);
+                    if (use_envelope) {
+                        candidates.resize(count);
+                        geometry_cache->FilterByEnvelopeUnsafe(
+                            hit_offsets.data() + begin,
+                            count,
+                            query->envelope,
+                            candidates.data());
                     }
-                    // Use prepared geometry for faster evaluation
-                    bool result = evaluate_geometry_prepared(*cached_geometry);
+                    for (size_t i = 0; i < count; ++i) {
+                        if (use_envelope && !candidates[i]) {
+                            continue;
+                        }
+                        const auto pos = hit_offsets[begin + i];
 
-                    if (result) {
-                        refined.set(pos);
+                        auto cached_geometry =
+                            geometry_cache->GetByOffsetUnsafe(pos);
+                        // skip invalid geometry
+                        if (cached_geometry == nullptr) {
+                            continue;
+                        }
+                        // Use prepared geometry for faster evaluation
+                        bool result =
+                            evaluate_geometry_prepared(*cached_geometry);
+
+                        if (result) {
+                            refined.set(pos);
+                        }
                     }
                 }
             } else {
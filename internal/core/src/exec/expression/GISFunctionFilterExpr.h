@@ -24,6 +24,7 @@
 #include "common/Geometry.h"
 #include "common/OpContext.h"
 #include "common/PreparedGeometry.h"
+#include "common/PreparedGeometryCache.h"
 #include "common/Types.h"
 #include "common/Vector.h"
 #include "common/protobuf_utils.h"
@@ -211,6 +212,16 @@ class PhyGISFunctionFilterExpr : public SegmentExpr {
     VectorPtr
     EvalForDataSegment();
 
+    // Binary predicates on raw data: every row of the batch is tested
+    // against the one prepared query geometry, cached rows are prefiltered
+    // by bounding box first.
+    template <typename T>
+    void
+    EvalPreparedOnData(const PreparedQueryGeometry& query,
+                       TargetBitmapView res,
+                       TargetBitmapView valid_res,
+                       int64_t real_batch_size);
+
  private:
     std::shared_ptr<const milvus::expr::GISFunctionFilterExpr> expr_;
 
@@ -0,0 +1,187 @@
+// Copyright (C) 2019-2020 Zilliz. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+// http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software distributed under the License
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
+// or implied. See the License for the specific language governing permissions and limitations under the License
+
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "common/RegexQuery.h"
+#include "common/Schema.h"
+#include "common/Types.h"
+#include "common/Volnitsky.h"
+#include "exec/expression/UnaryExpr.h"
+#include "expr/ITypeExpr.h"
+#include "index/NgramInvertedIndex.h"
+#include "knowhere/comp/index_param.h"
+#include "plan/PlanNode.h"
+#include "query/ExecPlanNodeVisitor.h"
+#include "test_utils/DataGen.h"
+#include "test_utils/storage_test_utils.h"
+
+using namespace milvus;
+
+TEST(LikePrefilter, VolnitskyFind) {
+    for (std::string needle : {"a", "ab", "abcd", "needle_in_haystack"}) {
+        VolnitskySearcher searcher(needle);
+        EXPECT_EQ(searcher.needle_size(), needle.size());
+        for (std::string haystack :
+             {std::string(),
+              needle,
+              "xx" + needle,
+              std::string(300, 'x') + needle + std::string(7, 'y'),
+              std::string(300, 'x')}) {
+            auto found = searcher.find(haystack);
+            if (haystack.find(needle) == std::string::npos) {
+                EXPECT_EQ(found, std::string_view::npos);
+            } else {
+                ASSERT_NE(found, std::string_view::npos);
+                EXPECT_EQ(haystack.compare(found, needle.size(), needle), 0);
+            }
+        }
+    }
+}
+
+TEST(LikePrefilter, MarkRowsContaining) {
+    std::mt19937 rng(5);
+    for (int iter = 0; iter < 500; ++iter) {
+        // back to back rows over a two letter alphabet, so occurrences
+        // overlap and cross row boundaries
+        const int64_t n = 1 + rng() % 200;
+        std::string buffer;
+        std::vector<size_t> offsets = {0};
+        for (int64_t i = 0; i < n; ++i) {
+            const int len = rng() % 40;
+            for (int k = 0; k < len; ++k) {
+                buffer += "ab"[rng() % 2];
+            }
+            offsets.push_back(buffer.size());
+        }
+        std::string needle;
+        for (int k = 0, len = 1 + rng() % 10; k < len; ++k) {
+            needle += "ab"[rng() % 2];
+        }
+        std::vector<std::string_view> rows(n);
+        for (int64_t i = 0; i < n; ++i) {
+            rows[i] = std::string_view(buffer.data() + offsets[i],
+                                       offsets[i + 1] - offsets[i]);
+        }
+
+        VolnitskySearcher searcher(needle);
+        TargetBitmap res(n, true);
+        ASSERT_TRUE(exec::MarkRowsContaining(searcher, rows.data(), n, res));
+        for (int64_t i = 0; i < n; ++i) {
+            ASSERT_EQ(res[i], rows[i].find(needle) != std::string_view::npos)
+                << "needle " << needle << ", row " << i;
+        }
+    }
+
+    std::string first = "abc";
+    std::string second = "abd";
+    std::vector<std::string_view> rows = {first, second};
+    VolnitskySearcher searcher("ab");
+    TargetBitmap res(2);
+    EXPECT_FALSE(exec::MarkRowsContaining(searcher, rows.data(), 2, res));
+}
+
+TEST(LikePrefilter, SplitByWildcard) {
+    EXPECT_EQ(index::split_by_wildcard("%foo%bar%"),
+              (std::vector<std::string>{"foo", "bar"}));
+    EXPECT_EQ(index::split_by_wildcard("a_b\\%c%"),
+              (std::vector<std::string>{"a", "b%c"}));
+    EXPECT_TRUE(index::split_by_wildcard("%_%").empty());
+}
+
+TEST(LikePrefilter, SealedLikeAndRegex) {
+    using namespace milvus::query;
+    const int64_t N = 5000;
+    auto schema = std::make_shared<Schema>();
+    schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, 16, knowhere::metric::L2);
+    auto pk_fid = schema->AddDebugField("id", DataType::INT64);
+    schema->set_primary_field_id(pk_fid);
+    auto str_fid = schema->AddDebugField("description", DataType::VARCHAR);
+    auto nullable_fid =
+        schema->AddDebugField("nullable_description", DataType::VARCHAR, true);
+
+    auto raw_data = DataGen(schema, N);
+    std::vector<std::string> descriptions(N);
+    std::mt19937 rng(17);
+    const std::vector<std::string> words = {
+        "foo", "bar", "baz", "fo", "ba", "qux", "foobar", "%", "_"};
+    for (int64_t i = 0; i < N; ++i) {
+        for (int k = 0, len = rng() % 6; k < len; ++k) {
+            descriptions[i] += words[rng() % words.size()];
+        }
+    }
+    for (auto& field_data : *raw_data.raw_->mutable_fields_data()) {
+        auto field_id = FieldId(field_data.field_id());
+        if (field_id == str_fid || field_id == nullable_fid) {
+            auto values = field_data.mutable_scalars()
+                              ->mutable_string_data()
+                              ->mutable_data();
+            for (int64_t i = 0; i < N; ++i) {
+                *values->Mutable(i) = descriptions[i];
+            }
+        }
+    }
+    auto segment = CreateSealedWithFieldDataLoaded(schema, raw_data);
+    auto str_col = raw_data.get_col<std::string>(str_fid);
+    auto nullable_col = raw_data.get_col<std::string>(nullable_fid);
+    auto nullable_valid = raw_data.get_col_valid(nullable_fid);
+
+    auto check = [&](proto::plan::OpType op, const std::string& pattern) {
+        proto::plan::GenericValue value;
+        value.set_string_val(pattern);
+        for (auto field_id : {str_fid, nullable_fid}) {
+            auto expr = std::make_shared<expr::UnaryRangeFilterExpr>(
+                expr::ColumnInfo(
+                    field_id, DataType::VARCHAR, std::vector<std::string>()),
+                op,
+                value);
+            auto plan = std::make_shared<plan::FilterBitsNode>(
+                DEFAULT_PLANNODE_ID, expr);
+            auto final =
+                ExecuteQueryExpr(plan, segment.get(), N, MAX_TIMESTAMP);
+            ASSERT_EQ(final.size(), N);
+            const bool nullable = field_id == nullable_fid;
+            for (int64_t i = 0; i < N; ++i) {
+                if (nullable && !nullable_valid[i]) {
+                    ASSERT_FALSE(final[i]) << pattern << ", row " << i;
+                    continue;
+                }
+                const auto& row = nullable ? nullable_col[i] : str_col[i];
+                bool expected = op == proto::plan::OpType::Match
+                                    ? LikePatternMatcher(pattern)(row)
+                                    : PartialRegexMatcher(pattern)(row);
+                ASSERT_EQ(final[i], expected) << pattern << ", row " << i;
+            }
+        }
+    };
+
+    for (std::string pattern : {"%foo%bar%",
+                                "foo%",
+                                "%baz",
+                                "%qux%",
+                                "%o_b%",
+                                "%\\%%",
+                                "%\\_%",
+                                "%missing%",
+                                "%"}) {
+        check(proto::plan::OpType::Match, pattern);
+    }
+    for (std::string pattern : {"foo.*bar", "qux", "ba[rz]"}) {
+        check(proto::plan::OpType::RegexMatch, pattern);
+    }
+}
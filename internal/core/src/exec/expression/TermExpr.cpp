@@ -300,9 +300,7 @@ PhyTermFilterExpr::ExecTermArrayVariableInField(EvalCtx& context) {
         return nullptr;
     }
 
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                       TargetBitmap(real_batch_size, true));
+    auto res_vec = MakeBitmapResult(context, real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
 
@@ -394,9 +392,7 @@ PhyTermFilterExpr::ExecTermArrayFieldInVariable(EvalCtx& context) {
         return nullptr;
     }
 
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                       TargetBitmap(real_batch_size, true));
+    auto res_vec = MakeBitmapResult(context, real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
 
@@ -505,9 +501,7 @@ PhyTermFilterExpr::ExecTermJsonVariableInField(EvalCtx& context) {
         return nullptr;
     }
 
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                       TargetBitmap(real_batch_size, true));
+    auto res_vec = MakeBitmapResult(context, real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
 
@@ -796,9 +790,7 @@ PhyTermFilterExpr::ExecTermJsonFieldInVariable(EvalCtx& context) {
         return nullptr;
     }
 
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                       TargetBitmap(real_batch_size, true));
+    auto res_vec = MakeBitmapResult(context, real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
 
@@ -1040,9 +1032,7 @@ PhyTermFilterExpr::ExecVisitorImplForData(EvalCtx& context) {
         return res;
     }
 
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                       TargetBitmap(real_batch_size, true));
+    auto res_vec = MakeBitmapResult(context, real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
 
@@ -1075,6 +1065,7 @@ PhyTermFilterExpr::ExecVisitorImplForData(EvalCtx& context) {
             } else {
                 arg_set_ = std::make_shared<SetElement<std::string>>(str_vals);
             }
+            cached_str_vals_ = std::move(str_vals);
         } else if constexpr (std::is_same_v<T, bool>) {
             // Bool: use specialized SetElement<bool> (two flags, O(1)).
             arg_set_ = std::make_shared<SetElement<T>>(vals);
@@ -1205,6 +1196,24 @@ PhyTermFilterExpr::ExecVisitorImplForData(EvalCtx& context) {
                 op_ctx, field_id, chunk_id, *elements);
         };
 
+    // Dictionary encoded string chunks of a sealed segment answer the IN
+    // list on their codes. They evaluate every row, so only without a bitmap
+    // input restricting the rows.
+    EncodedChunkFunc encoded_func;
+    if constexpr (std::is_same_v<T, std::string_view>) {
+        if (bitmap_input.empty()) {
+            encoded_func = [&str_vals = cached_str_vals_](
+                               const ChunkEncoding& encoding,
+                               int64_t offset,
+                               int64_t size,
+                               TargetBitmapView res) {
+                return encoding.Type() == ChunkEncodingType::Dictionary &&
+                       static_cast<const DictionaryEncoding&>(encoding).In(
+                           str_vals, offset, size, res);
+            };
+        }
+    }
+
     int64_t processed_size;
     if (has_offset_input_) {
         if (expr_->column_.element_level_) {
@@ -1229,8 +1238,12 @@ PhyTermFilterExpr::ExecVisitorImplForData(EvalCtx& context) {
             processed_size = ProcessDataChunksForElementLevel<T>(
                 execute_sub_batch, skip_index_func, res, valid_res, arg_set_);
         } else {
-            processed_size = ProcessDataChunks<T>(
-                execute_sub_batch, skip_index_func, res, valid_res, arg_set_);
+            processed_size = ProcessEncodedDataChunks<T>(encoded_func,
+                                                         execute_sub_batch,
+                                                         skip_index_func,
+                                                         res,
+                                                         valid_res,
+                                                         arg_set_);
         }
     }
     AssertInfo(processed_size == real_batch_size,
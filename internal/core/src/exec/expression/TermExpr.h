@@ -187,6 +187,8 @@ class PhyTermFilterExpr : public SegmentExpr {
     // variant construction. Set once during init; nullptr when arg_set_ is not
     // SetElement<string> (e.g. FlatVectorElement for small IN).
     SetElement<std::string>* cached_str_set_elem_{nullptr};
+    // The string IN values, translated to dictionary codes per encoded chunk.
+    std::vector<std::string> cached_str_vals_;
     // Cached element values for skip_index (avoids per-chunk vector copy).
     std::any cached_skip_elements_;
 };
@@ -66,6 +66,33 @@ namespace milvus {
 class SkipIndex;
 
 namespace exec {
+
+namespace {
+
+// The comparison ops a chunk encoding can evaluate, see
+// common/ChunkEncoding.h.
+std::optional<milvus::bitset::CompareOpType>
+ToEncodedCompareOp(proto::plan::OpType op) {
+    switch (op) {
+        case proto::plan::GreaterThan:
+            return milvus::bitset::CompareOpType::GT;
+        case proto::plan::GreaterEqual:
+            return milvus::bitset::CompareOpType::GE;
+        case proto::plan::LessThan:
+            return milvus::bitset::CompareOpType::LT;
+        case proto::plan::LessEqual:
+            return milvus::bitset::CompareOpType::LE;
+        case proto::plan::Equal:
+            return milvus::bitset::CompareOpType::EQ;
+        case proto::plan::NotEqual:
+            return milvus::bitset::CompareOpType::NE;
+        default:
+            return std::nullopt;
+    }
+}
+
+}  // namespace
+
 template <typename T>
 bool
 PhyUnaryRangeFilterExpr::CanUseIndexForArray() {
@@ -374,9 +401,7 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplJsonPreciseNumeric(
         return nullptr;
     }
 
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                       TargetBitmap(real_batch_size, true));
+    auto res_vec = MakeBitmapResult(context, real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
     auto pointer = milvus::Json::pointer(expr_->column_.nested_path_);
@@ -449,9 +474,7 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplArray(EvalCtx& context) {
     if (real_batch_size == 0) {
         return nullptr;
     }
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                       TargetBitmap(real_batch_size, true));
+    auto res_vec = MakeBitmapResult(context, real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
 
@@ -869,9 +892,7 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplJson(EvalCtx& context) {
         value_arg_.SetValue<ExprValueType>(expr_->val_);
         arg_inited_ = true;
     }
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                       TargetBitmap(real_batch_size, true));
+    auto res_vec = MakeBitmapResult(context, real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
 
@@ -1782,9 +1803,7 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplForData(EvalCtx& context) {
         arg_inited_ = true;
     }
     IndexInnerType val = GetValueFromProto<IndexInnerType>(expr_->val_);
-    auto res_vec =
-        std::make_shared<ColumnVector>(TargetBitmap(real_batch_size, false),
-                                       TargetBitmap(real_batch_size, true));
+    auto res_vec = MakeBitmapResult(context, real_batch_size);
     TargetBitmapView res(res_vec->GetRawData(), real_batch_size);
     TargetBitmapView valid_res(res_vec->GetValidRawData(), real_batch_size);
     auto expr_type = expr_->op_type_;
@@ -1795,6 +1814,7 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplForData(EvalCtx& context) {
     const PartialRegexMatcher* regex_matcher_ptr = cached_regex_matcher_.get();
     const VolnitskySearcher* volnitsky_ptr = cached_volnitsky_searcher_.get();
     const LikePatternMatcher* like_matcher_ptr = cached_like_matcher_.get();
+    const VolnitskySearcher* like_searcher_ptr = cached_like_searcher_.get();
 
     size_t processed_cursor = 0;
     auto execute_sub_batch =
@@ -1804,7 +1824,8 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplForData(EvalCtx& context) {
             &bitmap_input,
             regex_matcher_ptr,
             volnitsky_ptr,
-            like_matcher_ptr
+            like_matcher_ptr,
+            like_searcher_ptr
         ]<FilterType filter_type = FilterType::sequential>(
             const T* data,
             ValidityView valid_data,
@@ -1924,6 +1945,7 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplForData(EvalCtx& context) {
             case proto::plan::Match: {
                 UnaryElementFuncForMatch<T, filter_type> func;
                 func.matcher = like_matcher_ptr;
+                func.searcher = like_searcher_ptr;
                 func(data,
                      size,
                      val,
@@ -1990,6 +2012,49 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplForData(EvalCtx& context) {
                 op_ctx, field_id, chunk_id, expr_type, val);
         };
 
+    // Sealed chunks may carry an encoding that answers the comparison without
+    // reading their raw data. It evaluates every row, so it is only used when
+    // there is no bitmap input restricting the rows.
+    EncodedChunkFunc encoded_func;
+    auto encoded_op = ToEncodedCompareOp(expr_type);
+    if (encoded_op.has_value() && bitmap_input.empty()) {
+        if constexpr (std::is_same_v<T, bool>) {
+            encoded_func = [op = *encoded_op, val](
+                               const ChunkEncoding& encoding,
+                               int64_t offset,
+                               int64_t size,
+                               TargetBitmapView res) {
+                return encoding.Type() == ChunkEncodingType::RunLength &&
+                       static_cast<const RunLengthEncoding&>(encoding).Compare(
+                           op, val, offset, size, res);
+            };
+        } else if constexpr (std::is_integral_v<T>) {
+            encoded_func = [op = *encoded_op, val](
+                               const ChunkEncoding& encoding,
+                               int64_t offset,
+                               int64_t size,
+                               TargetBitmapView res) {
+                return encoding.Type() == ChunkEncodingType::ForBitPacked &&
+                       static_cast<const ForBitPackedEncoding&>(encoding)
+                           .Compare(op,
+                                    static_cast<int64_t>(val),
+                                    offset,
+                                    size,
+                                    res);
+            };
+        } else if constexpr (std::is_same_v<T, std::string_view>) {
+            encoded_func = [op = *encoded_op, &val](
+                               const ChunkEncoding& encoding,
+                               int64_t offset,
+                               int64_t size,
+                               TargetBitmapView res) {
+                return encoding.Type() == ChunkEncodingType::Dictionary &&
+                       static_cast<const DictionaryEncoding&>(encoding).Compare(
+                           op, val, offset, size, res);
+            };
+        }
+    }
+
     int64_t processed_size;
     if (has_offset_input_) {
         if (expr_->column_.element_level_) {
@@ -2006,8 +2071,12 @@ PhyUnaryRangeFilterExpr::ExecRangeVisitorImplForData(EvalCtx& context) {
             processed_size = ProcessDataChunksForElementLevel<T>(
                 execute_sub_batch, skip_index_func, res, valid_res, val);
         } else {
-            processed_size = ProcessDataChunks<T>(
-                execute_sub_batch, skip_index_func, res, valid_res, val);
+            processed_size = ProcessEncodedDataChunks<T>(encoded_func,
+                                                         execute_sub_batch,
+                                                         skip_index_func,
+                                                         res,
+                                                         valid_res,
+                                                         val);
         }
     }
     AssertInfo(processed_size == real_batch_size,
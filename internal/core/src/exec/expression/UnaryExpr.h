@@ -112,6 +112,49 @@ UnaryCompare(const T& get_value,
     }
 }
 
+// Sets res[i] for the rows that contain the searcher's literal and clears
+// the others, searching the bytes of all the rows at once instead of row by
+// row. The rows of a sealed string chunk lie back to back in one buffer, so a
+// literal absent from most rows costs one skipping scan over the batch.
+// Returns false, leaving res untouched, when the rows are not contiguous.
+inline bool
+MarkRowsContaining(const VolnitskySearcher& searcher,
+                   const std::string_view* rows,
+                   size_t size,
+                   TargetBitmapView res) {
+    if (size == 0) {
+        return true;
+    }
+    for (size_t i = 1; i < size; ++i) {
+        if (rows[i - 1].data() + rows[i - 1].size() != rows[i].data()) {
+            return false;
+        }
+    }
+    res.reset();
+    const char* const end = rows[size - 1].data() + rows[size - 1].size();
+    const char* pos = rows[0].data();
+    size_t row = 0;
+    while (pos < end) {
+        auto found = searcher.find(std::string_view(pos, end - pos));
+        if (found == std::string_view::npos) {
+            break;
+        }
+        const char* hit = pos + found;
+        while (rows[row].data() + rows[row].size() <= hit) {
+            ++row;
+        }
+        const char* row_end = rows[row].data() + rows[row].size();
+        if (hit + searcher.needle_size() <= row_end ||
+            searcher.contains(rows[row])) {
+            res[row] = true;
+        }
+        // an occurrence crossing into the next row only tells about this one
+        pos = row_end;
+        ++row;
+    }
+    return true;
+}
+
 template <typename T, FilterType filter_type = FilterType::sequential>
 struct UnaryElementFuncForMatch {
     using IndexInnerType =
@@ -121,6 +164,9 @@ struct UnaryElementFuncForMatch {
     // across batches; nullptr means build a local one (mirrors
     // UnaryElementFuncForRegexMatch).
     const LikePatternMatcher* matcher = nullptr;
+    // Searcher for the longest literal of the pattern, used to find the
+    // candidate rows of a contiguous batch; null if the pattern has none.
+    const VolnitskySearcher* searcher = nullptr;
 
     void
     operator()(const T* src,
@@ -166,6 +212,18 @@ struct UnaryElementFuncForMatch {
                 m = local_matcher.get();
             }
             bool has_bitmap_input = !bitmap_input.empty();
+            if constexpr (filter_type == FilterType::sequential &&
+                          std::is_same_v<T, std::string_view>) {
+                if (searcher != nullptr && !has_bitmap_input &&
+                    MarkRowsContaining(*searcher, src, size, res)) {
+                    // only the candidate rows run the full matcher
+                    for (auto i = res.find_first(); i.has_value();
+                         i = res.find_next(*i)) {
+                        res[*i] = (*m)(src[*i]);
+                    }
+                    return;
+                }
+            }
             for (int i = 0; i < size; ++i) {
                 if (has_bitmap_input && !bitmap_input[i + start_cursor]) {
                     continue;
@@ -247,6 +305,18 @@ struct UnaryElementFuncForRegexMatch {
             }
 
             bool has_bitmap_input = !bitmap_input.empty();
+            if constexpr (filter_type == FilterType::sequential &&
+                          std::is_same_v<T, std::string_view>) {
+                if (searcher != nullptr && !has_bitmap_input &&
+                    MarkRowsContaining(*searcher, src, size, res)) {
+                    // only the candidate rows run the full matcher
+                    for (auto i = res.find_first(); i.has_value();
+                         i = res.find_next(*i)) {
+                        res[*i] = (*m)(src[*i]);
+                    }
+                    return;
+                }
+            }
             if (searcher) {
                 for (int i = 0; i < size; ++i) {
                     if (has_bitmap_input && !bitmap_input[i + start_cursor])
@@ -1207,6 +1277,8 @@ class PhyUnaryRangeFilterExpr : public SegmentExpr {
     // across batches (the pattern is an expression constant).
     bool like_cache_inited_{false};
     std::unique_ptr<LikePatternMatcher> cached_like_matcher_;
+    std::string cached_like_literal_;
+    std::unique_ptr<VolnitskySearcher> cached_like_searcher_;
 
     void
     EnsureLikeMatcherCache() {
@@ -1217,6 +1289,16 @@ class PhyUnaryRangeFilterExpr : public SegmentExpr {
             return;
         auto pattern = GetValueFromProto<std::string>(expr_->val_);
         cached_like_matcher_ = std::make_unique<LikePatternMatcher>(pattern);
+        // Every part between wildcards must appear in a matching string, the
+        // longest one is the most selective to search for.
+        for (auto& l : index::split_by_wildcard(pattern)) {
+            if (l.size() > cached_like_literal_.size())
+                cached_like_literal_ = std::move(l);
+        }
+        if (!cached_like_literal_.empty()) {
+            cached_like_searcher_ =
+                std::make_unique<VolnitskySearcher>(cached_like_literal_);
+        }
     }
 };
 }  // namespace exec
@@ -16,29 +16,184 @@
 #include "AggregationNode.h"
 
 #include <functional>
+#include <string>
 #include <utility>
 
+#include "cachinglayer/CacheSlot.h"
 #include "common/Utils.h"
+#include "exec/QueryContext.h"
 #include "exec/VectorHasher.h"
+#include "exec/expression/Utils.h"
 #include "exec/operator/query-agg/AggregateInfo.h"
+#include "index/ScalarIndex.h"
 #include "plan/PlanNode.h"
+#include "segcore/SegmentInterface.h"
 
 namespace milvus {
 namespace exec {
+namespace {
+
+using IndexPins =
+    std::vector<cachinglayer::PinWrapper<const index::IndexBase*>>;
+
+// Calls func with a value of the C++ type the scalar indexes use for data
+// type, returns false for a type they don't cover.
+template <typename Func>
+bool
+DispatchIndexType(DataType data_type, Func&& func) {
+    switch (data_type) {
+        case DataType::BOOL:
+            return func(bool{});
+        case DataType::INT8:
+            return func(int8_t{});
+        case DataType::INT16:
+            return func(int16_t{});
+        case DataType::INT32:
+            return func(int32_t{});
+        case DataType::INT64:
+            return func(int64_t{});
+        case DataType::FLOAT:
+            return func(float{});
+        case DataType::DOUBLE:
+            return func(double{});
+        case DataType::VARCHAR:
+        case DataType::STRING:
+            return func(std::string{});
+        default:
+            return false;
+    }
+}
+
+// The scalar index covering every row of the segment for field_id, or
+// nullptr. The index stays pinned as long as pins lives.
+template <typename T>
+index::ScalarIndex<T>*
+PinScalarIndex(const segcore::SegmentInternalInterface* segment,
+               milvus::OpContext* op_ctx,
+               FieldId field_id,
+               int64_t row_count,
+               IndexPins& pins) {
+    if (!segment->HasIndex(field_id)) {
+        return nullptr;
+    }
+    auto pinned = segment->PinIndex(op_ctx, field_id);
+    if (pinned.empty()) {
+        return nullptr;
+    }
+    auto* index = const_cast<index::ScalarIndex<T>*>(
+        dynamic_cast<const index::ScalarIndex<T>*>(pinned[0].get()));
+    pins.push_back(std::move(pinned[0]));
+    if (index == nullptr || index->Count() != row_count) {
+        return nullptr;
+    }
+    return index;
+}
+
+// Min and max of a field over all rows from the chunk stats. Returns false
+// when some chunk has none, which also covers an all null chunk.
+template <typename T>
+bool
+MinMaxFromChunkStats(const segcore::SegmentInternalInterface* segment,
+                     milvus::OpContext* op_ctx,
+                     FieldId field_id,
+                     std::optional<std::pair<T, T>>& min_max) {
+    auto skip_index = segment->GetSkipIndex();
+    for (int64_t i = 0; i < segment->num_chunk(field_id); ++i) {
+        auto chunk_min_max =
+            skip_index->template GetChunkMinMax<T>(op_ctx, field_id, i);
+        if (!chunk_min_max.has_value()) {
+            return false;
+        }
+        if (!min_max.has_value()) {
+            min_max = chunk_min_max;
+            continue;
+        }
+        if (chunk_min_max->first < min_max->first) {
+            min_max->first = chunk_min_max->first;
+        }
+        if (min_max->second < chunk_min_max->second) {
+            min_max->second = chunk_min_max->second;
+        }
+    }
+    return true;
+}
+
+}  // namespace
 
 PhyAggregationNode::PhyAggregationNode(
     int32_t operator_id,
     milvus::exec::DriverContext* ctx,
-    const std::shared_ptr<const plan::AggregationNode>& node)
+    const std::shared_ptr<const plan::AggregationNode>& node,
+    std::shared_ptr<Operator> project)
     : Operator(
           ctx, node->output_type(), operator_id, node->id(), "AggregationNode"),
       aggregationNode_(node),
-      isGlobal_(node->GroupingKeys().empty()) {
+      isGlobal_(node->GroupingKeys().empty()),
+      project_(std::move(project)) {
+    if (project_ == nullptr) {
+        return;
+    }
+    AssertInfo(MayAnswerFromIndex(*node),
+               "aggregation can't be answered from scalar indexes");
+    if (!isGlobal_) {
+        index_key_ = node->GroupingKeys()[0]->field_id();
+        index_key_type_ = node->GroupingKeys()[0]->type();
+    }
+    for (const auto& aggregate : node->aggregates()) {
+        IndexAggregate index_aggregate{
+            aggregate.call_->fun_name(), std::nullopt, DataType::NONE};
+        if (!aggregate.call_->inputs().empty()) {
+            const auto& field = aggregate.call_->inputs()[0];
+            index_aggregate.field_id =
+                static_cast<const expr::FieldAccessTypeExpr*>(field.get())
+                    ->field_id();
+            index_aggregate.data_type = field->type();
+        }
+        index_aggregates_.push_back(std::move(index_aggregate));
+    }
+}
+
+bool
+PhyAggregationNode::MayAnswerFromIndex(const plan::AggregationNode& node) {
+    // grouping by the primary key streams instead
+    if (node.InputSortedByKeys() || node.GroupingKeys().size() > 1) {
+        return false;
+    }
+    std::optional<FieldId> key;
+    if (!node.GroupingKeys().empty()) {
+        key = node.GroupingKeys()[0]->field_id();
+    }
+    // a global count(*) alone is already a popcount in the ProjectNode
+    bool reads_field = key.has_value();
+    for (const auto& aggregate : node.aggregates()) {
+        const auto& name = aggregate.call_->fun_name();
+        const auto& inputs = aggregate.call_->inputs();
+        if (name != KCount && name != KMin && name != KMax) {
+            return false;
+        }
+        if (inputs.empty()) {
+            if (name != KCount) {
+                return false;
+            }
+            continue;
+        }
+        auto field =
+            dynamic_cast<const expr::FieldAccessTypeExpr*>(inputs[0].get());
+        if (inputs.size() != 1 || field == nullptr ||
+            (key.has_value() && field->field_id() != key.value())) {
+            return false;
+        }
+        reads_field = true;
+    }
+    return reads_field;
 }
 
 void
 PhyAggregationNode::initialize() {
     Operator::initialize();
+    if (project_ != nullptr) {
+        project_->initialize();
+    }
     // aggregation operator will always have single one source
     const auto& input_type = aggregationNode_->sources()[0]->output_type();
     auto hashers =
@@ -46,24 +201,76 @@ PhyAggregationNode::initialize() {
     auto numHashers = hashers.size();
     std::vector<AggregateInfo> aggregateInfos =
         toAggregateInfo(*aggregationNode_, *operator_context_, numHashers);
+    auto* pool = operator_context_->get_exec_context()
+                     ->get_query_context()
+                     ->memory_pool();
     grouping_set_ = std::make_unique<GroupingSet>(
-        input_type, std::move(hashers), std::move(aggregateInfos));
+        input_type,
+        std::move(hashers),
+        std::move(aggregateInfos),
+        aggregationNode_->InputSortedByKeys(),
+        aggregationNode_->GroupLimit(),
+        pool != nullptr ? pool->arena() : std::pmr::new_delete_resource());
     aggregationNode_.reset();
 }
 
 void
 PhyAggregationNode::AddInput(RowVectorPtr& input) {
+    if (project_ != nullptr) {
+        // the sealed segment's filter bitmap arrives as a single input
+        answered_from_index_ =
+            AggregateFromIndex(GetColumnVector(input), index_output_);
+        if (answered_from_index_) {
+            return;
+        }
+        project_->AddInput(input);
+        auto projected = project_->GetOutput();
+        if (projected == nullptr) {
+            return;
+        }
+        grouping_set_->addInput(projected);
+        numInputRows_ += projected->size();
+        return;
+    }
     grouping_set_->addInput(input);
     numInputRows_ += input->size();
 }
 
 RowVectorPtr
 PhyAggregationNode::GetOutput() {
-    if (finished_ || !no_more_input_) {
+    if (finished_) {
         input_ = nullptr;
         return nullptr;
     }
+    if (!no_more_input_) {
+        input_ = nullptr;
+        if (!grouping_set_->isStreaming()) {
+            return nullptr;
+        }
+        // groups closed by a key change are final, pass them on without
+        // waiting for the rest of the input
+        output_ = std::make_shared<RowVector>(output_type_, 0);
+        auto has_output = grouping_set_->getStreamingOutput(output_, false);
+        // every group was extracted once the limit is reached, the upstream
+        // operators aren't pulled anymore
+        if (grouping_set_->groupLimitReached()) {
+            finished_ = true;
+        }
+        if (!has_output) {
+            return nullptr;
+        }
+        numOutputRows_ += output_->size();
+        return output_;
+    }
     DeferLambda([&]() { finished_ = true; });
+    if (answered_from_index_) {
+        output_ = std::move(index_output_);
+        if (output_ == nullptr) {
+            return nullptr;
+        }
+        numOutputRows_ += output_->size();
+        return output_;
+    }
     const auto outputRowCount = isGlobal_ ? 1 : grouping_set_->outputRowCount();
     output_ = std::make_shared<RowVector>(output_type_, outputRowCount);
     const bool hasData = grouping_set_->getOutput(output_);
@@ -74,5 +281,167 @@ PhyAggregationNode::GetOutput() {
     return output_;
 }
 
+bool
+PhyAggregationNode::AggregateFromIndex(const ColumnVectorPtr& bitmap,
+                                       RowVectorPtr& result) {
+    auto query_context = operator_context_->get_exec_context()
+                             ->get_query_context();
+    auto segment = query_context->get_segment();
+    if (segment->type() != SegmentType::Sealed ||
+        query_context->bitset_is_element_level() || !bitmap->IsBitmap()) {
+        return false;
+    }
+    // the bitmap marks the rows filtered out
+    TargetBitmapView filtered(bitmap->GetRawData(), bitmap->size());
+    TargetBitmap rows(bitmap->size(), true);
+    rows -= filtered;
+
+    if (index_key_.has_value()) {
+        return DispatchIndexType(index_key_type_, [&](auto tag) {
+            return GroupByFromIndex<decltype(tag)>(rows, result);
+        });
+    }
+    auto output = std::make_shared<RowVector>(output_type_, 1);
+    for (size_t i = 0; i < index_aggregates_.size(); ++i) {
+        const auto& aggregate = index_aggregates_[i];
+        const auto& column = output->child(i);
+        if (!aggregate.field_id.has_value()) {
+            std::dynamic_pointer_cast<ColumnVector>(column)
+                ->SetValueAt<int64_t>(0, rows.count());
+            continue;
+        }
+        bool answered =
+            DispatchIndexType(aggregate.data_type, [&](auto tag) {
+                return GlobalFromIndex<decltype(tag)>(aggregate, rows, column);
+            });
+        if (!answered) {
+            return false;
+        }
+    }
+    result = std::move(output);
+    return true;
+}
+
+template <typename T>
+bool
+PhyAggregationNode::GroupByFromIndex(const TargetBitmap& rows,
+                                     RowVectorPtr& result) {
+    auto query_context = operator_context_->get_exec_context()
+                             ->get_query_context();
+    auto segment = query_context->get_segment();
+    IndexPins pins;
+    auto* index = PinScalarIndex<T>(segment,
+                                    query_context->get_op_context(),
+                                    index_key_.value(),
+                                    rows.size(),
+                                    pins);
+    if (index == nullptr || !index->SupportValueCounts()) {
+        return false;
+    }
+    // each posting holds the rows of one group, their intersection with the
+    // filter is the group's count
+    std::vector<std::pair<T, int64_t>> groups;
+    index->ValueCounts(rows, [&](const T& value, int64_t count) {
+        groups.emplace_back(value, count);
+    });
+    int64_t null_rows = 0;
+    if (segment->get_schema()[index_key_.value()].is_nullable()) {
+        auto selected_nulls = rows.clone();
+        null_rows =
+            selected_nulls.inplace_and_with_count(index->IsNull(), rows.size());
+    }
+
+    const auto num_groups = groups.size() + (null_rows > 0 ? 1 : 0);
+    if (num_groups == 0) {
+        result = nullptr;
+        return true;
+    }
+    result = std::make_shared<RowVector>(output_type_, num_groups);
+    auto key_column = std::dynamic_pointer_cast<ColumnVector>(result->child(0));
+    for (size_t i = 0; i < groups.size(); ++i) {
+        key_column->SetValueAt<T>(i, groups[i].first);
+    }
+    for (size_t j = 0; j < index_aggregates_.size(); ++j) {
+        const auto& aggregate = index_aggregates_[j];
+        auto column =
+            std::dynamic_pointer_cast<ColumnVector>(result->child(j + 1));
+        const bool is_count = aggregate.name == KCount;
+        for (size_t i = 0; i < groups.size(); ++i) {
+            if (is_count) {
+                column->SetValueAt<int64_t>(i, groups[i].second);
+            } else {
+                column->SetValueAt<T>(i, groups[i].first);
+            }
+        }
+        if (null_rows == 0) {
+            continue;
+        }
+        // the null group counts its rows for count(*) only
+        if (!is_count) {
+            column->nullAt(groups.size());
+        } else {
+            column->SetValueAt<int64_t>(
+                groups.size(), aggregate.field_id.has_value() ? 0 : null_rows);
+        }
+    }
+    if (null_rows > 0) {
+        key_column->nullAt(groups.size());
+    }
+    return true;
+}
+
+template <typename T>
+bool
+PhyAggregationNode::GlobalFromIndex(const IndexAggregate& aggregate,
+                                    const TargetBitmap& rows,
+                                    const VectorPtr& column) {
+    auto query_context = operator_context_->get_exec_context()
+                             ->get_query_context();
+    auto segment = query_context->get_segment();
+    auto op_context = query_context->get_op_context();
+    auto field_id = aggregate.field_id.value();
+    auto result = std::dynamic_pointer_cast<ColumnVector>(column);
+    const bool nullable = segment->get_schema()[field_id].is_nullable();
+    IndexPins pins;
+    auto* index =
+        PinScalarIndex<T>(segment, op_context, field_id, rows.size(), pins);
+
+    if (aggregate.name == KCount) {
+        int64_t count = rows.count();
+        if (nullable) {
+            if (index == nullptr) {
+                return false;
+            }
+            auto selected_nulls = rows.clone();
+            count -= selected_nulls.inplace_and_with_count(index->IsNull(),
+                                                           rows.size());
+        }
+        result->SetValueAt<int64_t>(0, count);
+        return true;
+    }
+
+    std::optional<std::pair<T, T>> min_max;
+    if (index != nullptr && index->SupportMinMax()) {
+        min_max = index->MinMax(rows);
+    } else if (!rows.all() ||
+               static_cast<int64_t>(rows.size()) !=
+                   segment->get_row_count()) {
+        // chunk stats cover every row of the segment, so they only answer
+        // when nothing is filtered out and the query timestamp hides no
+        // later insert
+        return false;
+    } else if (!MinMaxFromChunkStats<T>(
+                   segment, op_context, field_id, min_max)) {
+        return false;
+    }
+    if (!min_max.has_value()) {
+        result->nullAt(0);
+    } else {
+        result->SetValueAt<T>(
+            0, aggregate.name == KMin ? min_max->first : min_max->second);
+    }
+    return true;
+}
+
 };  // namespace exec
 };  // namespace milvus
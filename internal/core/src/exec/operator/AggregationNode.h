@@ -17,6 +17,7 @@
 #pragma once
 #include <stdint.h>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -35,11 +36,21 @@ class PhyAggregationNode : public Operator {
     PhyAggregationNode(
         int32_t operator_id,
         DriverContext* ctx,
-        const std::shared_ptr<const plan::AggregationNode>& node);
+        const std::shared_ptr<const plan::AggregationNode>& node,
+        std::shared_ptr<Operator> project = nullptr);
+
+    // Whether the aggregation only needs count, min and max of at most one
+    // field, grouped by that field or not grouped at all, so that a scalar
+    // index on the field may answer it from the filter bitmap alone. The
+    // Driver then hands the upstream ProjectNode to this operator, which
+    // falls back to it when the segment has no such index.
+    static bool
+    MayAnswerFromIndex(const plan::AggregationNode& node);
 
     bool
     NeedInput() const override {
-        return true;
+        return !finished_ && !(grouping_set_ != nullptr &&
+                               grouping_set_->groupLimitReached());
     }
 
     void
@@ -67,6 +78,9 @@ class PhyAggregationNode : public Operator {
     Close() override {
         input_ = nullptr;
         results_.clear();
+        if (project_ != nullptr) {
+            project_->Close();
+        }
     }
 
     void
@@ -78,6 +92,30 @@ class PhyAggregationNode : public Operator {
     }
 
  private:
+    struct IndexAggregate {
+        std::string name;
+        // std::nullopt for count(*)
+        std::optional<FieldId> field_id;
+        DataType data_type;
+    };
+
+    // Answers the aggregation from the scalar indexes of the segment (or,
+    // for an unfiltered min/max, the chunk stats), given the filter bitmap.
+    // Returns false when they can't; result is nullptr when there is no
+    // group to output.
+    bool
+    AggregateFromIndex(const ColumnVectorPtr& bitmap, RowVectorPtr& result);
+
+    template <typename T>
+    bool
+    GroupByFromIndex(const TargetBitmap& rows, RowVectorPtr& result);
+
+    template <typename T>
+    bool
+    GlobalFromIndex(const IndexAggregate& aggregate,
+                    const TargetBitmap& rows,
+                    const VectorPtr& column);
+
     RowVectorPtr output_;
     std::unique_ptr<GroupingSet> grouping_set_;
     std::shared_ptr<const plan::AggregationNode> aggregationNode_;
@@ -90,6 +128,15 @@ class PhyAggregationNode : public Operator {
     // flush.
     int64_t numOutputRows_ = 0;
     bool finished_ = false;
+
+    // Set when the Driver handed the upstream ProjectNode over, the input is
+    // then the filter bitmap instead of projected rows.
+    std::shared_ptr<Operator> project_;
+    std::optional<FieldId> index_key_;
+    DataType index_key_type_ = DataType::NONE;
+    std::vector<IndexAggregate> index_aggregates_;
+    bool answered_from_index_ = false;
+    RowVectorPtr index_output_;
 };
 }  // namespace exec
 }  // namespace milvus
@@ -258,6 +258,10 @@ PhyFilterBitsNode::GetOutput() {
             ThrowInfo(UnexpectedError,
                       "PhyFilterBitsNode result should be ColumnVector");
         }
+        // the batch is copied out, let the next batch reuse its buffers
+        if (auto* pool = eval_ctx.memory_pool(); pool != nullptr) {
+            pool->Recycle(std::move(results_[0]));
+        }
     }
     TargetBitmapView bitset_view(bitset);
     TargetBitmapView valid_bitset_view(valid_bitset);
@@ -41,11 +41,72 @@ struct SelectedOffsets {
     std::vector<int32_t> element_indices;
 };
 
+bool
+SamePk(DataType pk_type, const FieldDataPtr& pks, int64_t a, int64_t b) {
+    if (pk_type == DataType::INT64) {
+        return *static_cast<const int64_t*>(pks->RawValue(a)) ==
+               *static_cast<const int64_t*>(pks->RawValue(b));
+    }
+    return *static_cast<const std::string*>(pks->RawValue(a)) ==
+           *static_cast<const std::string*>(pks->RawValue(b));
+}
+
+// Rows of the first 'group_limit' distinct primary keys, in find_first_n
+// order. A sealed segment may hold a key in more than one row, so rows are
+// selected in growing batches until a row of the next key shows up or there
+// is none left.
+std::vector<int64_t>
+SelectPkGroupOffsets(const TargetBitmapView& raw_data_view,
+                     OpContext* op_context,
+                     const segcore::SegmentInternalInterface* segment,
+                     int64_t group_limit) {
+    auto& schema = segment->get_schema();
+    auto pk_field_id = schema.get_primary_field_id();
+    AssertInfo(pk_field_id.has_value(),
+               "primary key group limit requires a primary key field");
+    auto pk_type = schema[pk_field_id.value()].get_data_type();
+
+    int64_t n = group_limit + 1;
+    for (;;) {
+        auto [offsets, has_more] = segment->find_first_n(n, raw_data_view);
+        auto count = static_cast<int64_t>(offsets.size());
+        TargetBitmap valid_map(count);
+        auto pks = bulk_script_field_data(op_context,
+                                          pk_field_id.value(),
+                                          pk_type,
+                                          offsets.data(),
+                                          count,
+                                          segment,
+                                          valid_map);
+        int64_t groups = 0;
+        for (int64_t i = 0; i < count; i++) {
+            if (i > 0 && SamePk(pk_type, pks, i - 1, i)) {
+                continue;
+            }
+            if (++groups > group_limit) {
+                offsets.resize(i);
+                return std::move(offsets);
+            }
+        }
+        if (!has_more || count < n) {
+            return std::move(offsets);
+        }
+        n *= 2;
+    }
+}
+
 SelectedOffsets
 SelectOffsets(const TargetBitmapView& raw_data_view,
               QueryContext* query_context,
-              const segcore::SegmentInternalInterface* segment) {
+              OpContext* op_context,
+              const segcore::SegmentInternalInterface* segment,
+              int64_t pk_group_limit) {
     if (!query_context->bitset_is_element_level()) {
+        if (pk_group_limit >= 0) {
+            return {SelectPkGroupOffsets(
+                        raw_data_view, op_context, segment, pk_group_limit),
+                    {}};
+        }
         auto result_pair =
             segment->find_first_n(segcore::Unlimited, raw_data_view);
         return {std::move(result_pair.first), {}};
@@ -118,6 +179,7 @@ PhyProjectNode::PhyProjectNode(
                projectNode->id(),
                "Project"),
       fields_to_project_(projectNode->FieldsToProject()),
+      pk_group_limit_(projectNode->PkGroupLimit()),
       query_context_(nullptr),
       op_context_(nullptr) {
     auto exec_context = operator_context_->get_exec_context();
@@ -159,7 +221,11 @@ PhyProjectNode::GetOutput() {
         return row_vector;
     }
 
-    auto selected = SelectOffsets(raw_data_view, query_context_, segment_);
+    auto selected = SelectOffsets(raw_data_view,
+                                  query_context_,
+                                  op_context_,
+                                  segment_,
+                                  pk_group_limit_);
     auto& selected_offsets = selected.row_offsets;
     auto& selected_element_indices = selected.element_indices;
     auto selected_count = selected_offsets.size();
@@ -72,6 +72,8 @@ class PhyProjectNode : public Operator {
     const segcore::SegmentInternalInterface* segment_;
     bool is_finished_{false};
     const std::vector<FieldId> fields_to_project_;
+    // see plan::ProjectNode::PkGroupLimit()
+    const int64_t pk_group_limit_;
     QueryContext* query_context_;
     OpContext* op_context_;
 };
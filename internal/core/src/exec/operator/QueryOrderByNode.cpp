@@ -85,8 +85,14 @@ PhyQueryOrderByNode::PhyQueryOrderByNode(
     }
 
     // Create SortBuffer
+    auto* pool = operator_context_->get_exec_context()
+                     ->get_query_context()
+                     ->memory_pool();
     sort_buffer_ = std::make_unique<SortBuffer>(
-        column_types_, sort_key_infos, order_by_node->Limit());
+        column_types_,
+        sort_key_infos,
+        order_by_node->Limit(),
+        pool != nullptr ? pool->arena() : std::pmr::new_delete_resource());
 
     LOG_DEBUG(
         "PhyQueryOrderByNode created with {} sort keys, {} columns, limit={}",
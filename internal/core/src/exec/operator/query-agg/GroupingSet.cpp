@@ -49,6 +49,10 @@ GroupingSet::addInput(const RowVectorPtr& input) {
         addGlobalAggregationInput(input);
         return;
     }
+    if (isStreaming_) {
+        addStreamingInput(input);
+        return;
+    }
     addInputForActiveRows(input);
 }
 
@@ -138,6 +142,9 @@ GroupingSet::getOutput(milvus::RowVectorPtr& result) {
     if (isGlobal_) {
         return getGlobalAggregationOutput(result);
     }
+    if (isStreaming_) {
+        return getStreamingOutput(result, true);
+    }
     // For non-global aggregation, if hash_table_ is null, it means no input data
     // Return false directly without creating empty hash table
     if (!hash_table_) {
@@ -170,10 +177,18 @@ void
 GroupingSet::extractGroups(const milvus::RowVectorPtr& result) {
     RowContainer* rows = hash_table_->rows();
     const auto& groups = rows->allRows();
-    result->resize(groups.size());
+    extractGroups(
+        rows, const_cast<char**>(groups.data()), groups.size(), result);
+}
+
+void
+GroupingSet::extractGroups(RowContainer* rows,
+                           char** groups,
+                           int32_t numGroups,
+                           const milvus::RowVectorPtr& result) {
+    result->resize(numGroups);
     auto totalKeys = rows->KeyTypes().size();
-    auto groups_range =
-        folly::Range<char**>(const_cast<char**>(groups.data()), groups.size());
+    auto groups_range = folly::Range<char**>(groups, numGroups);
     for (auto i = 0; i < totalKeys; i++) {
         auto keyVector = result->child(i);
         rows->extractColumn(
@@ -225,6 +240,9 @@ GroupingSet::populateTempVectors(int32_t aggregateIndex,
 
 int32_t
 GroupingSet::outputRowCount() const {
+    if (isStreaming_) {
+        return streamingRows_ ? streamingRows_->allRows().size() : 0;
+    }
     if (!lookup_) {
         return 0;
     }
@@ -252,11 +270,116 @@ GroupingSet::createHashTable() {
     auto maxGroups =
         segcore::SegcoreConfig::default_config().get_max_group_by_groups();
     hash_table_ = std::make_unique<HashTable>(
-        std::move(hashers_), accumulators(), maxGroups);
+        std::move(hashers_), accumulators(), maxGroups, resource_);
     auto& rows = *(hash_table_->rows());
     initializeAggregates(aggregates_, rows);
     lookup_ = std::make_unique<HashLookup>(hash_table_->hashers());
 }
 
+bool
+GroupingSet::sameKeys(char* group, vector_size_t row) const {
+    for (int32_t i = 0; i < hashers_.size(); i++) {
+        if (!streamingRows_->equals(group,
+                                    streamingRows_->columnAt(i),
+                                    hashers_[i]->columnData(),
+                                    row)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void
+GroupingSet::addStreamingInput(const RowVectorPtr& input) {
+    AssertInfo(isStreaming_,
+               "Only streaming aggregations should reach add streaming input");
+    if (groupLimitReached_) {
+        return;
+    }
+    if (!streamingRows_) {
+        std::vector<DataType> keyTypes;
+        for (auto& hasher : hashers_) {
+            keyTypes.push_back(hasher->ChannelDataType());
+        }
+        streamingRows_ = std::make_unique<RowContainer>(
+            keyTypes, accumulators(), resource_);
+        initializeAggregates(aggregates_, *streamingRows_);
+    }
+    for (auto& hasher : hashers_) {
+        auto column_ptr = std::dynamic_pointer_cast<ColumnVector>(
+            input->child(hasher->ChannelIndex()));
+        AssertInfo(column_ptr != nullptr,
+                   "Failed to get column vector from row vector input");
+        hasher->setColumnData(column_ptr);
+    }
+
+    // a group ends where the keys change, the open group of the previous
+    // input may continue here
+    const auto numRows = static_cast<vector_size_t>(input->size());
+    const auto& rows = streamingRows_->allRows();
+    char* group = rows.empty() ? nullptr : rows.back();
+    streamingGroups_.resize(numRows);
+    streamingNewGroups_.clear();
+    vector_size_t row = 0;
+    for (; row < numRows; row++) {
+        if (group == nullptr || !sameKeys(group, row)) {
+            if (groupLimit_ >= 0 && numStreamingGroups_ >= groupLimit_) {
+                groupLimitReached_ = true;
+                break;
+            }
+            group = streamingRows_->newRow();
+            for (int32_t i = 0; i < hashers_.size(); i++) {
+                streamingRows_->store(
+                    hashers_[i]->columnData(), row, group, i);
+            }
+            streamingNewGroups_.push_back(row);
+            numStreamingGroups_++;
+        }
+        streamingGroups_[row] = group;
+    }
+    if (row == 0) {
+        return;
+    }
+    if (row < numRows) {
+        // aggregates consume whole input columns, drop the rows of the
+        // groups past the limit
+        input->resize(row);
+        streamingGroups_.resize(row);
+    }
+
+    auto* groups = streamingGroups_.data();
+    for (auto i = 0; i < aggregates_.size(); i++) {
+        auto& function = aggregates_[i].function_;
+        if (!streamingNewGroups_.empty()) {
+            function->initializeNewGroups(groups, streamingNewGroups_);
+        }
+        populateTempVectors(i, input);
+        function->addRawInput(groups, row, tempVectors_);
+    }
+    tempVectors_.clear();
+}
+
+bool
+GroupingSet::getStreamingOutput(milvus::RowVectorPtr& result,
+                                bool noMoreInput) {
+    if (!streamingRows_) {
+        return false;
+    }
+    const auto& rows = streamingRows_->allRows();
+    auto numGroups = rows.size();
+    if (!noMoreInput && !groupLimitReached_ && numGroups > 0) {
+        numGroups--;
+    }
+    if (numGroups == 0) {
+        return false;
+    }
+    extractGroups(streamingRows_.get(),
+                  const_cast<char**>(rows.data()),
+                  numGroups,
+                  result);
+    streamingRows_->eraseFirstRows(numGroups);
+    return true;
+}
+
 }  // namespace exec
 }  // namespace milvus
\ No newline at end of file
@@ -17,6 +17,7 @@
 #pragma once
 #include <stdint.h>
 #include <memory>
+#include <memory_resource>
 #include <utility>
 #include <vector>
 
@@ -32,11 +33,24 @@ namespace exec {
 
 class GroupingSet {
  public:
+    // With 'inputSortedByKeys' the rows of each group must arrive next to
+    // each other; groups are then aggregated one after another without a
+    // hash table and only the first 'groupLimit' ones (-1 for all) are kept.
+    // Group rows and per-input scratch are allocated from 'resource'.
     GroupingSet(const RowTypePtr& input_type,
                 std::vector<std::unique_ptr<VectorHasher>>&& hashers,
-                std::vector<AggregateInfo>&& aggregates)
-        : hashers_(std::move(hashers)), aggregates_(std::move(aggregates)) {
+                std::vector<AggregateInfo>&& aggregates,
+                bool inputSortedByKeys = false,
+                int64_t groupLimit = -1,
+                std::pmr::memory_resource* resource =
+                    std::pmr::new_delete_resource())
+        : hashers_(std::move(hashers)),
+          aggregates_(std::move(aggregates)),
+          groupLimit_(groupLimit),
+          resource_(resource),
+          streamingGroups_(resource) {
         isGlobal_ = hashers_.empty();
+        isStreaming_ = !isGlobal_ && inputSortedByKeys;
     }
 
     ~GroupingSet();
@@ -53,6 +67,27 @@ class GroupingSet {
     void
     addInputForActiveRows(const RowVectorPtr& input);
 
+    void
+    addStreamingInput(const RowVectorPtr& input);
+
+    bool
+    isStreaming() const {
+        return isStreaming_;
+    }
+
+    // True once a row past the first 'groupLimit' groups was seen, no later
+    // input can change the output then.
+    bool
+    groupLimitReached() const {
+        return groupLimitReached_;
+    }
+
+    // Extracts the groups of a streaming aggregation that later input can no
+    // longer add to: all but the last one, or all of them when 'noMoreInput'
+    // or the group limit was reached. Returns false if there is none.
+    bool
+    getStreamingOutput(RowVectorPtr& result, bool noMoreInput);
+
     void
     createHashTable();
 
@@ -81,6 +116,15 @@ class GroupingSet {
     outputRowCount() const;
 
  private:
+    void
+    extractGroups(RowContainer* rows,
+                  char** groups,
+                  int32_t numGroups,
+                  const RowVectorPtr& result);
+
+    bool
+    sameKeys(char* group, vector_size_t row) const;
+
     bool isGlobal_;
 
     std::vector<std::unique_ptr<VectorHasher>> hashers_;
@@ -98,6 +142,17 @@ class GroupingSet {
     // Boolean indicating whether accumulators for a global aggregation (i.e. hashers_.empty()) are initialized
     // This is used to avoid segv when getting output directly without input for empty output of upstream operator
     bool globalAggregationInitialized_{false};
+
+    bool isStreaming_{false};
+    const int64_t groupLimit_;
+    std::pmr::memory_resource* resource_;
+    // Groups of a streaming aggregation that haven't been extracted yet, the
+    // last one is still open for rows of the next input.
+    std::unique_ptr<RowContainer> streamingRows_;
+    std::pmr::vector<char*> streamingGroups_;
+    std::vector<vector_size_t> streamingNewGroups_;
+    int64_t numStreamingGroups_ = 0;
+    bool groupLimitReached_{false};
 };
 
 }  // namespace exec
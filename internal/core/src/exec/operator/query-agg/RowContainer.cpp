@@ -27,8 +27,9 @@ namespace milvus {
 namespace exec {
 
 RowContainer::RowContainer(const std::vector<DataType>& keyTypes,
-                           const std::vector<Accumulator>& accumulators)
-    : keyTypes_(keyTypes), accumulators_(accumulators) {
+                           const std::vector<Accumulator>& accumulators,
+                           std::pmr::memory_resource* resource)
+    : keyTypes_(keyTypes), accumulators_(accumulators), resource_(resource) {
     int32_t offset = 0;
     bool isVariableWidth = false;
     int idx = 0;
@@ -87,7 +88,8 @@ RowContainer::initializeRow(char* row) {
 
 char*
 RowContainer::newRow() {
-    char* row = new char[fixedRowSize_];
+    auto* row =
+        static_cast<char*>(resource_->allocate(fixedRowSize_, kRowAlignment));
     rows_.emplace_back(row);
     ++numRows_;
     return initializeRow(row);
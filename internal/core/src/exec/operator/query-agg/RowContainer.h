@@ -15,6 +15,8 @@
 // limitations under the License.
 #pragma once
 
+#include <cstddef>
+#include <memory_resource>
 #include <vector>
 #include <folly/Range.h>
 #include "common/Types.h"
@@ -88,8 +90,12 @@ class RowColumn {
 
 class RowContainer {
  public:
+    /// Rows are allocated from 'resource', e.g. the arena of the query's
+    /// memory pool, which must outlive the container.
     RowContainer(const std::vector<DataType>& keyTypes,
-                 const std::vector<Accumulator>& accumulators);
+                 const std::vector<Accumulator>& accumulators,
+                 std::pmr::memory_resource* resource =
+                     std::pmr::new_delete_resource());
 
     ~RowContainer();
 
@@ -451,28 +457,51 @@ class RowContainer {
     void
     clear() {
         for (auto row : rows_) {
-            for (auto i = 0; i < variable_offsets_.size(); i++) {
-                auto& off = variable_offsets_[i];
-                auto& row_col = columnAt(variable_idxes_[i]);
-                bool isStrNull =
-                    isNullAt(row, row_col.nullByte(), row_col.nullMask());
-                auto str = *reinterpret_cast<std::string**>(row + off);
-                if (!isStrNull && str) {
-                    delete str;
-                    str = nullptr;
-                    *reinterpret_cast<std::string**>(row + off) = nullptr;
-                }
-            }
-            delete[] row;
+            freeRow(row);
         }
         rows_.clear();
         numRows_ = 0;
     }
 
+    /// Frees the first 'numRows' rows, e.g. the groups a streaming
+    /// aggregation has already extracted.
+    void
+    eraseFirstRows(size_t numRows) {
+        AssertInfo(numRows <= rows_.size(),
+                   "cannot erase {} rows from a container of {} rows",
+                   numRows,
+                   rows_.size());
+        for (size_t i = 0; i < numRows; i++) {
+            freeRow(rows_[i]);
+        }
+        rows_.erase(rows_.begin(), rows_.begin() + numRows);
+        numRows_ -= numRows;
+    }
+
     char*
     initializeRow(char* row);
 
  private:
+    void
+    freeRow(char* row) {
+        for (auto i = 0; i < variable_offsets_.size(); i++) {
+            auto& off = variable_offsets_[i];
+            auto& row_col = columnAt(variable_idxes_[i]);
+            bool isStrNull =
+                isNullAt(row, row_col.nullByte(), row_col.nullMask());
+            auto str = *reinterpret_cast<std::string**>(row + off);
+            if (!isStrNull && str) {
+                delete str;
+                str = nullptr;
+                *reinterpret_cast<std::string**>(row + off) = nullptr;
+            }
+        }
+        resource_->deallocate(row, fixedRowSize_, kRowAlignment);
+    }
+
+    // what new char[] guaranteed before rows came from a memory resource
+    static constexpr size_t kRowAlignment = alignof(std::max_align_t);
+
     const std::vector<DataType> keyTypes_;
     std::vector<int> variable_offsets_{};
     std::vector<int> variable_idxes_{};
@@ -489,6 +518,7 @@ class RowContainer {
     std::vector<Accumulator> accumulators_;
     uint64_t numRows_ = 0;
     std::vector<char*> rows_{};
+    std::pmr::memory_resource* resource_;
 };
 
 inline void
@@ -32,6 +32,10 @@ namespace exec {
 
 namespace {
 
+// Bounds of the number of iterator results fetched per refill
+constexpr int64_t kGroupByMinFetchBatchSize = 64;
+constexpr int64_t kGroupByMaxFetchBatchSize = 4096;
+
 struct GroupedResult {
     int64_t row_offset;
     int32_t element_index;
@@ -41,9 +45,15 @@ struct GroupedResult {
 
 }  // namespace
 
+// Per-row and batched accessors of one group-by field, sharing one getter
+struct FieldGetter {
+    std::function<GroupByValueType(int64_t)> get;
+    MultiFieldDataGetter::BatchGetter batch_get;
+};
+
 // Helper to create a single-field getter that returns GroupByValueType
 template <typename T, typename InnerRawType = T>
-static std::function<GroupByValueType(int64_t)>
+static FieldGetter
 CreateFieldGetter(milvus::OpContext* op_ctx,
                   const segcore::SegmentInternalInterface& segment,
                   FieldId field_id,
@@ -52,8 +62,19 @@ CreateFieldGetter(milvus::OpContext* op_ctx,
                   bool strict_cast = false) {
     auto getter = GetDataGetter<T, InnerRawType>(
         op_ctx, segment, field_id, json_path, json_type, strict_cast);
-    return
-        [getter](int64_t idx) -> GroupByValueType { return getter->Get(idx); };
+    auto get = [getter](int64_t idx) -> GroupByValueType {
+        return getter->Get(idx);
+    };
+    auto batch_get = [getter](const int64_t* offsets,
+                              int64_t count,
+                              CompositeGroupKey* keys) {
+        std::vector<std::optional<T>> values(count);
+        getter->BatchGet(offsets, count, values.data());
+        for (int64_t i = 0; i < count; ++i) {
+            keys[i].Add(std::move(values[i]));
+        }
+    };
+    return FieldGetter{std::move(get), std::move(batch_get)};
 }
 
 MultiFieldDataGetter::MultiFieldDataGetter(
@@ -65,10 +86,11 @@ MultiFieldDataGetter::MultiFieldDataGetter(
     bool strict_cast)
     : field_count_(field_ids.size()) {
     getters_.reserve(field_ids.size());
+    batch_getters_.reserve(field_ids.size());
 
     for (const auto& field_id : field_ids) {
         auto data_type = segment.GetFieldDataType(field_id);
-        std::function<GroupByValueType(int64_t)> getter;
+        FieldGetter getter;
 
         switch (data_type) {
             case DataType::INT8:
@@ -171,7 +193,8 @@ MultiFieldDataGetter::MultiFieldDataGetter(
                               "unsupported data type {} for group by operator",
                               data_type));
         }
-        getters_.push_back(std::move(getter));
+        getters_.push_back(std::move(getter.get));
+        batch_getters_.push_back(std::move(getter.batch_get));
     }
 }
 
@@ -191,6 +214,20 @@ MultiFieldDataGetter::GetInto(int64_t idx, CompositeGroupKey& out) const {
     }
 }
 
+void
+MultiFieldDataGetter::GetBatchInto(const int64_t* offsets,
+                                   int64_t count,
+                                   std::vector<CompositeGroupKey>& out) const {
+    out.resize(count);
+    for (auto& key : out) {
+        key.Clear();
+        key.Reserve(field_count_);
+    }
+    for (const auto& batch_getter : batch_getters_) {
+        batch_getter(offsets, count, out.data());
+    }
+}
+
 // Internal helper: iterate a single iterator and collect grouped results.
 // All tunables (topk / group_size / strict_group_size / metric_type) are
 // read from `search_info` — don't duplicate them as separate parameters.
@@ -214,36 +251,62 @@ GroupIteratorResult(const std::shared_ptr<VectorIterator>& iterator,
     //2. do iteration until fill the whole map or run out of all data
     //note it may enumerate all data inside a segment and can block following
     //query and search possibly
+    //iterator results are pulled in batches so that the group keys of a whole
+    //batch can be fetched column-wise, pinning each chunk once per batch; the
+    //batch starts at topk and doubles, so small searches don't over-fetch
     std::vector<GroupedResult> res;
-    CompositeGroupKey scratch_key;
+    int64_t batch_size =
+        std::clamp<int64_t>(search_info.topk_,
+                            kGroupByMinFetchBatchSize,
+                            kGroupByMaxFetchBatchSize);
+    std::vector<int64_t> batch_offsets;
+    std::vector<int32_t> batch_element_indices;
+    std::vector<float> batch_distances;
+    std::vector<CompositeGroupKey> batch_keys;
     while (iterator->HasNext() && !groupMap.IsGroupResEnough()) {
-        auto offset_dis_pair = iterator->Next();
-        AssertInfo(offset_dis_pair.has_value(),
-                   "Wrong state! iterator cannot return valid result whereas "
-                   "it still tells hasNext");
-        auto raw_offset = offset_dis_pair.value().first;
-        auto dis = offset_dis_pair.value().second;
+        batch_offsets.clear();
+        batch_element_indices.clear();
+        batch_distances.clear();
+        while (static_cast<int64_t>(batch_offsets.size()) < batch_size &&
+               iterator->HasNext()) {
+            auto offset_dis_pair = iterator->Next();
+            AssertInfo(offset_dis_pair.has_value(),
+                       "Wrong state! iterator cannot return valid result "
+                       "whereas it still tells hasNext");
+            auto raw_offset = offset_dis_pair.value().first;
+            auto dis = offset_dis_pair.value().second;
 
-        // For element-level search, the offset is the element_id, we need to convert it to the row_id.
-        int64_t row_offset = raw_offset;
-        int32_t element_index = -1;
-        if (is_element_id) {
-            AssertInfo(search_info.array_offsets_ != nullptr,
-                       "Array offsets not available for element-level search");
-            auto [doc_id, elem_idx] =
-                search_info.array_offsets_->ElementIDToRowID(
-                    static_cast<int32_t>(raw_offset));
-            row_offset = doc_id;
-            element_index = elem_idx;
+            // For element-level search, the offset is the element_id, we need to convert it to the row_id.
+            int64_t row_offset = raw_offset;
+            int32_t element_index = -1;
+            if (is_element_id) {
+                AssertInfo(
+                    search_info.array_offsets_ != nullptr,
+                    "Array offsets not available for element-level search");
+                auto [doc_id, elem_idx] =
+                    search_info.array_offsets_->ElementIDToRowID(
+                        static_cast<int32_t>(raw_offset));
+                row_offset = doc_id;
+                element_index = elem_idx;
+            }
+            batch_offsets.push_back(row_offset);
+            batch_element_indices.push_back(element_index);
+            batch_distances.push_back(dis);
         }
 
-        data_getter->GetInto(row_offset, scratch_key);
-        if (groupMap.Push(scratch_key)) {
-            // Safe to move: next iteration's GetInto() will Clear+Reserve+Add
-            // on the moved-from small_vector, which is guaranteed empty-inline.
-            res.emplace_back(GroupedResult{
-                row_offset, element_index, dis, std::move(scratch_key)});
+        data_getter->GetBatchInto(
+            batch_offsets.data(), batch_offsets.size(), batch_keys);
+        for (size_t i = 0;
+             i < batch_offsets.size() && !groupMap.IsGroupResEnough();
+             ++i) {
+            if (groupMap.Push(batch_keys[i])) {
+                res.emplace_back(GroupedResult{batch_offsets[i],
+                                               batch_element_indices[i],
+                                               batch_distances[i],
+                                               std::move(batch_keys[i])});
+            }
         }
+        batch_size = std::min(batch_size * 2, kGroupByMaxFetchBatchSize);
     }
 
     // 3. Sort based on distances and metrics
@@ -18,6 +18,7 @@
 
 #include <simdjson.h>
 #include <stdint.h>
+#include <algorithm>
 #include <cstddef>
 #include <functional>
 #include <memory>
@@ -113,6 +114,18 @@ class DataGetter {
     virtual std::optional<T>
     Get(int64_t idx) const = 0;
 
+    // Fetch the values of `count` segment offsets, out[i] for offsets[i].
+    // The default falls back to per-row Get(); getters that can amortize
+    // pins or chunk lookups across a batch override it.
+    virtual void
+    BatchGet(const int64_t* offsets,
+             int64_t count,
+             std::optional<T>* out) const {
+        for (int64_t i = 0; i < count; ++i) {
+            out[i] = Get(offsets[i]);
+        }
+    }
+
  protected:
     std::optional<std::string> json_path_;
     bool specific_json_type_ = false;
@@ -174,6 +187,17 @@ class GrowingDataGetter : public DataGetter<OutputType> {
         }
     }
 
+    void
+    BatchGet(const int64_t* offsets,
+             int64_t count,
+             std::optional<OutputType>* out) const override {
+        // growing data is addressed directly by offset, only skip the
+        // per-row virtual dispatch
+        for (int64_t i = 0; i < count; ++i) {
+            out[i] = GrowingDataGetter::Get(offsets[i]);
+        }
+    }
+
  protected:
     const segcore::ConcurrentVector<InnerRawType>* growing_raw_data_;
     segcore::ThreadSafeValidDataPtr valid_data_;
@@ -303,6 +327,107 @@ class SealedDataGetter : public DataGetter<OutputType> {
             return raw.value();
         }
     }
+
+    void
+    BatchGet(const int64_t* offsets,
+             int64_t count,
+             std::optional<OutputType>* out) const override {
+        if (!from_data_) {
+            // index lookups are already per-row, nothing to amortize
+            DataGetter<OutputType>::BatchGet(offsets, count, out);
+            return;
+        }
+        // Resolve every offset to (chunk_id, offset_in_chunk) and visit the
+        // rows chunk by chunk, so that each chunk is pinned once per batch
+        // rather than once per row (or probed in the pin cache per row).
+        std::vector<std::pair<int64_t, int64_t>> locations(count);
+        std::vector<int64_t> order(count);
+        for (int64_t i = 0; i < count; ++i) {
+            locations[i] = segment_.get_chunk_by_offset(field_id_, offsets[i]);
+            order[i] = i;
+        }
+        std::stable_sort(
+            order.begin(), order.end(), [&locations](int64_t l, int64_t r) {
+                return locations[l].first < locations[r].first;
+            });
+
+        int64_t run_begin = 0;
+        while (run_begin < count) {
+            auto chunk_id = locations[order[run_begin]].first;
+            int64_t run_end = run_begin + 1;
+            while (run_end < count &&
+                   locations[order[run_end]].first == chunk_id) {
+                ++run_end;
+            }
+            FetchChunkRun(chunk_id,
+                          locations,
+                          order.data() + run_begin,
+                          run_end - run_begin,
+                          out);
+            run_begin = run_end;
+        }
+    }
+
+ private:
+    // Fill out[rows[i]] for `n` rows that all live in `chunk_id`, with a
+    // single pin on the chunk.
+    void
+    FetchChunkRun(int64_t chunk_id,
+                  const std::vector<std::pair<int64_t, int64_t>>& locations,
+                  const int64_t* rows,
+                  int64_t n,
+                  std::optional<OutputType>* out) const {
+        if constexpr (std::is_same_v<InnerRawType, std::string> ||
+                      std::is_same_v<InnerRawType, milvus::Json>) {
+            FixedVector<int32_t> inner_offsets(n);
+            for (int64_t i = 0; i < n; ++i) {
+                inner_offsets[i] =
+                    static_cast<int32_t>(locations[rows[i]].second);
+            }
+            if constexpr (std::is_same_v<InnerRawType, std::string>) {
+                auto pw = segment_.get_views_by_offsets<std::string_view>(
+                    op_ctx_, field_id_, chunk_id, inner_offsets);
+                auto& [str_views, valid_data] = pw.get();
+                for (int64_t i = 0; i < n; ++i) {
+                    if (!valid_data[i]) {
+                        out[rows[i]] = std::nullopt;
+                        continue;
+                    }
+                    out[rows[i]] =
+                        std::string(str_views[i].data(), str_views[i].length());
+                }
+            } else {
+                auto parse_json_doc =
+                    [&](milvus::Json& json_val) -> std::optional<OutputType> {
+                    JSON_TYPE_CASES(OutputType)
+                    JSON_STRING_CASE(OutputType)
+                    return std::nullopt;
+                };
+                auto pw = segment_.get_views_by_offsets<milvus::Json>(
+                    op_ctx_, field_id_, chunk_id, inner_offsets);
+                auto& [json_views, valid_data] = pw.get();
+                for (int64_t i = 0; i < n; ++i) {
+                    if (!valid_data[i]) {
+                        out[rows[i]] = std::nullopt;
+                        continue;
+                    }
+                    out[rows[i]] = parse_json_doc(json_views[i]);
+                }
+            }
+        } else {
+            auto pw = segment_.chunk_data<InnerRawType>(
+                op_ctx_, field_id_, chunk_id);
+            auto& span = pw.get();
+            for (int64_t i = 0; i < n; ++i) {
+                auto inner_offset = locations[rows[i]].second;
+                if (!span.is_valid(inner_offset)) {
+                    out[rows[i]] = std::nullopt;
+                    continue;
+                }
+                out[rows[i]] = span.operator[](inner_offset);
+            }
+        }
+    }
 };
 
 template <typename OutputType, typename InnerRawType = OutputType>
@@ -423,8 +548,21 @@ class MultiFieldDataGetter {
     void
     GetInto(int64_t idx, CompositeGroupKey& out) const;
 
+    // Build the keys of `count` offsets at once, out[i] for offsets[i].
+    // Each field is fetched column-wise through DataGetter::BatchGet, so a
+    // sealed chunk is pinned once per batch instead of once per row.
+    void
+    GetBatchInto(const int64_t* offsets,
+                 int64_t count,
+                 std::vector<CompositeGroupKey>& out) const;
+
+    // Appends one field's value for each of `count` offsets to keys[i].
+    using BatchGetter = std::function<void(
+        const int64_t* offsets, int64_t count, CompositeGroupKey* keys)>;
+
  private:
     std::vector<std::function<GroupByValueType(int64_t)>> getters_;
+    std::vector<BatchGetter> batch_getters_;
     size_t field_count_;
 };
 
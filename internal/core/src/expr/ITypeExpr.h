@@ -313,6 +313,11 @@ class FieldAccessTypeExpr : public ITypeExpr {
         return name_;
     }
 
+    FieldId
+    field_id() const {
+        return field_id_;
+    }
+
     std::string
     ToString() const override {
         if (inputs_.empty()) {
@@ -10,17 +10,123 @@
 // or implied. See the License for the specific language governing permissions and limitations under the License
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 #include "Executor.h"
+#include "common/Numa.h"
+#include "fmt/core.h"
 #include "folly/executors/CPUThreadPoolExecutor.h"
 #include "folly/executors/thread_factory/NamedThreadFactory.h"
+#include "log/Log.h"
 #include "storage/ThreadPool.h"
 
 namespace milvus::futures {
 
 const int kNumPriority = 3;
 
+namespace {
+
+// Names the threads it creates and pins them to the CPUs of a NUMA node.
+class NumaThreadFactory : public folly::NamedThreadFactory {
+ public:
+    NumaThreadFactory(std::string prefix, int node)
+        : folly::NamedThreadFactory(std::move(prefix)), node_(node) {
+    }
+
+    std::thread
+    newThread(folly::Func&& func) override {
+        return folly::NamedThreadFactory::newThread(
+            [node = node_, func = std::move(func)]() mutable {
+                PinThreadToNumaNode(node);
+                func();
+            });
+    }
+
+ private:
+    int node_;
+};
+
+// One executor per NUMA node, empty on a single node machine.
+class NumaExecutors {
+ public:
+    NumaExecutors(const std::string& name_prefix, int thread_num) {
+        const auto& topology = NumaTopology::GetInstance();
+        if (!topology.multi_node()) {
+            return;
+        }
+        for (int node = 0; node < topology.num_nodes(); node++) {
+            executors_.push_back(std::make_unique<folly::CPUThreadPoolExecutor>(
+                NodeThreadNum(thread_num, node),
+                folly::CPUThreadPoolExecutor::makeDefaultPriorityQueue(
+                    kNumPriority),
+                std::make_shared<NumaThreadFactory>(
+                    fmt::format("{}N{}_", name_prefix, node), node)));
+        }
+        LOG_INFO("created {} numa executors {} with {} threads in total",
+                 executors_.size(),
+                 name_prefix,
+                 thread_num);
+    }
+
+    folly::CPUThreadPoolExecutor*
+    Get(int node) {
+        return executors_.at(node).get();
+    }
+
+    void
+    SetNumThreads(int thread_num) {
+        for (size_t node = 0; node < executors_.size(); node++) {
+            executors_[node]->setNumThreads(NodeThreadNum(thread_num, node));
+        }
+    }
+
+ private:
+    // share of the node in `thread_num` by its CPU count
+    static int
+    NodeThreadNum(int thread_num, int node) {
+        const auto& topology = NumaTopology::GetInstance();
+        size_t total_cpus = 0;
+        for (int i = 0; i < topology.num_nodes(); i++) {
+            total_cpus += topology.node(i).cpus.size();
+        }
+        auto node_cpus = topology.node(node).cpus.size();
+        return std::max<int>(
+            1, (thread_num * node_cpus + total_cpus / 2) / total_cpus);
+    }
+
+    std::vector<std::unique_ptr<folly::CPUThreadPoolExecutor>> executors_;
+};
+
+// The per node executors are created by the first segment placed on a node,
+// i.e. only with NUMA_AWARE_EXECUTOR_ENABLED, and take their size from the
+// shared executor then.
+std::atomic<bool> search_numa_executors_created{false};
+std::atomic<bool> load_numa_executors_created{false};
+
+NumaExecutors&
+getSearchNumaExecutors() {
+    // thread names are cut at 15 characters, keep the node number in them
+    static NumaExecutors executors("MILVUS_SRCH_",
+                                   getSearchCPUExecutor()->numThreads());
+    search_numa_executors_created.store(true, std::memory_order_release);
+    return executors;
+}
+
+NumaExecutors&
+getLoadNumaExecutors() {
+    static NumaExecutors executors("MILVUS_LOAD_",
+                                   getLoadCPUExecutor()->numThreads());
+    load_numa_executors_created.store(true, std::memory_order_release);
+    return executors;
+}
+
+}  // namespace
+
 folly::CPUThreadPoolExecutor*
 getSearchCPUExecutor() {
     auto thread_num = std::max(1, milvus::CPU_NUM);
@@ -41,6 +147,40 @@ getLoadCPUExecutor() {
     return &executor;
 }
 
+folly::CPUThreadPoolExecutor*
+getSegmentSearchCPUExecutor(int64_t segment_id) {
+    auto node = HomeNumaNode(segment_id);
+    if (node < 0) {
+        return getSearchCPUExecutor();
+    }
+    return getSearchNumaExecutors().Get(node);
+}
+
+folly::CPUThreadPoolExecutor*
+getSegmentLoadCPUExecutor(int64_t segment_id) {
+    auto node = HomeNumaNode(segment_id);
+    if (node < 0) {
+        return getLoadCPUExecutor();
+    }
+    return getLoadNumaExecutors().Get(node);
+}
+
+void
+setSearchCPUExecutorThreadNum(int thread_num) {
+    getSearchCPUExecutor()->setNumThreads(thread_num);
+    if (search_numa_executors_created.load(std::memory_order_acquire)) {
+        getSearchNumaExecutors().SetNumThreads(thread_num);
+    }
+}
+
+void
+setLoadCPUExecutorThreadNum(int thread_num) {
+    getLoadCPUExecutor()->setNumThreads(thread_num);
+    if (load_numa_executors_created.load(std::memory_order_acquire)) {
+        getLoadNumaExecutors().SetNumThreads(thread_num);
+    }
+}
+
 folly::CPUThreadPoolExecutor*
 getGlobalCPUExecutor() {
     return getSearchCPUExecutor();
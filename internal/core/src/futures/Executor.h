@@ -11,6 +11,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory>
 #include <folly/executors/CPUThreadPoolExecutor.h>
 #include <folly/executors/task_queue/PriorityLifoSemMPMCQueue.h>
@@ -33,4 +34,23 @@ getSearchCPUExecutor();
 folly::CPUThreadPoolExecutor*
 getLoadCPUExecutor();
 
+// Executors for the work on one segment. With NUMA placement on (see
+// common/Numa.h), every NUMA node has its own search and load executor, whose
+// workers are pinned to the CPUs of the node and share the threads of the
+// plain executor by the CPU count of the node. The work on a segment goes to
+// the executor of its home node. Otherwise these are the plain executors.
+folly::CPUThreadPoolExecutor*
+getSegmentSearchCPUExecutor(int64_t segment_id);
+
+folly::CPUThreadPoolExecutor*
+getSegmentLoadCPUExecutor(int64_t segment_id);
+
+// Resize the plain executor, and the per node executors once NUMA placement
+// created them.
+void
+setSearchCPUExecutorThreadNum(int thread_num);
+
+void
+setLoadCPUExecutorThreadNum(int thread_num);
+
 };  // namespace milvus::futures
@@ -15,10 +15,12 @@
 // limitations under the License.
 
 #include <algorithm>
+#include <cstring>
 #include "common/FastMem.h"
 #include <boost/algorithm/string.hpp>
 #include <folly/ScopeGuard.h>
 #include <optional>
+#include <vector>
 #include <sys/errno.h>
 #include <unistd.h>
 #include <yaml-cpp/yaml.h>
@@ -50,6 +52,94 @@ constexpr size_t ALIGNMENT = 32;  // 32-byte alignment
 constexpr const char* BITMAP_INDEX_IS_NESTED = "is_nested_index";
 constexpr const char* BITMAP_INDEX_IS_NESTED_META = "is_nested";
 
+namespace {
+
+// IN-lists up to this size look every value up on its own; longer lists are
+// sorted once and looked up in one ordered walk of the dictionary
+constexpr size_t kBatchInThreshold = 32;
+// dictionary entries a walk steps over before it searches instead
+constexpr size_t kMaxWalkSteps = 8;
+// postings unioned with roaring's multi-way fastunion from this count on
+constexpr size_t kFastUnionThreshold = 4;
+
+// Postings of the `values` present in `postings`.
+template <typename T, typename Posting>
+std::vector<const Posting*>
+LookupPostings(const std::map<T, Posting>& postings,
+               size_t n,
+               const T* values) {
+    std::vector<const Posting*> found;
+    if (n <= kBatchInThreshold) {
+        for (size_t i = 0; i < n; ++i) {
+            auto it = postings.find(values[i]);
+            if (it != postings.end()) {
+                found.push_back(&it->second);
+            }
+        }
+        return found;
+    }
+
+    // NaN matches nothing and would break the sort order
+    FixedVector<T> targets;
+    targets.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        if (values[i] == values[i]) {
+            targets.push_back(values[i]);
+        }
+    }
+    std::sort(targets.begin(), targets.end());
+    targets.erase(std::unique(targets.begin(), targets.end()), targets.end());
+
+    found.reserve(std::min(targets.size(), postings.size()));
+    auto it = postings.begin();
+    for (const auto& target : targets) {
+        size_t steps = 0;
+        while (it != postings.end() && it->first < target &&
+               steps < kMaxWalkSteps) {
+            ++it;
+            ++steps;
+        }
+        if (it != postings.end() && it->first < target) {
+            it = postings.lower_bound(target);
+        }
+        if (it == postings.end()) {
+            break;
+        }
+        if (!(target < it->first)) {
+            found.push_back(&it->second);
+        }
+    }
+    return found;
+}
+
+// Rows in any of `postings`, as a bitmap of `num_rows` rows.
+TargetBitmap
+UnionPostings(std::vector<const roaring::Roaring*> postings, size_t num_rows) {
+    TargetBitmap res(num_rows, false);
+    if (postings.size() < kFastUnionThreshold) {
+        for (auto posting : postings) {
+            for (auto row : *posting) {
+                res.set(row);
+            }
+        }
+        return res;
+    }
+    // Merge container by container, then copy the words of the union out
+    // instead of setting its rows one by one.
+    auto merged = roaring::Roaring::fastunion(postings.size(), postings.data());
+    bitset_t* words = bitset_create_with_capacity(num_rows);
+    AssertInfo(words != nullptr, "allocate bitset of {} rows failed", num_rows);
+    auto free_words = folly::makeGuard([words]() { bitset_free(words); });
+    roaring_bitmap_to_bitset(&merged.roaring, words);
+    std::memcpy(res.data(),
+                words->array,
+                std::min(words->arraysize * sizeof(uint64_t),
+                         static_cast<size_t>(res.size_in_bytes())));
+    return res;
+}
+
+}  // namespace
+
 template <typename T>
 BitmapIndex<T>::BitmapIndex(
     const storage::FileManagerContext& file_manager_context,
@@ -723,38 +813,17 @@ BitmapIndex<T>::In(const size_t n, const T* values) {
     tracer::AutoSpan span("BitmapIndex::In", tracer::GetRootSpan());
 
     AssertInfo(is_built_, "index has not been built");
-    TargetBitmap res(total_num_rows_, false);
-
     if (is_mmap_) {
-        for (size_t i = 0; i < n; ++i) {
-            const auto& val = values[i];
-            auto it = bitmap_info_map_.find(val);
-            if (it != bitmap_info_map_.end()) {
-                for (const auto& v : it->second) {
-                    res.set(v);
-                }
-            }
-        }
-        return res;
+        return UnionPostings(LookupPostings(bitmap_info_map_, n, values),
+                             total_num_rows_);
     }
     if (build_mode_ == BitmapIndexBuildMode::ROARING) {
-        for (size_t i = 0; i < n; ++i) {
-            const auto& val = values[i];
-            auto it = data_.find(val);
-            if (it != data_.end()) {
-                for (const auto& v : it->second) {
-                    res.set(v);
-                }
-            }
-        }
-    } else {
-        for (size_t i = 0; i < n; ++i) {
-            const auto& val = values[i];
-            auto it = bitsets_.find(val);
-            if (it != bitsets_.end()) {
-                res |= it->second;
-            }
-        }
+        return UnionPostings(LookupPostings(data_, n, values),
+                             total_num_rows_);
+    }
+    TargetBitmap res(total_num_rows_, false);
+    for (auto bitset : LookupPostings(bitsets_, n, values)) {
+        res |= *bitset;
     }
     return res;
 }
@@ -765,50 +834,11 @@ BitmapIndex<T>::NotIn(const size_t n, const T* values) {
     tracer::AutoSpan span("BitmapIndex::NotIn", tracer::GetRootSpan());
 
     AssertInfo(is_built_, "index has not been built");
-
-    if (is_mmap_) {
-        TargetBitmap res(total_num_rows_, true);
-        for (int i = 0; i < n; ++i) {
-            const auto& val = values[i];
-            auto it = bitmap_info_map_.find(val);
-            if (it != bitmap_info_map_.end()) {
-                for (const auto& v : it->second) {
-                    res.reset(v);
-                }
-            }
-        }
-        // NotIn(null) and In(null) is both false, need to mask with IsNotNull operate
-        res &= valid_bitset_;
-        return res;
-    }
-    if (build_mode_ == BitmapIndexBuildMode::ROARING) {
-        TargetBitmap res(total_num_rows_, true);
-        for (int i = 0; i < n; ++i) {
-            const auto& val = values[i];
-            auto it = data_.find(val);
-            if (it != data_.end()) {
-                for (const auto& v : it->second) {
-                    res.reset(v);
-                }
-            }
-        }
-        // NotIn(null) and In(null) is both false, need to mask with IsNotNull operate
-        res &= valid_bitset_;
-        return res;
-    } else {
-        TargetBitmap res(total_num_rows_, false);
-        for (size_t i = 0; i < n; ++i) {
-            const auto& val = values[i];
-            auto it = bitsets_.find(val);
-            if (it != bitsets_.end()) {
-                res |= it->second;
-            }
-        }
-        res.flip();
-        // NotIn(null) and In(null) is both false, need to mask with IsNotNull operate
-        res &= valid_bitset_;
-        return res;
-    }
+    auto res = In(n, values);
+    res.flip();
+    // NotIn(null) and In(null) is both false, need to mask with IsNotNull operate
+    res &= valid_bitset_;
+    return res;
 }
 
 template <typename T>
@@ -834,6 +864,109 @@ BitmapIndex<T>::IsNotNull() {
     return res;
 }
 
+namespace {
+
+// Positions of the set bits of a row bitmap, as a roaring bitmap that the
+// postings can be intersected with.
+roaring::Roaring
+RowsToRoaring(const TargetBitmap& rows) {
+    const auto* words = reinterpret_cast<const uint64_t*>(rows.data());
+    const size_t num_words = (rows.size() + 63) / 64;
+    std::vector<uint32_t> positions;
+    positions.reserve(rows.count());
+    for (size_t w = 0; w < num_words; ++w) {
+        uint64_t word = words[w];
+        while (word != 0) {
+            auto pos = w * 64 + __builtin_ctzll(word);
+            if (pos >= rows.size()) {
+                break;
+            }
+            positions.push_back(static_cast<uint32_t>(pos));
+            word &= word - 1;
+        }
+    }
+    roaring::Roaring res;
+    res.addMany(positions.size(), positions.data());
+    return res;
+}
+
+}  // namespace
+
+template <typename T>
+void
+BitmapIndex<T>::ValueCounts(
+    const TargetBitmap& rows,
+    const std::function<void(const T&, int64_t)>& fn) const {
+    AssertInfo(is_built_, "index has not been built");
+    AssertInfo(rows.size() == total_num_rows_,
+               "rows size {} must match index rows {}",
+               rows.size(),
+               total_num_rows_);
+    const bool all_rows = rows.all();
+    if (is_mmap_ || build_mode_ == BitmapIndexBuildMode::ROARING) {
+        const auto& postings = is_mmap_ ? bitmap_info_map_ : data_;
+        auto selected = all_rows ? roaring::Roaring() : RowsToRoaring(rows);
+        for (const auto& [key, bitmap] : postings) {
+            auto count = all_rows ? bitmap.cardinality()
+                                  : bitmap.and_cardinality(selected);
+            if (count > 0) {
+                fn(key, static_cast<int64_t>(count));
+            }
+        }
+    } else {
+        for (const auto& [key, bitset] : bitsets_) {
+            int64_t count;
+            if (all_rows) {
+                count = bitset.count();
+            } else {
+                auto scratch = bitset.clone();
+                count = scratch.inplace_and_with_count(rows, rows.size());
+            }
+            if (count > 0) {
+                fn(key, count);
+            }
+        }
+    }
+}
+
+template <typename T>
+std::optional<std::pair<T, T>>
+BitmapIndex<T>::MinMax(const TargetBitmap& rows) const {
+    AssertInfo(is_built_, "index has not been built");
+    AssertInfo(rows.size() == total_num_rows_,
+               "rows size {} must match index rows {}",
+               rows.size(),
+               total_num_rows_);
+    // postings are keyed in value order, so probe them from both ends and
+    // stop at the first one holding a selected row
+    auto find_ends = [](const auto& postings, const auto& hit)
+        -> std::optional<std::pair<T, T>> {
+        auto lo = std::find_if(postings.begin(), postings.end(), hit);
+        if (lo == postings.end()) {
+            return std::nullopt;
+        }
+        auto hi = std::find_if(postings.rbegin(), postings.rend(), hit);
+        return std::make_pair(lo->first, hi->first);
+    };
+    const bool all_rows = rows.all();
+    if (is_mmap_ || build_mode_ == BitmapIndexBuildMode::ROARING) {
+        auto selected = all_rows ? roaring::Roaring() : RowsToRoaring(rows);
+        auto hit = [&](const auto& entry) {
+            return all_rows ? !entry.second.isEmpty()
+                            : entry.second.intersect(selected);
+        };
+        return find_ends(is_mmap_ ? bitmap_info_map_ : data_, hit);
+    }
+    auto hit = [&](const auto& entry) {
+        if (all_rows) {
+            return entry.second.any();
+        }
+        auto scratch = entry.second.clone();
+        return scratch.inplace_and_with_count(rows, rows.size()) > 0;
+    };
+    return find_ends(bitsets_, hit);
+}
+
 template <typename T>
 TargetBitmap
 BitmapIndex<T>::RangeForBitset(const T& value, const OpType op) {
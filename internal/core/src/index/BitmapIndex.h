@@ -220,6 +220,25 @@ class BitmapIndex : public ScalarIndex<T> {
     LoadEntries(storage::IndexEntryReader& reader,
                 const Config& config) override;
 
+    // Postings of a nested index are per element, not per row.
+    bool
+    SupportValueCounts() const override {
+        return !is_nested_index_;
+    }
+
+    void
+    ValueCounts(
+        const TargetBitmap& rows,
+        const std::function<void(const T&, int64_t)>& fn) const override;
+
+    bool
+    SupportMinMax() const override {
+        return !is_nested_index_;
+    }
+
+    std::optional<std::pair<T, T>>
+    MinMax(const TargetBitmap& rows) const override;
+
     bool
     SupportPatternMatch() const override {
         return std::is_same_v<T, std::string>;
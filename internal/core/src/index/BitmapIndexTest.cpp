@@ -19,7 +19,9 @@
 #include <stdlib.h>
 #include <cstddef>
 #include <functional>
+#include <map>
 #include <memory>
+#include <random>
 #include <string>
 #include <unordered_set>
 #include <variant>
@@ -266,70 +268,76 @@ class BitmapIndexTest : public testing::Test {
  public:
     void
     TestInFunc() {
-        boost::container::vector<T> test_data;
-        std::unordered_set<T> s;
-        size_t nq = 10;
-        for (size_t i = 0; i < nq; i++) {
-            test_data.push_back(data_[i]);
-            s.insert(data_[i]);
-        }
-        auto index_ptr = dynamic_cast<index::BitmapIndex<T>*>(index_.get());
-        auto bitset = index_ptr->In(test_data.size(), test_data.data());
-        size_t start = 0;
-        if (has_lack_binlog_row_) {
-            for (int i = 0; i < lack_binlog_row_; i++) {
-                if (!has_default_value_) {
-                    ASSERT_EQ(bitset[i], false);
-                } else {
-                    if constexpr (std::is_same_v<std::string, T>) {
-                        ASSERT_EQ(bitset[i], s.find("10") != s.end());
+        // short lists probe value by value, long ones take the batched
+        // lookup and union
+        for (size_t nq : {size_t(10), size_t(500)}) {
+            boost::container::vector<T> test_data;
+            std::unordered_set<T> s;
+            for (size_t i = 0; i < nq; i++) {
+                test_data.push_back(data_[i]);
+                s.insert(data_[i]);
+            }
+            auto index_ptr = dynamic_cast<index::BitmapIndex<T>*>(index_.get());
+            auto bitset = index_ptr->In(test_data.size(), test_data.data());
+            size_t start = 0;
+            if (has_lack_binlog_row_) {
+                for (int i = 0; i < lack_binlog_row_; i++) {
+                    if (!has_default_value_) {
+                        ASSERT_EQ(bitset[i], false);
                     } else {
-                        ASSERT_EQ(bitset[i], s.find(10) != s.end());
+                        if constexpr (std::is_same_v<std::string, T>) {
+                            ASSERT_EQ(bitset[i], s.find("10") != s.end());
+                        } else {
+                            ASSERT_EQ(bitset[i], s.find(10) != s.end());
+                        }
                     }
                 }
+                start += lack_binlog_row_;
             }
-            start += lack_binlog_row_;
-        }
-        for (size_t i = start; i < bitset.size(); i++) {
-            if (nullable_ && !valid_data_[i - start]) {
-                ASSERT_EQ(bitset[i], false);
-            } else {
-                ASSERT_EQ(bitset[i], s.find(data_[i - start]) != s.end());
+            for (size_t i = start; i < bitset.size(); i++) {
+                if (nullable_ && !valid_data_[i - start]) {
+                    ASSERT_EQ(bitset[i], false);
+                } else {
+                    ASSERT_EQ(bitset[i], s.find(data_[i - start]) != s.end());
+                }
             }
         }
     }
 
     void
     TestNotInFunc() {
-        boost::container::vector<T> test_data;
-        std::unordered_set<T> s;
-        size_t nq = 10;
-        for (size_t i = 0; i < nq; i++) {
-            test_data.push_back(data_[i]);
-            s.insert(data_[i]);
-        }
-        auto index_ptr = dynamic_cast<index::BitmapIndex<T>*>(index_.get());
-        auto bitset = index_ptr->NotIn(test_data.size(), test_data.data());
-        size_t start = 0;
-        if (has_lack_binlog_row_) {
-            for (int i = 0; i < lack_binlog_row_; i++) {
-                if (!has_default_value_) {
-                    ASSERT_EQ(bitset[i], false);
-                } else {
-                    if constexpr (std::is_same_v<std::string, T>) {
-                        ASSERT_EQ(bitset[i], s.find("10") == s.end());
+        // short lists probe value by value, long ones take the batched
+        // lookup and union
+        for (size_t nq : {size_t(10), size_t(500)}) {
+            boost::container::vector<T> test_data;
+            std::unordered_set<T> s;
+            for (size_t i = 0; i < nq; i++) {
+                test_data.push_back(data_[i]);
+                s.insert(data_[i]);
+            }
+            auto index_ptr = dynamic_cast<index::BitmapIndex<T>*>(index_.get());
+            auto bitset = index_ptr->NotIn(test_data.size(), test_data.data());
+            size_t start = 0;
+            if (has_lack_binlog_row_) {
+                for (int i = 0; i < lack_binlog_row_; i++) {
+                    if (!has_default_value_) {
+                        ASSERT_EQ(bitset[i], false);
                     } else {
-                        ASSERT_EQ(bitset[i], s.find(10) == s.end());
+                        if constexpr (std::is_same_v<std::string, T>) {
+                            ASSERT_EQ(bitset[i], s.find("10") == s.end());
+                        } else {
+                            ASSERT_EQ(bitset[i], s.find(10) == s.end());
+                        }
                     }
                 }
+                start += lack_binlog_row_;
             }
-            start += lack_binlog_row_;
-        }
-        for (size_t i = start; i < bitset.size(); i++) {
-            if (nullable_ && !valid_data_[i - start]) {
-                ASSERT_EQ(bitset[i], false);
-            } else {
-                ASSERT_EQ(bitset[i], s.find(data_[i - start]) == s.end());
+            for (size_t i = start; i < bitset.size(); i++) {
+                if (nullable_ && !valid_data_[i - start]) {
+                    ASSERT_EQ(bitset[i], false);
+                } else {
+                    ASSERT_EQ(bitset[i], s.find(data_[i - start]) == s.end());
+                }
             }
         }
     }
@@ -961,3 +969,59 @@ REGISTER_TYPED_TEST_SUITE_P(BitmapIndexTestV6,
 INSTANTIATE_TYPED_TEST_SUITE_P(BitmapIndexE2ECheck_Mmap,
                                BitmapIndexTestV6,
                                BitmapType);
+
+TEST(BitmapIndexAggregation, ValueCountsAndMinMax) {
+    // bitset and roaring build modes
+    for (int64_t cardinality :
+         {int64_t{7}, 2 * DEFAULT_BITMAP_INDEX_BUILD_MODE_BOUND}) {
+        const int64_t n = 5000;
+        std::mt19937 rng(cardinality);
+        std::vector<int32_t> data(n);
+        std::unique_ptr<bool[]> valid(new bool[n]);
+        for (int64_t i = 0; i < n; i++) {
+            data[i] = rng() % cardinality;
+            valid[i] = i % 11 != 0;
+        }
+        index::BitmapIndex<int32_t> index;
+        index.Build(n, data.data(), valid.get());
+        ASSERT_TRUE(index.SupportValueCounts());
+        ASSERT_TRUE(index.SupportMinMax());
+
+        for (bool all_rows : {true, false}) {
+            TargetBitmap rows(n, all_rows);
+            for (int64_t i = 0; !all_rows && i < n; i++) {
+                if (rng() % 3 == 0) {
+                    rows.set(i);
+                }
+            }
+            std::map<int32_t, int64_t> expected;
+            for (int64_t i = 0; i < n; i++) {
+                if (rows[i] && valid[i]) {
+                    expected[data[i]]++;
+                }
+            }
+            std::vector<std::pair<int32_t, int64_t>> counts;
+            index.ValueCounts(rows, [&](const int32_t& value, int64_t count) {
+                counts.emplace_back(value, count);
+            });
+            EXPECT_EQ(counts,
+                      (std::vector<std::pair<int32_t, int64_t>>(
+                          expected.begin(), expected.end())));
+
+            auto min_max = index.MinMax(rows);
+            ASSERT_TRUE(min_max.has_value());
+            EXPECT_EQ(min_max->first, expected.begin()->first);
+            EXPECT_EQ(min_max->second, expected.rbegin()->first);
+        }
+
+        // only null rows selected
+        TargetBitmap null_rows(n, false);
+        null_rows.set(0);
+        null_rows.set(11);
+        EXPECT_FALSE(index.MinMax(null_rows).has_value());
+        int64_t groups = 0;
+        index.ValueCounts(null_rows,
+                          [&](const int32_t&, int64_t) { groups++; });
+        EXPECT_EQ(groups, 0);
+    }
+}
@@ -28,6 +28,11 @@ namespace milvus::index {
 std::vector<std::string>
 extract_literals_from_regex(const std::string& pattern);
 
+// Split a LIKE pattern into the literal runs between its % and _ wildcards,
+// with escapes resolved. Every run appears in any matching string.
+std::vector<std::string>
+split_by_wildcard(const std::string& literal);
+
 class NgramInvertedIndex : public InvertedIndexTantivy<std::string> {
  public:
     // for string/varchar type
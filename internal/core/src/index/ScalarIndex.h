@@ -17,9 +17,12 @@
 #pragma once
 
 #include <boost/dynamic_bitset.hpp>
+#include <functional>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
+#include <utility>
 
 #include "common/Types.h"
 #include "common/EasyAssert.h"
@@ -200,6 +203,35 @@ class ScalarIndex : public IndexBase {
         ThrowInfo(Unsupported, "pattern match is not supported");
     }
 
+    // Aggregation pushdown. `rows` has one bit per row of the index, set for
+    // the rows to aggregate. An index that keeps per-value postings or the
+    // values in sorted order answers these without reading the raw column;
+    // callers check the Support* gate first and fall back to a scan.
+    virtual bool
+    SupportValueCounts() const {
+        return false;
+    }
+
+    // Calls fn(value, count) once per non-null value with at least one row
+    // in `rows`, in ascending value order.
+    virtual void
+    ValueCounts(const TargetBitmap& rows,
+                const std::function<void(const T&, int64_t)>& fn) const {
+        ThrowInfo(Unsupported, "value counts are not supported");
+    }
+
+    virtual bool
+    SupportMinMax() const {
+        return false;
+    }
+
+    // Smallest and largest non-null value among `rows`, std::nullopt when
+    // all of them are null.
+    virtual std::optional<std::pair<T, T>>
+    MinMax(const TargetBitmap& rows) const {
+        ThrowInfo(Unsupported, "min/max is not supported");
+    }
+
     virtual bool
     IsMmapSupported() const override {
         return index_type_ == milvus::index::BITMAP_INDEX_TYPE ||
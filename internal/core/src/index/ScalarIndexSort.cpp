@@ -22,6 +22,7 @@
 #include <cstdint>
 #include <exception>
 #include <filesystem>
+#include <limits>
 #include <map>
 #include <memory>
 #include <optional>
@@ -69,6 +70,31 @@ const uint64_t MMAP_INDEX_PADDING = 1;
 
 namespace {
 
+// values per sample of the search directory; a block of int64 values spans
+// eight cache lines
+constexpr size_t kSearchBlockSize = 64;
+
+// ranges with more rows than this are scattered into the result bitmap one
+// bitmap block at a time rather than in value order
+constexpr size_t kScatterPartitionThreshold = 1 << 16;
+// 32K rows, i.e. one 4KB page of the result bitmap
+constexpr size_t kScatterBlockBits = 15;
+
+// IN-lists up to this size search every value on its own; longer lists are
+// sorted once and merged against the sorted values
+constexpr size_t kBatchInThreshold = 32;
+
+// Offsets are kept as uint32_t next to the sorted values, see row_id_at().
+// `num_rows` counts the elements of a nested index.
+void
+AssertOffsetsFitUint32(size_t num_rows, bool is_nested) {
+    AssertInfo(num_rows <= std::numeric_limits<uint32_t>::max(),
+               "ScalarIndexSort can't index {} {}, offsets are kept as "
+               "uint32_t",
+               num_rows,
+               is_nested ? "elements" : "rows");
+}
+
 bool
 IsArrayField(const storage::FileManagerContext& file_manager_context) {
     return file_manager_context.Valid() &&
@@ -121,6 +147,7 @@ ScalarIndexSort<T>::Build(size_t n, const T* values, const bool* valid_data) {
     }
     index_build_begin_ = std::chrono::system_clock::now();
 
+    AssertOffsetsFitUint32(n, is_nested_index_);
     data_.reserve(n);
     total_num_rows_ = n;
     valid_bitset_ = TargetBitmap(total_num_rows_, false);
@@ -165,6 +192,7 @@ ScalarIndexSort<T>::BuildWithFieldData(
     if (total_num_rows_ == 0) {
         ThrowInfo(DataIsEmpty, "ScalarIndexSort cannot build null values!");
     }
+    AssertOffsetsFitUint32(total_num_rows_, false);
 
     data_.reserve(length);
     valid_bitset_ = TargetBitmap(total_num_rows_, false);
@@ -217,6 +245,7 @@ ScalarIndexSort<T>::BuildWithArrayDataNested(
     if (total_num_rows_ == 0) {
         ThrowInfo(DataIsEmpty, "ScalarIndexSort cannot build null values!");
     }
+    AssertOffsetsFitUint32(total_num_rows_, true);
 
     data_.reserve(total_num_rows_);
     // all values are valid for nested index because any given slot in a valid_bitset_ denotes one element in a valid row
@@ -250,18 +279,84 @@ ScalarIndexSort<T>::BuildWithArrayDataNested(
     ComputeByteSize();
 }
 
+template <typename T>
+void
+ScalarIndexSort<T>::setup_data_pointers() {
+    if (is_mmap_) {
+        size_ = data_size_ / sizeof(IndexStructure<T>);
+        values_base_ = mmap_data_ + offsetof(IndexStructure<T>, a_);
+        values_stride_ = sizeof(IndexStructure<T>);
+        row_ids_base_ = mmap_data_ + offsetof(IndexStructure<T>, idx_);
+        row_ids_stride_ = sizeof(IndexStructure<T>);
+    } else {
+        if (!data_.empty()) {
+            values_.resize(data_.size());
+            row_ids_.resize(data_.size());
+            for (size_t i = 0; i < data_.size(); ++i) {
+                values_[i] = data_[i].a_;
+                row_ids_[i] = static_cast<uint32_t>(data_[i].idx_);
+            }
+            std::vector<IndexStructure<T>>().swap(data_);
+        }
+        size_ = values_.size();
+        values_base_ = reinterpret_cast<const char*>(values_.data());
+        values_stride_ = sizeof(T);
+        row_ids_base_ = reinterpret_cast<const char*>(row_ids_.data());
+        row_ids_stride_ = sizeof(uint32_t);
+    }
+    BuildSearchDirectory();
+}
+
+template <typename T>
+void
+ScalarIndexSort<T>::BuildSearchDirectory() {
+    search_keys_.clear();
+    search_ranks_.clear();
+    // a plain binary search over a few blocks is already cheap
+    if (size_ < 4 * kSearchBlockSize) {
+        return;
+    }
+    auto num_samples = (size_ + kSearchBlockSize - 1) / kSearchBlockSize;
+    search_keys_.resize(num_samples + 1);
+    search_ranks_.resize(num_samples + 1);
+    // in-order walk of the implicit tree assigns samples in sorted order
+    uint32_t sample = 0;
+    auto fill = [&](auto& self, size_t k) -> void {
+        if (k > num_samples) {
+            return;
+        }
+        self(self, 2 * k);
+        search_keys_[k] = value_at(sample * kSearchBlockSize);
+        search_ranks_[k] = sample++;
+        self(self, 2 * k + 1);
+    };
+    fill(fill, 1);
+}
+
+template <typename T>
+std::vector<IndexStructure<T>>
+ScalarIndexSort<T>::MaterializeEntries() const {
+    std::vector<IndexStructure<T>> entries;
+    entries.reserve(size_);
+    for (size_t i = 0; i < size_; ++i) {
+        entries.emplace_back(value_at(i), row_id_at(i));
+    }
+    return entries;
+}
+
 template <typename T>
 BinarySet
 ScalarIndexSort<T>::Serialize(const Config& config) {
     AssertInfo(is_built_, "index has not been built");
 
-    auto index_data_size = data_.size() * sizeof(IndexStructure<T>);
+    auto entries = MaterializeEntries();
+    auto index_data_size = entries.size() * sizeof(IndexStructure<T>);
     std::shared_ptr<uint8_t[]> index_data(new uint8_t[index_data_size]);
     milvus::fastmem::FastMemcpy(
-        index_data.get(), data_.data(), index_data_size);
+        index_data.get(), entries.data(), index_data_size);
 
     std::shared_ptr<uint8_t[]> index_length(new uint8_t[sizeof(size_t)]);
-    auto index_size = data_.size();
+    auto index_size = entries.size();
     milvus::fastmem::FastMemcpy(
         index_length.get(), &index_size, sizeof(size_t));
 
@@ -407,14 +502,15 @@ ScalarIndexSort<T>::LoadWithoutAssemble(const BinarySet& index_binary,
     } else {
         total_num_rows_ = index_size;
     }
+    AssertOffsetsFitUint32(total_num_rows_, is_nested_index_);
 
     idx_to_offsets_.resize(total_num_rows_);
     valid_bitset_ = TargetBitmap(total_num_rows_, false);
 
     for (size_t i = 0; i < Size(); ++i) {
-        const auto& item = operator[](i);
-        idx_to_offsets_[item.idx_] = i;
-        valid_bitset_.set(item.idx_);
+        auto row_id = row_id_at(i);
+        idx_to_offsets_[row_id] = i;
+        valid_bitset_.set(row_id);
     }
     idx_to_offsets_ptr_ = idx_to_offsets_.data();
     idx_to_offsets_size_ = idx_to_offsets_.size();
@@ -460,21 +556,7 @@ const TargetBitmap
 ScalarIndexSort<T>::In(const size_t n, const T* values) {
     AssertInfo(is_built_, "index has not been built");
     TargetBitmap bitset(Count());
-    for (size_t i = 0; i < n; ++i) {
-        const auto target = IndexStructure<T>(*(values + i));
-        auto lb = std::lower_bound(begin(), end(), target);
-        auto ub = std::upper_bound(lb, end(), target);
-        for (; lb < ub; ++lb) {
-            if (lb->a_ != target.a_) {
-                LOG_ERROR(
-                    "error happens in ScalarIndexSort<T>::In, "
-                    "expected value is: {}, but real value is: {}",
-                    target.a_,
-                    lb->a_);
-            }
-            bitset[lb->idx_] = true;
-        }
-    }
+    SetInRows(n, values, true, bitset);
     return bitset;
 }
 
@@ -483,24 +565,76 @@ const TargetBitmap
 ScalarIndexSort<T>::NotIn(const size_t n, const T* values) {
     AssertInfo(is_built_, "index has not been built");
     TargetBitmap bitset(Count(), true);
+    SetInRows(n, values, false, bitset);
+    // NotIn(null) and In(null) is both false, need to mask with IsNotNull operate
+    bitset &= valid_bitset_;
+    return bitset;
+}
+
+template <typename T>
+void
+ScalarIndexSort<T>::SetInRows(const size_t n,
+                              const T* values,
+                              bool value,
+                              TargetBitmap& bitset) const {
+    if (n <= kBatchInThreshold) {
+        for (size_t i = 0; i < n; ++i) {
+            const auto& target = values[i];
+            auto lb = Bound(target, false);
+            auto ub = lb;
+            while (ub < size_ && value_at(ub) == target) {
+                ++ub;
+            }
+            SetRows(lb, ub, value, bitset);
+        }
+        return;
+    }
+
+    // NaN never equals a stored value and would break the sort order
+    FixedVector<T> targets;
+    targets.reserve(n);
     for (size_t i = 0; i < n; ++i) {
-        const auto target = IndexStructure<T>(*(values + i));
-        auto lb = std::lower_bound(begin(), end(), target);
-        auto ub = std::upper_bound(lb, end(), target);
-        for (; lb < ub; ++lb) {
-            if (lb->a_ != target.a_) {
-                LOG_ERROR(
-                    "error happens in ScalarIndexSort<T>::NotIn, "
-                    "expected value is: {}, but real value is: {}",
-                    target.a_,
-                    lb->a_);
+        if (values[i] == values[i]) {
+            targets.push_back(values[i]);
+        }
+    }
+    std::sort(targets.begin(), targets.end());
+    targets.erase(std::unique(targets.begin(), targets.end()), targets.end());
+
+    // Walk the sorted values once. Each search gallops forward from the end
+    // of the previous match, so it costs the log of the distance skipped,
+    // not of the whole index.
+    auto gallop = [this](size_t from, auto&& before) {
+        size_t lo = from;
+        size_t step = 1;
+        while (lo + step < size_ && before(value_at(lo + step))) {
+            lo += step;
+            step <<= 1;
+        }
+        if (lo < size_ && before(value_at(lo))) {
+            auto hi = std::min(lo + step, size_);
+            ++lo;
+            while (lo < hi) {
+                auto mid = lo + (hi - lo) / 2;
+                if (before(value_at(mid))) {
+                    lo = mid + 1;
+                } else {
+                    hi = mid;
+                }
             }
-            bitset[lb->idx_] = false;
         }
+        return lo;
+    };
+    size_t pos = 0;
+    for (const auto& target : targets) {
+        if (pos >= size_) {
+            break;
+        }
+        auto lb = gallop(pos, [&](const T& v) { return v < target; });
+        auto ub = gallop(lb, [&](const T& v) { return !(target < v); });
+        SetRows(lb, ub, value, bitset);
+        pos = ub;
     }
-    // NotIn(null) and In(null) is both false, need to mask with IsNotNull operate
-    bitset &= valid_bitset_;
-    return bitset;
 }
 
 template <typename T>
@@ -526,53 +660,30 @@ template <typename T>
 const TargetBitmap
 ScalarIndexSort<T>::Range(const T& value, const OpType op) {
     AssertInfo(is_built_, "index has not been built");
-    auto lb = begin();
-    auto ub = end();
+    size_t lb = 0;
+    size_t ub = size_;
     if (ShouldSkip(value, value, op)) {
         TargetBitmap bitset(Count());
         return bitset;
     }
     switch (op) {
         case OpType::LessThan:
-            ub = std::lower_bound(begin(), end(), IndexStructure<T>(value));
+            ub = Bound(value, false);
             break;
         case OpType::LessEqual:
-            ub = std::upper_bound(begin(), end(), IndexStructure<T>(value));
+            ub = Bound(value, true);
             break;
         case OpType::GreaterThan:
-            lb = std::upper_bound(begin(), end(), IndexStructure<T>(value));
+            lb = Bound(value, true);
             break;
         case OpType::GreaterEqual:
-            lb = std::lower_bound(begin(), end(), IndexStructure<T>(value));
+            lb = Bound(value, false);
             break;
         default:
             ThrowInfo(OpTypeInvalid,
                       fmt::format("Invalid OperatorType: {}", op));
     }
-
-    size_t hit_count = ub - lb;
-    size_t total_count = Count();
-
-    if (hit_count > total_count / 2) {
-        // Most elements are in range, initialize with `valid_bitset` and set non-matching to false
-        TargetBitmap bitset = valid_bitset_.clone();
-        // Set elements before lb to false
-        for (auto it = begin(); it < lb; ++it) {
-            bitset[it->idx_] = false;
-        }
-        // Set elements after ub to false
-        for (auto it = ub; it < end(); ++it) {
-            bitset[it->idx_] = false;
-        }
-        return bitset;
-    } else {
-        // Fewer elements are in range, initialize with false and set matching to true
-        TargetBitmap bitset(total_count);
-        for (; lb < ub; ++lb) {
-            bitset[lb->idx_] = true;
-        }
-        return bitset;
-    }
+    return RangeByPosition(lb, ub);
 }
 
 template <typename T>
@@ -592,44 +703,96 @@ ScalarIndexSort<T>::Range(const T& lower_bound_value,
         TargetBitmap bitset(Count());
         return bitset;
     }
-    auto lb = begin();
-    auto ub = end();
-    if (lb_inclusive) {
-        lb = std::lower_bound(
-            begin(), end(), IndexStructure<T>(lower_bound_value));
-    } else {
-        lb = std::upper_bound(
-            begin(), end(), IndexStructure<T>(lower_bound_value));
+    auto lb = Bound(lower_bound_value, !lb_inclusive);
+    auto ub = Bound(upper_bound_value, ub_inclusive);
+    return RangeByPosition(lb, ub);
+}
+
+template <typename T>
+size_t
+ScalarIndexSort<T>::Bound(const T& value, bool upper) const {
+    auto before = [&](const T& v) { return upper ? !(value < v) : v < value; };
+    size_t lo = 0;
+    size_t hi = size_;
+    if (!search_keys_.empty()) {
+        auto num_samples = search_keys_.size() - 1;
+        size_t k = 1;
+        while (k <= num_samples) {
+            k = 2 * k + before(search_keys_[k]);
+        }
+        // drop the trailing right turns to reach the first sample that is
+        // not before `value`; k == 0 when every sample is
+        k >>= __builtin_ffsll(~k);
+        size_t sample = k == 0 ? num_samples : search_ranks_[k];
+        if (sample > 0) {
+            lo = (sample - 1) * kSearchBlockSize + 1;
+        }
+        if (sample < num_samples) {
+            hi = sample * kSearchBlockSize;
+        }
     }
-    if (ub_inclusive) {
-        ub = std::upper_bound(
-            begin(), end(), IndexStructure<T>(upper_bound_value));
-    } else {
-        ub = std::lower_bound(
-            begin(), end(), IndexStructure<T>(upper_bound_value));
+    while (lo < hi) {
+        auto mid = lo + (hi - lo) / 2;
+        if (before(value_at(mid))) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+template <typename T>
+void
+ScalarIndexSort<T>::SetRows(size_t first,
+                            size_t last,
+                            bool value,
+                            TargetBitmap& bitset) const {
+    if (last - first < kScatterPartitionThreshold) {
+        for (auto pos = first; pos < last; ++pos) {
+            bitset[row_id_at(pos)] = value;
+        }
+        return;
+    }
+    // Rows in value order land all over the bitmap. Partition the row ids by
+    // bitmap block first, so the bitmap is written one block at a time.
+    auto num_blocks = (total_num_rows_ >> kScatterBlockBits) + 1;
+    std::vector<uint32_t> cursors(num_blocks + 1, 0);
+    for (auto pos = first; pos < last; ++pos) {
+        ++cursors[(row_id_at(pos) >> kScatterBlockBits) + 1];
     }
+    for (size_t i = 1; i <= num_blocks; ++i) {
+        cursors[i] += cursors[i - 1];
+    }
+    std::vector<uint32_t> partitioned(last - first);
+    for (auto pos = first; pos < last; ++pos) {
+        auto row_id = row_id_at(pos);
+        partitioned[cursors[row_id >> kScatterBlockBits]++] = row_id;
+    }
+    for (auto row_id : partitioned) {
+        bitset[row_id] = value;
+    }
+}
 
+template <typename T>
+const TargetBitmap
+ScalarIndexSort<T>::RangeByPosition(size_t lb, size_t ub) const {
+    size_t total_count = total_num_rows_;
+    if (lb >= ub) {
+        return TargetBitmap(total_count);
+    }
     size_t hit_count = ub - lb;
-    size_t total_count = Count();
 
     if (hit_count > total_count / 2) {
         // Most elements are in range, initialize with `valid_bitset_` and set non-matching to false
         TargetBitmap bitset = valid_bitset_.clone();
-        // Set elements before lb to false
-        for (auto it = begin(); it < lb; ++it) {
-            bitset[it->idx_] = false;
-        }
-        // Set elements after ub to false
-        for (auto it = ub; it < end(); ++it) {
-            bitset[it->idx_] = false;
-        }
+        SetRows(0, lb, false, bitset);
+        SetRows(ub, size_, false, bitset);
         return bitset;
     } else {
         // Fewer elements are in range, initialize with false and set matching to true
         TargetBitmap bitset(total_count);
-        for (; lb < ub; ++lb) {
-            bitset[lb->idx_] = true;
-        }
+        SetRows(lb, ub, true, bitset);
         return bitset;
     }
 }
@@ -644,7 +807,31 @@ ScalarIndexSort<T>::Reverse_Lookup(size_t idx) const {
         return std::nullopt;
     }
     auto offset = idx_to_offsets_ptr_[idx];
-    return operator[](offset).a_;
+    return value_at(offset);
+}
+
+template <typename T>
+std::optional<std::pair<T, T>>
+ScalarIndexSort<T>::MinMax(const TargetBitmap& rows) const {
+    AssertInfo(is_built_, "index has not been built");
+    AssertInfo(rows.size() == total_num_rows_,
+               "rows size {} must match index rows {}",
+               rows.size(),
+               total_num_rows_);
+    // null rows are not in the sorted data, so the first and last entries
+    // that are selected hold the answer
+    size_t lo = 0;
+    while (lo < size_ && !rows[row_id_at(lo)]) {
+        ++lo;
+    }
+    if (lo == size_) {
+        return std::nullopt;
+    }
+    size_t hi = size_ - 1;
+    while (!rows[row_id_at(hi)]) {
+        --hi;
+    }
+    return std::make_pair(value_at(lo), value_at(hi));
 }
 
 template <typename T>
@@ -653,29 +840,29 @@ ScalarIndexSort<T>::ShouldSkip(const T lower_value,
                                const T upper_value,
                                const milvus::OpType op) {
     if (!Empty()) {
-        auto lower_bound = begin();
-        auto upper_bound = rbegin();
+        const auto& min_value = value_at(0);
+        const auto& max_value = value_at(size_ - 1);
         bool shouldSkip = false;
         switch (op) {
             case OpType::LessThan: {
-                shouldSkip = upper_value <= lower_bound->a_;
+                shouldSkip = upper_value <= min_value;
                 break;
             }
             case OpType::LessEqual: {
-                shouldSkip = upper_value < lower_bound->a_;
+                shouldSkip = upper_value < min_value;
                 break;
             }
             case OpType::GreaterThan: {
-                shouldSkip = lower_value >= upper_bound->a_;
+                shouldSkip = lower_value >= max_value;
                 break;
             }
             case OpType::GreaterEqual: {
-                shouldSkip = lower_value > upper_bound->a_;
+                shouldSkip = lower_value > max_value;
                 break;
             }
             case OpType::Range: {
-                shouldSkip = (lower_value > upper_bound->a_) ||
-                             (upper_value < lower_bound->a_);
+                shouldSkip = (lower_value > max_value) ||
+                             (upper_value < min_value);
                 break;
             }
             default:
@@ -694,12 +881,14 @@ void
 ScalarIndexSort<T>::WriteEntries(storage::IndexEntryWriter* writer) {
     AssertInfo(is_built_, "index has not been built");
 
-    writer->PutMeta("index_length", data_.size());
+    auto entries = MaterializeEntries();
+    writer->PutMeta("index_length", entries.size());
     writer->PutMeta("num_rows", total_num_rows_);
     writer->PutMeta("is_nested", is_nested_index_);
 
-    writer->WriteEntry(
-        "index_data", data_.data(), data_.size() * sizeof(IndexStructure<T>));
+    writer->WriteEntry("index_data",
+                       entries.data(),
+                       entries.size() * sizeof(IndexStructure<T>));
 
     // Persist idx_to_offsets and valid_bitset to avoid recomputation at load.
     writer->WriteEntry("idx_to_offsets",
@@ -717,6 +906,7 @@ ScalarIndexSort<T>::LoadEntries(storage::IndexEntryReader& reader,
     size_t index_size = reader.GetMeta<size_t>("index_length");
     total_num_rows_ = reader.GetMeta<size_t>("num_rows");
     is_nested_index_ = is_nested_index_ || reader.GetMeta<bool>("is_nested");
+    AssertOffsetsFitUint32(total_num_rows_, is_nested_index_);
 
     is_mmap_ = GetValueFromConfig<bool>(config, ENABLE_MMAP).value_or(true);
 
@@ -888,9 +1078,9 @@ ScalarIndexSort<T>::LoadEntries(storage::IndexEntryReader& reader,
         idx_to_offsets_.resize(total_num_rows_);
         valid_bitset_ = TargetBitmap(total_num_rows_, false);
         for (size_t i = 0; i < Size(); ++i) {
-            const auto& item = operator[](i);
-            idx_to_offsets_[item.idx_] = i;
-            valid_bitset_.set(item.idx_);
+            auto row_id = row_id_at(i);
+            idx_to_offsets_[row_id] = i;
+            valid_bitset_.set(row_id);
         }
         idx_to_offsets_ptr_ = idx_to_offsets_.data();
         idx_to_offsets_size_ = idx_to_offsets_.size();
@@ -22,7 +22,6 @@
 #include <unistd.h>
 #include <chrono>
 #include <cstddef>
-#include <iterator>
 #include <memory>
 #include <optional>
 #include <string>
@@ -130,6 +129,14 @@ class ScalarIndexSort : public ScalarIndex<T> {
     std::optional<T>
     Reverse_Lookup(size_t offset) const override;
 
+    bool
+    SupportMinMax() const override {
+        return !is_nested_index_;
+    }
+
+    std::optional<std::pair<T, T>>
+    MinMax(const TargetBitmap& rows) const override;
+
     int64_t
     Size() override {
         return (int64_t)size_;
@@ -159,10 +166,15 @@ class ScalarIndexSort : public ScalarIndex<T> {
             // mmap mode: add mmap size and filepath
             total += mmap_size_;
         } else {
-            // memory mode: add data vector
-            total += data_.capacity() * sizeof(IndexStructure<T>);
+            // memory mode: add the value and row id arrays
+            total += values_.capacity() * sizeof(T);
+            total += row_ids_.capacity() * sizeof(uint32_t);
         }
 
+        // sampled search directory
+        total += search_keys_.capacity() * sizeof(T);
+        total += search_ranks_.capacity() * sizeof(uint32_t);
+
         this->cached_byte_size_ = total;
     }
 
@@ -185,11 +197,6 @@ class ScalarIndexSort : public ScalarIndex<T> {
     ShouldSkip(const T lower_value, const T upper_value, const OpType op);
 
  public:
-    const IndexStructure<T>*
-    GetData() {
-        return data_ptr_;
-    }
-
     bool
     IsBuilt() const {
         return is_built_;
@@ -207,29 +214,19 @@ class ScalarIndexSort : public ScalarIndex<T> {
                 const Config& config) override;
 
  public:
-    // zero-cost data acess api
-    ALWAYS_INLINE const IndexStructure<T>&
-    operator[](size_t idx) const {
-        assert(idx < size_);
-        return data_ptr_[idx];
+    // zero-cost data acess api, `pos` is the position in sorted order
+    ALWAYS_INLINE const T&
+    value_at(size_t pos) const {
+        assert(pos < size_);
+        return *reinterpret_cast<const T*>(values_base_ +
+                                           pos * values_stride_);
     }
 
-    ALWAYS_INLINE const IndexStructure<T>*
-    begin() const {
-        return data_ptr_;
-    }
-
-    using const_iterator = const IndexStructure<T>*;
-    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
-
-    ALWAYS_INLINE const_reverse_iterator
-    rbegin() const {
-        return const_reverse_iterator(end());
-    }
-
-    ALWAYS_INLINE const IndexStructure<T>*
-    end() const {
-        return end_ptr_;
+    ALWAYS_INLINE uint32_t
+    row_id_at(size_t pos) const {
+        assert(pos < size_);
+        return *reinterpret_cast<const uint32_t*>(row_ids_base_ +
+                                                  pos * row_ids_stride_);
     }
 
  private:
@@ -242,18 +239,43 @@ class ScalarIndexSort : public ScalarIndex<T> {
                       size_t size,
                       milvus::proto::common::LoadPriority priority);
 
+    // Point the accessors at the sorted entries. In memory mode the sorted
+    // IndexStructure entries in data_ are split into values_ and row_ids_
+    // and released; mmap mode reads the persisted entries in place.
     void
-    setup_data_pointers() const {
-        if (is_mmap_) {
-            data_ptr_ = reinterpret_cast<IndexStructure<T>*>(mmap_data_);
-            size_ = data_size_ / sizeof(IndexStructure<T>);
-            end_ptr_ = data_ptr_ + size_;
-        } else {
-            data_ptr_ = data_.data();
-            end_ptr_ = data_ptr_ + data_.size();
-            size_ = data_.size();
-        }
-    }
+    setup_data_pointers();
+
+    // Sample every kSearchBlockSize-th value into an Eytzinger ordered
+    // directory, so a bound search walks a small cache-resident array before
+    // a short binary search inside one block.
+    void
+    BuildSearchDirectory();
+
+    // First sorted position whose value is not less than `value`, or with
+    // `upper` set, greater than `value`.
+    size_t
+    Bound(const T& value, bool upper) const;
+
+    // Set bitset[row_id_at(pos)] = `value` for positions in [first, last).
+    void
+    SetRows(size_t first,
+            size_t last,
+            bool value,
+            TargetBitmap& bitset) const;
+
+    const TargetBitmap
+    RangeByPosition(size_t lb, size_t ub) const;
+
+    // Set bitset[row] = `value` for the rows holding any of `values`.
+    void
+    SetInRows(size_t n,
+              const T* values,
+              bool value,
+              TargetBitmap& bitset) const;
+
+    // Rebuild the persisted IndexStructure entries from the sorted view.
+    std::vector<IndexStructure<T>>
+    MaterializeEntries() const;
 
     int64_t field_id_ = 0;
 
@@ -273,15 +295,28 @@ class ScalarIndexSort : public ScalarIndex<T> {
     // generate valid_bitset_ to speed up NotIn and IsNull and IsNotNull operate
     TargetBitmap valid_bitset_;
 
-    // for ram and also used for building index.
-    // Note: it should not be used directly for accessing data. Use data_ptr_ instead.
+    // sorted entries while building or loading in memory mode, split into
+    // values_ and row_ids_ by setup_data_pointers().
+    // Note: it should not be used directly for accessing data. Use value_at()
+    // and row_id_at() instead.
     std::vector<IndexStructure<T>> data_;
 
+    // for ram: sorted values and their row ids, kept apart so searches only
+    // touch the values. FixedVector keeps bool values addressable.
+    FixedVector<T> values_;
+    FixedVector<uint32_t> row_ids_;
+
+    // Eytzinger ordered samples of values_, 1-based, and the sample number
+    // of each key. Empty for small indexes.
+    FixedVector<T> search_keys_;
+    FixedVector<uint32_t> search_ranks_;
+
     // for mmap: index_data
     bool is_mmap_{false};
     int64_t mmap_size_ = 0;
     int64_t data_size_ = 0;
-    // Note: it should not be used directly for accessing data. Use data_ptr_ instead.
+    // Note: it should not be used directly for accessing data. Use value_at()
+    // and row_id_at() instead.
     char* mmap_data_ = nullptr;
     std::string mmap_filepath_;
 
@@ -290,9 +325,11 @@ class ScalarIndexSort : public ScalarIndex<T> {
     int64_t mmap_meta_size_ = 0;
     std::string mmap_meta_filepath_;
 
-    mutable const IndexStructure<T>* data_ptr_ = nullptr;
-    mutable const IndexStructure<T>* end_ptr_ = nullptr;
-    mutable size_t size_ = 0;
+    const char* values_base_ = nullptr;
+    size_t values_stride_ = sizeof(T);
+    const char* row_ids_base_ = nullptr;
+    size_t row_ids_stride_ = sizeof(uint32_t);
+    size_t size_ = 0;
 
     std::chrono::time_point<std::chrono::system_clock> index_build_begin_;
 };
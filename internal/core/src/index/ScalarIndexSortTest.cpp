@@ -1,10 +1,13 @@
 #include <gtest/gtest.h>
 #include <nlohmann/json.hpp>
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <memory>
 #include <optional>
+#include <random>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -132,6 +135,119 @@ TEST(StlSortIndexTest, TestIn) {
         data, DataType::INT64, true, exec_expr, expected_result);
 }
 
+TEST(StlSortIndexTest, TestMinMax) {
+    std::vector<int64_t> data = {10, 2, 6, 5, 9, 3, 7, 8, 4, 1};
+    std::vector<bool> expected_result(data.size(), false);
+    using MinMax = std::optional<std::pair<int64_t, int64_t>>;
+
+    auto exec_expr =
+        [&data](const std::shared_ptr<ScalarIndexSort<int64_t>>& index) {
+            EXPECT_TRUE(index->SupportMinMax());
+            TargetBitmap rows(data.size(), true);
+            EXPECT_EQ(index->MinMax(rows), MinMax(std::make_pair(1, 10)));
+            TargetBitmap some_rows(data.size(), false);
+            some_rows.set(2);
+            some_rows.set(3);
+            some_rows.set(6);
+            EXPECT_EQ(index->MinMax(some_rows), MinMax(std::make_pair(5, 7)));
+            TargetBitmap no_rows(data.size(), false);
+            EXPECT_EQ(index->MinMax(no_rows), std::nullopt);
+            return no_rows;
+        };
+    test_stlsort_for_range(
+        data, DataType::INT64, false, exec_expr, expected_result);
+
+    test_stlsort_for_range(
+        data, DataType::INT64, true, exec_expr, expected_result);
+}
+
+TEST(StlSortIndexTest, SampledSearchMatchesBruteForce) {
+    // large enough for the sampled search directory and the partitioned
+    // scatter of wide ranges
+    constexpr size_t nb = 200000;
+    std::default_random_engine rng(42);
+    std::uniform_int_distribution<int64_t> value_dist(-5000, 5000);
+    std::vector<int64_t> data(nb);
+    std::unique_ptr<bool[]> valid_data(new bool[nb]);
+    for (size_t i = 0; i < nb; ++i) {
+        data[i] = value_dist(rng);
+        valid_data[i] = i % 7 != 0;
+    }
+
+    auto check = [&](ScalarIndexSort<int64_t>& index) {
+        auto expect_rows = [&](const TargetBitmap& bitset, auto pred) {
+            ASSERT_EQ(bitset.size(), nb);
+            for (size_t i = 0; i < nb; ++i) {
+                ASSERT_EQ(bitset[i], valid_data[i] && pred(data[i]))
+                    << "row " << i;
+            }
+        };
+        for (int64_t v : {-6000, -5000, -17, 0, 1234, 5000, 6000}) {
+            expect_rows(index.Range(v, OpType::LessThan),
+                        [v](int64_t x) { return x < v; });
+            expect_rows(index.Range(v, OpType::LessEqual),
+                        [v](int64_t x) { return x <= v; });
+            expect_rows(index.Range(v, OpType::GreaterThan),
+                        [v](int64_t x) { return x > v; });
+            expect_rows(index.Range(v, OpType::GreaterEqual),
+                        [v](int64_t x) { return x >= v; });
+        }
+        expect_rows(index.Range(-4000, true, 4000, false),
+                    [](int64_t x) { return x >= -4000 && x < 4000; });
+        expect_rows(index.Range(-10, false, 10, true),
+                    [](int64_t x) { return x > -10 && x <= 10; });
+
+        std::vector<int64_t> values = {-5000, 3, 77, 5000, 9999};
+        auto in = [&](int64_t x) {
+            return std::find(values.begin(), values.end(), x) != values.end();
+        };
+        expect_rows(index.In(values.size(), values.data()), in);
+        expect_rows(index.NotIn(values.size(), values.data()),
+                    [&](int64_t x) { return !in(x); });
+
+        // long lists are sorted and merged against the index
+        std::vector<int64_t> many_values;
+        for (int64_t v = -6000; v <= 6000; v += 7) {
+            many_values.push_back(v);
+            many_values.push_back(v);
+        }
+        std::set<int64_t> many(many_values.begin(), many_values.end());
+        auto in_many = [&](int64_t x) { return many.count(x) > 0; };
+        expect_rows(index.In(many_values.size(), many_values.data()),
+                    in_many);
+        expect_rows(index.NotIn(many_values.size(), many_values.data()),
+                    [&](int64_t x) { return !in_many(x); });
+
+        for (size_t i = 0; i < nb; i += 997) {
+            auto value = index.Reverse_Lookup(i);
+            ASSERT_EQ(value.has_value(), valid_data[i]);
+            if (valid_data[i]) {
+                ASSERT_EQ(value.value(), data[i]);
+            }
+        }
+    };
+
+    std::vector<std::string> index_files;
+    {
+        ScalarIndexSort<int64_t> index(
+            CreateScalarSortTestFileManagerContext());
+        index.Build(nb, data.data(), valid_data.get());
+        check(index);
+        index_files = index.UploadUnified({})->GetIndexFiles();
+    }
+    for (bool enable_mmap : {false, true}) {
+        Config config;
+        config[milvus::index::ENABLE_MMAP] = enable_mmap;
+        config[milvus::LOAD_PRIORITY] =
+            milvus::proto::common::LoadPriority::HIGH;
+        config["index_files"] = index_files;
+        ScalarIndexSort<int64_t> index(
+            CreateScalarSortTestFileManagerContext());
+        index.LoadUnified(config);
+        check(index);
+    }
+}
+
 TEST(StlSortIndexTest, MmapByteSizeCountsValidBitsetOnce) {
     constexpr size_t kAlignment = 32;
     constexpr uint64_t kMmapIndexPadding = 1;
@@ -456,6 +456,24 @@ class SkipIndex {
         return CanSkipInQuery<T>(nullptr, field_id, chunk_id, values);
     }
 
+    // Min and max of the non-null values of one chunk, as recorded by its
+    // metrics; std::nullopt when they aren't recorded.
+    template <typename T>
+    std::optional<std::pair<T, T>>
+    GetChunkMinMax(milvus::OpContext* op_ctx,
+                   FieldId field_id,
+                   int64_t chunk_id) const {
+        auto pw = GetFieldChunkMetrics(op_ctx, field_id, chunk_id);
+        auto min_max = pw.get()->GetMinMax();
+        if (!min_max.has_value() ||
+            !std::holds_alternative<T>(min_max->first) ||
+            !std::holds_alternative<T>(min_max->second)) {
+            return std::nullopt;
+        }
+        return std::make_pair(std::get<T>(min_max->first),
+                              std::get<T>(min_max->second));
+    }
+
     void
     LoadSkip(int64_t segment_id,
              milvus::FieldId field_id,
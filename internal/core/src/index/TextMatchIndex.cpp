@@ -12,13 +12,18 @@
 #include <boost/uuid/random_generator.hpp>
 #include "common/FastMem.h"
 #include <boost/uuid/uuid_io.hpp>
+#include <algorithm>
+#include <functional>
+#include <limits>
 #include <memory>
+#include <queue>
 #include <shared_mutex>
 
 #include "index/TextMatchIndex.h"
 #include "index/InvertedIndexUtil.h"
 #include "index/Utils.h"
 #include "storage/ThreadPools.h"
+#include "tantivy/tokenizer.h"
 
 namespace milvus::index {
 
@@ -31,6 +36,46 @@ StripTextLogPrefix(const std::string& path, const std::string& base_prefix) {
     }
     return path;
 }
+
+std::vector<std::pair<std::string, uint32_t>>
+Tokenize(tantivy::Tokenizer& tokenizer, const std::string& text) {
+    std::vector<std::pair<std::string, uint32_t>> tokens;
+    auto stream = tokenizer.CreateTokenStreamCopyText(text);
+    while (stream->advance()) {
+        auto token = stream->get_detailed_token();
+        tokens.emplace_back(token.token, static_cast<uint32_t>(token.position));
+        free_rust_string(token.token);
+    }
+    return tokens;
+}
+
+// Smallest window holding one value of every list, all sorted and non-empty.
+// With positions shifted by their reverse query position this is the slop a
+// row needs to match the phrase, see compute_phrase_match_slop.
+int64_t
+MinCoveringRange(const std::vector<std::vector<int64_t>>& lists) {
+    using Node = std::pair<int64_t, size_t>;
+    std::priority_queue<Node, std::vector<Node>, std::greater<Node>> heap;
+    std::vector<size_t> next(lists.size(), 1);
+    int64_t current_max = std::numeric_limits<int64_t>::min();
+    for (size_t i = 0; i < lists.size(); ++i) {
+        heap.emplace(lists[i][0], i);
+        current_max = std::max(current_max, lists[i][0]);
+    }
+    int64_t best = std::numeric_limits<int64_t>::max();
+    while (true) {
+        auto [value, list] = heap.top();
+        heap.pop();
+        best = std::min(best, current_max - value);
+        if (best == 0 || next[list] == lists[list].size()) {
+            break;
+        }
+        auto next_value = lists[list][next[list]++];
+        current_max = std::max(current_max, next_value);
+        heap.emplace(next_value, list);
+    }
+    return best;
+}
 }  // namespace
 
 TextMatchIndex::TextMatchIndex(int64_t commit_interval_in_ms,
@@ -54,6 +99,16 @@ TextMatchIndex::TextMatchIndex(int64_t commit_interval_in_ms,
         milvus::tantivy::DEFAULT_OVERALL_MEMORY_BUDGET_IN_BYTES,
         enable_background_merge);
     set_is_growing(true);
+    try {
+        tail_tokenizer_ =
+            std::make_unique<tantivy::Tokenizer>(std::string(analyzer_params));
+    } catch (const std::exception& e) {
+        LOG_WARN(
+            "text match index {} can not tokenize uncommitted rows, queries "
+            "will commit inline: {}",
+            unique_id,
+            e.what());
+    }
 }
 
 TextMatchIndex::TextMatchIndex(const std::string& path,
@@ -113,6 +168,15 @@ TextMatchIndex::TextMatchIndex(const storage::FileManagerContext& ctx)
     d_type_ = TantivyDataType::Text;
 }
 
+TextMatchIndex::~TextMatchIndex() {
+    waitScheduledCommit();
+}
+
+int64_t
+TextMatchIndex::Count() {
+    return std::max<int64_t>(wrapper_->count(), tail_end_.load());
+}
+
 IndexStatsPtr
 TextMatchIndex::Upload(const Config& config) {
     finish();
@@ -289,9 +353,25 @@ TextMatchIndex::AddTextsGrowing(size_t n,
         }
     }
     wrapper_->add_data(texts, n, offset_begin);
-    if (shouldTriggerCommit()) {
-        Commit();
+    if (tail_tokenizer_ != nullptr) {
+        // Only publish after add_data, so that a Commit() that sees this
+        // batch in the tail is known to cover its rows.
+        auto batch = std::make_shared<TailBatch>();
+        batch->offset_begin = offset_begin;
+        auto tokenizer = tail_tokenizer_->Clone();
+        for (size_t i = 0; i < n; i++) {
+            if (valids != nullptr && !valids[i]) {
+                continue;
+            }
+            for (auto& [token, position] : Tokenize(*tokenizer, texts[i])) {
+                batch->postings[token].emplace_back(i, position);
+            }
+        }
+        std::unique_lock<std::shared_mutex> lck(tail_mtx_);
+        tail_.push_back(std::move(batch));
+        tail_end_.store(std::max<int64_t>(tail_end_.load(), offset_begin + n));
     }
+    scheduleCommitIfDue();
 }
 
 // schema_ may not be initialized so we need this `nullable` parameter
@@ -352,18 +432,154 @@ TextMatchIndex::shouldTriggerCommit() {
 
 void
 TextMatchIndex::Commit() {
-    std::unique_lock<std::mutex> lck(mtx_, std::defer_lock);
-    if (lck.try_lock()) {
-        wrapper_->commit();
-        last_commit_time_.store(stdclock::now());
+    std::lock_guard<std::mutex> lck(mtx_);
+    {
+        std::shared_lock<std::shared_mutex> tail_lck(tail_mtx_);
+        committed_tail_ = tail_.size();
     }
+    wrapper_->commit();
+    last_commit_time_.store(stdclock::now());
 }
 
 void
 TextMatchIndex::Reload() {
-    std::unique_lock<std::mutex> lck(mtx_, std::defer_lock);
-    if (lck.try_lock()) {
-        wrapper_->reload();
+    std::lock_guard<std::mutex> lck(mtx_);
+    wrapper_->reload();
+    // the committed batches are searchable in tantivy from now on
+    if (committed_tail_ > 0) {
+        std::unique_lock<std::shared_mutex> tail_lck(tail_mtx_);
+        tail_.erase(tail_.begin(), tail_.begin() + committed_tail_);
+        committed_tail_ = 0;
+    }
+}
+
+void
+TextMatchIndex::scheduleCommitIfDue() {
+    if (!shouldTriggerCommit()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lck(schedule_mtx_);
+    if (commit_scheduled_) {
+        return;
+    }
+    commit_scheduled_ = true;
+    auto& pool = ThreadPools::GetThreadPool(milvus::ThreadPoolPriority::LOW);
+    commit_future_ = pool.Submit([this]() {
+        try {
+            Commit();
+            Reload();
+        } catch (const std::exception& e) {
+            LOG_WARN("background commit of text match index failed: {}",
+                     e.what());
+        }
+        std::lock_guard<std::mutex> lck(schedule_mtx_);
+        commit_scheduled_ = false;
+    });
+}
+
+void
+TextMatchIndex::waitScheduledCommit() {
+    std::future<void> future;
+    {
+        std::lock_guard<std::mutex> lck(schedule_mtx_);
+        future = std::move(commit_future_);
+    }
+    if (future.valid()) {
+        future.wait();
+    }
+}
+
+std::vector<TextMatchIndex::TailBatchPtr>
+TextMatchIndex::snapshotTail() const {
+    std::shared_lock<std::shared_mutex> lck(tail_mtx_);
+    return {tail_.begin(), tail_.end()};
+}
+
+std::vector<std::pair<std::string, uint32_t>>
+TextMatchIndex::tokenizeQuery(const std::string& query) const {
+    auto tokenizer = tail_tokenizer_->Clone();
+    return Tokenize(*tokenizer, query);
+}
+
+void
+TextMatchIndex::matchTail(
+    const std::vector<TailBatchPtr>& tail,
+    const std::vector<std::pair<std::string, uint32_t>>& terms,
+    uint32_t min_should_match,
+    TargetBitmap& bitset) const {
+    // every query token is a clause, as in tantivy's boolean query
+    auto required = std::max<uint32_t>(1, min_should_match);
+    for (const auto& batch : tail) {
+        std::unordered_map<uint32_t, uint32_t> hits;
+        for (const auto& term : terms) {
+            auto it = batch->postings.find(term.first);
+            if (it == batch->postings.end()) {
+                continue;
+            }
+            // postings are in row order, count each row once per clause
+            auto last_row = std::numeric_limits<uint32_t>::max();
+            for (const auto& [row, position] : it->second) {
+                if (row != last_row) {
+                    ++hits[row];
+                    last_row = row;
+                }
+            }
+        }
+        for (const auto& [row, count] : hits) {
+            auto offset = static_cast<size_t>(batch->offset_begin + row);
+            if (count >= required && offset < bitset.size()) {
+                bitset.set(offset);
+            }
+        }
+    }
+}
+
+void
+TextMatchIndex::phraseMatchTail(
+    const std::vector<TailBatchPtr>& tail,
+    const std::vector<std::pair<std::string, uint32_t>>& terms,
+    uint32_t slop,
+    TargetBitmap& bitset) const {
+    uint32_t max_query_pos = 0;
+    for (const auto& term : terms) {
+        max_query_pos = std::max(max_query_pos, term.second);
+    }
+    for (const auto& batch : tail) {
+        // row -> positions of each query term, shifted by the reverse query
+        // position so that an exact phrase lines up on one value
+        std::unordered_map<uint32_t, std::vector<std::vector<int64_t>>> rows;
+        for (size_t t = 0; t < terms.size(); ++t) {
+            auto it = batch->postings.find(terms[t].first);
+            if (it == batch->postings.end()) {
+                rows.clear();
+                break;
+            }
+            int64_t shift = static_cast<int64_t>(max_query_pos) -
+                            static_cast<int64_t>(terms[t].second);
+            for (const auto& [row, position] : it->second) {
+                auto row_it = rows.find(row);
+                if (row_it == rows.end()) {
+                    if (t > 0) {
+                        continue;
+                    }
+                    row_it = rows.emplace(row, terms.size()).first;
+                }
+                row_it->second[t].push_back(position + shift);
+            }
+        }
+        for (const auto& [row, lists] : rows) {
+            auto offset = static_cast<size_t>(batch->offset_begin + row);
+            if (offset >= bitset.size()) {
+                continue;
+            }
+            bool has_all = std::all_of(
+                lists.begin(), lists.end(), [](const auto& list) {
+                    return !list.empty();
+                });
+            if (has_all && MinCoveringRange(lists) <= slop) {
+                bitset.set(offset);
+            }
+        }
     }
 }
 
@@ -380,11 +596,15 @@ TextMatchIndex::RegisterAnalyzer(const char* analyzer_name,
 
 // Refresh a growing index if due, then allocate the result bitset. Shared by
 // the text-index query methods so the commit/reload logic lives in one place.
+// With an uncommitted tail the refresh runs in the background; without one
+// rows are only searchable once committed, so commit inline.
 TargetBitmap
 TextMatchIndex::PrepareBitset() {
-    if (shouldTriggerCommit()) {
+    if (tail_tokenizer_ == nullptr && shouldTriggerCommit()) {
         Commit();
         Reload();
+    } else {
+        scheduleCommitIfDue();
     }
     return TargetBitmap{static_cast<size_t>(Count())};
 }
@@ -393,8 +613,14 @@ TargetBitmap
 TextMatchIndex::MatchQuery(const std::string& query,
                            uint32_t min_should_match) {
     tracer::AutoSpan span("TextMatchIndex::MatchQuery", tracer::GetRootSpan());
+    // Take the tail before searching tantivy: batches only leave the tail
+    // after a reload, so every row is seen by one side or the other.
+    auto tail = snapshotTail();
     TargetBitmap bitset = PrepareBitset();
     wrapper_->match_query(query, min_should_match, &bitset);
+    if (!tail.empty()) {
+        matchTail(tail, tokenizeQuery(query), min_should_match, bitset);
+    }
     return bitset;
 }
 
@@ -402,8 +628,18 @@ TargetBitmap
 TextMatchIndex::PhraseMatchQuery(const std::string& query, uint32_t slop) {
     tracer::AutoSpan span("TextMatchIndex::PhraseMatchQuery",
                           tracer::GetRootSpan());
+    auto tail = snapshotTail();
     TargetBitmap bitset = PrepareBitset();
     wrapper_->phrase_match_query(query, slop, &bitset);
+    if (!tail.empty()) {
+        auto terms = tokenizeQuery(query);
+        if (terms.size() <= 1) {
+            // tantivy runs a single term phrase as a text match as well
+            matchTail(tail, terms, 1, bitset);
+        } else {
+            phraseMatchTail(tail, terms, slop, bitset);
+        }
+    }
     return bitset;
 }
 
@@ -412,6 +648,12 @@ TextMatchIndex::FuzzyMatchQuery(const std::string& query,
                                 uint32_t max_edit_distance) {
     tracer::AutoSpan span("TextMatchIndex::FuzzyMatchQuery",
                           tracer::GetRootSpan());
+    // fuzzy terms are not matched against the tail, make it searchable in
+    // tantivy first
+    if (!snapshotTail().empty()) {
+        Commit();
+        Reload();
+    }
     TargetBitmap bitset = PrepareBitset();
     wrapper_->fuzzy_match_query(query, max_edit_distance, &bitset);
     return bitset;
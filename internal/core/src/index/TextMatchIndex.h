@@ -11,13 +11,24 @@
 
 #pragma once
 
+#include <deque>
+#include <future>
+#include <memory>
+#include <shared_mutex>
 #include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 #include <boost/filesystem.hpp>
 
 #include "cachinglayer/Manager.h"
 #include "index/InvertedIndexTantivy.h"
 #include "index/IndexStats.h"
 
+namespace milvus::tantivy {
+struct Tokenizer;
+}  // namespace milvus::tantivy
+
 namespace milvus::index {
 
 using stdclock = std::chrono::high_resolution_clock;
@@ -49,8 +60,15 @@ class TextMatchIndex : public InvertedIndexTantivy<std::string> {
     // for loading built index
     explicit TextMatchIndex(const storage::FileManagerContext& ctx);
 
+    ~TextMatchIndex();
+
     using InvertedIndexTantivy<std::string>::Load;
 
+    // rows visible to queries, including the uncommitted tail of a growing
+    // index
+    int64_t
+    Count() override;
+
  public:
     IndexStatsPtr
     Upload(const Config& config) override;
@@ -81,6 +99,8 @@ class TextMatchIndex : public InvertedIndexTantivy<std::string> {
     void
     Finish();
 
+    // Commit and Reload block until done. Rows added by AddTextsGrowing
+    // leave the uncommitted tail once a Reload follows their Commit.
     void
     Commit();
 
@@ -110,10 +130,62 @@ class TextMatchIndex : public InvertedIndexTantivy<std::string> {
     bool
     shouldTriggerCommit();
 
+    // Submit Commit() + Reload() to the LOW pool if the commit interval has
+    // elapsed and no commit is in flight, so inserts never wait on tantivy.
+    void
+    scheduleCommitIfDue();
+
+    void
+    waitScheduledCommit();
+
+    // Rows of one AddTextsGrowing call that are not searchable in tantivy
+    // yet. postings maps a token to (row in batch, token position) pairs.
+    struct TailBatch {
+        int64_t offset_begin;
+        std::unordered_map<std::string,
+                           std::vector<std::pair<uint32_t, uint32_t>>>
+            postings;
+    };
+    using TailBatchPtr = std::shared_ptr<const TailBatch>;
+
+    // (token, position) pairs of `query` under the field analyzer.
+    std::vector<std::pair<std::string, uint32_t>>
+    tokenizeQuery(const std::string& query) const;
+
+    std::vector<TailBatchPtr>
+    snapshotTail() const;
+
+    void
+    matchTail(const std::vector<TailBatchPtr>& tail,
+              const std::vector<std::pair<std::string, uint32_t>>& terms,
+              uint32_t min_should_match,
+              TargetBitmap& bitset) const;
+
+    void
+    phraseMatchTail(
+        const std::vector<TailBatchPtr>& tail,
+        const std::vector<std::pair<std::string, uint32_t>>& terms,
+        uint32_t slop,
+        TargetBitmap& bitset) const;
+
  private:
     mutable std::mutex mtx_;
     std::atomic<stdclock::time_point> last_commit_time_;
     int64_t commit_interval_in_ms_;
+
+    // background commit, growing only
+    std::mutex schedule_mtx_;
+    bool commit_scheduled_ = false;
+    std::future<void> commit_future_;
+
+    // Uncommitted tail, growing only. Null when the analyzer can not be
+    // created outside tantivy; queries then commit inline as before.
+    std::unique_ptr<tantivy::Tokenizer> tail_tokenizer_;
+    mutable std::shared_mutex tail_mtx_;
+    std::deque<TailBatchPtr> tail_;
+    // batches at the front of tail_ covered by the last Commit()
+    size_t committed_tail_ = 0;
+    std::atomic<int64_t> tail_end_{0};
 };
 
 class TextMatchIndexHolder {
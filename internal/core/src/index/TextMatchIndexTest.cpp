@@ -390,6 +390,72 @@ TEST(TextMatch, FuzzyIndex) {
     }
 }
 
+TEST(TextMatch, GrowingUncommittedTail) {
+    using Index = index::TextMatchIndex;
+    // never due, so nothing is committed in the background
+    auto index = std::make_unique<Index>(std::numeric_limits<int64_t>::max(),
+                                         "unique_id",
+                                         "milvus_tokenizer",
+                                         "{}",
+                                         /*enable_background_merge=*/false);
+    index->CreateReader(milvus::index::SetBitsetGrowing);
+    std::vector<std::string> texts = {
+        "football, basketball, pingpang", "", "swimming, football"};
+    bool valids[] = {true, false, true};
+    index->AddTextsGrowing(texts.size(), texts.data(), valids, 0);
+
+    auto check = [&]() {
+        auto res = index->MatchQuery("football", 1);
+        ASSERT_EQ(res.size(), 3);
+        ASSERT_TRUE(res[0]);
+        ASSERT_FALSE(res[1]);
+        ASSERT_TRUE(res[2]);
+        auto res1 = index->MatchQuery("football pingpang cricket", 2);
+        ASSERT_TRUE(res1[0]);
+        ASSERT_FALSE(res1[1]);
+        ASSERT_FALSE(res1[2]);
+        auto res2 = index->IsNotNull();
+        ASSERT_EQ(res2.size(), 3);
+        ASSERT_TRUE(res2[0]);
+        ASSERT_FALSE(res2[1]);
+        ASSERT_TRUE(res2[2]);
+
+        auto res3 = index->PhraseMatchQuery("swimming football", 0);
+        ASSERT_FALSE(res3[0]);
+        ASSERT_TRUE(res3[2]);
+        auto res4 = index->PhraseMatchQuery("football swimming", 1);
+        ASSERT_FALSE(res4[0]);
+        ASSERT_FALSE(res4[2]);
+        auto res5 = index->PhraseMatchQuery("football swimming", 2);
+        ASSERT_FALSE(res5[0]);
+        ASSERT_TRUE(res5[2]);
+        auto res6 = index->PhraseMatchQuery("basketball", 0);
+        ASSERT_TRUE(res6[0]);
+        ASSERT_FALSE(res6[2]);
+    };
+
+    // served from the uncommitted tail
+    check();
+
+    // served from tantivy
+    index->Commit();
+    index->Reload();
+    check();
+
+    // rows added after the commit come from the tail again
+    std::vector<std::string> more = {"football swimming"};
+    index->AddTextsGrowing(more.size(), more.data(), nullptr, 3);
+    auto res = index->PhraseMatchQuery("football swimming", 0);
+    ASSERT_EQ(res.size(), 4);
+    ASSERT_FALSE(res[2]);
+    ASSERT_TRUE(res[3]);
+    auto fuzzy = index->FuzzyMatchQuery("swiming", 1);
+    ASSERT_EQ(fuzzy.size(), 4);
+    ASSERT_FALSE(fuzzy[0]);
+    ASSERT_TRUE(fuzzy[2]);
+    ASSERT_TRUE(fuzzy[3]);
+}
+
 TEST(TextMatch, UploadReturnsRelativeTextLogPaths) {
     auto ctx = CreateTextMatchTestFileManagerContext(1000);
     auto index = BuildTextMatchIndexForUpload(ctx);
@@ -36,6 +36,7 @@
 #include <unordered_set>
 #include <utility>
 
+#include "common/AnonymousMmapBuffer.h"
 #include "common/BitsetView.h"
 #include "common/Common.h"
 #include "common/Consts.h"
@@ -533,9 +534,6 @@ void
 VectorMemIndex<T>::Build(const Config& config) {
     LOG_INFO("start build memory index, build_id: {}",
              config.value("build_id", "unknown"));
-    auto field_datas = file_manager_->CacheRawDataToMemory(config);
-    LOG_INFO("CacheRawDataToMemory success, build_id: {}",
-             config.value("build_id", "unknown"));
     auto opt_fields = GetValueFromConfig<OptFieldT>(config, VEC_OPT_FIELDS);
     std::unordered_map<int64_t, std::vector<std::vector<uint32_t>>> scalar_info;
     auto is_partition_key_isolation =
@@ -551,6 +549,15 @@ VectorMemIndex<T>::Build(const Config& config) {
     build_config.erase(INSERT_FILES_KEY);
     build_config.erase(VEC_OPT_FIELDS);
 
+    if (elem_type_ == DataType::NONE && !IndexIsSparse(GetIndexType())) {
+        BuildDenseFromRawDataStream(config, build_config, scalar_info);
+        return;
+    }
+
+    auto field_datas = file_manager_->CacheRawDataToMemory(config);
+    LOG_INFO("CacheRawDataToMemory success, build_id: {}",
+             config.value("build_id", "unknown"));
+
     bool nullable = false;
     int64_t total_valid_rows = 0;
     int64_t total_num_rows = 0;
@@ -594,17 +601,14 @@ VectorMemIndex<T>::Build(const Config& config) {
     };
 
     if (!IndexIsSparse(GetIndexType())) {
+        // embedding list, elem_type_ is not NONE
         int64_t dim = 0;
         int64_t total_size = 0;
         for (const auto& data : field_datas) {
             AssertInfo(dim == 0 || dim == data->get_dim(),
                        "inconsistent dim value between field datas!");
             dim = data->get_dim();
-            if (elem_type_ == DataType::NONE) {
-                total_size += data->DataSize();
-            } else {
-                total_size += data->Size();
-            }
+            total_size += data->Size();
         }
         if (nullable && total_valid_rows == 0) {
             auto dataset = make_dataset(0, dim, nullptr);
@@ -617,17 +621,7 @@ VectorMemIndex<T>::Build(const Config& config) {
         std::vector<size_t> offsets;
 
         int64_t offset = 0;
-        // For embedding list index, elem_type_ is not NONE
-        if (elem_type_ == DataType::NONE) {
-            // TODO: avoid copying
-            for (auto& data : field_datas) {
-                auto valid_size = data->DataSize();
-                milvus::fastmem::FastMemcpy(
-                    buf.get() + offset, data->Data(), valid_size);
-                offset += valid_size;
-                data.reset();
-            }
-        } else {
+        {
             offsets.reserve((nullable ? total_valid_rows : total_num_rows) + 1);
             offsets.push_back(lim_offset);
             auto bytes_per_vec = vector_bytes_per_element(elem_type_, dim);
@@ -683,17 +677,13 @@ VectorMemIndex<T>::Build(const Config& config) {
 
         field_datas.clear();
 
-        auto rows = elem_type_ == DataType::NONE
-                        ? total_valid_rows
-                        : static_cast<int64_t>(lim_offset);
-        auto dataset = make_dataset(rows, dim, buf.get());
+        auto dataset =
+            make_dataset(static_cast<int64_t>(lim_offset), dim, buf.get());
         if (!scalar_info.empty()) {
             dataset->Set(knowhere::meta::SCALAR_INFO, std::move(scalar_info));
         }
-        if (!offsets.empty()) {
-            dataset->Set(knowhere::meta::EMB_LIST_OFFSET,
-                         const_cast<const size_t*>(offsets.data()));
-        }
+        dataset->Set(knowhere::meta::EMB_LIST_OFFSET,
+                     const_cast<const size_t*>(offsets.data()));
         BuildWithDataset(dataset, build_config);
     } else {
         // sparse
@@ -735,6 +725,64 @@ VectorMemIndex<T>::Build(const Config& config) {
     }
 }
 
+template <typename T>
+void
+VectorMemIndex<T>::BuildDenseFromRawDataStream(
+    const Config& config,
+    const Config& build_config,
+    std::unordered_map<int64_t, std::vector<std::vector<uint32_t>>>&
+        scalar_info) {
+    // Decode the raw vectors straight into one buffer and drop every chunk
+    // once it is appended, so the build holds about one copy of the vectors
+    // instead of all the chunks plus their concatenation.
+    AnonymousMmapBuffer buf;
+    int64_t dim = 0;
+    int64_t total_num_rows = 0;
+    int64_t total_valid_rows = 0;
+    bool nullable = false;
+    FixedVector<bool> valid_data;
+    file_manager_->IterateRawData(config, [&](FieldDataPtr data) {
+        AssertInfo(dim == 0 || dim == data->get_dim(),
+                   "inconsistent dim value between field datas!");
+        dim = data->get_dim();
+        auto rows = data->get_num_rows();
+        if (data->IsNullable()) {
+            nullable = true;
+            // rows of earlier non-nullable chunks are all valid
+            valid_data.resize(total_num_rows, true);
+            auto src_bitmap = data->ValidData();
+            for (int64_t i = 0; i < rows; ++i) {
+                valid_data.push_back((src_bitmap[i >> 3] >> (i & 7)) & 1);
+            }
+        }
+        if (buf.capacity() == 0 && data->get_valid_rows() > 0) {
+            // most segments have a handful of similar binlogs, start with
+            // room for a few of them
+            buf.Reserve(data->DataSize() * 4);
+        }
+        buf.Append(data->Data(), data->DataSize());
+        total_num_rows += rows;
+        total_valid_rows += data->get_valid_rows();
+    });
+    LOG_INFO("IterateRawData success, rows: {}, bytes: {}, build_id: {}",
+             total_num_rows,
+             buf.size(),
+             config.value("build_id", "unknown"));
+
+    auto dataset =
+        GenDataset(total_valid_rows, dim, total_valid_rows > 0 ? buf.data()
+                                                               : nullptr);
+    if (nullable) {
+        valid_data.resize(total_num_rows, true);
+        dataset->SetIdMapData(knowhere::IdMapData::FromValidData(
+            valid_data.data(), static_cast<size_t>(total_num_rows)));
+    }
+    if (total_valid_rows > 0 && !scalar_info.empty()) {
+        dataset->Set(knowhere::meta::SCALAR_INFO, std::move(scalar_info));
+    }
+    BuildWithDataset(dataset, build_config);
+}
+
 template <typename T>
 void
 VectorMemIndex<T>::AddWithDataset(const DatasetPtr& dataset,
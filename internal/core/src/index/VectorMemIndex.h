@@ -156,6 +156,15 @@ class VectorMemIndex : public VectorIndex {
     void
     LoadFromFile(const Config& config);
 
+    // Build a dense float/binary vector index by streaming the raw data into
+    // one contiguous buffer, without keeping all the decoded chunks around.
+    void
+    BuildDenseFromRawDataStream(
+        const Config& config,
+        const Config& build_config,
+        std::unordered_map<int64_t, std::vector<std::vector<uint32_t>>>&
+            scalar_info);
+
     bool
     IsEmptyEmbListIndex() const {
         return elem_type_ != DataType::NONE && !empty_emb_list_offsets_.empty();
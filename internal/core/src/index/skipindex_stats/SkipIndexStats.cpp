@@ -28,6 +28,10 @@ std::unique_ptr<FieldChunkMetrics>
 SkipIndexStatsBuilder::Build(
     DataType data_type,
     const std::shared_ptr<parquet::Statistics>& statistic) const {
+    // row groups written without statistics, or holding only nulls
+    if (statistic == nullptr || !statistic->HasMinMax()) {
+        return std::make_unique<NoneFieldChunkMetrics>();
+    }
     std::unique_ptr<FieldChunkMetrics> chunk_metrics;
     switch (data_type) {
         case DataType::INT8: {
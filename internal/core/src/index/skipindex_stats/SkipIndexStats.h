@@ -191,6 +191,13 @@ class FieldChunkMetrics {
         return false;
     }
 
+    // Min and max of the non-null values of the chunk, std::nullopt when the
+    // metrics don't track them or the chunk has no such value.
+    virtual std::optional<std::pair<Metrics, Metrics>>
+    GetMinMax() const {
+        return std::nullopt;
+    }
+
     cachinglayer::ResourceUsage
     CellByteSize() const {
         return cell_size_;
@@ -396,6 +403,14 @@ class FloatFieldChunkMetrics : public FieldChunkMetrics {
         return FieldChunkMetricsType::FLOAT;
     }
 
+    std::optional<std::pair<Metrics, Metrics>>
+    GetMinMax() const override {
+        if (!this->has_value_) {
+            return std::nullopt;
+        }
+        return std::make_pair(Metrics{min_}, Metrics{max_});
+    }
+
     nlohmann::json
     ToJson() const override {
         nlohmann::json j;
@@ -435,6 +450,14 @@ class IntFieldChunkMetrics : public FieldChunkMetrics {
         return FieldChunkMetricsType::INT;
     }
 
+    std::optional<std::pair<Metrics, Metrics>>
+    GetMinMax() const override {
+        if (!this->has_value_) {
+            return std::nullopt;
+        }
+        return std::make_pair(Metrics{min_}, Metrics{max_});
+    }
+
     bool
     CanSkipUnaryRange(OpType op_type, const Metrics& val) const override {
         if (!this->has_value_) {
@@ -560,6 +583,14 @@ class StringFieldChunkMetrics : public FieldChunkMetrics {
         return FieldChunkMetricsType::STRING;
     }
 
+    std::optional<std::pair<Metrics, Metrics>>
+    GetMinMax() const override {
+        if (!this->has_value_) {
+            return std::nullopt;
+        }
+        return std::make_pair(Metrics{min_}, Metrics{max_});
+    }
+
     bool
     CanSkipUnaryRange(OpType op_type, const Metrics& val) const override {
         if (!this->has_value_) {
@@ -24,6 +24,8 @@
 #include <gtest/gtest.h>
 #include <nlohmann/json.hpp>
 #include <parquet/arrow/reader.h>
+#include <parquet/schema.h>
+#include <parquet/statistics.h>
 #include <cstdint>
 #include <memory>
 #include <optional>
@@ -1112,3 +1114,27 @@ TEST_F(SkipIndexStatsBuilderTest,
     ASSERT_TRUE(
         metrics->CanSkipUnaryRange(OpType::PostfixMatch, std::string("xyz")));
 }
+
+TEST_F(SkipIndexStatsBuilderTest, BuildFromParquetStatisticsWithoutMinMax) {
+    auto node = parquet::schema::PrimitiveNode::Make(
+        "a", parquet::Repetition::OPTIONAL, parquet::Type::INT64);
+    parquet::ColumnDescriptor descr(node, 1, 0);
+
+    auto metrics = builder_->Build(DataType::INT64,
+                                   std::shared_ptr<parquet::Statistics>());
+    ASSERT_EQ(metrics->GetMetricsType(), FieldChunkMetricsType::NONE);
+
+    // all-null row group: statistics carry a null count but no min/max
+    auto stats = parquet::MakeStatistics<parquet::Int64Type>(&descr);
+    stats->IncrementNullCount(8);
+    ASSERT_FALSE(stats->HasMinMax());
+    metrics = builder_->Build(DataType::INT64, stats);
+    ASSERT_EQ(metrics->GetMetricsType(), FieldChunkMetricsType::NONE);
+    ASSERT_FALSE(metrics->CanSkipUnaryRange(OpType::Equal, int64_t(1)));
+
+    stats->Update(std::vector<int64_t>{3, 7}.data(), 2, 0);
+    metrics = builder_->Build(DataType::INT64, stats);
+    ASSERT_EQ(metrics->GetMetricsType(), FieldChunkMetricsType::INT);
+    ASSERT_TRUE(metrics->CanSkipUnaryRange(OpType::Equal, int64_t(1)));
+    ASSERT_FALSE(metrics->CanSkipUnaryRange(OpType::Equal, int64_t(5)));
+}
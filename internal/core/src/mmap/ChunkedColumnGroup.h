@@ -200,6 +200,16 @@ class ChunkedColumnGroup {
     TestCacheWarmupPolicy() const {
         return slot_->meta()->cache_warmup_policy;
     }
+
+    bool
+    TestAnyCellLoaded() const {
+        for (size_t cid = 0; cid < num_chunks_; cid++) {
+            if (slot_->IsCached(cid)) {
+                return true;
+            }
+        }
+        return false;
+    }
 #endif
 
  protected:
@@ -329,6 +339,11 @@ class ProxyChunkColumn : public ChunkedColumnInterface {
     TestCacheWarmupPolicy() const {
         return group_->TestCacheWarmupPolicy();
     }
+
+    bool
+    TestAnyCellLoaded() const {
+        return group_->TestAnyCellLoaded();
+    }
 #endif
 
     int64_t
@@ -253,6 +253,14 @@ DEFINE_PROMETHEUS_HISTOGRAM_WITH_BUCKETS(internal_core_gis_refine_ratio,
                                          internal_core_search_latency,
                                          gisRefineRatioLabels,
                                          ratioBuckets)
+
+std::map<std::string, std::string> queryMemoryPeakLabels{{"type", "peak"}};
+DEFINE_PROMETHEUS_HISTOGRAM_FAMILY(internal_core_query_memory_bytes,
+                                   "[cpp]memory held by per-query pool")
+DEFINE_PROMETHEUS_HISTOGRAM_WITH_BUCKETS(internal_core_query_memory_bytes_peak,
+                                         internal_core_query_memory_bytes,
+                                         queryMemoryPeakLabels,
+                                         bytesBuckets)
 // mmap metrics
 std::map<std::string, std::string> mmapAllocatedSpaceAnonLabel = {
     {"type", "anon"}};
@@ -445,6 +453,19 @@ DEFINE_PROMETHEUS_COUNTER(internal_storage_pool_task_completed_total_low,
                           internal_storage_pool_task_completed_total,
                           lowPoolLabel);
 
+DEFINE_PROMETHEUS_COUNTER_FAMILY(
+    internal_storage_pool_task_stolen_total,
+    "[cpp]storage thread pool tasks stolen from another worker");
+DEFINE_PROMETHEUS_COUNTER(internal_storage_pool_task_stolen_total_high,
+                          internal_storage_pool_task_stolen_total,
+                          highPoolLabel);
+DEFINE_PROMETHEUS_COUNTER(internal_storage_pool_task_stolen_total_middle,
+                          internal_storage_pool_task_stolen_total,
+                          middlePoolLabel);
+DEFINE_PROMETHEUS_COUNTER(internal_storage_pool_task_stolen_total_low,
+                          internal_storage_pool_task_stolen_total,
+                          lowPoolLabel);
+
 DEFINE_PROMETHEUS_HISTOGRAM_FAMILY(
     internal_storage_pool_queue_duration_seconds,
     "[cpp]storage thread pool task queue duration");
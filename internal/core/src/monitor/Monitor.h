@@ -79,6 +79,10 @@ DECLARE_PROMETHEUS_HISTOGRAM(internal_core_expr_filter_ratio);
 DECLARE_PROMETHEUS_HISTOGRAM(internal_core_gis_coarse_ratio);
 DECLARE_PROMETHEUS_HISTOGRAM(internal_core_gis_refine_ratio);
 
+// per-query memory pool metrics, peak bytes held by the pool of one query
+DECLARE_PROMETHEUS_HISTOGRAM_FAMILY(internal_core_query_memory_bytes);
+DECLARE_PROMETHEUS_HISTOGRAM(internal_core_query_memory_bytes_peak);
+
 // async cgo metrics
 DECLARE_PROMETHEUS_HISTOGRAM_FAMILY(internal_cgo_queue_duration_seconds);
 DECLARE_PROMETHEUS_HISTOGRAM(internal_cgo_queue_duration_seconds_search);
@@ -127,6 +131,10 @@ DECLARE_PROMETHEUS_COUNTER_FAMILY(internal_storage_pool_task_completed_total);
 DECLARE_PROMETHEUS_COUNTER(internal_storage_pool_task_completed_total_high);
 DECLARE_PROMETHEUS_COUNTER(internal_storage_pool_task_completed_total_middle);
 DECLARE_PROMETHEUS_COUNTER(internal_storage_pool_task_completed_total_low);
+DECLARE_PROMETHEUS_COUNTER_FAMILY(internal_storage_pool_task_stolen_total);
+DECLARE_PROMETHEUS_COUNTER(internal_storage_pool_task_stolen_total_high);
+DECLARE_PROMETHEUS_COUNTER(internal_storage_pool_task_stolen_total_middle);
+DECLARE_PROMETHEUS_COUNTER(internal_storage_pool_task_stolen_total_low);
 DECLARE_PROMETHEUS_HISTOGRAM_FAMILY(
     internal_storage_pool_queue_duration_seconds);
 DECLARE_PROMETHEUS_HISTOGRAM(internal_storage_pool_queue_duration_seconds_high);
@@ -52,14 +52,18 @@ AggregationNode::AggregationNode(
     std::vector<expr::FieldAccessTypeExprPtr>&& groupingKeys,
     std::vector<std::string>&& aggNames,
     std::vector<Aggregate>&& aggregates,
-    std::vector<PlanNodePtr> sources)
+    std::vector<PlanNodePtr> sources,
+    bool inputSortedByKeys,
+    int64_t groupLimit)
     : PlanNode(id),
       groupingKeys_(std::move(groupingKeys)),
       aggregateNames_(std::move(aggNames)),
       aggregates_(std::move(aggregates)),
       sources_(std::move(sources)),
       output_type_(getAggregationOutputType(
-          groupingKeys_, aggregateNames_, aggregates_)) {
+          groupingKeys_, aggregateNames_, aggregates_)),
+      inputSortedByKeys_(inputSortedByKeys),
+      groupLimit_(groupLimit) {
 }
 
 }  // namespace plan
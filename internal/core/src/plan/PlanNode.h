@@ -322,12 +322,14 @@ class ProjectNode : public PlanNode {
                 std::vector<FieldId>&& field_ids,
                 std::vector<std::string>&& field_names,
                 std::vector<milvus::DataType>&& field_types,
-                std::vector<PlanNodePtr> sources = std::vector<PlanNodePtr>{})
+                std::vector<PlanNodePtr> sources = std::vector<PlanNodePtr>{},
+                int64_t pkGroupLimit = -1)
         : PlanNode(id),
           sources_(std::move(sources)),
           field_ids_(std::move(field_ids)),
           output_type_(std::make_shared<RowType>(std::move(field_names),
-                                                 std::move(field_types))) {
+                                                 std::move(field_types))),
+          pk_group_limit_(pkGroupLimit) {
     }
 
     std::vector<PlanNodePtr>
@@ -356,10 +358,19 @@ class ProjectNode : public PlanNode {
         return field_ids_;
     }
 
+    /// Number of distinct primary keys whose rows are selected, in primary
+    /// key order, -1 for every row. Set when the downstream aggregation only
+    /// needs its first groups (see AggregationNode::GroupLimit()).
+    int64_t
+    PkGroupLimit() const {
+        return pk_group_limit_;
+    }
+
  private:
     const std::vector<PlanNodePtr> sources_;
     const std::vector<FieldId> field_ids_;
     const RowTypePtr output_type_;
+    const int64_t pk_group_limit_;
 };
 
 class MvccNode : public PlanNode {
@@ -570,7 +581,9 @@ class AggregationNode : public PlanNode {
         std::vector<expr::FieldAccessTypeExprPtr>&& groupingKeys,
         std::vector<std::string>&& aggNames,
         std::vector<Aggregate>&& aggregates,
-        std::vector<PlanNodePtr> sources = std::vector<PlanNodePtr>{});
+        std::vector<PlanNodePtr> sources = std::vector<PlanNodePtr>{},
+        bool inputSortedByKeys = false,
+        int64_t groupLimit = -1);
 
     RowTypePtr
     output_type() const override {
@@ -602,12 +615,30 @@ class AggregationNode : public PlanNode {
         return aggregates_;
     }
 
+    /// True when the source emits the rows of each group next to each other,
+    /// in ascending key order, so groups can be aggregated one after another
+    /// without a hash table.
+    bool
+    InputSortedByKeys() const {
+        return inputSortedByKeys_;
+    }
+
+    /// Number of leading groups needed downstream (an ascending ORDER BY on
+    /// the grouping keys with this LIMIT follows), -1 for all of them. Only
+    /// meaningful with InputSortedByKeys().
+    int64_t
+    GroupLimit() const {
+        return groupLimit_;
+    }
+
  private:
     const std::vector<expr::FieldAccessTypeExprPtr> groupingKeys_;
     const std::vector<std::string> aggregateNames_;
     const std::vector<Aggregate> aggregates_;
     const std::vector<PlanNodePtr> sources_;
     const RowTypePtr output_type_;
+    const bool inputSortedByKeys_;
+    const int64_t groupLimit_;
 };
 
 /// Sort order specification for ORDER BY
@@ -108,6 +108,10 @@ ExecPlanNodeVisitor::ExecuteTask(
     span.GetSpan()->SetAttribute("total_rows", processed_num);
     span.GetSpan()->SetAttribute("matched_rows",
                                  ret ? processed_num - ret->nullCount() : 0);
+    if (auto* pool = query_context->memory_pool(); pool != nullptr) {
+        span.GetSpan()->SetAttribute("query_memory_peak_bytes",
+                                     pool->PeakBytes());
+    }
     return ret;
 }
 
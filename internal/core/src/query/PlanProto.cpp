@@ -441,6 +441,7 @@ ProcessAggregates(const proto::plan::QueryPlanNode& query,
 plan::PlanNodePtr
 BuildProjectAndAggregationNodes(
     const proto::plan::QueryPlanNode& query,
+    const SchemaPtr& schema,
     const std::vector<plan::PlanNodePtr>& sources,
     std::vector<expr::FieldAccessTypeExprPtr> groupingKeys,
     std::vector<std::string> agg_names,
@@ -450,6 +451,24 @@ BuildProjectAndAggregationNodes(
     std::vector<milvus::DataType> project_type_list) {
     plan::PlanNodePtr plannode = sources.empty() ? nullptr : sources[0];
 
+    // ProjectNode selects rows with find_first_n, which walks the primary
+    // key index, so grouping by the primary key alone sees each group as a
+    // run of adjacent rows in ascending key order. The aggregation can then
+    // stream groups out without a hash table, and an ascending ORDER BY on
+    // that key only needs the first LIMIT groups of the segment, so
+    // ProjectNode stops selecting rows after them.
+    auto pk_field_id = schema->get_primary_field_id();
+    bool input_sorted_by_keys =
+        query.group_by_field_ids_size() == 1 && pk_field_id.has_value() &&
+        query.group_by_field_ids(0) == pk_field_id->get();
+    int64_t group_limit = -1;
+    if (input_sorted_by_keys && query.limit() > 0 &&
+        query.order_by_fields_size() == 1 &&
+        query.order_by_fields(0).field_id() == pk_field_id->get() &&
+        query.order_by_fields(0).ascending()) {
+        group_limit = query.limit();
+    }
+
     // Always build ProjectNode when aggregation is present.
     // ProjectNode consumes the MVCC bitmap from upstream and materializes
     // filtered rows, so AggregationNode always receives input where
@@ -462,7 +481,8 @@ BuildProjectAndAggregationNodes(
             std::move(project_field_id_list),
             std::move(project_name_list),
             std::move(project_type_list),
-            sources);
+            sources,
+            group_limit);
     }
 
     // Build AggregationNode
@@ -473,7 +493,9 @@ BuildProjectAndAggregationNodes(
         std::move(groupingKeys),
         std::move(agg_names),
         std::move(aggregates),
-        agg_sources);
+        agg_sources,
+        input_sorted_by_keys,
+        group_limit);
 }
 // Helper function to build ProjectNode for ORDER BY queries.
 // Returns {ProjectNode, deferred_field_ids, pipeline_field_ids}.
@@ -914,6 +936,7 @@ ProtoParser::RetrievePlanNodeFromProto(
             // Build ProjectNode and AggregationNode
             plannode =
                 BuildProjectAndAggregationNodes(query,
+                                                schema,
                                                 sources,
                                                 std::move(groupingKeys),
                                                 std::move(agg_names),
@@ -30,6 +30,7 @@
 #include <memory>
 #include <new>
 #include <mutex>
+#include <numeric>
 #include <optional>
 #include <ratio>
 #include <set>
@@ -124,6 +125,7 @@
 #include "query/SearchOnSealed.h"
 #include "segcore/ConcurrentVector.h"
 #include "segcore/DeletedRecord.h"
+#include "segcore/ManifestChunkStatistics.h"
 #include "segcore/SealedIndexingRecord.h"
 #include "segcore/SegmentSealed.h"
 #include "segcore/TimestampIndex.h"
@@ -315,13 +317,10 @@ ChunkedSegmentSealedImpl::ReadTimestamp(
     // so the short-circuit above always hits; only tests and degenerate
     // states reach here.
     //
-    // NOTE for anyone making this path live (e.g. an evictable timestamp
-    // column for tiered storage): this access pattern pins a cell and
-    // resolves the chunk PER CALL. Do not drive it from a per-row loop
-    // (mask_with_timestamps grey-zone scan, search_batch_pks) — introduce a
-    // batched ReadTimestamps(offsets, count) that pins all involved chunks
-    // once and dedups resolution per distinct chunk (see ForEachResolvedRow
-    // in mmap/ChunkedColumnGroup.h for the shape).
+    // This access pattern pins a cell and resolves the chunk PER CALL, so it
+    // must not be driven from a per-row loop: bulk readers go through
+    // ReadTimestamps() below, which is what keeps an evictable timestamp
+    // column (tiered storage) usable.
     auto column = get_column(runtime, TimestampFieldID);
     AssertInfo(column != nullptr, "timestamp data is not ready");
     const auto chunk_pos = column->GetChunkIDByOffset(offset);
@@ -330,6 +329,66 @@ ChunkedSegmentSealedImpl::ReadTimestamp(
     return span[chunk_pos.second];
 }
 
+void
+ChunkedSegmentSealedImpl::ReadTimestamps(
+    const int64_t* offsets,
+    int64_t count,
+    Timestamp* output,
+    const std::shared_ptr<const RuntimeResourceState>& runtime,
+    std::optional<Timestamp> effective_commit_ts) const {
+    if (count <= 0) {
+        return;
+    }
+    if (effective_commit_ts) {
+        std::fill_n(output, count, *effective_commit_ts);
+        return;
+    }
+    auto timestamps = runtime != nullptr ? runtime->timestamps : nullptr;
+    if (timestamps != nullptr && !timestamps->empty()) {
+        const auto& ts = *timestamps;
+        for (int64_t i = 0; i < count; ++i) {
+            output[i] = ts[offsets[i]];
+        }
+        return;
+    }
+    // Timestamp column path. Group the rows by chunk, then pin each involved
+    // chunk once and gather its rows in a tight loop. Only one chunk is
+    // pinned at a time, the same peak residency as the per-row path, which
+    // matters once the column is evictable. Offsets almost always arrive
+    // ascending (range scans, sorted-pk matches), and grouping is free then;
+    // scattered offsets are ordered by chunk through an index permutation,
+    // so the output keeps the caller's row order either way.
+    auto column = get_column(runtime, TimestampFieldID);
+    AssertInfo(column != nullptr, "timestamp data is not ready");
+    auto [cids, offsets_in_chunk] =
+        column->GetChunkIDsByOffsets(offsets, count);
+    std::vector<int64_t> order;
+    if (!std::is_sorted(cids.begin(), cids.end())) {
+        order.resize(count);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(
+            order.begin(), order.end(), [&cids = cids](int64_t a, int64_t b) {
+                return cids[a] < cids[b];
+            });
+    }
+    int64_t k = 0;
+    while (k < count) {
+        const auto cid = cids[order.empty() ? k : order[k]];
+        auto pin = column->DataOfChunk(nullptr, cid);
+        auto* data = reinterpret_cast<const Timestamp*>(pin.get());
+        if (order.empty()) {
+            for (; k < count && cids[k] == cid; ++k) {
+                output[k] = data[offsets_in_chunk[k]];
+            }
+        } else {
+            for (; k < count && cids[order[k]] == cid; ++k) {
+                const auto row = order[k];
+                output[row] = data[offsets_in_chunk[row]];
+            }
+        }
+    }
+}
+
 PinWrapper<const storagev2translator::PkIndexCell*>
 ChunkedSegmentSealedImpl::PinPkIndex(
     const std::shared_ptr<const RuntimeResourceState>& runtime,
@@ -1042,6 +1101,7 @@ ChunkedSegmentSealedImpl::CloneRuntimeResourceState(
     state->json_indices = current->json_indices;
     state->json_stats = current->json_stats;
     state->reader = current->reader;
+    state->reader_generation = current->reader_generation;
     state->timestamps = current->timestamps;
     state->timestamp_index = current->timestamp_index;
     state->timestamp_index_slot = current->timestamp_index_slot;
@@ -1103,6 +1163,15 @@ ChunkedSegmentSealedImpl::CaptureReaderSnapshot() const {
     return runtime != nullptr ? runtime->reader : nullptr;
 }
 
+void
+ChunkedSegmentSealedImpl::ReplaceReader(
+    RuntimeResourceState& runtime,
+    std::shared_ptr<milvus_storage::api::Reader> reader) {
+    runtime.reader = std::move(reader);
+    runtime.reader_generation = ++last_reader_generation_;
+    take_cache_.Clear();
+}
+
 std::shared_ptr<const TimestampData>
 ChunkedSegmentSealedImpl::CaptureTimestampSnapshot() const {
     auto runtime = CaptureRuntimeResourceState();
@@ -1444,6 +1513,7 @@ ChunkedSegmentSealedImpl::FreezeRuntimeResourceState(
     runtime->json_indices = current.json_indices;
     runtime->json_stats = current.json_stats;
     runtime->reader = current.reader;
+    runtime->reader_generation = current.reader_generation;
     runtime->timestamps = current.timestamps;
     runtime->timestamp_index = current.timestamp_index;
     runtime->timestamp_index_slot = current.timestamp_index_slot;
@@ -2146,9 +2216,9 @@ ChunkedSegmentSealedImpl::LoadColumnGroups(
                                             needed_columns,
                                             *properties)
             .release());
-    committer.Commit([reader](RuntimeResourceState& runtime,
-                              PublishedSegmentState&) mutable {
-        runtime.reader = std::move(reader);
+    committer.Commit([this, reader](RuntimeResourceState& runtime,
+                                    PublishedSegmentState&) mutable {
+        ReplaceReader(runtime, std::move(reader));
     });
 
     auto reader_create_ms =
@@ -2198,6 +2268,7 @@ ChunkedSegmentSealedImpl::LoadColumnGroups(
         storagev2translator::ColumnSizeEstimateResult size_estimate;
     };
     std::vector<FieldGroupTask> tasks;
+    const bool split_per_field = segment_load_info.SplitColumnGroupsPerField();
     for (const auto& pair : cg_field_ids) {
         auto cg_index = pair.first;
         const auto& all_fields = pair.second;
@@ -2229,7 +2300,11 @@ ChunkedSegmentSealedImpl::LoadColumnGroups(
             }
         }
 
-        if (!eager_fields.empty()) {
+        if (split_per_field) {
+            for (const auto& fid : eager_fields) {
+                tasks.push_back({cg_index, {fid}, true});
+            }
+        } else if (!eager_fields.empty()) {
             tasks.push_back({cg_index, std::move(eager_fields), true});
         }
         for (const auto& fid : lazy_fields) {
@@ -3464,6 +3539,31 @@ ChunkedSegmentSealedImpl::chunk_data_impl(milvus::OpContext* op_ctx,
               "chunk_data_impl only used for chunk column field ");
 }
 
+PinWrapper<const Chunk*>
+ChunkedSegmentSealedImpl::encoded_chunk(milvus::OpContext* op_ctx,
+                                        FieldId field_id,
+                                        int64_t chunk_id) const {
+    // chunks are only encoded while this is enabled, skip the extra pin
+    // otherwise
+    if (!CHUNK_ENCODING_ENABLED.load(std::memory_order_relaxed)) {
+        return PinWrapper<const Chunk*>(nullptr);
+    }
+    auto snapshot = CapturePublishedState();
+    if (!get_bit(snapshot->field_data_ready_bitset, field_id)) {
+        return PinWrapper<const Chunk*>(nullptr);
+    }
+    auto column = get_column(snapshot->runtime, field_id);
+    if (column == nullptr) {
+        return PinWrapper<const Chunk*>(nullptr);
+    }
+    auto pw = column->GetChunk(op_ctx, chunk_id);
+    if (pw.get() == nullptr || pw.get()->Encoding() == nullptr) {
+        return PinWrapper<const Chunk*>(nullptr);
+    }
+    return pw.transform<const Chunk*>(
+        [](Chunk*&& chunk) { return static_cast<const Chunk*>(chunk); });
+}
+
 PinWrapper<std::pair<std::vector<ArrayView>, ValidityView>>
 ChunkedSegmentSealedImpl::chunk_array_view_impl(
     milvus::OpContext* op_ctx,
@@ -3691,6 +3791,27 @@ ChunkedSegmentSealedImpl::vector_search(SearchInfo& search_info,
     AssertInfo(field_meta.is_vector(),
                "The meta type of vector field is not vector type");
 
+    // The filter bitset only covers get_active_count() rows. Indexes and the
+    // raw column address every row (or element), so the rows newer than the
+    // query timestamp are appended as filtered out.
+    BitsetView search_bitset = bitset;
+    BitsetType padded_bitset;
+    if (!bitset.empty()) {
+        int64_t full_size =
+            search_info.array_offsets_ != nullptr
+                ? search_info.array_offsets_->GetTotalElementCount()
+                : (runtime != nullptr ? runtime->row_count : 0);
+        auto active_size = static_cast<int64_t>(bitset.size());
+        if (active_size < full_size) {
+            padded_bitset.resize(full_size, true);
+            padded_bitset.inplace_and(
+                BitsetTypeView(const_cast<uint8_t*>(bitset.data()),
+                               active_size),
+                active_size);
+            search_bitset = padded_bitset;
+        }
+    }
+
     if (get_bit(snapshot->binlog_index_bitset, field_id)) {
         auto config_it = runtime->vec_binlog_config.find(field_id);
         AssertInfo(config_it != runtime->vec_binlog_config.end(),
@@ -3707,7 +3828,7 @@ ChunkedSegmentSealedImpl::vector_search(SearchInfo& search_info,
                                    query_data,
                                    query_offsets,
                                    query_count,
-                                   bitset,
+                                   search_bitset,
                                    op_context,
                                    output);
         milvus::tracer::AddEvent(
@@ -3727,7 +3848,7 @@ ChunkedSegmentSealedImpl::vector_search(SearchInfo& search_info,
                                    query_data,
                                    query_offsets,
                                    query_count,
-                                   bitset,
+                                   search_bitset,
                                    op_context,
                                    output);
         milvus::tracer::AddEvent("finish_searching_vector_index");
@@ -3762,7 +3883,7 @@ ChunkedSegmentSealedImpl::vector_search(SearchInfo& search_info,
                                     query_offsets,
                                     query_count,
                                     row_count,
-                                    bitset,
+                                    search_bitset,
                                     op_context,
                                     output);
         milvus::tracer::AddEvent("finish_searching_vector_data");
@@ -4267,59 +4388,64 @@ ChunkedSegmentSealedImpl::search_batch_pks(
     bool include_same_ts,
     const std::function<void(const SegOffset offset, const Timestamp ts)>&
         callback) const {
-    // Helper to read a single timestamp by segment offset.
     // For import/CDC segments with commit_ts_ set: every row carries commit_ts_,
     // so short-circuit without touching the raw timestamp column.
-    // For StorageV2: pins the timestamp column and indexes into chunks.
     // PK lookup and timestamp data come from the same published runtime.
     auto snapshot = CapturePublishedState();
     auto runtime = snapshot->runtime;
     auto effective_commit_ts =
         snapshot->commit_ts != 0 ? std::optional<Timestamp>{snapshot->commit_ts}
                                  : std::nullopt;
-    // Resolve matched-row timestamps by lazily pinning the timestamp column
-    // ONE chunk at a time and reusing that pin for all offsets that fall in
-    // it, instead of the per-row ReadTimestamp() path (a fresh cachinglayer
-    // pin per matched row). Under the delete-replay amplification of issue
-    // #49435 (tens of millions of matched rows per LoadDeletedRecord call)
-    // the per-row pin dominated the whole call. A single group chunk stays
-    // pinned at a time (same peak residency as the per-row path, not the
-    // whole column group), and nothing is pinned for zero-hit calls (empty
-    // pks, bloom-filter false positives) because the pin is created on first
-    // use inside read_ts. Pins are refcounts on the snapshot's cells, so
-    // reopen's atomic publication is not blocked, and per-call snapshot
-    // consistency is identical to the per-row variant.
-    auto runtime_ts_data = runtime != nullptr ? runtime->timestamps : nullptr;
-    bool ts_from_array =
-        runtime_ts_data != nullptr && !runtime_ts_data->empty();
-    std::shared_ptr<ChunkedColumnInterface> ts_column;
-    cachinglayer::PinWrapper<Chunk*> ts_chunk_pin{nullptr};
-    const Timestamp* ts_chunk_data = nullptr;
-    int64_t ts_chunk_base = 0;
-    int64_t ts_chunk_limit = -1;  // pinned chunk covers offsets [base, limit)
-    auto read_ts = [&](int64_t offset) -> Timestamp {
-        if (effective_commit_ts) {
-            return *effective_commit_ts;
-        }
-        if (ts_from_array) {
-            return (*runtime_ts_data)[offset];
+    // Matched rows are buffered and their insert timestamps resolved in
+    // blocks through ReadTimestamps, instead of a cachinglayer pin per
+    // matched row. Under the delete-replay amplification of issue #49435
+    // (tens of millions of matched rows per LoadDeletedRecord call) the
+    // per-row pin dominated the whole call. ReadTimestamps pins one chunk of
+    // the timestamp column at a time (same peak residency as the per-row
+    // path), and nothing is pinned for zero-hit calls (empty pks,
+    // bloom-filter false positives) because an empty block is never
+    // resolved. Pins are refcounts on the snapshot's cells, so reopen's
+    // atomic publication is not blocked, and per-call snapshot consistency
+    // is identical to the per-row variant. Callbacks fire in match order.
+    auto timestamp_hit = include_same_ts
+                             ? [](Timestamp lhs, Timestamp rhs) {
+                                   return lhs <= rhs;
+                               }
+                             : [](Timestamp lhs, Timestamp rhs) {
+                                   return lhs < rhs;
+                               };
+    constexpr size_t kHitBlockRows = 4096;
+    std::vector<int64_t> hit_offsets;
+    std::vector<Timestamp> hit_delete_ts;
+    std::vector<Timestamp> hit_insert_ts;
+    auto flush_hits = [&]() {
+        if (hit_offsets.empty()) {
+            return;
         }
-        if (offset < ts_chunk_base || offset >= ts_chunk_limit) {
-            if (!ts_column) {
-                ts_column = get_column(runtime, TimestampFieldID);
-                AssertInfo(ts_column != nullptr, "timestamp data is not ready");
+        hit_insert_ts.resize(hit_offsets.size());
+        ReadTimestamps(hit_offsets.data(),
+                       static_cast<int64_t>(hit_offsets.size()),
+                       hit_insert_ts.data(),
+                       runtime,
+                       effective_commit_ts);
+        for (size_t k = 0; k < hit_offsets.size(); ++k) {
+            if (timestamp_hit(hit_insert_ts[k], hit_delete_ts[k])) {
+                callback(SegOffset(hit_offsets[k]), hit_delete_ts[k]);
             }
-            auto [cid, off_in_chunk] = ts_column->GetChunkIDByOffset(offset);
-            ts_chunk_pin = ts_column->GetChunk(nullptr, cid);
-            // Data() (not RawData()) skips a nullable field's leading null
-            // bitmap; the timestamp system field is non-nullable today so the
-            // two coincide, but Data() is the layout-correct accessor.
-            ts_chunk_data =
-                reinterpret_cast<const Timestamp*>(ts_chunk_pin.get()->Data());
-            ts_chunk_base = offset - static_cast<int64_t>(off_in_chunk);
-            ts_chunk_limit = ts_chunk_base + ts_column->chunk_row_nums(cid);
-        }
-        return ts_chunk_data[offset - ts_chunk_base];
+        }
+        hit_offsets.clear();
+        hit_delete_ts.clear();
+    };
+    auto add_hit = [&](int64_t offset, Timestamp timestamp) {
+        if (hit_offsets.empty()) {
+            hit_offsets.reserve(kHitBlockRows);
+            hit_delete_ts.reserve(kHitBlockRows);
+        }
+        hit_offsets.push_back(offset);
+        hit_delete_ts.push_back(timestamp);
+        if (hit_offsets.size() >= kHitBlockRows) {
+            flush_hits();
+        }
     };
 
     // Virtual PK offset maps can resolve pk -> offset directly by bit-extract.
@@ -4327,19 +4453,13 @@ ChunkedSegmentSealedImpl::search_batch_pks(
     // with VirtualPKChunkedColumn, which intentionally does not support
     // GetAllChunks().
     if (runtime != nullptr && runtime->virtual_pk2offset != nullptr) {
-        auto timestamp_hit =
-            include_same_ts
-                ? [](Timestamp lhs, Timestamp rhs) { return lhs <= rhs; }
-                : [](Timestamp lhs, Timestamp rhs) { return lhs < rhs; };
         for (size_t i = 0; i < pks.size(); i++) {
             auto timestamp = get_timestamp(i);
             for (auto offset : runtime->virtual_pk2offset->find(pks[i])) {
-                auto insert_ts = read_ts(offset);
-                if (timestamp_hit(insert_ts, timestamp)) {
-                    callback(SegOffset(offset), timestamp);
-                }
+                add_hit(offset, timestamp);
             }
         }
+        flush_hits();
         return;
     }
 
@@ -4350,20 +4470,14 @@ ChunkedSegmentSealedImpl::search_batch_pks(
         if (pk_cell == nullptr || !pk_cell->has_pk2offset()) {
             return;
         }
-        auto timestamp_hit =
-            include_same_ts
-                ? [](Timestamp lhs, Timestamp rhs) { return lhs <= rhs; }
-                : [](Timestamp lhs, Timestamp rhs) { return lhs < rhs; };
         for (size_t i = 0; i < pks.size(); i++) {
             auto timestamp = get_timestamp(i);
             auto offsets = pk_cell->pk2offset().find(pks[i]);
             for (auto offset : offsets) {
-                auto insert_ts = read_ts(offset);
-                if (timestamp_hit(insert_ts, timestamp)) {
-                    callback(SegOffset(offset), timestamp);
-                }
+                add_hit(offset, timestamp);
             }
         }
+        flush_hits();
         return;
     }
 
@@ -4376,69 +4490,25 @@ ChunkedSegmentSealedImpl::search_batch_pks(
 
     auto all_chunk_pins = pk_column->GetAllChunks(nullptr);
 
-    auto timestamp_hit = include_same_ts
-                             ? [](const Timestamp& ts1,
-                                  const Timestamp& ts2) { return ts1 <= ts2; }
-                             : [](const Timestamp& ts1, const Timestamp& ts2) {
-                                   return ts1 < ts2;
-                               };
-
     switch (schema_snapshot->get_fields().at(pk_field_id).get_data_type()) {
         case DataType::INT64: {
-            auto num_chunk = pk_column->num_chunks();
-            for (int i = 0; i < num_chunk; ++i) {
-                const auto& pw = all_chunk_pins[i];
-                auto src =
-                    reinterpret_cast<const int64_t*>(pw.get()->RawData());
-                auto chunk_row_num = pk_column->chunk_row_nums(i);
-                for (size_t j = 0; j < pks.size(); j++) {
-                    // get int64 pks
-                    auto target = std::get<int64_t>(pks[j]);
-                    auto timestamp = get_timestamp(j);
-                    auto it = std::lower_bound(
-                        src,
-                        src + chunk_row_num,
-                        target,
-                        [](const int64_t& elem, const int64_t& value) {
-                            return elem < value;
-                        });
-                    auto num_rows_until_chunk =
-                        pk_column->GetNumRowsUntilChunk(i);
-                    for (; it != src + chunk_row_num && *it == target; ++it) {
-                        auto offset = it - src + num_rows_until_chunk;
-                        auto insert_ts = read_ts(offset);
-                        if (timestamp_hit(insert_ts, timestamp)) {
-                            callback(SegOffset(offset), timestamp);
-                        }
-                    }
-                }
-            }
-
+            for_each_sorted_pk_match<int64_t>(
+                pks,
+                pk_column.get(),
+                all_chunk_pins,
+                [&](size_t j, int64_t offset) {
+                    add_hit(offset, get_timestamp(j));
+                });
             break;
         }
         case DataType::VARCHAR: {
-            auto num_chunk = pk_column->num_chunks();
-            for (int i = 0; i < num_chunk; ++i) {
-                // TODO @xiaocai2333, @sunby: chunk need to record the min/max.
-                auto num_rows_until_chunk = pk_column->GetNumRowsUntilChunk(i);
-                const auto& pw = all_chunk_pins[i];
-                auto string_chunk = static_cast<StringChunk*>(pw.get());
-                for (size_t j = 0; j < pks.size(); ++j) {
-                    // get varchar pks
-                    auto& target = std::get<std::string>(pks[j]);
-                    auto timestamp = get_timestamp(j);
-                    auto offset = string_chunk->binary_search_string(target);
-                    for (; offset != -1 && offset < string_chunk->RowNums() &&
-                           string_chunk->operator[](offset) == target;
-                         ++offset) {
-                        auto segment_offset = offset + num_rows_until_chunk;
-                        auto insert_ts = read_ts(segment_offset);
-                        if (timestamp_hit(insert_ts, timestamp)) {
-                            callback(SegOffset(segment_offset), timestamp);
-                        }
-                    }
-                }
-            }
+            for_each_sorted_pk_match<std::string>(
+                pks,
+                pk_column.get(),
+                all_chunk_pins,
+                [&](size_t j, int64_t offset) {
+                    add_hit(offset, get_timestamp(j));
+                });
             break;
         }
         default: {
@@ -4449,6 +4519,7 @@ ChunkedSegmentSealedImpl::search_batch_pks(
                                       .get_data_type()));
         }
     }
+    flush_hits();
 }
 
 void
@@ -4800,63 +4871,29 @@ ChunkedSegmentSealedImpl::ChunkedSegmentSealedImpl(
                                   .at(pk_field_id)
                                   .get_data_type()) {
                           case DataType::INT64: {
-                              auto num_chunk = pk_column->num_chunks();
-                              for (int i = 0; i < num_chunk; ++i) {
-                                  const auto& pw = all_chunk_pins[i];
-                                  auto src = reinterpret_cast<const int64_t*>(
-                                      pw.get()->RawData());
-                                  auto chunk_row_num =
-                                      pk_column->chunk_row_nums(i);
-                                  auto num_rows_until_chunk =
-                                      pk_column->GetNumRowsUntilChunk(i);
-                                  for (size_t j = 0; j < pks.size(); j++) {
-                                      if (!delete_is_after_insert(j)) {
-                                          continue;
-                                      }
-                                      auto target = std::get<int64_t>(pks[j]);
-                                      auto it = std::lower_bound(
-                                          src, src + chunk_row_num, target);
-                                      for (; it != src + chunk_row_num &&
-                                             *it == target;
-                                           ++it) {
-                                          callback(
-                                              SegOffset(it - src +
-                                                        num_rows_until_chunk),
-                                              timestamps[j]);
+                              for_each_sorted_pk_match<int64_t>(
+                                  pks,
+                                  pk_column.get(),
+                                  all_chunk_pins,
+                                  [&](size_t j, int64_t offset) {
+                                      if (delete_is_after_insert(j)) {
+                                          callback(SegOffset(offset),
+                                                   timestamps[j]);
                                       }
-                                  }
-                              }
+                                  });
                               break;
                           }
                           case DataType::VARCHAR: {
-                              auto num_chunk = pk_column->num_chunks();
-                              for (int i = 0; i < num_chunk; ++i) {
-                                  auto num_rows_until_chunk =
-                                      pk_column->GetNumRowsUntilChunk(i);
-                                  const auto& pw = all_chunk_pins[i];
-                                  auto string_chunk =
-                                      static_cast<StringChunk*>(pw.get());
-                                  for (size_t j = 0; j < pks.size(); ++j) {
-                                      if (!delete_is_after_insert(j)) {
-                                          continue;
+                              for_each_sorted_pk_match<std::string>(
+                                  pks,
+                                  pk_column.get(),
+                                  all_chunk_pins,
+                                  [&](size_t j, int64_t offset) {
+                                      if (delete_is_after_insert(j)) {
+                                          callback(SegOffset(offset),
+                                                   timestamps[j]);
                                       }
-                                      auto& target =
-                                          std::get<std::string>(pks[j]);
-                                      auto offset =
-                                          string_chunk->binary_search_string(
-                                              target);
-                                      for (; offset != -1 &&
-                                             offset < string_chunk->RowNums() &&
-                                             string_chunk->operator[](offset) ==
-                                                 target;
-                                           ++offset) {
-                                          callback(
-                                              SegOffset(offset +
-                                                        num_rows_until_chunk),
-                                              timestamps[j]);
-                                      }
-                                  }
-                              }
+                                  });
                               break;
                           }
                           default:
@@ -4911,10 +4948,8 @@ ChunkedSegmentSealedImpl::bulk_subscript(milvus::OpContext* op_ctx,
                 snapshot->commit_ts != 0
                     ? std::optional<Timestamp>{snapshot->commit_ts}
                     : std::nullopt;
-            for (int64_t i = 0; i < count; ++i) {
-                dst[i] =
-                    ReadTimestamp(seg_offsets[i], runtime, effective_commit_ts);
-            }
+            ReadTimestamps(
+                seg_offsets, count, dst, runtime, effective_commit_ts);
             break;
         }
         case SystemFieldType::RowId:
@@ -6587,8 +6622,25 @@ ChunkedSegmentSealedImpl::LoadSegmentMeta(
 
 int64_t
 ChunkedSegmentSealedImpl::get_active_count(Timestamp ts) const {
-    // TODO optimize here to reduce expr search range
-    return this->get_row_count();
+    auto snapshot = CapturePublishedState();
+    auto runtime = snapshot->runtime;
+    auto row_count = runtime != nullptr ? runtime->row_count : 0;
+    if (snapshot->schema->is_external_collection()) {
+        return row_count;
+    }
+    // Every row of an import segment carries commit_ts; the timestamp index
+    // may still be built over the raw column, so it is not consulted.
+    if (snapshot->commit_ts != 0) {
+        return ts >= snapshot->commit_ts ? row_count : 0;
+    }
+    if (runtime == nullptr || runtime->timestamp_index == nullptr) {
+        return row_count;
+    }
+    // Rows in [end, row_count) are all newer than ts, so expressions, the
+    // MVCC mask and brute-force search can stop at end. A segment sorted by
+    // pk usually has a single timestamp slice and keeps its full row count.
+    auto [beg, end] = runtime->timestamp_index->get_active_range(ts);
+    return std::min(end, row_count);
 }
 
 // Helper: apply a per-element timestamp scan over a range [beg, end),
@@ -6662,16 +6714,43 @@ ChunkedSegmentSealedImpl::mask_with_timestamps(BitsetTypeView& bitset_chunk,
     auto effective_commit_ts =
         snapshot->commit_ts != 0 ? std::optional<Timestamp>{snapshot->commit_ts}
                                  : std::nullopt;
-    auto total_size = runtime->row_count;
-
+    // The bitset covers get_active_count() rows, which may stop short of the
+    // segment's row count; rows past it are newer than any query timestamp
+    // that produced it.
+    auto total_size = std::min(runtime->row_count,
+                               static_cast<int64_t>(bitset_chunk.size()));
+
+    // Grey-zone scan over [beg, end), the contiguous-range counterpart of
+    // ReadTimestamps: a timestamp column that is not fully resident is pinned
+    // once per chunk (scan_timestamp_range), never once per row.
+    auto runtime_ts_data = runtime->timestamps;
     auto do_scan = [&](int64_t beg, int64_t end, auto pred) {
-        for (int64_t i = beg; i < end; ++i) {
-            pred(i, ReadTimestamp(i, runtime, effective_commit_ts));
+        if (effective_commit_ts) {
+            for (int64_t i = beg; i < end; ++i) {
+                pred(i, *effective_commit_ts);
+            }
+            return;
         }
+        if (runtime_ts_data != nullptr && !runtime_ts_data->empty()) {
+            const auto& ts = *runtime_ts_data;
+            for (int64_t i = beg; i < end; ++i) {
+                pred(i, ts[i]);
+            }
+            return;
+        }
+        auto column = get_column(runtime, TimestampFieldID);
+        AssertInfo(column != nullptr, "timestamp data is not ready");
+        scan_timestamp_range(*column, beg, end, pred);
+    };
+
+    auto clamped_active_range = [&](Timestamp ts) {
+        auto [beg, end] = ts_index_data.get_active_range(ts);
+        return std::make_pair(std::min(beg, total_size),
+                              std::min(end, total_size));
     };
 
     if (collection_ttl > 0) {
-        auto range = ts_index_data.get_active_range(collection_ttl);
+        auto range = clamped_active_range(collection_ttl);
         if (range.first == range.second && range.first == total_size) {
             bitset_chunk.set();
             return;
@@ -6688,7 +6767,7 @@ ChunkedSegmentSealedImpl::mask_with_timestamps(BitsetTypeView& bitset_chunk,
         }
     }
 
-    auto range = ts_index_data.get_active_range(timestamp);
+    auto range = clamped_active_range(timestamp);
 
     // range == (size_, size_): all data is useful, no filtering needed.
     if (range.first == range.second && range.first == total_size) {
@@ -7333,9 +7412,10 @@ ChunkedSegmentSealedImpl::PrepareLoadDiffForReopen(
                     column_groups, arrow_schema, needed_columns, *properties)
                     .release());
             committer.Commit(
-                [reader = std::move(reader)](RuntimeResourceState& runtime,
-                                             PublishedSegmentState&) mutable {
-                    runtime.reader = std::move(reader);
+                [this, reader = std::move(reader)](
+                    RuntimeResourceState& runtime,
+                    PublishedSegmentState&) mutable {
+                    ReplaceReader(runtime, std::move(reader));
                 });
             if (!diff.column_groups_to_load.empty()) {
                 LoadColumnGroups(column_groups,
@@ -8302,6 +8382,37 @@ ChunkedSegmentSealedImpl::LoadColumnGroup(
                     nullptr);
 }
 
+ChunkStatisticsByField
+ChunkedSegmentSealedImpl::LoadManifestGroupStatistics(
+    const milvus_storage::api::ColumnGroup& column_group,
+    const std::shared_ptr<milvus_storage::api::Properties>& properties,
+    int64_t index,
+    const std::vector<FieldId>& milvus_field_ids,
+    const std::vector<std::string>& column_names,
+    const std::unordered_map<FieldId, FieldMeta>& field_metas,
+    const SchemaPtr& schema_snapshot,
+    const std::vector<int64_t>& num_rows_until_chunk) {
+    if (properties == nullptr || (!schema_snapshot->is_external_collection() &&
+                                  !ENABLE_PARQUET_STATS_SKIP_INDEX)) {
+        return {};
+    }
+    std::vector<ManifestStatisticsColumn> columns;
+    for (size_t i = 0; i < milvus_field_ids.size(); i++) {
+        auto data_type = field_metas.at(milvus_field_ids[i]).get_data_type();
+        if (IsVectorDataType(data_type) ||
+            (IsVariableDataType(data_type) && !IsStringDataType(data_type))) {
+            continue;
+        }
+        columns.push_back({milvus_field_ids[i], column_names[i], data_type});
+    }
+    return LoadManifestChunkStatistics(
+        column_group,
+        *properties,
+        columns,
+        num_rows_until_chunk,
+        fmt::format("seg_{}_cg_{}", get_segment_id(), index));
+}
+
 void
 ChunkedSegmentSealedImpl::LoadColumnGroup(
     const std::shared_ptr<milvus_storage::api::ColumnGroups>& column_groups,
@@ -8398,10 +8509,10 @@ ChunkedSegmentSealedImpl::LoadColumnGroup(
 
     // Multiple lazy entries can share the same column-group index (one per
     // field), so the translator cache key must be disambiguated by the
-    // field-id of this entry. Eager entries are still one-per-cg, so they
-    // keep the unsuffixed key.
+    // field-id of this entry. Eager entries are one-per-cg and keep the
+    // unsuffixed key, unless the segment splits them per field too.
     std::string cache_key_suffix;
-    if (!eager_load) {
+    if (!eager_load || segment_load_info.SplitColumnGroupsPerField()) {
         cache_key_suffix = std::to_string(milvus_field_ids.front().get());
     }
 
@@ -8426,6 +8537,15 @@ ChunkedSegmentSealedImpl::LoadColumnGroup(
             segment_load_info.GetInsertChannel());
     auto chunked_column_group =
         std::make_shared<ChunkedColumnGroup>(std::move(translator));
+    auto parquet_stats_by_field = LoadManifestGroupStatistics(
+        *column_group,
+        properties,
+        index,
+        milvus_field_ids,
+        *needed_columns,
+        field_metas,
+        schema_snapshot,
+        chunked_column_group->GetNumRowsUntilChunk());
 
     // Create ProxyChunkColumn for each field
     for (const auto& field_id : milvus_field_ids) {
@@ -8433,20 +8553,23 @@ ChunkedSegmentSealedImpl::LoadColumnGroup(
         auto column = std::make_shared<ProxyChunkColumn>(
             chunked_column_group, field_id, field_meta);
         auto data_type = field_meta.get_data_type();
-        load_field_data_common(
-            field_id,
-            column,
-            segment_load_info.GetNumOfRows(),
-            data_type,
-            use_mmap,
-            true,
-            segment_load_info,
-            schema_snapshot,
-            runtime,
-            std::
-                nullopt,  // manifest cannot provide parquet skip index directly
-            op_ctx,
-            is_replace);
+        std::optional<ParquetStatistics> statistics_opt;
+        auto it = parquet_stats_by_field.find(field_id.get());
+        if (it != parquet_stats_by_field.end()) {
+            statistics_opt = std::move(it->second);
+        }
+        load_field_data_common(field_id,
+                               column,
+                               segment_load_info.GetNumOfRows(),
+                               data_type,
+                               use_mmap,
+                               true,
+                               segment_load_info,
+                               schema_snapshot,
+                               runtime,
+                               statistics_opt,
+                               op_ctx,
+                               is_replace);
         if (field_id == TimestampFieldID) {
             int64_t num_rows = segment_load_info.GetNumOfRows();
             if (commit_ts_ != 0) {
@@ -8546,7 +8669,7 @@ ChunkedSegmentSealedImpl::LoadColumnGroup(
     std::string warmup_policy = aggregated_warmup_policy;
 
     std::string cache_key_suffix;
-    if (!eager_load) {
+    if (!eager_load || segment_load_info.SplitColumnGroupsPerField()) {
         cache_key_suffix = std::to_string(milvus_field_ids.front().get());
     }
 
@@ -8572,12 +8695,26 @@ ChunkedSegmentSealedImpl::LoadColumnGroup(
             std::move(column_size_estimate));
     auto chunked_column_group =
         std::make_shared<ChunkedColumnGroup>(std::move(translator));
+    auto parquet_stats_by_field = LoadManifestGroupStatistics(
+        *column_group,
+        properties,
+        index,
+        milvus_field_ids,
+        *needed_columns,
+        field_metas,
+        schema_snapshot,
+        chunked_column_group->GetNumRowsUntilChunk());
 
     for (const auto& field_id : milvus_field_ids) {
         const auto& field_meta = field_metas.at(field_id);
         auto column = std::make_shared<ProxyChunkColumn>(
             chunked_column_group, field_id, field_meta);
         auto data_type = field_meta.get_data_type();
+        std::optional<ParquetStatistics> statistics_opt;
+        auto it = parquet_stats_by_field.find(field_id.get());
+        if (it != parquet_stats_by_field.end()) {
+            statistics_opt = std::move(it->second);
+        }
         load_field_data_common(field_id,
                                column,
                                segment_load_info.GetNumOfRows(),
@@ -8587,7 +8724,7 @@ ChunkedSegmentSealedImpl::LoadColumnGroup(
                                segment_load_info,
                                schema_snapshot,
                                nullptr,
-                               std::nullopt,
+                               statistics_opt,
                                op_ctx,
                                is_replace,
                                &committer);
@@ -9525,22 +9662,33 @@ ChunkedSegmentSealedImpl::ExecuteTake(
         return nullptr;
     }
 
-    // Reader::take() itself is not thread-safe, so serialize only the call,
-    // while the reader object lifetime is owned by the captured runtime snapshot.
-    std::lock_guard<std::mutex> lock(reader_mutex_);
+    // Rows already taken for these columns are served from take_cache_, so
+    // only the remaining offsets reach the reader.
+    auto take = [&](const std::vector<int64_t>& offsets)
+        -> std::shared_ptr<arrow::Table> {
+        // Reader::take() itself is not thread-safe, so serialize only the
+        // call, while the reader object lifetime is owned by the captured
+        // runtime snapshot.
+        std::lock_guard<std::mutex> lock(reader_mutex_);
+        auto result = reader->take(offsets, 1, needed_columns);
+        if (!result.ok()) {
+            LOG_WARN("[TakeAPI] {} take() failed for segment {}: {}",
+                     caller_tag,
+                     id_,
+                     result.status().ToString());
+            return nullptr;
+        }
+        return *result;
+    };
     auto take_start = std::chrono::high_resolution_clock::now();
-    auto result = reader->take(unique_offsets, 1, needed_columns);
+    auto table = take_cache_.Take(snapshot->runtime->reader_generation,
+                                  *needed_columns,
+                                  unique_offsets,
+                                  take);
     elapsed_ms = std::chrono::duration<double, std::milli>(
                      std::chrono::high_resolution_clock::now() - take_start)
                      .count();
-    if (!result.ok()) {
-        LOG_WARN("[TakeAPI] {} take() failed for segment {}: {}",
-                 caller_tag,
-                 id_,
-                 result.status().ToString());
-        return nullptr;
-    }
-    return *result;
+    return table;
 }
 
 // ---- End shared helpers ----
@@ -13,6 +13,7 @@
 
 #include <folly/ExceptionWrapper.h>
 #include <stdint.h>
+#include <algorithm>
 #include <any>
 #include <atomic>
 #include <cstddef>
@@ -20,6 +21,7 @@
 #include <map>
 #include <memory>
 #include <mutex>
+#include <numeric>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -77,10 +79,12 @@
 #include "query/PlanImpl.h"
 #include "segcore/IndexConfigGenerator.h"
 #include "segcore/InsertRecord.h"
+#include "segcore/ManifestChunkStatistics.h"
 #include "segcore/SegcoreConfig.h"
 #include "segcore/SegmentReadLease.h"
 #include "segcore/SegmentInterface.h"
 #include "segcore/SegmentLoadInfo.h"
+#include "segcore/TakeCache.h"
 #include "segcore/Types.h"
 #include "storage/MmapChunkManager.h"
 #include "segcore/TextColumnCache.h"
@@ -360,6 +364,8 @@ class ChunkedSegmentSealedImpl : public SegmentSealed {
         std::unordered_map<FieldId, std::shared_ptr<index::JsonKeyStats>>
             json_stats;
         std::shared_ptr<milvus_storage::api::Reader> reader;
+        // bumped on every reader replacement, keys take_cache_
+        uint64_t reader_generation = 0;
         std::shared_ptr<TimestampData> timestamps;
         std::shared_ptr<const TimestampIndex> timestamp_index;
         std::shared_ptr<CacheSlot<storagev2translator::TimestampIndexCell>>
@@ -624,6 +630,11 @@ class ChunkedSegmentSealedImpl : public SegmentSealed {
                                  int64_t count,
                                  TargetBitmapView valid_result) const override;
 
+    PinWrapper<const Chunk*>
+    encoded_chunk(milvus::OpContext* op_ctx,
+                  FieldId field_id,
+                  int64_t chunk_id) const override;
+
  protected:
     // blob and row_count
     PinWrapper<SpanBase>
@@ -815,7 +826,12 @@ class ChunkedSegmentSealedImpl : public SegmentSealed {
                 auto end_idx = pk_column->GetNumRowsUntilChunk(last_chunk_id) +
                                last_in_chunk_offset;
 
-                bitset.set(start_idx, end_idx - start_idx + 1, true);
+                // the bitset covers the rows visible at the query timestamp
+                // only
+                end_idx = std::min<int64_t>(end_idx, bitset.size() - 1);
+                if (start_idx <= end_idx) {
+                    bitset.set(start_idx, end_idx - start_idx + 1, true);
+                }
             }
         } else if (op == proto::plan::OpType::GreaterEqual ||
                    op == proto::plan::OpType::GreaterThan) {
@@ -863,6 +879,7 @@ class ChunkedSegmentSealedImpl : public SegmentSealed {
                     pk_column->GetNumRowsUntilChunk(chunk_id) + in_chunk_offset;
             }
 
+            end_idx = std::min<int64_t>(end_idx, bitset.size());
             if (end_idx > 0) {
                 bitset.set(0, end_idx, true);
             }
@@ -941,6 +958,7 @@ class ChunkedSegmentSealedImpl : public SegmentSealed {
         }
 
         // Set bits from start_idx to end_idx - 1
+        end_idx = std::min<int64_t>(end_idx, bitset.size());
         if (start_idx < end_idx) {
             bitset.set(start_idx, end_idx - start_idx, true);
         }
@@ -960,6 +978,110 @@ class ChunkedSegmentSealedImpl : public SegmentSealed {
         return pk_column->GetNumRowsUntilChunk(chunk_id) + in_chunk_offset;
     }
 
+    // Merge-joins a batch of pks against the pk-sorted column, calling
+    // fn(j, seg_offset) for every row whose pk equals pks[j]. The batch is
+    // sorted once; a chunk's first and last rows bound its pks (the segment
+    // is globally sorted), so chunks outside the remaining key range are
+    // skipped without searching them, and within a chunk the row cursor only
+    // moves forward, galloping to each next distinct key.
+    template <typename PK, typename Fn>
+    void
+    for_each_sorted_pk_match(
+        const std::vector<PkType>& pks,
+        const ChunkedColumnInterface* pk_column,
+        const std::vector<PinWrapper<Chunk*>>& all_chunk_pins,
+        Fn&& fn) const {
+        using PKViewType = std::conditional_t<std::is_same_v<PK, int64_t>,
+                                              int64_t,
+                                              std::string_view>;
+        if (pks.empty()) {
+            return;
+        }
+        std::vector<PKViewType> keys;
+        keys.reserve(pks.size());
+        for (const auto& pk : pks) {
+            keys.emplace_back(std::get<PK>(pk));
+        }
+        std::vector<size_t> order(keys.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+            return keys[lhs] < keys[rhs];
+        });
+
+        // keys before `next` have no rows in the chunks still to visit
+        size_t next = 0;
+        const auto num_chunk = pk_column->num_chunks();
+        for (int chunk_id = 0; chunk_id < num_chunk && next < order.size();
+             ++chunk_id) {
+            const int64_t chunk_row_num = pk_column->chunk_row_nums(chunk_id);
+            if (chunk_row_num == 0) {
+                continue;
+            }
+            auto* chunk = all_chunk_pins[chunk_id].get();
+            auto value_at = [&](int64_t row) -> PKViewType {
+                if constexpr (std::is_same_v<PK, int64_t>) {
+                    return reinterpret_cast<const int64_t*>(
+                        chunk->RawData())[row];
+                } else {
+                    return static_cast<StringChunk*>(chunk)->operator[](row);
+                }
+            };
+            const auto chunk_max = value_at(chunk_row_num - 1);
+            if (keys[order[next]] > chunk_max) {
+                continue;
+            }
+            const auto chunk_min = value_at(0);
+            while (next < order.size() && keys[order[next]] < chunk_min) {
+                ++next;
+            }
+
+            const auto num_rows_until_chunk =
+                pk_column->GetNumRowsUntilChunk(chunk_id);
+            int64_t row = 0;
+            size_t group = next;
+            while (group < order.size() && keys[order[group]] <= chunk_max) {
+                const auto key = keys[order[group]];
+                // gallop: all rows before `row` are < key
+                int64_t bound = row;
+                int64_t step = 1;
+                while (bound < chunk_row_num && value_at(bound) < key) {
+                    row = bound + 1;
+                    bound += step;
+                    step <<= 1;
+                }
+                bound = std::min(bound, chunk_row_num);
+                while (row < bound) {
+                    auto mid = row + (bound - row) / 2;
+                    if (value_at(mid) < key) {
+                        row = mid + 1;
+                    } else {
+                        bound = mid;
+                    }
+                }
+                auto row_end = row;
+                while (row_end < chunk_row_num && value_at(row_end) == key) {
+                    ++row_end;
+                }
+                auto group_end = group;
+                while (group_end < order.size() &&
+                       keys[order[group_end]] == key) {
+                    ++group_end;
+                }
+                for (auto r = row; r < row_end; ++r) {
+                    for (auto g = group; g < group_end; ++g) {
+                        fn(order[g], num_rows_until_chunk + r);
+                    }
+                }
+                row = row_end;
+                group = group_end;
+            }
+            // rows equal to chunk_max may continue into the next chunk
+            while (next < group && keys[order[next]] < chunk_max) {
+                ++next;
+            }
+        }
+    }
+
     template <typename PK>
     void
     search_pks_with_two_pointers_impl(
@@ -1008,6 +1130,12 @@ class ChunkedSegmentSealedImpl : public SegmentSealed {
                     pk_column->GetNumRowsUntilChunk(last_chunk_id_found) +
                     last_in_chunk_offset;
 
+                // the bitset covers the rows visible at the query timestamp
+                // only, the pks left are at larger offsets
+                if (start_idx >= static_cast<int64_t>(bitset.size())) {
+                    break;
+                }
+                end_idx = std::min<int64_t>(end_idx, bitset.size() - 1);
                 bitset.set(start_idx, end_idx - start_idx + 1, true);
                 last_chunk_id = last_chunk_id_found;
             }
@@ -1444,6 +1572,12 @@ class ChunkedSegmentSealedImpl : public SegmentSealed {
     std::shared_ptr<milvus_storage::api::Reader>
     CaptureReaderSnapshot() const;
 
+    // Installs a new reader into the staged runtime state under a fresh
+    // generation and drops the rows take_cache_ holds for the old one.
+    void
+    ReplaceReader(RuntimeResourceState& runtime,
+                  std::shared_ptr<milvus_storage::api::Reader> reader);
+
     std::shared_ptr<const TimestampData>
     CaptureTimestampSnapshot() const;
 
@@ -2058,6 +2192,20 @@ class ChunkedSegmentSealedImpl : public SegmentSealed {
         milvus::OpContext* op_ctx = nullptr,
         bool is_replace = false);
 
+    // Per-chunk Parquet statistics of `milvus_field_ids` in manifest column
+    // group `index`. Only external collections, or segments loaded with
+    // ENABLE_PARQUET_STATS_SKIP_INDEX, pay for reading the file footers.
+    ChunkStatisticsByField
+    LoadManifestGroupStatistics(
+        const milvus_storage::api::ColumnGroup& column_group,
+        const std::shared_ptr<milvus_storage::api::Properties>& properties,
+        int64_t index,
+        const std::vector<FieldId>& milvus_field_ids,
+        const std::vector<std::string>& column_names,
+        const std::unordered_map<FieldId, FieldMeta>& field_metas,
+        const SchemaPtr& schema_snapshot,
+        const std::vector<int64_t>& num_rows_until_chunk);
+
     void
     ReloadColumns(const std::vector<FieldId>& field_ids_to_reload,
                   milvus::OpContext* op_ctx = nullptr);
@@ -2215,6 +2363,16 @@ class ChunkedSegmentSealedImpl : public SegmentSealed {
                   const std::shared_ptr<const RuntimeResourceState>& runtime,
                   std::optional<Timestamp> effective_commit_ts) const;
 
+    // Batched ReadTimestamp: output[i] = insert timestamp of offsets[i].
+    // Reading from the timestamp column, rows are grouped by chunk so every
+    // involved chunk is pinned once (one at a time) instead of once per row.
+    void
+    ReadTimestamps(const int64_t* offsets,
+                   int64_t count,
+                   Timestamp* output,
+                   const std::shared_ptr<const RuntimeResourceState>& runtime,
+                   std::optional<Timestamp> effective_commit_ts) const;
+
     PinWrapper<const storagev2translator::PkIndexCell*>
     PinPkIndex(const std::shared_ptr<const RuntimeResourceState>& runtime,
                milvus::OpContext* op_ctx) const;
@@ -2284,6 +2442,12 @@ class ChunkedSegmentSealedImpl : public SegmentSealed {
     // reopen/load can stage a replacement reader without exposing it early.
     mutable std::mutex reader_mutex_;
 
+    // Output rows fetched by ExecuteTake(), keyed by reader generation and
+    // cleared by ReplaceReader() so a reopened reader starts cold.
+    mutable TakeCache take_cache_{
+        SegcoreConfig::default_config().get_take_cache_bytes_per_segment()};
+    std::atomic<uint64_t> last_reader_generation_{0};
+
 #ifdef MILVUS_UNIT_TEST
  public:
     // Test-only: inject a mock Reader for unit testing take() paths.
@@ -28,6 +28,7 @@
 #include <algorithm>
 #include <chrono>
 #include <cstdint>
+#include <filesystem>
 #include <map>
 #include <memory>
 #include <numeric>
@@ -74,7 +75,9 @@
 #include "segcore/storagev1translator/ChunkTranslator.h"
 #include "storage/FileManager.h"
 #include "storage/Types.h"
+#include "test_utils/Constants.h"
 #include "test_utils/DataGen.h"
+#include "test_utils/ManifestTestUtil.h"
 #include "test_utils/cachinglayer_test_utils.h"
 
 using namespace milvus;
@@ -296,6 +299,101 @@ TEST(ChunkedSegmentSealedStorageV2,
               CacheWarmupPolicy::CacheWarmupPolicy_Sync);
 }
 
+TEST(ChunkedSegmentSealedStorageV2, TakeForOutputFilterPinsOnlyFilterColumn) {
+    constexpr int64_t kPkFieldId = START_USER_FIELDID;
+    constexpr int64_t kFlagFieldId = START_USER_FIELDID + 1;
+    constexpr int64_t kPayloadFieldId = START_USER_FIELDID + 2;
+    constexpr int64_t kRowCount = 100;
+
+    milvus::proto::schema::CollectionSchema schema_proto;
+    auto add_field = [&](int64_t field_id,
+                         const std::string& name,
+                         milvus::proto::schema::DataType data_type) {
+        auto* field = schema_proto.add_fields();
+        field->set_fieldid(field_id);
+        field->set_name(name);
+        field->set_data_type(data_type);
+        return field;
+    };
+    add_field(RowFieldID.get(), "RowID", milvus::proto::schema::Int64);
+    add_field(
+        TimestampFieldID.get(), "Timestamp", milvus::proto::schema::Int64);
+    add_field(kPkFieldId, "pk", milvus::proto::schema::Int64)
+        ->set_is_primary_key(true);
+    add_field(kFlagFieldId, "flag", milvus::proto::schema::Int64);
+    auto* max_length =
+        add_field(kPayloadFieldId, "payload", milvus::proto::schema::VarChar)
+            ->add_type_params();
+    max_length->set_key("max_length");
+    max_length->set_value("256");
+    AddWarmupProperty(schema_proto, "warmup.scalarField", "disable");
+    auto schema = Schema::ParseFrom(schema_proto);
+
+    auto base_path =
+        (std::filesystem::path(TestLocalPath) / "take_for_output_split")
+            .string();
+    std::filesystem::remove_all(base_path);
+    milvus::test::V3SegmentTestData test_data(
+        schema, 1, kRowCount, 1, TestLocalPath, base_path);
+    ASSERT_EQ(test_data.NumColumnGroups(), 1);
+
+    proto::segcore::SegmentLoadInfo load_info;
+    load_info.set_collectionid(1);
+    load_info.set_partitionid(2);
+    load_info.set_segmentid(3);
+    load_info.set_storageversion(STORAGE_V3);
+    load_info.set_num_of_rows(kRowCount);
+    load_info.set_manifest_path(test_data.ManifestPathJson());
+    load_info.set_insert_channel("take-for-output-split-test");
+    load_info.set_use_take_for_output(true);
+
+    auto& config = segcore::SegcoreConfig::default_config();
+    config.set_split_column_groups_for_take(true);
+    auto segment =
+        segcore::CreateSealedSegment(schema, nullptr, load_info.segmentid());
+    segment->SetLoadInfo(load_info);
+    milvus::tracer::TraceContext trace_ctx;
+    EXPECT_NO_THROW(segment->Load(trace_ctx, nullptr));
+    config.set_split_column_groups_for_take(false);
+
+    // the scalar column group is loaded one field per translator
+    auto* sealed = dynamic_cast<ChunkedSegmentSealedImpl*>(segment.get());
+    ASSERT_NE(sealed, nullptr);
+    auto runtime = sealed->TestCloneMutableRuntimeResourceState();
+    auto column_of = [&](int64_t field_id) {
+        auto field = runtime->fields.find(FieldId(field_id));
+        return field == runtime->fields.end()
+                   ? nullptr
+                   : std::dynamic_pointer_cast<ProxyChunkColumn>(field->second);
+    };
+    auto flag = column_of(kFlagFieldId);
+    auto payload = column_of(kPayloadFieldId);
+    ASSERT_NE(flag, nullptr);
+    ASSERT_NE(payload, nullptr);
+    EXPECT_FALSE(flag->IsInMultiFieldColumnGroup());
+    EXPECT_FALSE(payload->IsInMultiFieldColumnGroup());
+    ASSERT_FALSE(flag->TestAnyCellLoaded());
+    ASSERT_FALSE(payload->TestAnyCellLoaded());
+
+    // flag holds its row index
+    proto::plan::GenericValue bound;
+    bound.set_int64_val(kRowCount / 2);
+    auto filter = std::make_shared<expr::UnaryRangeFilterExpr>(
+        expr::ColumnInfo(FieldId(kFlagFieldId), milvus::DataType::INT64),
+        proto::plan::OpType::LessThan,
+        bound);
+    auto plan =
+        std::make_shared<plan::FilterBitsNode>(DEFAULT_PLANNODE_ID, filter);
+    auto result =
+        query::ExecuteQueryExpr(plan, segment.get(), kRowCount, MAX_TIMESTAMP);
+    EXPECT_EQ(result.count(), kRowCount / 2);
+
+    EXPECT_TRUE(flag->TestAnyCellLoaded());
+    EXPECT_FALSE(payload->TestAnyCellLoaded());
+
+    std::filesystem::remove_all(base_path);
+}
+
 class TestChunkSegmentStorageV2 : public testing::TestWithParam<bool> {
  protected:
     segcore::SegmentSealedUPtr
@@ -878,7 +976,7 @@ TEST_P(TestChunkSegmentStorageV2, TestCompareExpr) {
 }
 
 TEST(TestChunkSegmentStorageV2Regression,
-     TestCompareExprFallsBackWhenColumnGroupChunksAreMisaligned) {
+     TestCompareExprAcrossMisalignedColumnGroupChunks) {
     StorageV2CellTargetGuard cell_target_guard(1 * 1024 * 1024);
 
     auto schema = std::make_shared<Schema>();
@@ -1000,6 +1098,18 @@ TEST(TestChunkSegmentStorageV2Regression,
         query::ExecuteQueryExpr(plan, segment.get(), row_count, MAX_TIMESTAMP);
     ASSERT_EQ(row_count, final.count());
 
+    // rows only line up if both sides are read at the same offset across the
+    // differing chunk boundaries
+    expr = std::make_shared<expr::CompareExpr>(left_fid,
+                                               right_fid,
+                                               milvus::DataType::INT64,
+                                               milvus::DataType::INT64,
+                                               proto::plan::OpType::LessThan);
+    plan = std::make_shared<plan::FilterBitsNode>(DEFAULT_PLANNODE_ID, expr);
+    final =
+        query::ExecuteQueryExpr(plan, segment.get(), row_count, MAX_TIMESTAMP);
+    ASSERT_EQ(0, final.count());
+
     ASSERT_TRUE(fs->DeleteDir(root).ok());
 }
 
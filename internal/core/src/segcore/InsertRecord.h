@@ -671,7 +671,7 @@ class OffsetOrderedArray : public OffsetMap {
             auto it = std::lower_bound(
                 array_.begin(), array_.end(), target, lower_bound_comp);
             for (; it != array_.end() && it->first == target; ++it) {
-                if (condition(it->second)) {
+                if (condition(it->second) && it->second < bitset.size()) {
                     bitset[it->second] = true;
                 }
             }
@@ -679,7 +679,7 @@ class OffsetOrderedArray : public OffsetMap {
             auto it = std::lower_bound(
                 array_.begin(), array_.end(), target, lower_bound_comp);
             for (; it < array_.end(); ++it) {
-                if (condition(it->second)) {
+                if (condition(it->second) && it->second < bitset.size()) {
                     bitset[it->second] = true;
                 }
             }
@@ -687,7 +687,7 @@ class OffsetOrderedArray : public OffsetMap {
             auto it = std::upper_bound(
                 array_.begin(), array_.end(), target, upper_bound_comp);
             for (; it < array_.end(); ++it) {
-                if (condition(it->second)) {
+                if (condition(it->second) && it->second < bitset.size()) {
                     bitset[it->second] = true;
                 }
             }
@@ -695,7 +695,7 @@ class OffsetOrderedArray : public OffsetMap {
             auto it = std::upper_bound(
                 array_.begin(), array_.end(), target, upper_bound_comp);
             for (auto ptr = array_.begin(); ptr < it; ++ptr) {
-                if (condition(ptr->second)) {
+                if (condition(ptr->second) && ptr->second < bitset.size()) {
                     bitset[ptr->second] = true;
                 }
             }
@@ -703,7 +703,7 @@ class OffsetOrderedArray : public OffsetMap {
             auto it = std::lower_bound(
                 array_.begin(), array_.end(), target, lower_bound_comp);
             for (auto ptr = array_.begin(); ptr < it; ++ptr) {
-                if (condition(ptr->second)) {
+                if (condition(ptr->second) && ptr->second < bitset.size()) {
                     bitset[ptr->second] = true;
                 }
             }
@@ -942,14 +942,17 @@ class VirtualPKOffsetMap : public OffsetMap {
         // Virtual PKs for this segment are [base, base+num_rows_)
         // where base = shifted_segment_id_
         int64_t base = shifted_segment_id_;
-        int64_t lo = 0, hi = num_rows_;  // offset range
+        // offset range, the bitset covers the rows visible at the query
+        // timestamp only
+        int64_t lo = 0;
+        int64_t hi = std::min(num_rows_, static_cast<int64_t>(bitset.size()));
 
         // Convert target to offset space
         int64_t target_offset = target - base;
 
         switch (op) {
             case proto::plan::OpType::Equal: {
-                if (target_offset >= 0 && target_offset < num_rows_) {
+                if (target_offset >= 0 && target_offset < hi) {
                     if (condition(target_offset)) {
                         bitset[target_offset] = true;
                     }
@@ -971,14 +974,14 @@ class VirtualPKOffsetMap : public OffsetMap {
                 }
                 break;
             case proto::plan::OpType::LessEqual:
-                hi = std::min(num_rows_, target_offset + 1);
+                hi = std::min(hi, target_offset + 1);
                 for (int64_t i = 0; i < hi; i++) {
                     if (condition(i))
                         bitset[i] = true;
                 }
                 break;
             case proto::plan::OpType::LessThan:
-                hi = std::min(num_rows_, target_offset);
+                hi = std::min(hi, target_offset);
                 for (int64_t i = 0; i < hi; i++) {
                     if (condition(i))
                         bitset[i] = true;
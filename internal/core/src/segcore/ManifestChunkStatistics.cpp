@@ -0,0 +1,314 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "segcore/ManifestChunkStatistics.h"
+
+#include <algorithm>
+#include <exception>
+#include <future>
+#include <utility>
+
+#include "log/Log.h"
+#include "milvus-storage/common/constants.h"
+#include "milvus-storage/filesystem/fs.h"
+#include "parquet/file_reader.h"
+#include "parquet/schema.h"
+#include "parquet/types.h"
+#include "storage/ThreadPools.h"
+
+namespace milvus::segcore {
+
+namespace {
+
+// Whether min/max of `descr` bound the values the field reads back, in the
+// order the skip index compares them.
+bool
+IsComparableColumn(const parquet::ColumnDescriptor& descr,
+                   DataType data_type) {
+    auto expected_order = parquet::SortOrder::SIGNED;
+    int max_int_width = 0;
+    switch (data_type) {
+        case DataType::INT8:
+            max_int_width = 8;
+            break;
+        case DataType::INT16:
+            max_int_width = 16;
+            break;
+        case DataType::INT32:
+            if (descr.physical_type() != parquet::Type::INT32) {
+                return false;
+            }
+            break;
+        case DataType::INT64:
+            if (descr.physical_type() != parquet::Type::INT64) {
+                return false;
+            }
+            break;
+        case DataType::FLOAT:
+            if (descr.physical_type() != parquet::Type::FLOAT) {
+                return false;
+            }
+            break;
+        case DataType::DOUBLE:
+            if (descr.physical_type() != parquet::Type::DOUBLE) {
+                return false;
+            }
+            break;
+        case DataType::VARCHAR:
+            if (descr.physical_type() != parquet::Type::BYTE_ARRAY) {
+                return false;
+            }
+            expected_order = parquet::SortOrder::UNSIGNED;
+            break;
+        default:
+            return false;
+    }
+    if (max_int_width != 0) {
+        // INT8/INT16 are stored as annotated INT32
+        const auto& logical_type = descr.logical_type();
+        if (descr.physical_type() != parquet::Type::INT32 ||
+            logical_type == nullptr || !logical_type->is_int()) {
+            return false;
+        }
+        const auto& int_type =
+            static_cast<const parquet::IntLogicalType&>(*logical_type);
+        if (int_type.bit_width() > max_int_width) {
+            return false;
+        }
+    }
+    return descr.sort_order() == expected_order;
+}
+
+template <typename DType>
+std::shared_ptr<parquet::Statistics>
+MergeTypedStatistics(
+    const std::vector<std::shared_ptr<parquet::Statistics>>& parts) {
+    auto merged = parquet::MakeStatistics<DType>(parts.front()->descr());
+    for (const auto& part : parts) {
+        merged->Merge(
+            static_cast<const parquet::TypedStatistics<DType>&>(*part));
+    }
+    return merged;
+}
+
+std::shared_ptr<parquet::Statistics>
+MergeStatistics(
+    const std::vector<std::shared_ptr<parquet::Statistics>>& parts) {
+    if (parts.size() == 1) {
+        return parts.front();
+    }
+    switch (parts.front()->physical_type()) {
+        case parquet::Type::INT32:
+            return MergeTypedStatistics<parquet::Int32Type>(parts);
+        case parquet::Type::INT64:
+            return MergeTypedStatistics<parquet::Int64Type>(parts);
+        case parquet::Type::FLOAT:
+            return MergeTypedStatistics<parquet::FloatType>(parts);
+        case parquet::Type::DOUBLE:
+            return MergeTypedStatistics<parquet::DoubleType>(parts);
+        case parquet::Type::BYTE_ARRAY:
+            return MergeTypedStatistics<parquet::ByteArrayType>(parts);
+        default:
+            return nullptr;
+    }
+}
+
+struct ChunkParts {
+    // some overlapping row group has no usable statistics
+    bool unknown = false;
+    std::vector<std::shared_ptr<parquet::Statistics>> parts;
+};
+
+}  // namespace
+
+ChunkStatisticsByField
+MergeRowGroupStatistics(const std::vector<ManifestFileMetadata>& files,
+                        const std::vector<ManifestStatisticsColumn>& columns,
+                        const std::vector<int64_t>& num_rows_until_chunk) {
+    if (num_rows_until_chunk.size() < 2 || columns.empty()) {
+        return {};
+    }
+    const size_t num_chunks = num_rows_until_chunk.size() - 1;
+    std::vector<std::vector<ChunkParts>> chunk_parts(
+        columns.size(), std::vector<ChunkParts>(num_chunks));
+    std::vector<bool> usable(columns.size(), true);
+
+    int64_t segment_rows = 0;
+    for (const auto& file : files) {
+        const auto& metadata = *file.metadata;
+        int64_t begin = 0;
+        int64_t end = metadata.num_rows();
+        if (file.start_row >= 0 && file.end_row > file.start_row) {
+            begin = file.start_row;
+            end = std::min(file.end_row, metadata.num_rows());
+        }
+        if (begin >= end) {
+            continue;
+        }
+
+        std::vector<int> column_indices(columns.size(), -1);
+        for (size_t c = 0; c < columns.size(); c++) {
+            auto index = metadata.schema()->ColumnIndex(columns[c].column_name);
+            if (index < 0 ||
+                !IsComparableColumn(*metadata.schema()->Column(index),
+                                    columns[c].data_type)) {
+                usable[c] = false;
+            }
+            column_indices[c] = index;
+        }
+
+        int64_t row_group_begin = 0;
+        for (int rg = 0; rg < metadata.num_row_groups(); rg++) {
+            auto row_group = metadata.RowGroup(rg);
+            auto row_group_end = row_group_begin + row_group->num_rows();
+            auto lo = std::max(row_group_begin, begin);
+            auto hi = std::min(row_group_end, end);
+            row_group_begin = row_group_end;
+            if (lo >= hi) {
+                continue;
+            }
+            // segment rows [first_row, last_row) come from this row group
+            auto first_row = segment_rows + lo - begin;
+            auto last_row = segment_rows + hi - begin;
+            auto first_chunk = std::upper_bound(num_rows_until_chunk.begin(),
+                                                num_rows_until_chunk.end(),
+                                                first_row) -
+                               num_rows_until_chunk.begin() - 1;
+            // chunks starting before last_row
+            auto last_chunk = std::min<int64_t>(
+                std::lower_bound(num_rows_until_chunk.begin(),
+                                 num_rows_until_chunk.end(),
+                                 last_row) -
+                    num_rows_until_chunk.begin(),
+                num_chunks);
+            for (size_t c = 0; c < columns.size(); c++) {
+                if (!usable[c]) {
+                    continue;
+                }
+                auto column_chunk = row_group->ColumnChunk(column_indices[c]);
+                auto stats = column_chunk->is_stats_set()
+                                 ? column_chunk->statistics()
+                                 : nullptr;
+                bool all_null = stats != nullptr && stats->HasNullCount() &&
+                                stats->null_count() == row_group->num_rows();
+                bool known =
+                    stats != nullptr && (stats->HasMinMax() || all_null);
+                for (auto chunk = first_chunk; chunk < last_chunk; chunk++) {
+                    auto& parts = chunk_parts[c][chunk];
+                    if (!known) {
+                        parts.unknown = true;
+                    } else if (!all_null) {
+                        parts.parts.push_back(stats);
+                    }
+                }
+            }
+        }
+        segment_rows += end - begin;
+    }
+    if (segment_rows != num_rows_until_chunk.back()) {
+        LOG_WARN(
+            "row groups cover {} rows but chunks hold {}, ignore statistics",
+            segment_rows,
+            num_rows_until_chunk.back());
+        return {};
+    }
+
+    ChunkStatisticsByField result;
+    for (size_t c = 0; c < columns.size(); c++) {
+        if (!usable[c]) {
+            continue;
+        }
+        auto& chunk_stats = result[columns[c].field_id.get()];
+        chunk_stats.reserve(num_chunks);
+        for (const auto& parts : chunk_parts[c]) {
+            if (parts.unknown || parts.parts.empty()) {
+                chunk_stats.push_back(nullptr);
+            } else {
+                chunk_stats.push_back(MergeStatistics(parts.parts));
+            }
+        }
+    }
+    return result;
+}
+
+ChunkStatisticsByField
+LoadManifestChunkStatistics(
+    const milvus_storage::api::ColumnGroup& column_group,
+    const milvus_storage::api::Properties& properties,
+    const std::vector<ManifestStatisticsColumn>& columns,
+    const std::vector<int64_t>& num_rows_until_chunk,
+    const std::string& debug_key) {
+    if (columns.empty() || column_group.files.empty() ||
+        column_group.format != LOON_FORMAT_PARQUET) {
+        return {};
+    }
+
+    auto& pool = ThreadPools::GetThreadPool(ThreadPoolPriority::HIGH);
+    std::vector<std::future<std::shared_ptr<parquet::FileMetaData>>> futures;
+    futures.reserve(column_group.files.size());
+    for (const auto& file : column_group.files) {
+        futures.push_back(pool.Submit([&properties, path = file.path]() {
+            auto fs = milvus_storage::FilesystemCache::getInstance().get(
+                properties, path);
+            if (!fs.ok()) {
+                throw std::runtime_error(fs.status().ToString());
+            }
+            auto input = (*fs)->OpenInputFile(path);
+            if (!input.ok()) {
+                throw std::runtime_error(input.status().ToString());
+            }
+            return parquet::ReadMetaData(*input);
+        }));
+    }
+
+    std::vector<ManifestFileMetadata> files;
+    files.reserve(column_group.files.size());
+    std::string error;
+    for (size_t i = 0; i < futures.size(); i++) {
+        try {
+            files.push_back({futures[i].get(),
+                             column_group.files[i].start_index,
+                             column_group.files[i].end_index});
+        } catch (const std::exception& e) {
+            if (error.empty()) {
+                error = fmt::format(
+                    "{}: {}", column_group.files[i].path, e.what());
+            }
+        }
+    }
+    if (!error.empty()) {
+        LOG_WARN("{} skips chunk statistics, read footer of {} failed",
+                 debug_key,
+                 error);
+        return {};
+    }
+
+    try {
+        auto result =
+            MergeRowGroupStatistics(files, columns, num_rows_until_chunk);
+        LOG_INFO("{} loaded chunk statistics of {}/{} columns from {} files",
+                 debug_key,
+                 result.size(),
+                 columns.size(),
+                 files.size());
+        return result;
+    } catch (const std::exception& e) {
+        LOG_WARN("{} skips chunk statistics: {}", debug_key, e.what());
+        return {};
+    }
+}
+
+}  // namespace milvus::segcore
@@ -0,0 +1,84 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/Types.h"
+#include "milvus-storage/column_groups.h"
+#include "milvus-storage/properties.h"
+#include "parquet/metadata.h"
+#include "parquet/statistics.h"
+
+namespace milvus::segcore {
+
+// Chunk statistics of manifest column groups.
+//
+// Chunks of a manifest column group are cells of several row groups, and
+// external files are often sliced by a row window, so Parquet row-group
+// statistics can't be handed to the skip index one per chunk. Instead every
+// row group is mapped to the segment rows it holds, and the statistics of all
+// row groups overlapping a chunk are merged into the chunk's statistics. The
+// expression layer then skips chunks whose statistics rule a predicate out,
+// without ever fetching them.
+
+// field id -> one statistics per chunk; nullptr when a chunk has no usable
+// statistics.
+using ChunkStatisticsByField =
+    std::map<int64_t, std::vector<std::shared_ptr<parquet::Statistics>>>;
+
+struct ManifestStatisticsColumn {
+    FieldId field_id;
+    // physical column name in the data files
+    std::string column_name;
+    DataType data_type;
+};
+
+struct ManifestFileMetadata {
+    std::shared_ptr<parquet::FileMetaData> metadata;
+    // Row window [start_row, end_row) of the file that belongs to the
+    // segment; the whole file when the window is empty or negative.
+    int64_t start_row = -1;
+    int64_t end_row = -1;
+};
+
+// Merge the row-group statistics of `files`, laid out back to back in
+// segment row order, into the chunks bounded by `num_rows_until_chunk`.
+// Columns that are missing from a file, whose physical type or sort order
+// doesn't match the field type, or whose files don't add up to the chunk
+// rows get no entry.
+ChunkStatisticsByField
+MergeRowGroupStatistics(const std::vector<ManifestFileMetadata>& files,
+                        const std::vector<ManifestStatisticsColumn>& columns,
+                        const std::vector<int64_t>& num_rows_until_chunk);
+
+// Read the Parquet footers of the files of `column_group` and merge their
+// row-group statistics into its chunks. Failures are logged and yield no
+// statistics, the caller then evaluates every chunk.
+ChunkStatisticsByField
+LoadManifestChunkStatistics(
+    const milvus_storage::api::ColumnGroup& column_group,
+    const milvus_storage::api::Properties& properties,
+    const std::vector<ManifestStatisticsColumn>& columns,
+    const std::vector<int64_t>& num_rows_until_chunk,
+    const std::string& debug_key);
+
+}  // namespace milvus::segcore
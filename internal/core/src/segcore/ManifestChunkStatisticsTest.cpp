@@ -0,0 +1,184 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "segcore/ManifestChunkStatistics.h"
+
+#include <arrow/api.h>
+#include <arrow/io/memory.h>
+#include <gtest/gtest.h>
+#include <parquet/arrow/writer.h>
+#include <parquet/file_reader.h>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace milvus::segcore {
+namespace {
+
+// Writes column "a" (int64) and "s" (string) with `rows_per_group` rows per
+// row group; std::nullopt becomes a null.
+std::shared_ptr<parquet::FileMetaData>
+WriteFile(const std::vector<std::optional<int64_t>>& values,
+          int64_t rows_per_group,
+          bool write_statistics = true) {
+    arrow::Int64Builder ints;
+    arrow::StringBuilder strings;
+    for (const auto& value : values) {
+        if (value.has_value()) {
+            EXPECT_TRUE(ints.Append(*value).ok());
+            EXPECT_TRUE(strings.Append("v" + std::to_string(*value)).ok());
+        } else {
+            EXPECT_TRUE(ints.AppendNull().ok());
+            EXPECT_TRUE(strings.AppendNull().ok());
+        }
+    }
+    auto schema = arrow::schema({arrow::field("a", arrow::int64()),
+                                 arrow::field("s", arrow::utf8())});
+    auto table =
+        arrow::Table::Make(schema, {*ints.Finish(), *strings.Finish()});
+
+    parquet::WriterProperties::Builder props;
+    if (!write_statistics) {
+        props.disable_statistics();
+    }
+    auto sink = *arrow::io::BufferOutputStream::Create();
+    EXPECT_TRUE(parquet::arrow::WriteTable(*table,
+                                           arrow::default_memory_pool(),
+                                           sink,
+                                           rows_per_group,
+                                           props.build())
+                    .ok());
+    auto buffer = *sink->Finish();
+    return parquet::ReadMetaData(
+        std::make_shared<arrow::io::BufferReader>(buffer));
+}
+
+std::vector<std::optional<int64_t>>
+Range(int64_t begin, int64_t end) {
+    std::vector<std::optional<int64_t>> values;
+    for (auto v = begin; v < end; v++) {
+        values.emplace_back(v);
+    }
+    return values;
+}
+
+const ManifestStatisticsColumn kIntColumn{FieldId(100), "a", DataType::INT64};
+const ManifestStatisticsColumn kStringColumn{
+    FieldId(101), "s", DataType::VARCHAR};
+
+void
+ExpectMinMax(const std::shared_ptr<parquet::Statistics>& stats,
+             int64_t min,
+             int64_t max) {
+    ASSERT_NE(stats, nullptr);
+    ASSERT_TRUE(stats->HasMinMax());
+    auto typed =
+        std::static_pointer_cast<parquet::TypedStatistics<parquet::Int64Type>>(
+            stats);
+    EXPECT_EQ(typed->min(), min);
+    EXPECT_EQ(typed->max(), max);
+}
+
+}  // namespace
+
+TEST(ManifestChunkStatistics, MergesRowGroupsIntoChunks) {
+    // two files of 4 row groups each, chunks of 2, 6 and 8 rows
+    std::vector<ManifestFileMetadata> files = {{WriteFile(Range(0, 8), 2)},
+                                               {WriteFile(Range(8, 16), 2)}};
+    auto result = MergeRowGroupStatistics(
+        files, {kIntColumn, kStringColumn}, {0, 2, 8, 16});
+
+    ASSERT_EQ(result.size(), 2);
+    const auto& ints = result.at(100);
+    ASSERT_EQ(ints.size(), 3);
+    ExpectMinMax(ints[0], 0, 1);
+    ExpectMinMax(ints[1], 2, 7);
+    ExpectMinMax(ints[2], 8, 15);
+
+    const auto& strings = result.at(101);
+    ASSERT_EQ(strings.size(), 3);
+    ASSERT_NE(strings[2], nullptr);
+    auto typed = std::static_pointer_cast<
+        parquet::TypedStatistics<parquet::ByteArrayType>>(strings[2]);
+    EXPECT_EQ(parquet::ByteArrayToString(typed->min()), "v10");
+    EXPECT_EQ(parquet::ByteArrayToString(typed->max()), "v9");
+}
+
+TEST(ManifestChunkStatistics, RowGroupsSpanningChunksBoundEachChunk) {
+    // one row group of 10 rows split over two chunks
+    std::vector<ManifestFileMetadata> files = {{WriteFile(Range(0, 10), 10)}};
+    auto result = MergeRowGroupStatistics(files, {kIntColumn}, {0, 4, 10});
+
+    const auto& ints = result.at(100);
+    ASSERT_EQ(ints.size(), 2);
+    ExpectMinMax(ints[0], 0, 9);
+    ExpectMinMax(ints[1], 0, 9);
+}
+
+TEST(ManifestChunkStatistics, HonorsFileRowWindow) {
+    // rows [4, 8) of the file belong to the segment
+    std::vector<ManifestFileMetadata> files = {
+        {WriteFile(Range(0, 12), 4), 4, 8}};
+    auto result = MergeRowGroupStatistics(files, {kIntColumn}, {0, 4});
+
+    const auto& ints = result.at(100);
+    ASSERT_EQ(ints.size(), 1);
+    ExpectMinMax(ints[0], 4, 7);
+}
+
+TEST(ManifestChunkStatistics, RowCountMismatchYieldsNothing) {
+    std::vector<ManifestFileMetadata> files = {{WriteFile(Range(0, 8), 4)}};
+    auto result = MergeRowGroupStatistics(files, {kIntColumn}, {0, 4, 10});
+    EXPECT_TRUE(result.empty());
+}
+
+TEST(ManifestChunkStatistics, SkipsIncompatibleAndMissingColumns) {
+    std::vector<ManifestFileMetadata> files = {{WriteFile(Range(0, 8), 4)}};
+    auto result = MergeRowGroupStatistics(
+        files,
+        {{FieldId(100), "a", DataType::INT32},
+         {FieldId(101), "s", DataType::INT64},
+         {FieldId(102), "missing", DataType::INT64}},
+        {0, 8});
+    EXPECT_TRUE(result.empty());
+}
+
+TEST(ManifestChunkStatistics, NullsAndMissingStatistics) {
+    // the first row group only holds nulls, the second has values
+    std::vector<std::optional<int64_t>> values(4, std::nullopt);
+    values.push_back(5);
+    values.push_back(6);
+    values.push_back(std::nullopt);
+    values.push_back(7);
+    std::vector<ManifestFileMetadata> files = {{WriteFile(values, 4)}};
+    auto result = MergeRowGroupStatistics(files, {kIntColumn}, {0, 4, 8});
+    const auto& ints = result.at(100);
+    ASSERT_EQ(ints.size(), 2);
+    EXPECT_EQ(ints[0], nullptr);
+    ExpectMinMax(ints[1], 5, 7);
+
+    // a file written without statistics leaves its chunks unknown
+    files.push_back({WriteFile(Range(0, 4), 4, false)});
+    result = MergeRowGroupStatistics(files, {kIntColumn}, {0, 4, 12});
+    const auto& merged = result.at(100);
+    ASSERT_EQ(merged.size(), 2);
+    EXPECT_EQ(merged[0], nullptr);
+    EXPECT_EQ(merged[1], nullptr);
+}
+
+}  // namespace milvus::segcore
@@ -245,8 +245,31 @@ class SegcoreConfig {
             std::memory_order_relaxed);
     }
 
+    void
+    set_take_cache_bytes_per_segment(int64_t value) {
+        take_cache_bytes_per_segment_.store(value, std::memory_order_relaxed);
+    }
+
+    int64_t
+    get_take_cache_bytes_per_segment() const {
+        return take_cache_bytes_per_segment_.load(std::memory_order_relaxed);
+    }
+
+    void
+    set_split_column_groups_for_take(bool value) {
+        split_column_groups_for_take_.store(value, std::memory_order_relaxed);
+    }
+
+    bool
+    get_split_column_groups_for_take() const {
+        return split_column_groups_for_take_.load(std::memory_order_relaxed);
+    }
+
     static constexpr int64_t kDefaultMaxGroupByGroups = 100000;
     static constexpr int64_t kDefaultTakeForOutputResultCountLimit = 10000;
+    // off by default: the cached rows are charged to the caching layer, which
+    // can't evict them
+    static constexpr int64_t kDefaultTakeCacheBytesPerSegment = 0;
 
     int64_t
     get_max_group_by_groups() const {
@@ -307,6 +330,16 @@ class SegcoreConfig {
     inline static bool reject_remote_vector_output_ = false;
     inline static std::atomic<int64_t> take_for_output_result_count_limit_{
         kDefaultTakeForOutputResultCountLimit};
+    // Byte budget of the output row take cache of each sealed segment,
+    // 0 disables it. Read when a segment is created.
+    inline static std::atomic<int64_t> take_cache_bytes_per_segment_{
+        kDefaultTakeCacheBytesPerSegment};
+    // Load every field of a manifest column group into its own cells when
+    // the segment serves output fields through take(), so filters only fetch
+    // the filter columns. Read when a segment loads.
+    // off until the extra chunk readers and parquet footers it opens per
+    // field at load time have been measured against the filter savings
+    inline static std::atomic<bool> split_column_groups_for_take_{false};
     inline static float interim_index_mem_expansion_rate_ = 1.15f;
     inline static int64_t max_group_by_groups_ = kDefaultMaxGroupByGroups;
 };
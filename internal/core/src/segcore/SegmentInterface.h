@@ -423,6 +423,16 @@ class SegmentInternalInterface : public SegmentInterface {
                                  int64_t count,
                                  TargetBitmapView valid_result) const = 0;
 
+    // The sealed chunk if it carries a lightweight encoding of its values
+    // (see common/ChunkEncoding.h), nullptr otherwise. Filters use it to
+    // answer simple predicates without scanning the raw chunk data.
+    virtual PinWrapper<const Chunk*>
+    encoded_chunk(milvus::OpContext* op_ctx,
+                  FieldId field_id,
+                  int64_t chunk_id) const {
+        return PinWrapper<const Chunk*>(nullptr);
+    }
+
     template <typename T>
     PinWrapper<Span<T>>
     chunk_data(milvus::OpContext* op_ctx,
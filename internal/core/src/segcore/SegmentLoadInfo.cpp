@@ -443,6 +443,12 @@ SegmentLoadInfo::ComputeDiffBinlogs(LoadDiff& diff, SegmentLoadInfo& new_info) {
     }
 }
 
+bool
+SegmentLoadInfo::SplitColumnGroupsPerField() const {
+    return GetUseTakeForOutput() &&
+           SegcoreConfig::default_config().get_split_column_groups_for_take();
+}
+
 void
 SegmentLoadInfo::ComputeDiffColumnGroups(LoadDiff& diff,
                                          SegmentLoadInfo& new_info) {
@@ -451,6 +457,7 @@ SegmentLoadInfo::ComputeDiffColumnGroups(LoadDiff& diff,
             .get_prefer_field_data_when_index_has_raw_data();
     auto cur_column_group = GetColumnGroups();
     auto new_column_group = new_info.GetColumnGroups();
+    const bool split_per_field = new_info.SplitColumnGroupsPerField();
 
     AssertInfo(cur_column_group, "current column groups shall not be null");
     AssertInfo(new_column_group, "new column groups shall not be null");
@@ -579,11 +586,24 @@ SegmentLoadInfo::ComputeDiffColumnGroups(LoadDiff& diff,
             // resident copy instead of lazifying it (lazy still keeps it on
             // disk on top of the index — the double-footprint bug this fixes).
         }
-        if (!fields.empty()) {
-            diff.column_groups_to_load.emplace_back(i, fields);
-        }
-        if (!replace_fields.empty()) {
-            diff.column_groups_to_replace.emplace_back(i, replace_fields);
+        if (split_per_field) {
+            // Late materialization: filters pin only the cells of the fields
+            // they read, output fields are taken for the surviving rows.
+            for (const auto& fid : fields) {
+                diff.column_groups_to_load.emplace_back(
+                    i, std::vector<FieldId>{fid});
+            }
+            for (const auto& fid : replace_fields) {
+                diff.column_groups_to_replace.emplace_back(
+                    i, std::vector<FieldId>{fid});
+            }
+        } else {
+            if (!fields.empty()) {
+                diff.column_groups_to_load.emplace_back(i, fields);
+            }
+            if (!replace_fields.empty()) {
+                diff.column_groups_to_replace.emplace_back(i, replace_fields);
+            }
         }
         // Lazy entries are emitted one-per-field on purpose: each entry maps
         // to a separate single-column projected ChunkReader in
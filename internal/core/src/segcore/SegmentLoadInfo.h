@@ -607,6 +607,12 @@ class SegmentLoadInfo {
         return info_.use_take_for_output();
     }
 
+    // Whether the eager fields of a manifest column group load into cells of
+    // their own. Output fields are served by take() then, so a filter only
+    // fetches the columns it reads instead of whole column groups.
+    [[nodiscard]] bool
+    SplitColumnGroupsPerField() const;
+
     [[nodiscard]] bool
     HasFieldInSchema(FieldId field_id) const {
         return field_id.get() < START_USER_FIELDID ||
@@ -38,6 +38,7 @@
 #include "pb/index_cgo_msg.pb.h"
 #include "pb/index_coord.pb.h"
 #include "pb/segcore.pb.h"
+#include "segcore/SegcoreConfig.h"
 #include "segcore/SegmentLoadInfo.h"
 #include "segcore/Types.h"
 
@@ -3293,6 +3294,42 @@ TEST_F(SegmentLoadInfoTest, ComputeDiffDropsManifestFieldRemovedFromSchema) {
     EXPECT_TRUE(diff.column_groups_to_lazyreplace.empty());
 }
 
+TEST_F(SegmentLoadInfoTest, ComputeDiffSplitsColumnGroupPerFieldForTake) {
+    auto schema = MakeSchemaWithFieldIds({100, 101, 102});
+    auto diff_for = [&](bool use_take) {
+        SegmentLoadInfo current_info(MakeManifestProto("/manifest/old"),
+                                     schema);
+        current_info.SetColumnGroupsForTesting(MakeColumnGroups({}));
+        auto new_proto = MakeManifestProto("/manifest/new");
+        new_proto.set_use_take_for_output(use_take);
+        SegmentLoadInfo new_info(new_proto, schema);
+        new_info.SetColumnGroupsForTesting(
+            MakeColumnGroups({{{100, 101, 102}, {"/path/to/cg0.parquet"}}}));
+        return current_info.ComputeDiff(new_info);
+    };
+
+    // the split is off by default
+    auto diff = diff_for(true);
+    ASSERT_EQ(diff.column_groups_to_load.size(), 1);
+    EXPECT_EQ(diff.column_groups_to_load[0].second.size(), 3);
+
+    auto& config = SegcoreConfig::default_config();
+    config.set_split_column_groups_for_take(true);
+    auto untaken_diff = diff_for(false);
+    diff = diff_for(true);
+    config.set_split_column_groups_for_take(false);
+    ASSERT_EQ(untaken_diff.column_groups_to_load.size(), 1);
+    EXPECT_EQ(untaken_diff.column_groups_to_load[0].second.size(), 3);
+
+    // output fields are taken, so each field loads into its own cells
+    ASSERT_EQ(diff.column_groups_to_load.size(), 3);
+    for (const auto& [cg_index, field_ids] : diff.column_groups_to_load) {
+        EXPECT_EQ(cg_index, 0);
+        EXPECT_EQ(field_ids.size(), 1);
+    }
+    EXPECT_TRUE(diff.column_groups_to_lazyload.empty());
+}
+
 TEST_F(SegmentLoadInfoTest, SchemaReopenLoadsNewFieldWithBinlog) {
     proto::segcore::SegmentLoadInfo current_proto;
     current_proto.set_segmentid(100);
@@ -0,0 +1,327 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "segcore/TakeCache.h"
+
+#include <arrow/array/concatenate.h>
+#include <arrow/builder.h>
+#include <arrow/compute/api_vector.h>
+#include <arrow/util/byte_size.h>
+#include <algorithm>
+#include <utility>
+
+#include "cachinglayer/Manager.h"
+#include "log/Log.h"
+
+namespace milvus::segcore {
+
+namespace {
+
+void
+ChargeCachedBytes(int64_t delta) {
+    if (delta > 0) {
+        cachinglayer::Manager::GetInstance().ChargeLoadedResource(
+            cachinglayer::ResourceUsage{delta, 0});
+    } else if (delta < 0) {
+        cachinglayer::Manager::GetInstance().RefundLoadedResource(
+            cachinglayer::ResourceUsage{-delta, 0});
+    }
+}
+
+std::shared_ptr<arrow::Array>
+FlattenColumn(const arrow::Table& table, const std::string& column) {
+    auto chunked = table.GetColumnByName(column);
+    if (chunked == nullptr || chunked->num_chunks() == 0) {
+        return nullptr;
+    }
+    if (chunked->num_chunks() == 1) {
+        return chunked->chunk(0);
+    }
+    auto combined = arrow::Concatenate(chunked->chunks());
+    if (!combined.ok()) {
+        LOG_WARN("[TakeCache] concatenate of column '{}' failed: {}",
+                 column,
+                 combined.status().ToString());
+        return nullptr;
+    }
+    return *combined;
+}
+
+// Bytes of one row slice of a compacted array, the even share of the array
+// when its layout can't be walked.
+int64_t
+RowBytes(const arrow::Array& row, int64_t array_bytes, int64_t array_rows) {
+    auto referenced = arrow::util::ReferencedBufferSize(row);
+    if (referenced.ok() && referenced.ValueOrDie() > 0) {
+        return referenced.ValueOrDie();
+    }
+    return array_bytes / std::max<int64_t>(array_rows, 1);
+}
+
+}  // namespace
+
+TakeCache::TakeCache(int64_t capacity_bytes)
+    : capacity_bytes_(capacity_bytes) {
+}
+
+TakeCache::~TakeCache() {
+    Clear();
+}
+
+std::shared_ptr<arrow::Table>
+TakeCache::Take(uint64_t generation,
+                const std::vector<std::string>& columns,
+                const std::vector<int64_t>& offsets,
+                const TakeFn& take) {
+    if (capacity_bytes_ <= 0 || offsets.empty()) {
+        return take(offsets);
+    }
+
+    // rows[c][i] is the cached row of columns[c] at offsets[i], or null
+    std::vector<arrow::ArrayVector> rows(columns.size(),
+                                         arrow::ArrayVector(offsets.size()));
+    std::vector<bool> is_hit(offsets.size(), false);
+    std::vector<int64_t> missing;
+    int64_t charged = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (generation < generation_) {
+            return take(offsets);
+        }
+        if (generation > generation_) {
+            charged += ClearLocked();
+            generation_ = generation;
+        }
+        for (size_t i = 0; i < offsets.size(); i++) {
+            bool hit = true;
+            for (size_t c = 0; c < columns.size(); c++) {
+                auto column_it = index_.find(columns[c]);
+                if (column_it == index_.end()) {
+                    hit = false;
+                    break;
+                }
+                auto entry_it = column_it->second.find(offsets[i]);
+                if (entry_it == column_it->second.end()) {
+                    hit = false;
+                    break;
+                }
+                lru_.splice(lru_.begin(), lru_, entry_it->second);
+                rows[c][i] = entry_it->second->row;
+            }
+            if (hit) {
+                is_hit[i] = true;
+            } else {
+                missing.push_back(offsets[i]);
+            }
+        }
+    }
+    ChargeCachedBytes(charged);
+    row_hits_.fetch_add(offsets.size() - missing.size(),
+                        std::memory_order_relaxed);
+    row_misses_.fetch_add(missing.size(), std::memory_order_relaxed);
+
+    std::shared_ptr<arrow::Table> fetched;
+    if (!missing.empty()) {
+        fetched = take(missing);
+        if (fetched == nullptr) {
+            return nullptr;
+        }
+        Insert(generation, columns, missing, *fetched);
+        if (missing.size() == offsets.size()) {
+            return fetched;
+        }
+    }
+
+    // Stitch cached rows and runs of fetched rows back into offset order.
+    arrow::FieldVector fields;
+    arrow::ArrayVector arrays;
+    fields.reserve(columns.size());
+    arrays.reserve(columns.size());
+    for (size_t c = 0; c < columns.size(); c++) {
+        std::shared_ptr<arrow::Array> fetched_column;
+        if (fetched != nullptr) {
+            fetched_column = FlattenColumn(*fetched, columns[c]);
+            if (fetched_column == nullptr) {
+                return nullptr;
+            }
+        }
+        arrow::ArrayVector pieces;
+        int64_t next_fetched = 0;
+        for (size_t i = 0; i < offsets.size();) {
+            if (is_hit[i]) {
+                pieces.push_back(rows[c][i]);
+                i++;
+                continue;
+            }
+            int64_t run = 0;
+            while (i < offsets.size() && !is_hit[i]) {
+                run++;
+                i++;
+            }
+            pieces.push_back(fetched_column->Slice(next_fetched, run));
+            next_fetched += run;
+        }
+        auto combined = arrow::Concatenate(pieces);
+        if (!combined.ok()) {
+            LOG_WARN("[TakeCache] concatenate of column '{}' failed: {}",
+                     columns[c],
+                     combined.status().ToString());
+            return nullptr;
+        }
+        fields.push_back(arrow::field(columns[c], (*combined)->type()));
+        arrays.push_back(*combined);
+    }
+    return arrow::Table::Make(arrow::schema(std::move(fields)),
+                              std::move(arrays),
+                              static_cast<int64_t>(offsets.size()));
+}
+
+void
+TakeCache::Insert(uint64_t generation,
+                  const std::vector<std::string>& columns,
+                  const std::vector<int64_t>& offsets,
+                  const arrow::Table& table) {
+    struct Row {
+        size_t column;
+        int64_t offset;
+        std::shared_ptr<arrow::Array> row;
+        int64_t bytes;
+    };
+    auto num_rows = static_cast<int64_t>(offsets.size());
+    std::shared_ptr<arrow::Array> indices;
+    {
+        arrow::Int64Builder builder;
+        if (!builder.Reserve(num_rows).ok()) {
+            return;
+        }
+        for (int64_t i = 0; i < num_rows; i++) {
+            builder.UnsafeAppend(i);
+        }
+        if (!builder.Finish(&indices).ok()) {
+            return;
+        }
+    }
+
+    // Copy the rows out of the take result with one Take per column, so the
+    // entries don't pin the whole result buffers.
+    std::vector<Row> copies;
+    copies.reserve(columns.size() * offsets.size());
+    for (size_t c = 0; c < columns.size(); c++) {
+        auto array = FlattenColumn(table, columns[c]);
+        if (array == nullptr || array->length() != num_rows) {
+            continue;
+        }
+        auto compacted = arrow::compute::Take(*array, *indices);
+        if (!compacted.ok()) {
+            LOG_WARN("[TakeCache] copy of column '{}' failed: {}",
+                     columns[c],
+                     compacted.status().ToString());
+            continue;
+        }
+        auto array_bytes = arrow::util::TotalBufferSize(**compacted);
+        for (int64_t i = 0; i < num_rows; i++) {
+            auto row = (*compacted)->Slice(i, 1);
+            auto bytes = RowBytes(*row, array_bytes, num_rows);
+            copies.push_back({c, offsets[i], std::move(row), bytes});
+        }
+    }
+
+    int64_t charged = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        // the reader was replaced while `take` ran
+        if (generation != generation_) {
+            return;
+        }
+        for (auto& copy : copies) {
+            charged += PutLocked(columns[copy.column],
+                                 copy.offset,
+                                 std::move(copy.row),
+                                 copy.bytes);
+        }
+    }
+    ChargeCachedBytes(charged);
+}
+
+int64_t
+TakeCache::PutLocked(const std::string& column,
+                     int64_t offset,
+                     std::shared_ptr<arrow::Array> row,
+                     int64_t bytes) {
+    if (bytes > capacity_bytes_) {
+        return 0;
+    }
+    int64_t delta = 0;
+    auto& column_index = index_[column];
+    auto entry_it = column_index.find(offset);
+    if (entry_it != column_index.end()) {
+        auto& entry = *entry_it->second;
+        delta += bytes - entry.bytes;
+        entry.row = std::move(row);
+        entry.bytes = bytes;
+        lru_.splice(lru_.begin(), lru_, entry_it->second);
+    } else {
+        auto column_key = &index_.find(column)->first;
+        lru_.push_front({column_key, offset, std::move(row), bytes});
+        column_index.emplace(offset, lru_.begin());
+        delta += bytes;
+    }
+    cached_bytes_ += delta;
+
+    while (cached_bytes_ > capacity_bytes_) {
+        auto& victim = lru_.back();
+        auto victim_column = index_.find(*victim.column);
+        victim_column->second.erase(victim.offset);
+        cached_bytes_ -= victim.bytes;
+        delta -= victim.bytes;
+        lru_.pop_back();
+        if (victim_column->second.empty()) {
+            index_.erase(victim_column);
+        }
+    }
+    return delta;
+}
+
+int64_t
+TakeCache::ClearLocked() {
+    auto released = cached_bytes_;
+    lru_.clear();
+    index_.clear();
+    cached_bytes_ = 0;
+    return -released;
+}
+
+void
+TakeCache::Clear() {
+    int64_t charged = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        charged = ClearLocked();
+    }
+    ChargeCachedBytes(charged);
+}
+
+TakeCacheStats
+TakeCache::GetStats() const {
+    TakeCacheStats stats;
+    stats.row_hits = row_hits_.load(std::memory_order_relaxed);
+    stats.row_misses = row_misses_.load(std::memory_order_relaxed);
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats.cached_bytes = cached_bytes_;
+    return stats;
+}
+
+}  // namespace milvus::segcore
@@ -0,0 +1,138 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <arrow/array.h>
+#include <arrow/table.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace milvus::segcore {
+
+struct TakeCacheStats {
+    size_t row_hits = 0;
+    size_t row_misses = 0;
+    int64_t cached_bytes = 0;
+};
+
+// Fetches rows by segment offset, e.g. Reader::take() for a set of columns.
+// Returns nullptr on failure.
+using TakeFn = std::function<std::shared_ptr<arrow::Table>(
+    const std::vector<int64_t>& offsets)>;
+
+// TakeCache keeps rows fetched by Reader::take() for output fields, so hot
+// entities of external and storage v2 segments are not read from remote
+// storage on every search/retrieve.
+//
+// One instance per segment. Each entry is a one-row slice of a column at a
+// segment offset; the rows cached by one take are copied into one compacted
+// array, which is freed once its last row is evicted. Entries are evicted LRU
+// once the byte budget is exceeded, and cached bytes are charged to the
+// caching layer as loaded memory, which can't evict them, so the budget is
+// kept small and caching is off by default (capacity 0).
+//
+// Thread safety: All methods are thread-safe
+class TakeCache {
+ public:
+    explicit TakeCache(int64_t capacity_bytes);
+    ~TakeCache();
+
+    // Non-copyable, non-movable
+    TakeCache(const TakeCache&) = delete;
+    TakeCache&
+    operator=(const TakeCache&) = delete;
+    TakeCache(TakeCache&&) = delete;
+    TakeCache&
+    operator=(TakeCache&&) = delete;
+
+    // Returns a table holding `columns` for `offsets` (sorted, unique), one
+    // row per offset in order. Offsets that are not cached for every column
+    // are fetched with a single call to `take`, then cached.
+    //
+    // `generation` identifies the reader the rows come from and grows every
+    // time the segment replaces it. A newer generation clears the cache, an
+    // older one (a query still holding the replaced reader) bypasses it.
+    // Returns nullptr if `take` fails.
+    std::shared_ptr<arrow::Table>
+    Take(uint64_t generation,
+         const std::vector<std::string>& columns,
+         const std::vector<int64_t>& offsets,
+         const TakeFn& take);
+
+    // Drops every cached row, called when the segment replaces its reader.
+    void
+    Clear();
+
+    TakeCacheStats
+    GetStats() const;
+
+    int64_t
+    GetCapacity() const {
+        return capacity_bytes_;
+    }
+
+ private:
+    struct Entry {
+        const std::string* column;
+        int64_t offset;
+        std::shared_ptr<arrow::Array> row;
+        int64_t bytes;
+    };
+    using EntryList = std::list<Entry>;
+
+    // Cache row i of every column of `table` as offsets[i].
+    void
+    Insert(uint64_t generation,
+           const std::vector<std::string>& columns,
+           const std::vector<int64_t>& offsets,
+           const arrow::Table& table);
+
+    // Returns the change of cached bytes, to be charged by the caller.
+    int64_t
+    PutLocked(const std::string& column,
+              int64_t offset,
+              std::shared_ptr<arrow::Array> row,
+              int64_t bytes);
+
+    int64_t
+    ClearLocked();
+
+    const int64_t capacity_bytes_;
+
+    mutable std::mutex mutex_;
+    uint64_t generation_ = 0;
+    // most recently used first
+    EntryList lru_;
+    // column -> offset -> entry
+    std::unordered_map<std::string,
+                       std::unordered_map<int64_t, EntryList::iterator>>
+        index_;
+    int64_t cached_bytes_ = 0;
+
+    std::atomic<size_t> row_hits_{0};
+    std::atomic<size_t> row_misses_{0};
+};
+
+}  // namespace milvus::segcore
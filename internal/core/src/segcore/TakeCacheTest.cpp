@@ -0,0 +1,180 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "segcore/TakeCache.h"
+
+#include <arrow/array.h>
+#include <arrow/builder.h>
+#include <arrow/table.h>
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace milvus::segcore {
+namespace {
+
+const std::vector<std::string> kColumns = {"100", "101"};
+
+// Serves column "100" as offset * 10 and column "101" as "row-<offset>",
+// recording the offsets of every call.
+class FakeReader {
+ public:
+    TakeFn
+    AsTakeFn() {
+        return [this](const std::vector<int64_t>& offsets) {
+            calls_.push_back(offsets);
+            arrow::Int64Builder ints;
+            arrow::StringBuilder strings;
+            for (auto offset : offsets) {
+                EXPECT_TRUE(ints.Append(offset * 10).ok());
+                EXPECT_TRUE(
+                    strings.Append("row-" + std::to_string(offset)).ok());
+            }
+            auto schema = arrow::schema({arrow::field("100", arrow::int64()),
+                                         arrow::field("101", arrow::utf8())});
+            return arrow::Table::Make(
+                schema, {*ints.Finish(), *strings.Finish()});
+        };
+    }
+
+    const std::vector<std::vector<int64_t>>&
+    Calls() const {
+        return calls_;
+    }
+
+ private:
+    std::vector<std::vector<int64_t>> calls_;
+};
+
+void
+ExpectRows(const std::shared_ptr<arrow::Table>& table,
+           const std::vector<int64_t>& offsets) {
+    ASSERT_NE(table, nullptr);
+    ASSERT_EQ(table->num_rows(), static_cast<int64_t>(offsets.size()));
+    auto ints = table->GetColumnByName("100");
+    auto strings = table->GetColumnByName("101");
+    ASSERT_NE(ints, nullptr);
+    ASSERT_NE(strings, nullptr);
+    for (size_t i = 0; i < offsets.size(); i++) {
+        auto value = ints->GetScalar(i);
+        ASSERT_TRUE(value.ok());
+        EXPECT_EQ((*value)->ToString(), std::to_string(offsets[i] * 10));
+        auto text = strings->GetScalar(i);
+        ASSERT_TRUE(text.ok());
+        EXPECT_EQ((*text)->ToString(), "row-" + std::to_string(offsets[i]));
+    }
+}
+
+}  // namespace
+
+TEST(TakeCache, RepeatedTakeIsServedFromCache) {
+    TakeCache cache(1 << 20);
+    FakeReader reader;
+    std::vector<int64_t> offsets = {1, 5, 9};
+
+    ExpectRows(cache.Take(1, kColumns, offsets, reader.AsTakeFn()), offsets);
+    ExpectRows(cache.Take(1, kColumns, offsets, reader.AsTakeFn()), offsets);
+
+    ASSERT_EQ(reader.Calls().size(), 1);
+    auto stats = cache.GetStats();
+    EXPECT_EQ(stats.row_hits, 3);
+    EXPECT_EQ(stats.row_misses, 3);
+    EXPECT_GT(stats.cached_bytes, 0);
+}
+
+TEST(TakeCache, PartialHitTakesOnlyMissingOffsets) {
+    TakeCache cache(1 << 20);
+    FakeReader reader;
+
+    cache.Take(1, kColumns, {2, 4, 6}, reader.AsTakeFn());
+    std::vector<int64_t> offsets = {1, 2, 3, 4, 7};
+    ExpectRows(cache.Take(1, kColumns, offsets, reader.AsTakeFn()), offsets);
+
+    ASSERT_EQ(reader.Calls().size(), 2);
+    EXPECT_EQ(reader.Calls()[1], (std::vector<int64_t>{1, 3, 7}));
+
+    // a column that was never taken makes every row a miss
+    cache.Take(1, {"100", "102"}, {2}, reader.AsTakeFn());
+    EXPECT_EQ(reader.Calls().size(), 3);
+}
+
+TEST(TakeCache, EvictsLeastRecentlyUsedWithinCapacity) {
+    FakeReader reader;
+    TakeCache probe(1 << 20);
+    probe.Take(1, kColumns, {0}, reader.AsTakeFn());
+    auto row_bytes = probe.GetStats().cached_bytes;
+    ASSERT_GT(row_bytes, 0);
+
+    TakeCache cache(row_bytes * 4);
+    for (int64_t offset = 0; offset < 16; offset++) {
+        cache.Take(1, kColumns, {offset}, reader.AsTakeFn());
+        EXPECT_LE(cache.GetStats().cached_bytes, cache.GetCapacity());
+    }
+
+    auto calls = reader.Calls().size();
+    ExpectRows(cache.Take(1, kColumns, {15}, reader.AsTakeFn()), {15});
+    EXPECT_EQ(reader.Calls().size(), calls);
+    ExpectRows(cache.Take(1, kColumns, {0}, reader.AsTakeFn()), {0});
+    EXPECT_EQ(reader.Calls().size(), calls + 1);
+}
+
+TEST(TakeCache, NewerGenerationClearsCache) {
+    TakeCache cache(1 << 20);
+    FakeReader old_reader;
+    FakeReader new_reader;
+
+    cache.Take(1, kColumns, {1, 2}, old_reader.AsTakeFn());
+    ExpectRows(cache.Take(2, kColumns, {1, 2}, new_reader.AsTakeFn()), {1, 2});
+    EXPECT_EQ(new_reader.Calls().size(), 1);
+
+    // a query still holding the replaced reader bypasses the cache
+    auto cached_bytes = cache.GetStats().cached_bytes;
+    ExpectRows(cache.Take(1, kColumns, {1, 3}, old_reader.AsTakeFn()), {1, 3});
+    EXPECT_EQ(old_reader.Calls().size(), 2);
+    EXPECT_EQ(cache.GetStats().cached_bytes, cached_bytes);
+    ExpectRows(cache.Take(2, kColumns, {1, 2}, new_reader.AsTakeFn()), {1, 2});
+    EXPECT_EQ(new_reader.Calls().size(), 1);
+
+    cache.Clear();
+    EXPECT_EQ(cache.GetStats().cached_bytes, 0);
+    cache.Take(2, kColumns, {1, 2}, new_reader.AsTakeFn());
+    EXPECT_EQ(new_reader.Calls().size(), 2);
+}
+
+TEST(TakeCache, ZeroCapacityPassesThrough) {
+    TakeCache cache(0);
+    FakeReader reader;
+
+    cache.Take(1, kColumns, {3}, reader.AsTakeFn());
+    cache.Take(1, kColumns, {3}, reader.AsTakeFn());
+
+    EXPECT_EQ(reader.Calls().size(), 2);
+    EXPECT_EQ(cache.GetStats().cached_bytes, 0);
+}
+
+TEST(TakeCache, FailedTakeReturnsNull) {
+    TakeCache cache(1 << 20);
+    auto failing = [](const std::vector<int64_t>&) {
+        return std::shared_ptr<arrow::Table>();
+    };
+
+    EXPECT_EQ(cache.Take(1, kColumns, {1}, failing), nullptr);
+    EXPECT_EQ(cache.GetStats().cached_bytes, 0);
+}
+
+}  // namespace milvus::segcore
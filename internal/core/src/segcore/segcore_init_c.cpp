@@ -133,6 +133,34 @@ SegcoreGetTakeForOutputResultCountLimit() {
     return config.get_take_for_output_result_count_limit();
 }
 
+extern "C" void
+SegcoreSetSplitColumnGroupsForTake(const bool value) {
+    milvus::segcore::SegcoreConfig& config =
+        milvus::segcore::SegcoreConfig::default_config();
+    config.set_split_column_groups_for_take(value);
+}
+
+extern "C" bool
+SegcoreGetSplitColumnGroupsForTake() {
+    milvus::segcore::SegcoreConfig& config =
+        milvus::segcore::SegcoreConfig::default_config();
+    return config.get_split_column_groups_for_take();
+}
+
+extern "C" void
+SegcoreSetTakeCacheBytesPerSegment(const int64_t value) {
+    milvus::segcore::SegcoreConfig& config =
+        milvus::segcore::SegcoreConfig::default_config();
+    config.set_take_cache_bytes_per_segment(value);
+}
+
+extern "C" int64_t
+SegcoreGetTakeCacheBytesPerSegment() {
+    milvus::segcore::SegcoreConfig& config =
+        milvus::segcore::SegcoreConfig::default_config();
+    return config.get_take_cache_bytes_per_segment();
+}
+
 extern "C" void
 SegcoreSetNlist(const int64_t value) {
     milvus::segcore::SegcoreConfig& config =
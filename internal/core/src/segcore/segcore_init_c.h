@@ -118,6 +118,18 @@ SegcoreSetTakeForOutputResultCountLimit(const int64_t value);
 int64_t
 SegcoreGetTakeForOutputResultCountLimit();
 
+void
+SegcoreSetSplitColumnGroupsForTake(const bool value);
+
+bool
+SegcoreGetSplitColumnGroupsForTake();
+
+void
+SegcoreSetTakeCacheBytesPerSegment(const int64_t value);
+
+int64_t
+SegcoreGetTakeCacheBytesPerSegment();
+
 void
 SegcoreCloseGlog();
 
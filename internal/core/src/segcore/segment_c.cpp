@@ -36,6 +36,7 @@
 #include "common/EasyAssert.h"
 #include "common/LoadInfo.h"
 #include "common/OpContext.h"
+#include "common/PersistentChunkFile.h"
 #include "common/QueryInfo.h"
 #include "common/QueryResult.h"
 #include "common/Tracer.h"
@@ -73,6 +74,7 @@
 #include "segcore/SegmentSealed.h"
 #include "segcore/Types.h"
 #include "storage/FileManager.h"
+#include "storage/LocalChunkManagerSingleton.h"
 #include "storage/ThreadPools.h"
 #include "storage/Types.h"
 #include "storage/loon_ffi/property_singleton.h"
@@ -233,7 +235,8 @@ AsyncReopenSegment(CTraceContext c_trace,
             static_cast<milvus::segcore::SegmentInterface*>(c_segment);
 
         auto future = milvus::futures::Future<bool>::async(
-            milvus::futures::getLoadCPUExecutor(),
+            milvus::futures::getSegmentLoadCPUExecutor(
+                segment->get_segment_id()),
             milvus::futures::ExecutePriority::NORMAL,
             [c_trace,
              segment,
@@ -317,7 +320,7 @@ AsyncSegmentLoad(CTraceContext c_trace, CSegmentInterface c_segment) {
     auto segment = static_cast<milvus::segcore::SegmentInterface*>(c_segment);
 
     auto future = milvus::futures::Future<bool>::async(
-        milvus::futures::getLoadCPUExecutor(),
+        milvus::futures::getSegmentLoadCPUExecutor(segment->get_segment_id()),
         milvus::futures::ExecutePriority::NORMAL,
         [c_trace, segment](folly::CancellationToken cancel_token) -> bool* {
             auto trace_ctx = milvus::tracer::TraceContext{
@@ -349,6 +352,23 @@ ClearSegmentData(CSegmentInterface c_segment) {
     s->ClearData();
 }
 
+void
+RemoveSegmentPersistentChunkFiles(int64_t segment_id) {
+    SCOPE_CGO_CALL_METRIC();
+
+    if (!milvus::PERSISTENT_CHUNK_FILE_ENABLED.load()) {
+        return;
+    }
+    auto local_chunk_manager =
+        milvus::storage::LocalChunkManagerSingleton::GetInstance()
+            .GetChunkManager();
+    if (local_chunk_manager == nullptr) {
+        return;
+    }
+    milvus::RemoveSegmentPersistentChunkFiles(
+        local_chunk_manager->GetRootPath(), segment_id);
+}
+
 void
 DeleteSearchResult(CSearchResult search_result) {
     SCOPE_CGO_CALL_METRIC();
@@ -458,7 +478,8 @@ AsyncSearch(CTraceContext c_trace,
     auto phg_ptr = reinterpret_cast<const milvus::query::PlaceholderGroup*>(
         c_placeholder_group);
     auto future = milvus::futures::Future<milvus::SearchResult>::async(
-        milvus::futures::getSearchCPUExecutor(),
+        milvus::futures::getSegmentSearchCPUExecutor(
+            segment->get_segment_id()),
         milvus::futures::ExecutePriority::HIGH,
         [c_trace,
          segment,
@@ -580,7 +601,8 @@ AsyncRetrieve(CTraceContext c_trace,
     auto segment = static_cast<milvus::segcore::SegmentInterface*>(c_segment);
     auto plan = static_cast<const milvus::query::RetrievePlan*>(c_plan);
     auto future = milvus::futures::Future<CRetrieveResult>::async(
-        milvus::futures::getSearchCPUExecutor(),
+        milvus::futures::getSegmentSearchCPUExecutor(
+            segment->get_segment_id()),
         milvus::futures::ExecutePriority::HIGH,
         [c_trace,
          segment,
@@ -635,7 +657,8 @@ AsyncRetrieveByOffsets(CTraceContext c_trace,
     auto plan = static_cast<const milvus::query::RetrievePlan*>(c_plan);
 
     auto future = milvus::futures::Future<CRetrieveResult>::async(
-        milvus::futures::getSearchCPUExecutor(),
+        milvus::futures::getSegmentSearchCPUExecutor(
+            segment->get_segment_id()),
         milvus::futures::ExecutePriority::HIGH,
         [c_trace, segment, plan, offsets, len](
             folly::CancellationToken cancel_token) {
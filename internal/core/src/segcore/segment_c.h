@@ -146,6 +146,11 @@ DeleteSegment(CSegmentInterface c_segment);
 void
 ClearSegmentData(CSegmentInterface c_segment);
 
+// Remove the persistent chunk files of a segment the node released for good.
+// Not called on shutdown, a restarted node maps the files again.
+void
+RemoveSegmentPersistentChunkFiles(int64_t segment_id);
+
 void
 DeleteSearchResult(CSearchResult search_result);
 
@@ -14,12 +14,16 @@
 #include <filesystem>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "cachinglayer/Utils.h"
 #include "segcore/Utils.h"
 #include "common/ChunkWriter.h"
+#include "common/Common.h"
 #include "common/EasyAssert.h"
+#include "common/Numa.h"
+#include "common/PersistentChunkFile.h"
 #include "common/Types.h"
 #include "common/SystemProperty.h"
 #include "segcore/Utils.h"
@@ -162,25 +166,63 @@ ChunkTranslator::get_cells(
         std::pair<milvus::cachinglayer::cid_t, std::unique_ptr<milvus::Chunk>>>
         cells;
     cells.reserve(cids.size());
+    // in-memory chunks go to the home NUMA node of the segment
+    NumaNodeScope numa_scope(HomeNumaNode(segment_id_));
 
+    // Cells kept in persistent chunk files by an earlier load are mapped
+    // directly, only the rest is fetched from remote.
+    std::string persistent_dir;
+    std::unordered_map<milvus::cachinglayer::cid_t,
+                       std::unique_ptr<milvus::Chunk>>
+        persisted;
+    if (use_mmap_ &&
+        PERSISTENT_CHUNK_FILE_ENABLED.load(std::memory_order_relaxed)) {
+        persistent_dir = PersistentChunkDir(mmap_dir_path_);
+        for (auto cid : cids) {
+            auto chunk = open_persistent_chunk(field_meta_,
+                                               mmap_populate_,
+                                               persistent_dir,
+                                               persistent_chunk_key(cid));
+            if (chunk != nullptr) {
+                persisted.emplace(cid, std::move(chunk));
+            }
+        }
+    }
+
+    std::vector<milvus::cachinglayer::cid_t> remote_cids;
     std::vector<std::string> remote_files;
+    remote_cids.reserve(cids.size());
     remote_files.reserve(cids.size());
     for (auto cid : cids) {
-        remote_files.push_back(file_infos_[cid].file_path);
+        if (persisted.count(cid) == 0) {
+            remote_cids.push_back(cid);
+            remote_files.push_back(file_infos_[cid].file_path);
+        }
     }
 
     auto channel = std::make_shared<ArrowReaderChannel>();
-    LOG_INFO("segment {} submits load field {} chunks {} task to thread pool",
-             segment_id_,
-             field_id_,
-             fmt::format("{}", fmt::join(cids, " ")));
-    LoadArrowReaderFromRemote(remote_files, channel, load_priority_);
+    if (!remote_files.empty()) {
+        LOG_INFO(
+            "segment {} submits load field {} chunks {} task to thread pool, "
+            "{} chunks mapped from persistent chunk files",
+            segment_id_,
+            field_id_,
+            fmt::format("{}", fmt::join(remote_cids, " ")),
+            persisted.size());
+        LoadArrowReaderFromRemote(remote_files, channel, load_priority_);
+    }
 
     for (auto cid : cids) {
         // Check for cancellation before processing each chunk
         CheckCancellation(
             ctx, segment_id_, field_id_, "ChunkTranslator::get_cells()");
 
+        auto persisted_it = persisted.find(cid);
+        if (persisted_it != persisted.end()) {
+            cells.emplace_back(cid, std::move(persisted_it->second));
+            continue;
+        }
+
         std::unique_ptr<milvus::Chunk> chunk = nullptr;
         if (!use_mmap_) {
             std::shared_ptr<milvus::ArrowDataWrapper> r;
@@ -209,11 +251,20 @@ ChunkTranslator::get_cells(
             AssertInfo(popped, "failed to pop arrow reader from channel");
             arrow::ArrayVector array_vec =
                 read_single_column_batches(r->reader);
-            chunk = create_chunk(field_meta_,
-                                 array_vec,
-                                 mmap_populate_,
-                                 filepath.string(),
-                                 load_priority_);
+            if (!persistent_dir.empty()) {
+                chunk = create_persistent_chunk(field_meta_,
+                                                array_vec,
+                                                mmap_populate_,
+                                                persistent_dir,
+                                                persistent_chunk_key(cid),
+                                                load_priority_);
+            } else {
+                chunk = create_chunk(field_meta_,
+                                     array_vec,
+                                     mmap_populate_,
+                                     filepath.string(),
+                                     load_priority_);
+            }
         }
         cells.emplace_back(cid, std::move(chunk));
     }
@@ -221,4 +272,14 @@ ChunkTranslator::get_cells(
     return cells;
 }
 
+PersistentChunkKey
+ChunkTranslator::persistent_chunk_key(milvus::cachinglayer::cid_t cid) const {
+    // a binlog is immutable, its path identifies the cell data
+    return PersistentChunkKey{
+        segment_id_,
+        field_id_,
+        static_cast<int64_t>(cid),
+        PersistentChunkSourceHash({file_infos_[cid].file_path})};
+}
+
 }  // namespace milvus::segcore::storagev1translator
@@ -18,6 +18,7 @@
 #include "cachinglayer/Translator.h"
 #include "cachinglayer/Utils.h"
 #include "common/Chunk.h"
+#include "common/PersistentChunkFile.h"
 #include "common/type_c.h"
 #include "mmap/Types.h"
 #include "segcore/CacheMetricAttribution.h"
@@ -106,6 +107,9 @@ class ChunkTranslator : public milvus::cachinglayer::Translator<milvus::Chunk> {
     }
 
  private:
+    PersistentChunkKey
+    persistent_chunk_key(milvus::cachinglayer::cid_t cid) const;
+
     std::vector<FileInfo> file_infos_;
     int64_t segment_id_;
     int64_t field_id_;
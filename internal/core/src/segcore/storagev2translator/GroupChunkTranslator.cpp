@@ -38,6 +38,8 @@
 #include "common/EasyAssert.h"
 #include "common/FieldMeta.h"
 #include "common/GroupChunk.h"
+#include "common/Numa.h"
+#include "common/PersistentChunkFile.h"
 #include "common/Types.h"
 #include "fmt/core.h"
 #include "glog/logging.h"
@@ -345,10 +347,31 @@ GroupChunkTranslator::get_cells(milvus::OpContext* ctx,
             meta_.chunk_memory_size_.size());
     }
 
+    std::unordered_map<cachinglayer::cid_t, std::unique_ptr<milvus::GroupChunk>>
+        completed_cells;
+    completed_cells.reserve(cids.size());
+
+    // Cells kept in persistent chunk files by an earlier load are mapped
+    // directly, only the rest is fetched from remote.
+    if (use_persistent_chunk_file()) {
+        auto dir = PersistentChunkDir(column_group_info_.mmap_dir_path);
+        for (auto cid : cids) {
+            auto chunks = open_persistent_group_chunk(
+                field_metas_, mmap_populate_, dir, persistent_chunk_key(cid));
+            if (chunks.has_value()) {
+                completed_cells[cid] =
+                    std::make_unique<milvus::GroupChunk>(*chunks);
+            }
+        }
+    }
+
     // Build CellSpec for each requested cid
     std::vector<milvus::segcore::CellSpec> cell_specs;
     cell_specs.reserve(cids.size());
     for (auto cid : cids) {
+        if (completed_cells.count(cid) != 0) {
+            continue;
+        }
         auto [rg_start, rg_end] = meta_.get_row_group_range(cid);
         auto [file_idx, local_off] = get_file_and_row_group_offset(rg_start);
         cell_specs.push_back(
@@ -360,6 +383,14 @@ GroupChunkTranslator::get_cells(milvus::OpContext* ctx,
              loading_overhead_bytes(meta_.chunk_memory_size_[cid])});
     }
 
+    if (cell_specs.empty()) {
+        for (auto cid : cids) {
+            cells.emplace_back(cid, std::move(completed_cells[cid]));
+        }
+        return cells;
+    }
+    const auto persisted_cells = cids.size() - cell_specs.size();
+
     // Submit cell-batch loading tasks
     auto fs = milvus::segcore::GetDefaultArrowFileSystem();
 
@@ -379,14 +410,12 @@ GroupChunkTranslator::get_cells(milvus::OpContext* ctx,
         std::move(finalize_cell));
 
     LOG_INFO(
-        "[StorageV2] translator {} submits {} batch tasks for column group {}",
+        "[StorageV2] translator {} submits {} batch tasks for column group "
+        "{}, {} cells mapped from persistent chunk files",
         key_,
         load_futures.size(),
-        column_group_info_.field_id);
-
-    std::unordered_map<cachinglayer::cid_t, std::unique_ptr<milvus::GroupChunk>>
-        completed_cells;
-    completed_cells.reserve(cids.size());
+        column_group_info_.field_id,
+        persisted_cells);
 
     std::exception_ptr first_error = nullptr;
     for (auto& future : load_futures) {
@@ -438,6 +467,9 @@ GroupChunkTranslator::load_group_chunk(
     const std::vector<std::shared_ptr<arrow::Table>>& tables,
     const milvus::cachinglayer::cid_t cid) {
     assert(!tables.empty());
+    // runs on a batch loading thread of any node, so place the chunks on the
+    // home node of the segment explicitly
+    NumaNodeScope numa_scope(HomeNumaNode(segment_id_));
     // Use the first table's schema as reference for field iteration
     const auto& schema = tables[0]->schema();
 
@@ -495,6 +527,16 @@ GroupChunkTranslator::load_group_chunk(
     if (!use_mmap_) {
         chunks = create_group_chunk(
             field_ids, field_metas, array_vecs, mmap_populate_);
+    } else if (use_persistent_chunk_file()) {
+        // persistent files are renamed into place, never truncated
+        chunks = create_persistent_group_chunk(
+            field_ids,
+            field_metas,
+            array_vecs,
+            mmap_populate_,
+            PersistentChunkDir(column_group_info_.mmap_dir_path),
+            persistent_chunk_key(cid),
+            load_priority_);
     } else {
         // Use a unique generation suffix to avoid file path collision when a
         // column group is replaced.  Without this, the new FileWriter would
@@ -539,6 +581,31 @@ GroupChunkTranslator::load_group_chunk(
     return std::make_unique<milvus::GroupChunk>(chunks);
 }
 
+bool
+GroupChunkTranslator::use_persistent_chunk_file() const {
+    return use_mmap_ &&
+           PERSISTENT_CHUNK_FILE_ENABLED.load(std::memory_order_relaxed);
+}
+
+PersistentChunkKey
+GroupChunkTranslator::persistent_chunk_key(
+    milvus::cachinglayer::cid_t cid) const {
+    // A cell is a row group range of one immutable file, which identifies
+    // the cell data together with the chunk type.
+    auto [rg_start, rg_end] = meta_.get_row_group_range(cid);
+    auto [file_idx, local_off] = get_file_and_row_group_offset(rg_start);
+    return PersistentChunkKey{
+        segment_id_,
+        column_group_info_.field_id,
+        static_cast<int64_t>(cid),
+        PersistentChunkSourceHash(
+            {insert_files_[file_idx],
+             fmt::format("{}+{}", local_off, rg_end - rg_start),
+             fmt::format("{}:{}",
+                         static_cast<uint8_t>(group_chunk_type_),
+                         column_group_info_.main_field_id)})};
+}
+
 int64_t
 GroupChunkTranslator::loading_overhead_bytes(int64_t cell_size) const {
     if (!has_array_field_) {
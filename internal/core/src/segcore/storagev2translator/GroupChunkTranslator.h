@@ -26,6 +26,7 @@
 #include "mmap/Types.h"
 #include "common/Types.h"
 #include "common/GroupChunk.h"
+#include "common/PersistentChunkFile.h"
 #include "segcore/InsertRecord.h"
 #include "segcore/storagev2translator/GroupCTMeta.h"
 
@@ -100,6 +101,12 @@ class GroupChunkTranslator
     int64_t
     loading_overhead_bytes(int64_t cell_size) const;
 
+    bool
+    use_persistent_chunk_file() const;
+
+    PersistentChunkKey
+    persistent_chunk_key(milvus::cachinglayer::cid_t cid) const;
+
     int64_t segment_id_;
     GroupChunkType group_chunk_type_{GroupChunkType::DEFAULT};
     std::string key_;
@@ -40,6 +40,7 @@
 #include "common/EasyAssert.h"
 #include "common/FieldMeta.h"
 #include "common/GroupChunk.h"
+#include "common/Numa.h"
 #include "common/Schema.h"
 #include "common/Types.h"
 #include "fmt/core.h"
@@ -638,6 +639,8 @@ ManifestGroupTranslator::load_group_chunk(
     const std::vector<std::shared_ptr<arrow::Table>>& tables,
     const milvus::cachinglayer::cid_t cid) {
     assert(!tables.empty());
+    // see GroupChunkTranslator::load_group_chunk()
+    NumaNodeScope numa_scope(HomeNumaNode(segment_id_));
     // Use the first table's schema as reference for field iteration
     const auto& schema = tables[0]->schema();
 
@@ -681,66 +681,48 @@ DiskFileManagerImpl::cache_raw_data_to_disk_internal(const Config& config) {
     uint64_t total_num_rows = 0;
     bool nullable = false;
 
-    // get batch raw data from s3 and write batch data to disk file
-    // TODO: load and write of different batches at the same time
-    std::vector<std::string> batch_files;
-
     // file format
     // num_rows(uint32) | dim(uint32) | index_data ([]uint8_t)
     uint32_t num_rows = 0;
     uint32_t dim = 0;
     int64_t write_offset = sizeof(num_rows) + sizeof(dim);
 
-    auto FetchRawData = [&]() {
-        auto field_datas = GetObjectData(rcm_.get(), batch_files);
-        storage::ProcessFuturesInOrder(
-            field_datas, [&](std::unique_ptr<DataCodec> codec) {
-                auto field_data = codec->GetFieldData();
-                num_rows += uint32_t(field_data->get_valid_rows());
-
-                if (valid_data_path.has_value() && field_data->IsNullable()) {
-                    nullable = true;
-                    auto rows = field_data->get_num_rows();
-                    if (rows > 0) {
-                        auto new_size = (total_num_rows + rows + 7) / 8;
-                        if (new_size >
-                            static_cast<int64_t>(valid_bitmap.size())) {
-                            valid_bitmap.resize(new_size, 0);
-                        }
-                        for (int64_t i = 0; i < rows; ++i) {
-                            if (field_data->is_valid(i)) {
-                                set_bit(valid_bitmap, total_num_rows + i);
-                            }
+    // Binlogs are downloaded and decoded on the pool while earlier ones are
+    // written to the local file, bounded by RAW_DATA_CACHE_INFLIGHT_BYTES.
+    storage::ProcessObjectDataPipelined(
+        rcm_.get(),
+        remote_files,
+        RAW_DATA_CACHE_INFLIGHT_BYTES.load(),
+        [&](std::unique_ptr<DataCodec> codec) {
+            auto field_data = codec->GetFieldData();
+            num_rows += uint32_t(field_data->get_valid_rows());
+
+            if (valid_data_path.has_value() && field_data->IsNullable()) {
+                nullable = true;
+                auto rows = field_data->get_num_rows();
+                if (rows > 0) {
+                    auto new_size = (total_num_rows + rows + 7) / 8;
+                    if (new_size > static_cast<int64_t>(valid_bitmap.size())) {
+                        valid_bitmap.resize(new_size, 0);
+                    }
+                    for (int64_t i = 0; i < rows; ++i) {
+                        if (field_data->is_valid(i)) {
+                            set_bit(valid_bitmap, total_num_rows + i);
                         }
-                        total_num_rows += rows;
                     }
+                    total_num_rows += rows;
                 }
+            }
 
-                cache_raw_data_to_disk_common<DataType>(
-                    field_data,
-                    local_chunk_manager,
-                    local_data_path,
-                    file_created,
-                    dim,
-                    write_offset,
-                    is_vector_array ? &offsets : nullptr);
-            });
-    };
-
-    auto parallel_degree =
-        uint64_t(DEFAULT_FIELD_MAX_MEMORY_LIMIT / FILE_SLICE_SIZE);
-    for (auto& file : remote_files) {
-        if (batch_files.size() >= parallel_degree) {
-            FetchRawData();
-            batch_files.clear();
-        }
-
-        batch_files.emplace_back(file);
-    }
-
-    if (batch_files.size() > 0) {
-        FetchRawData();
-    }
+            cache_raw_data_to_disk_common<DataType>(
+                field_data,
+                local_chunk_manager,
+                local_data_path,
+                file_created,
+                dim,
+                write_offset,
+                is_vector_array ? &offsets : nullptr);
+        });
 
     // For vector arrays, num_rows should be the total flattened vector count,
     // not the number of emb_lists, because DiskANN reads this from the data file header.
@@ -1668,6 +1668,88 @@ TEST_F(DiskAnnFileManagerTest, CacheRawDataToDiskValidDataFile) {
     cm_->Remove(insert_file_path);
 }
 
+TEST_F(DiskAnnFileManagerTest, CacheRawDataToDiskPipelinedKeepsFileOrder) {
+    const int64_t collection_id = 1;
+    const int64_t partition_id = 2;
+    const int64_t segment_id = 3;
+    const int64_t field_id = 100;
+    const int64_t dim = 8;
+    const int64_t rows_per_file = 10;
+    const int64_t num_files = 5;
+
+    FieldDataMeta field_data_meta = {
+        collection_id, partition_id, segment_id, field_id};
+    std::vector<std::string> insert_files;
+    std::vector<float> expected;
+    for (int64_t f = 0; f < num_files; ++f) {
+        std::vector<float> vec_data(rows_per_file * dim);
+        for (size_t i = 0; i < vec_data.size(); ++i) {
+            vec_data[i] = static_cast<float>(f * 1000 + i);
+        }
+        expected.insert(expected.end(), vec_data.begin(), vec_data.end());
+
+        auto field_data = storage::CreateFieldData(
+            DataType::VECTOR_FLOAT, DataType::NONE, false, dim);
+        field_data->FillFieldData(vec_data.data(), rows_per_file);
+        auto payload_reader =
+            std::make_shared<milvus::storage::PayloadReader>(field_data);
+        storage::InsertData insert_data(payload_reader);
+        insert_data.SetFieldDataMeta(field_data_meta);
+        insert_data.SetTimestamps(0, 100);
+        auto serialized_data =
+            insert_data.Serialize(storage::StorageType::Remote);
+
+        auto path =
+            TestLocalPath + "diskann/pipelined_raw_data_" + std::to_string(f);
+        cm_->Write(path, serialized_data.data(), serialized_data.size());
+        insert_files.push_back(path);
+    }
+
+    IndexMeta index_meta = {segment_id,
+                            field_id,
+                            1000,
+                            1,
+                            "test",
+                            "vec_field",
+                            DataType::VECTOR_FLOAT,
+                            dim};
+    auto local_chunk_manager =
+        LocalChunkManagerSingleton::GetInstance().GetChunkManager();
+    auto old_budget = milvus::RAW_DATA_CACHE_INFLIGHT_BYTES.load();
+
+    // one download at a time, and all downloads ahead of the writer
+    for (int64_t budget : {int64_t(1), int64_t(1) << 30}) {
+        milvus::SetRawDataCacheInflightBytes(budget);
+        auto file_manager = std::make_shared<DiskFileManagerImpl>(
+            storage::FileManagerContext(field_data_meta, index_meta, cm_, fs_));
+        milvus::Config config;
+        config[INSERT_FILES_KEY] = insert_files;
+        auto local_data_path = file_manager->CacheRawDataToDisk<float>(config);
+
+        uint32_t num_rows = 0;
+        uint32_t read_dim = 0;
+        local_chunk_manager->Read(
+            local_data_path, 0, &num_rows, sizeof(num_rows));
+        local_chunk_manager->Read(
+            local_data_path, sizeof(num_rows), &read_dim, sizeof(read_dim));
+        EXPECT_EQ(num_rows, rows_per_file * num_files);
+        EXPECT_EQ(read_dim, dim);
+
+        std::vector<float> data(expected.size());
+        local_chunk_manager->Read(local_data_path,
+                                  sizeof(num_rows) + sizeof(read_dim),
+                                  data.data(),
+                                  data.size() * sizeof(float));
+        EXPECT_EQ(data, expected) << "budget " << budget;
+        local_chunk_manager->Remove(local_data_path);
+    }
+
+    milvus::SetRawDataCacheInflightBytes(old_budget);
+    for (auto& path : insert_files) {
+        cm_->Remove(path);
+    }
+}
+
 TEST_F(DiskAnnFileManagerTest, BuildAllNullNullableDiskVectorIndexFromDataset) {
     const int64_t collection_id = 1;
     const int64_t partition_id = 2;
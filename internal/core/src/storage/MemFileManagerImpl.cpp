@@ -217,6 +217,63 @@ MemFileManagerImpl::cache_raw_data_to_memory_internal(const Config& config) {
     return field_datas;
 }
 
+void
+MemFileManagerImpl::IterateRawData(
+    const Config& config, const std::function<void(FieldDataPtr)>& consumer) {
+    auto storage_version =
+        index::GetValueFromConfig<int64_t>(config, STORAGE_VERSION_KEY)
+            .value_or(0);
+    if (storage_version == STORAGE_V2 || storage_version == STORAGE_V3) {
+        auto data_type =
+            index::GetValueFromConfig<DataType>(config, DATA_TYPE_KEY);
+        auto element_type =
+            index::GetValueFromConfig<DataType>(config, ELEMENT_TYPE_KEY);
+        auto manifest = index::GetValueFromConfig<std::string>(
+                            config, SEGMENT_MANIFEST_KEY)
+                            .value_or("");
+        if (!manifest.empty() && data_type.has_value() &&
+            element_type.has_value() && data_type.value() != DataType::TEXT) {
+            AssertInfo(loon_ffi_properties_ != nullptr,
+                       "[StorageV2] loon ffi properties is null when build "
+                       "index with manifest");
+            auto dim =
+                index::GetValueFromConfig<int64_t>(config, DIM_KEY).value_or(0);
+            IterateFieldDataFromManifest(
+                manifest,
+                loon_ffi_properties_,
+                field_meta_,
+                data_type,
+                dim,
+                element_type,
+                GetStorageColumnMapping(field_meta_.field_id),
+                consumer);
+            return;
+        }
+        auto field_datas = cache_raw_data_to_memory_storage_v2(config);
+        for (auto& field_data : field_datas) {
+            consumer(std::move(field_data));
+        }
+        return;
+    }
+
+    auto insert_files = index::GetValueFromConfig<std::vector<std::string>>(
+        config, INSERT_FILES_KEY);
+    AssertInfo(insert_files.has_value(),
+               "insert file paths is empty when build index");
+    auto remote_files = insert_files.value();
+    SortByPath(remote_files);
+    size_t num_field_datas = 0;
+    ProcessObjectDataPipelined(rcm_.get(),
+                               remote_files,
+                               RAW_DATA_CACHE_INFLIGHT_BYTES.load(),
+                               [&](std::unique_ptr<DataCodec> codec) {
+                                   consumer(codec->GetFieldData());
+                                   ++num_field_datas;
+                               });
+    AssertInfo(num_field_datas == remote_files.size(),
+               "inconsistent file num and raw data num!");
+}
+
 std::vector<FieldDataPtr>
 MemFileManagerImpl::cache_raw_data_to_memory_storage_v2(const Config& config) {
     auto data_type = index::GetValueFromConfig<DataType>(config, DATA_TYPE_KEY);
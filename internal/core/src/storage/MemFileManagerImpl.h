@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <map>
 #include <string>
 #include <vector>
@@ -63,6 +64,15 @@ class MemFileManagerImpl : public FileManagerImpl {
     std::vector<FieldDataPtr>
     CacheRawDataToMemory(const Config& config);
 
+    // Hands the raw data of the field to consumer in row order. V1 binlogs
+    // and storage v2/v3 manifests are streamed one decoded binlog (or record
+    // batch) at a time, a chunk is released as soon as the consumer drops
+    // it. Storage v2 without a manifest, and text fields, are still cached
+    // whole first and then handed over chunk by chunk.
+    void
+    IterateRawData(const Config& config,
+                   const std::function<void(FieldDataPtr)>& consumer);
+
     bool
     AddFile(const BinarySet& binary_set);
 
@@ -0,0 +1,525 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/TaskScheduler.h"
+
+#include <algorithm>
+
+#include "common/EasyAssert.h"
+#include "fmt/ranges.h"
+#include "log/Log.h"
+
+namespace milvus {
+
+thread_local TaskScheduler* TaskScheduler::current_scheduler_ = nullptr;
+thread_local TaskScheduler::Worker* TaskScheduler::current_worker_ = nullptr;
+
+void
+TaskScheduler::TaskRing::push(ScheduledTask&& task) {
+    if (size_ == buf_.size()) {
+        std::vector<ScheduledTask> grown(std::max<size_t>(16, buf_.size() * 2));
+        for (size_t i = 0; i < size_; i++) {
+            grown[i] = std::move(buf_[(head_ + i) % buf_.size()]);
+        }
+        buf_.swap(grown);
+        head_ = 0;
+    }
+    buf_[(head_ + size_) % buf_.size()] = std::move(task);
+    size_++;
+}
+
+bool
+TaskScheduler::TaskRing::pop(ScheduledTask& task) {
+    if (size_ == 0) {
+        return false;
+    }
+    task = std::move(buf_[head_]);
+    head_ = (head_ + 1) % buf_.size();
+    size_--;
+    return true;
+}
+
+TaskScheduler::TaskScheduler(std::string name,
+                             const std::vector<int>& class_max_threads)
+    : name_(std::move(name)),
+      num_classes_(static_cast<int>(class_max_threads.size())),
+      classes_(std::make_unique<ClassState[]>(class_max_threads.size())) {
+    AssertInfo(num_classes_ > 0, "task scheduler {} has no task class", name_);
+    for (int c = 0; c < num_classes_; c++) {
+        classes_[c].max_threads.store(std::max(1, class_max_threads[c]));
+    }
+    LOG_INFO("Init task scheduler:{} with max worker num per class:[{}]",
+             name_,
+             fmt::join(class_max_threads, ","));
+    std::lock_guard<std::mutex> lock(registry_mutex_);
+    for (int i = 0; i < min_threads_; i++) {
+        SpawnWorkerLocked();
+    }
+}
+
+TaskScheduler::~TaskScheduler() {
+    ShutDown();
+}
+
+void
+TaskScheduler::ShutDown() {
+    auto first = !shutdown_.exchange(true);
+    if (first) {
+        LOG_INFO("Start shutting down {}", name_);
+    }
+    {
+        std::lock_guard<std::mutex> lock(park_mutex_);
+    }
+    park_cv_.notify_all();
+    // a worker may be submitting, which takes registry_mutex_, so join
+    // outside of it
+    std::vector<std::thread> threads;
+    {
+        std::lock_guard<std::mutex> lock(registry_mutex_);
+        for (auto& worker : worker_storage_) {
+            if (worker->thread.joinable()) {
+                threads.push_back(std::move(worker->thread));
+            }
+        }
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    if (first) {
+        LOG_INFO("Finish shutting down {}", name_);
+    }
+}
+
+void
+TaskScheduler::Schedule(int task_class, SmallTask task) {
+    AssertInfo(task_class >= 0 && task_class < num_classes_,
+               "invalid task class {} for task scheduler {}",
+               task_class,
+               name_);
+    if (shutdown_.load()) {
+        // dropping the task breaks its promise
+        return;
+    }
+    ScheduledTask scheduled{std::move(task), std::chrono::steady_clock::now()};
+    auto pushed = current_scheduler_ == this &&
+                  Push(current_worker_, task_class, scheduled, false);
+    auto* list = worker_list_.load(std::memory_order_acquire);
+    if (!pushed && list != nullptr) {
+        auto num_workers = list->workers.size();
+        auto first = next_worker_.fetch_add(1, std::memory_order_relaxed);
+        for (size_t i = 0; i < num_workers && !pushed; i++) {
+            pushed = Push(list->workers[(first + i) % num_workers],
+                          task_class,
+                          scheduled,
+                          false);
+        }
+    }
+    if (!pushed) {
+        // no worker could be started so far, leave the task to the next one
+        std::lock_guard<std::mutex> lock(registry_mutex_);
+        auto* worker = SpawnWorkerLocked();
+        if (worker == nullptr && worker_storage_.empty()) {
+            LOG_WARN("Drop task of {}, no worker could be started", name_);
+            return;
+        }
+        Push(worker != nullptr ? worker : worker_storage_.front().get(),
+             task_class,
+             scheduled,
+             true);
+    }
+
+    auto& cls = classes_[task_class];
+    auto* metrics = cls.metrics.load(std::memory_order_acquire);
+    if (metrics != nullptr) {
+        if (metrics->submitted) {
+            metrics->submitted->Increment();
+        }
+        if (metrics->queue_depth) {
+            metrics->queue_depth->Set(cls.queued.load());
+        }
+    }
+    Wake(task_class);
+}
+
+bool
+TaskScheduler::Push(Worker* worker,
+                    int task_class,
+                    ScheduledTask& task,
+                    bool force) {
+    std::lock_guard<std::mutex> lock(worker->mutex);
+    if (!worker->active && !force) {
+        return false;
+    }
+    worker->rings[task_class].push(std::move(task));
+    classes_[task_class].queued.fetch_add(1);
+    return true;
+}
+
+void
+TaskScheduler::Wake(int task_class) {
+    auto can_spawn = [this, task_class]() {
+        auto total = TotalMaxThreads();
+        auto live = live_.load();
+        if (live < total) {
+            return true;
+        }
+        // the class is under its own share, but the workers are taken by
+        // classes borrowing it
+        auto& cls = classes_[task_class];
+        return cls.running.load() < cls.max_threads.load() &&
+               live < 2 * total;
+    };
+
+    // pairs with the idle_ increment and the queued check in Park()
+    if (idle_.load() > 0) {
+        std::lock_guard<std::mutex> lock(park_mutex_);
+        park_cv_.notify_one();
+        return;
+    }
+    if (!can_spawn()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(registry_mutex_);
+    if (idle_.load() == 0 && can_spawn()) {
+        SpawnWorkerLocked();
+    }
+}
+
+TaskScheduler::Worker*
+TaskScheduler::SpawnWorkerLocked() {
+    if (shutdown_.load()) {
+        return nullptr;
+    }
+    Worker* worker = nullptr;
+    for (auto& slot : worker_storage_) {
+        std::lock_guard<std::mutex> lock(slot->mutex);
+        if (!slot->active) {
+            worker = slot.get();
+            break;
+        }
+    }
+    if (worker == nullptr) {
+        worker_storage_.push_back(
+            std::make_unique<Worker>(num_classes_, worker_storage_.size()));
+        worker = worker_storage_.back().get();
+        auto list = std::make_unique<WorkerList>();
+        for (auto& slot : worker_storage_) {
+            list->workers.push_back(slot.get());
+        }
+        // readers may still hold the old list, keep it until destruction
+        worker_list_.store(list.get(), std::memory_order_release);
+        worker_lists_.push_back(std::move(list));
+    }
+    // the previous worker of a slot has retired, it only has to exit
+    if (worker->thread.joinable()) {
+        worker->thread.join();
+    }
+
+    auto deactivate = [this, worker]() {
+        std::lock_guard<std::mutex> lock(worker->mutex);
+        worker->active = false;
+        live_.fetch_sub(1);
+    };
+    try {
+        if (worker_spawn_hook_for_test_) {
+            worker_spawn_hook_for_test_();
+        }
+        {
+            std::lock_guard<std::mutex> lock(worker->mutex);
+            worker->active = true;
+            live_.fetch_add(1);
+        }
+        try {
+            worker->thread =
+                std::thread(&TaskScheduler::WorkerLoop, this, worker);
+        } catch (...) {
+            deactivate();
+            throw;
+        }
+    } catch (const std::exception& e) {
+        LOG_WARN("Failed to expand task scheduler {}: {}", name_, e.what());
+        return nullptr;
+    } catch (...) {
+        LOG_WARN("Failed to expand task scheduler {}", name_);
+        return nullptr;
+    }
+    return worker;
+}
+
+void
+TaskScheduler::WorkerLoop(Worker* self) {
+    SetThreadName(name_);
+    current_scheduler_ = this;
+    current_worker_ = self;
+    ScheduledTask task;
+    int task_class = 0;
+    while (!shutdown_.load()) {
+        if (Take(self, task, task_class)) {
+            // hand the rest of the queued work to another worker before
+            // running this task
+            auto next_class = RunnableClass();
+            if (next_class >= 0) {
+                Wake(next_class);
+            }
+            Run(task, task_class);
+            continue;
+        }
+        if (!Park(self)) {
+            break;
+        }
+    }
+    current_worker_ = nullptr;
+    current_scheduler_ = nullptr;
+}
+
+bool
+TaskScheduler::Take(Worker* self, ScheduledTask& task, int& task_class) {
+    auto lowest_first = self->picks % kFairnessPeriod == kFairnessPeriod - 1;
+    for (int i = 0; i < num_classes_; i++) {
+        auto c = lowest_first ? num_classes_ - 1 - i : i;
+        if (classes_[c].queued.load() == 0 || !ClaimRunning(c)) {
+            continue;
+        }
+        if (Pop(self, c, task) || Steal(self, c, task)) {
+            self->picks++;
+            task_class = c;
+            return true;
+        }
+        ReleaseRunning(c);
+    }
+    return false;
+}
+
+bool
+TaskScheduler::Pop(Worker* worker, int task_class, ScheduledTask& task) {
+    std::lock_guard<std::mutex> lock(worker->mutex);
+    if (!worker->rings[task_class].pop(task)) {
+        return false;
+    }
+    classes_[task_class].queued.fetch_sub(1);
+    return true;
+}
+
+bool
+TaskScheduler::Steal(Worker* self, int task_class, ScheduledTask& task) {
+    auto* list = worker_list_.load(std::memory_order_acquire);
+    auto num_workers = list->workers.size();
+    for (size_t i = 1; i < num_workers; i++) {
+        auto* victim = list->workers[(self->index + i) % num_workers];
+        if (Pop(victim, task_class, task)) {
+            classes_[task_class].stolen.fetch_add(1);
+            auto* metrics =
+                classes_[task_class].metrics.load(std::memory_order_acquire);
+            if (metrics != nullptr && metrics->stolen) {
+                metrics->stolen->Increment();
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+void
+TaskScheduler::Run(ScheduledTask& task, int task_class) {
+    auto* metrics =
+        classes_[task_class].metrics.load(std::memory_order_acquire);
+    auto execute_start = std::chrono::steady_clock::now();
+    if (metrics != nullptr && metrics->queue_duration) {
+        metrics->queue_duration->Observe(
+            std::chrono::duration<double>(execute_start - task.enqueue_time)
+                .count());
+    }
+    UpdateGauges(task_class);
+    try {
+        task.fn();
+    } catch (const std::exception& e) {
+        LOG_WARN("Task of {} failed: {}", name_, e.what());
+    } catch (...) {
+        LOG_WARN("Task of {} failed", name_);
+    }
+    // release what the task holds before it counts as completed
+    task.fn = SmallTask();
+    ReleaseRunning(task_class);
+    if (metrics != nullptr) {
+        if (metrics->execute_duration) {
+            metrics->execute_duration->Observe(
+                std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                              execute_start)
+                    .count());
+        }
+        if (metrics->completed) {
+            metrics->completed->Increment();
+        }
+    }
+    UpdateGauges(task_class);
+}
+
+bool
+TaskScheduler::CanClaim(int task_class, int running) const {
+    if (running < classes_[task_class].max_threads.load()) {
+        return true;
+    }
+    int class_running = running;
+    int limit = classes_[task_class].max_threads.load();
+    for (int c = task_class + 1; c < num_classes_; c++) {
+        class_running += classes_[c].running.load();
+        limit += classes_[c].max_threads.load();
+    }
+    return class_running < limit;
+}
+
+bool
+TaskScheduler::ClaimRunning(int task_class) {
+    auto& running = classes_[task_class].running;
+    auto current = running.load();
+    // exact within the class; borrowing reads the lower classes without
+    // locking, so concurrent claims may overshoot a borrowed share briefly
+    do {
+        if (!CanClaim(task_class, current)) {
+            return false;
+        }
+    } while (!running.compare_exchange_weak(current, current + 1));
+    return true;
+}
+
+void
+TaskScheduler::ReleaseRunning(int task_class) {
+    classes_[task_class].running.fetch_sub(1);
+}
+
+int
+TaskScheduler::RunnableClass() const {
+    for (int c = 0; c < num_classes_; c++) {
+        if (classes_[c].queued.load() > 0 &&
+            CanClaim(c, classes_[c].running.load())) {
+            return c;
+        }
+    }
+    return -1;
+}
+
+bool
+TaskScheduler::Park(Worker* self) {
+    std::unique_lock<std::mutex> lock(park_mutex_);
+    idle_.fetch_add(1);
+    UpdateIdleGauges();
+    auto woken = park_cv_.wait_for(lock, kIdleTimeout, [this]() {
+        return shutdown_.load() || RunnableClass() >= 0;
+    });
+    auto retired = !woken && TryRetireLocked(self);
+    idle_.fetch_sub(1);
+    UpdateIdleGauges();
+    return !retired && !shutdown_.load();
+}
+
+bool
+TaskScheduler::TryRetireLocked(Worker* self) {
+    std::lock_guard<std::mutex> lock(self->mutex);
+    for (auto& ring : self->rings) {
+        if (!ring.empty()) {
+            return false;
+        }
+    }
+    auto live = live_.load();
+    do {
+        if (live <= min_threads_) {
+            return false;
+        }
+    } while (!live_.compare_exchange_weak(live, live - 1));
+    // no task is pushed to an inactive worker, it exits with empty queues
+    self->active = false;
+    return true;
+}
+
+int
+TaskScheduler::GetMaxThreads(int task_class) const {
+    return classes_[task_class].max_threads.load();
+}
+
+int
+TaskScheduler::GetClassLimit(int task_class) const {
+    int limit = 0;
+    for (int c = task_class; c < num_classes_; c++) {
+        limit += classes_[c].max_threads.load();
+    }
+    return limit;
+}
+
+int
+TaskScheduler::TotalMaxThreads() const {
+    return GetClassLimit(0);
+}
+
+void
+TaskScheduler::Resize(int task_class, int max_threads) {
+    classes_[task_class].max_threads.store(std::max(1, max_threads));
+    UpdateGauges(task_class);
+    if (classes_[task_class].queued.load() > 0) {
+        Wake(task_class);
+    }
+}
+
+int
+TaskScheduler::GetRunning(int task_class) const {
+    return classes_[task_class].running.load();
+}
+
+int64_t
+TaskScheduler::GetStolen(int task_class) const {
+    return classes_[task_class].stolen.load();
+}
+
+void
+TaskScheduler::SetMetrics(int task_class, const Metrics& metrics) {
+    {
+        std::lock_guard<std::mutex> lock(registry_mutex_);
+        metrics_storage_.push_back(std::make_unique<Metrics>(metrics));
+        classes_[task_class].metrics.store(metrics_storage_.back().get(),
+                                           std::memory_order_release);
+    }
+    UpdateGauges(task_class);
+    UpdateIdleGauges();
+}
+
+void
+TaskScheduler::UpdateGauges(int task_class) const {
+    auto& cls = classes_[task_class];
+    auto* metrics = cls.metrics.load(std::memory_order_acquire);
+    if (metrics == nullptr) {
+        return;
+    }
+    if (metrics->capacity) {
+        metrics->capacity->Set(cls.max_threads.load());
+    }
+    if (metrics->active) {
+        metrics->active->Set(cls.running.load());
+    }
+    if (metrics->queue_depth) {
+        metrics->queue_depth->Set(cls.queued.load());
+    }
+}
+
+void
+TaskScheduler::UpdateIdleGauges() const {
+    for (int c = 0; c < num_classes_; c++) {
+        auto* metrics = classes_[c].metrics.load(std::memory_order_acquire);
+        if (metrics != nullptr && metrics->idle) {
+            metrics->idle->Set(idle_.load());
+        }
+    }
+}
+
+}  // namespace milvus
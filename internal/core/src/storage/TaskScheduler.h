@@ -0,0 +1,415 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <prometheus/counter.h>
+#include <prometheus/gauge.h>
+#include <prometheus/histogram.h>
+
+namespace milvus {
+
+// Move-only void() callable. Callables of up to kInlineSize bytes that move
+// without throwing are stored in place, so wrapping a task allocates nothing.
+class SmallTask {
+ public:
+    static constexpr size_t kInlineSize = 96;
+
+    template <typename F>
+    static constexpr bool kStoredInline =
+        sizeof(F) <= kInlineSize && alignof(F) <= alignof(std::max_align_t) &&
+        std::is_nothrow_move_constructible_v<F>;
+
+    SmallTask() = default;
+
+    template <typename F,
+              typename Fn = std::decay_t<F>,
+              typename = std::enable_if_t<!std::is_same_v<Fn, SmallTask>>>
+    SmallTask(F&& f) {  // NOLINT(google-explicit-constructor)
+        if constexpr (kStoredInline<Fn>) {
+            new (storage_) Fn(std::forward<F>(f));
+            ops_ = &kInlineOps<Fn>;
+        } else {
+            new (storage_) Fn*(new Fn(std::forward<F>(f)));
+            ops_ = &kHeapOps<Fn>;
+        }
+    }
+
+    SmallTask(SmallTask&& other) noexcept {
+        MoveFrom(other);
+    }
+
+    SmallTask&
+    operator=(SmallTask&& other) noexcept {
+        if (this != &other) {
+            Reset();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    SmallTask(const SmallTask&) = delete;
+    SmallTask&
+    operator=(const SmallTask&) = delete;
+
+    ~SmallTask() {
+        Reset();
+    }
+
+    explicit operator bool() const {
+        return ops_ != nullptr;
+    }
+
+    bool
+    stored_inline() const {
+        return ops_ != nullptr && ops_->stored_inline;
+    }
+
+    void
+    operator()() {
+        ops_->invoke(storage_);
+    }
+
+ private:
+    struct Ops {
+        void (*invoke)(void* storage);
+        // move the callable from `src` to `dst` and destroy it in `src`
+        void (*relocate)(void* dst, void* src) noexcept;
+        void (*destroy)(void* storage) noexcept;
+        bool stored_inline;
+    };
+
+    template <typename Fn>
+    static Fn*
+    Inline(void* storage) {
+        return std::launder(reinterpret_cast<Fn*>(storage));
+    }
+
+    template <typename Fn>
+    static Fn*&
+    Heap(void* storage) {
+        return *std::launder(reinterpret_cast<Fn**>(storage));
+    }
+
+    template <typename Fn>
+    static constexpr Ops kInlineOps = {
+        [](void* s) { (*Inline<Fn>(s))(); },
+        [](void* dst, void* src) noexcept {
+            new (dst) Fn(std::move(*Inline<Fn>(src)));
+            Inline<Fn>(src)->~Fn();
+        },
+        [](void* s) noexcept { Inline<Fn>(s)->~Fn(); },
+        true};
+
+    template <typename Fn>
+    static constexpr Ops kHeapOps = {
+        [](void* s) { (*Heap<Fn>(s))(); },
+        [](void* dst, void* src) noexcept { new (dst) Fn*(Heap<Fn>(src)); },
+        [](void* s) noexcept { delete Heap<Fn>(s); },
+        false};
+
+    void
+    MoveFrom(SmallTask& other) noexcept {
+        if (other.ops_ != nullptr) {
+            other.ops_->relocate(storage_, other.storage_);
+            ops_ = other.ops_;
+            other.ops_ = nullptr;
+        }
+    }
+
+    void
+    Reset() noexcept {
+        if (ops_ != nullptr) {
+            ops_->destroy(storage_);
+            ops_ = nullptr;
+        }
+    }
+
+    alignas(std::max_align_t) unsigned char storage_[kInlineSize];
+    const Ops* ops_ = nullptr;
+};
+
+// Work-stealing scheduler with priority classes.
+//
+// Class 0 has the highest priority. Every class has its own share of the
+// workers and may borrow the unused shares of the classes below it: a class
+// and the classes below it together run at most as many tasks as their shares
+// add up to, so an idle LOW share helps a saturated HIGH class while LOW never
+// goes beyond its own share. A class under its own share may always run, on a
+// worker started beyond the shares if need be, so a task waiting on a task of
+// a lower class can't deadlock after its class borrowed every worker.
+//
+// Every worker owns a queue per class. A task submitted from a worker goes to
+// the worker's own queue, other tasks are spread over the workers round robin.
+// A worker takes from its own queues first and steals from the others when
+// they are empty, highest class first; every kFairnessPeriod-th pick goes
+// lowest class first, so a busy high class can't starve the lower ones.
+// Queues are FIFO rings that only grow, so a warmed up scheduler queues tasks
+// without allocating.
+//
+// Workers are started on demand and stop after kIdleTimeout without work,
+// keeping at least one.
+class TaskScheduler {
+ public:
+    struct Metrics {
+        prometheus::Gauge* capacity{nullptr};
+        prometheus::Gauge* active{nullptr};
+        prometheus::Gauge* idle{nullptr};
+        prometheus::Gauge* queue_depth{nullptr};
+        prometheus::Counter* submitted{nullptr};
+        prometheus::Counter* completed{nullptr};
+        prometheus::Counter* stolen{nullptr};
+        prometheus::Histogram* queue_duration{nullptr};
+        prometheus::Histogram* execute_duration{nullptr};
+    };
+
+    static constexpr auto kIdleTimeout = std::chrono::seconds(2);
+    static constexpr uint64_t kFairnessPeriod = 16;
+
+    TaskScheduler(std::string name, const std::vector<int>& class_max_threads);
+
+    ~TaskScheduler();
+
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler&
+    operator=(const TaskScheduler&) = delete;
+
+    // Stop the workers. Tasks still queued are dropped, which breaks the
+    // promises of their futures.
+    void
+    ShutDown();
+
+    template <typename F, typename... Args>
+    auto
+    Submit(int task_class, F&& f, Args&&... args)
+        -> std::future<decltype(f(args...))> {
+        using R = decltype(f(args...));
+        std::promise<R> promise;
+        auto future = promise.get_future();
+        Schedule(task_class,
+                 [promise = std::move(promise),
+                  f = std::forward<F>(f),
+                  ... args = std::forward<Args>(args)]() mutable {
+                     try {
+                         if constexpr (std::is_void_v<R>) {
+                             f(args...);
+                             promise.set_value();
+                         } else {
+                             promise.set_value(f(args...));
+                         }
+                     } catch (...) {
+                         promise.set_exception(std::current_exception());
+                     }
+                 });
+        return future;
+    }
+
+    void
+    Schedule(int task_class, SmallTask task);
+
+    int
+    num_classes() const {
+        return num_classes_;
+    }
+
+    // Own share of the class.
+    int
+    GetMaxThreads(int task_class) const;
+
+    // Shares of the class and of the classes below it.
+    int
+    GetClassLimit(int task_class) const;
+
+    void
+    Resize(int task_class, int max_threads);
+
+    // Live workers.
+    int
+    GetThreadNum() const {
+        return live_.load();
+    }
+
+    int
+    GetRunning(int task_class) const;
+
+    int64_t
+    GetStolen(int task_class) const;
+
+    void
+    SetMetrics(int task_class, const Metrics& metrics);
+
+ private:
+    friend class ThreadPool;
+    friend class TaskSchedulerTest;
+
+    struct ScheduledTask {
+        SmallTask fn;
+        std::chrono::steady_clock::time_point enqueue_time;
+    };
+
+    // FIFO ring, grown by doubling and never shrunk.
+    class TaskRing {
+     public:
+        bool
+        empty() const {
+            return size_ == 0;
+        }
+
+        void
+        push(ScheduledTask&& task);
+
+        bool
+        pop(ScheduledTask& task);
+
+     private:
+        std::vector<ScheduledTask> buf_;
+        size_t head_ = 0;
+        size_t size_ = 0;
+    };
+
+    struct Worker {
+        explicit Worker(int num_classes, size_t index)
+            : rings(num_classes), index(index) {
+        }
+
+        std::mutex mutex;
+        // guarded by mutex
+        std::vector<TaskRing> rings;
+        // guarded by mutex, a retired worker takes no tasks
+        bool active = false;
+        // guarded by registry_mutex_
+        std::thread thread;
+        // picks since the last lowest class first pick, owner only
+        uint64_t picks = 0;
+        const size_t index;
+    };
+
+    // Immutable snapshot of the worker slots, replaced when growing.
+    struct WorkerList {
+        std::vector<Worker*> workers;
+    };
+
+    struct ClassState {
+        std::atomic<int> max_threads{1};
+        std::atomic<int> running{0};
+        std::atomic<int64_t> queued{0};
+        std::atomic<int64_t> stolen{0};
+        std::atomic<const Metrics*> metrics{nullptr};
+    };
+
+    void
+    WorkerLoop(Worker* self);
+
+    bool
+    Take(Worker* self, ScheduledTask& task, int& task_class);
+
+    bool
+    Pop(Worker* worker, int task_class, ScheduledTask& task);
+
+    bool
+    Steal(Worker* self, int task_class, ScheduledTask& task);
+
+    void
+    Run(ScheduledTask& task, int task_class);
+
+    // Whether the class may start another task while `running` of its tasks
+    // run.
+    bool
+    CanClaim(int task_class, int running) const;
+
+    bool
+    ClaimRunning(int task_class);
+
+    void
+    ReleaseRunning(int task_class);
+
+    // Highest class with a queued task that may start, or -1.
+    int
+    RunnableClass() const;
+
+    // Wait for a task this worker may run. Returns false when the worker
+    // retired instead.
+    bool
+    Park(Worker* self);
+
+    // Requires park_mutex_.
+    bool
+    TryRetireLocked(Worker* self);
+
+    void
+    Wake(int task_class);
+
+    // Requires registry_mutex_. Returns nullptr when no thread could be
+    // started.
+    Worker*
+    SpawnWorkerLocked();
+
+    bool
+    Push(Worker* worker, int task_class, ScheduledTask& task, bool force);
+
+    int
+    TotalMaxThreads() const;
+
+    void
+    UpdateGauges(int task_class) const;
+
+    void
+    UpdateIdleGauges() const;
+
+    const std::string name_;
+    const int num_classes_;
+    const int min_threads_ = 1;
+    std::unique_ptr<ClassState[]> classes_;
+
+    std::atomic<bool> shutdown_{false};
+    std::atomic<int> live_{0};
+    // modified under park_mutex_
+    std::atomic<int> idle_{0};
+    std::atomic<size_t> next_worker_{0};
+    std::atomic<const WorkerList*> worker_list_{nullptr};
+
+    std::mutex park_mutex_;
+    std::condition_variable park_cv_;
+
+    std::mutex registry_mutex_;
+    std::vector<std::unique_ptr<Worker>> worker_storage_;
+    std::vector<std::unique_ptr<WorkerList>> worker_lists_;
+    std::vector<std::unique_ptr<Metrics>> metrics_storage_;
+    // Deterministic test seam for worker-spawn failure coverage.
+    std::function<void()> worker_spawn_hook_for_test_;
+
+    static thread_local TaskScheduler* current_scheduler_;
+    static thread_local Worker* current_worker_;
+};
+
+}  // namespace milvus
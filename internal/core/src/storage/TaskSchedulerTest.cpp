@@ -0,0 +1,260 @@
+// Licensed to the LF AI & Data foundation under one
+// or more contributor license agreements. See the NOTICE file
+// distributed with this work for additional information
+// regarding copyright ownership. The ASF licenses this file
+// to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance
+// with the License. You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "storage/TaskScheduler.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+namespace milvus {
+
+namespace {
+
+constexpr int kHigh = 0;
+constexpr int kLow = 1;
+
+bool
+WaitFor(const std::function<bool()>& condition) {
+    auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!condition()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+// Records the order tasks run in.
+class RunOrder {
+ public:
+    std::function<void()>
+    Task(std::string name) {
+        return [this, name = std::move(name)]() {
+            std::lock_guard<std::mutex> lock(mutex_);
+            order_.push_back(name);
+        };
+    }
+
+    std::vector<std::string>
+    order() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return order_;
+    }
+
+ private:
+    std::mutex mutex_;
+    std::vector<std::string> order_;
+};
+
+}  // namespace
+
+class TaskSchedulerTest : public testing::Test {
+ protected:
+    // Keep the scheduler at the worker it starts with.
+    static void
+    FailWorkerSpawn(TaskScheduler& scheduler) {
+        scheduler.worker_spawn_hook_for_test_ = []() {
+            throw std::system_error(std::make_error_code(
+                std::errc::resource_unavailable_try_again));
+        };
+    }
+
+    static bool
+    IsShutDown(TaskScheduler& scheduler) {
+        return scheduler.shutdown_.load();
+    }
+
+    // Occupy a worker with a task of `task_class` until `release` is set.
+    static std::future<void>
+    Block(TaskScheduler& scheduler,
+          int task_class,
+          std::shared_future<void> release) {
+        auto started = std::make_shared<std::promise<void>>();
+        auto running = started->get_future();
+        auto blocker =
+            scheduler.Submit(task_class, [started, release]() {
+                started->set_value();
+                release.wait();
+            });
+        EXPECT_EQ(running.wait_for(std::chrono::seconds(5)),
+                  std::future_status::ready);
+        return blocker;
+    }
+};
+
+TEST(SmallTask, StoresSmallCallablesInline) {
+    int runs = 0;
+    SmallTask small([&runs]() { runs++; });
+    EXPECT_TRUE(small.stored_inline());
+
+    std::array<char, 2 * SmallTask::kInlineSize> payload{};
+    payload[0] = 1;
+    SmallTask large([&runs, payload]() { runs += payload[0]; });
+    EXPECT_FALSE(large.stored_inline());
+
+    auto owned = std::make_unique<int>(10);
+    SmallTask move_only(
+        [&runs, owned = std::move(owned)]() { runs += *owned; });
+    EXPECT_TRUE(move_only.stored_inline());
+
+    auto moved = std::move(small);
+    EXPECT_FALSE(small);
+    moved();
+    large();
+    auto moved_large = std::move(large);
+    moved_large();
+    move_only();
+    EXPECT_EQ(runs, 13);
+}
+
+TEST_F(TaskSchedulerTest, SubmitReturnsResultOrException) {
+    TaskScheduler scheduler("test_scheduler", {2});
+    auto sum = scheduler.Submit(
+        0, [](int a, const std::string& b) { return a + b.size(); }, 1, "ab");
+    EXPECT_EQ(sum.get(), 3u);
+
+    auto failed =
+        scheduler.Submit(0, []() { throw std::runtime_error("failed"); });
+    EXPECT_THROW(failed.get(), std::runtime_error);
+}
+
+TEST_F(TaskSchedulerTest, HigherClassRunsFirst) {
+    TaskScheduler scheduler("test_scheduler", {1, 1});
+    FailWorkerSpawn(scheduler);
+    std::promise<void> release;
+    auto blocker = Block(scheduler, kLow, release.get_future().share());
+
+    RunOrder run_order;
+    std::vector<std::future<void>> futures;
+    futures.push_back(scheduler.Submit(kLow, run_order.Task("low_1")));
+    futures.push_back(scheduler.Submit(kLow, run_order.Task("low_2")));
+    futures.push_back(scheduler.Submit(kHigh, run_order.Task("high_1")));
+    futures.push_back(scheduler.Submit(kHigh, run_order.Task("high_2")));
+    release.set_value();
+    blocker.get();
+    for (auto& future : futures) {
+        future.get();
+    }
+    EXPECT_EQ(run_order.order(),
+              (std::vector<std::string>{"high_1", "high_2", "low_1", "low_2"}));
+}
+
+TEST_F(TaskSchedulerTest, LowerClassIsNotStarved) {
+    TaskScheduler scheduler("test_scheduler", {1, 1});
+    FailWorkerSpawn(scheduler);
+    std::promise<void> release;
+    auto blocker = Block(scheduler, kHigh, release.get_future().share());
+
+    RunOrder run_order;
+    std::vector<std::future<void>> futures;
+    const int num_high = 4 * TaskScheduler::kFairnessPeriod;
+    for (int i = 0; i < num_high; i++) {
+        futures.push_back(scheduler.Submit(kHigh, run_order.Task("high")));
+    }
+    futures.push_back(scheduler.Submit(kLow, run_order.Task("low")));
+    release.set_value();
+    blocker.get();
+    for (auto& future : futures) {
+        future.get();
+    }
+
+    auto order = run_order.order();
+    auto low = std::find(order.begin(), order.end(), "low") - order.begin();
+    EXPECT_LT(low, TaskScheduler::kFairnessPeriod);
+}
+
+TEST_F(TaskSchedulerTest, HighBorrowsIdleSharesLowKeepsItsOwn) {
+    TaskScheduler scheduler("test_scheduler", {2, 1});
+    EXPECT_EQ(scheduler.GetClassLimit(kHigh), 3);
+    EXPECT_EQ(scheduler.GetClassLimit(kLow), 1);
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    std::vector<std::future<void>> futures;
+
+    // the idle LOW share runs a third HIGH task
+    for (int i = 0; i < 4; i++) {
+        futures.push_back(
+            scheduler.Submit(kHigh, [released]() { released.wait(); }));
+    }
+    EXPECT_TRUE(WaitFor([&]() { return scheduler.GetRunning(kHigh) == 3; }));
+
+    // LOW gets its share back from the borrowing HIGH tasks, but not more
+    for (int i = 0; i < 3; i++) {
+        futures.push_back(
+            scheduler.Submit(kLow, [released]() { released.wait(); }));
+    }
+    EXPECT_TRUE(WaitFor([&]() { return scheduler.GetRunning(kLow) == 1; }));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(scheduler.GetRunning(kHigh), 3);
+    EXPECT_EQ(scheduler.GetRunning(kLow), 1);
+
+    release.set_value();
+    for (auto& future : futures) {
+        future.get();
+    }
+}
+
+TEST_F(TaskSchedulerTest, IdleWorkersStealQueuedTasks) {
+    TaskScheduler scheduler("test_scheduler", {4});
+    // the subtasks go to the queue of the worker running the parent, which
+    // waits for them, so the other workers have to steal every one
+    auto parent = scheduler.Submit(0, [&scheduler]() {
+        std::vector<std::future<int>> subtasks;
+        for (int i = 0; i < 3; i++) {
+            subtasks.push_back(scheduler.Submit(0, [i]() { return i; }));
+        }
+        int sum = 0;
+        for (auto& subtask : subtasks) {
+            sum += subtask.get();
+        }
+        return sum;
+    });
+    EXPECT_EQ(parent.get(), 3);
+    EXPECT_GE(scheduler.GetStolen(0), 3);
+}
+
+TEST_F(TaskSchedulerTest, QueuedTasksAreDroppedOnShutDown) {
+    auto scheduler =
+        std::make_unique<TaskScheduler>("test_scheduler", std::vector<int>{1});
+    FailWorkerSpawn(*scheduler);
+    std::promise<void> release;
+    auto blocker = Block(*scheduler, 0, release.get_future().share());
+    auto queued = scheduler->Submit(0, []() {});
+
+    std::thread shut_down([&scheduler]() { scheduler->ShutDown(); });
+    EXPECT_TRUE(WaitFor([&]() { return IsShutDown(*scheduler); }));
+    release.set_value();
+    shut_down.join();
+    blocker.get();
+    scheduler.reset();
+    EXPECT_THROW(queued.get(), std::future_error);
+}
+
+}  // namespace milvus
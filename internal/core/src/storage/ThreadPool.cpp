@@ -19,7 +19,6 @@
 #include <chrono>
 
 #include "log/Log.h"
-#include "storage/SafeQueue.h"
 
 namespace milvus {
 
@@ -66,111 +65,26 @@ SetThreadPoolMaxThreadsSize(const int size) {
     LOG_INFO("set thread pool max threads size: {}", size);
 }
 
-void
-ThreadPool::Init() {
-    std::lock_guard<std::mutex> lock(mutex_);
-    for (int i = 0; i < min_threads_size_; i++) {
-        threads_.emplace_back(&ThreadPool::Worker, this);
-        current_threads_size_++;
-    }
+ThreadPool::ThreadPool(const float thread_core_coefficient, std::string name)
+    : ThreadPool(std::make_shared<TaskScheduler>(
+                     name,
+                     std::vector<int>{
+                         ComputeThreadPoolMaxThreads(thread_core_coefficient)}),
+                 0,
+                 name) {
 }
 
-void
-ThreadPool::ShutDown() {
-    LOG_INFO("Start shutting down {}", name_);
-    {
-        std::lock_guard<std::mutex> lock(mutex_);
-        shutdown_ = true;
-    }
-    condition_lock_.notify_all();
-    for (auto& thread : threads_) {
-        if (thread.joinable()) {
-            thread.join();
-        }
-    }
-    LOG_INFO("Finish shutting down {}", name_);
+ThreadPool::ThreadPool(std::shared_ptr<TaskScheduler> scheduler,
+                       int task_class,
+                       std::string name)
+    : scheduler_(std::move(scheduler)),
+      task_class_(task_class),
+      name_(std::move(name)),
+      worker_spawn_hook_for_test_(scheduler_->worker_spawn_hook_for_test_) {
+    LOG_INFO("Init thread pool:{} on {} with max worker num:{}",
+             name_,
+             scheduler_->name_,
+             scheduler_->GetMaxThreads(task_class_));
 }
 
-void
-ThreadPool::FinishThreads() {
-    while (!need_finish_threads_.empty()) {
-        std::thread::id id;
-        auto dequeue = need_finish_threads_.dequeue(id);
-        if (dequeue) {
-            auto iter = std::find_if(
-                threads_.begin(), threads_.end(), [id](const std::thread& t) {
-                    return t.get_id() == id;
-                });
-            assert(iter != threads_.end());
-            if (iter->joinable()) {
-                iter->join();
-            }
-            threads_.erase(iter);
-        }
-    }
-}
-
-void
-ThreadPool::Worker() {
-    std::function<void()> func;
-    bool dequeue;
-    SetThreadName(name_);
-    while (!shutdown_) {
-        std::unique_lock<std::mutex> lock(mutex_);
-        idle_threads_size_++;
-        if (metric_idle_) {
-            metric_idle_->Set(idle_threads_size_);
-        }
-        if (metric_active_) {
-            metric_active_->Set(current_threads_size_ - idle_threads_size_);
-        }
-        auto is_timeout = !condition_lock_.wait_for(
-            lock, std::chrono::seconds(WAIT_SECONDS), [this]() {
-                return shutdown_ || !work_queue_.empty();
-            });
-        idle_threads_size_--;
-        if (metric_idle_) {
-            metric_idle_->Set(idle_threads_size_);
-        }
-        if (metric_active_) {
-            metric_active_->Set(current_threads_size_ - idle_threads_size_);
-        }
-        if (work_queue_.empty()) {
-            // Dynamic reduce thread number
-            if (shutdown_) {
-                current_threads_size_--;
-                if (metric_active_) {
-                    metric_active_->Set(current_threads_size_ -
-                                        idle_threads_size_);
-                }
-                return;
-            }
-            if (is_timeout) {
-                FinishThreads();
-                if (current_threads_size_ > min_threads_size_) {
-                    need_finish_threads_.enqueue(std::this_thread::get_id());
-                    current_threads_size_--;
-                    if (metric_active_) {
-                        metric_active_->Set(current_threads_size_ -
-                                            idle_threads_size_);
-                    }
-                    return;
-                }
-                continue;
-            }
-        }
-        dequeue = work_queue_.dequeue(func);
-        if (metric_queue_depth_) {
-            metric_queue_depth_->Set(work_queue_.size());
-        }
-        lock.unlock();
-        if (dequeue) {
-            func();
-            func = nullptr;
-            if (metric_completed_) {
-                metric_completed_->Increment();
-            }
-        }
-    }
-}
 };  // namespace milvus
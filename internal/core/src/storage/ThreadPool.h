@@ -38,9 +38,9 @@
 #include <prometheus/gauge.h>
 #include <prometheus/histogram.h>
 
-#include "SafeQueue.h"
 #include "glog/logging.h"
 #include "log/Log.h"
+#include "storage/TaskScheduler.h"
 
 namespace milvus {
 
@@ -90,24 +90,15 @@ ComputeThreadPoolMaxThreads(float thread_core_coefficient) {
         static_cast<int>(std::round(CPU_NUM * thread_core_coefficient)));
 }
 
+// A priority class of a TaskScheduler. A pool constructed on its own has a
+// scheduler of its own, the pools of ThreadPools share one scheduler.
 class ThreadPool {
  public:
-    explicit ThreadPool(const float thread_core_coefficient, std::string name)
-        : shutdown_(false), name_(std::move(name)) {
-        idle_threads_size_ = 0;
-        current_threads_size_ = 0;
-        min_threads_size_ = 1;
-        max_threads_size_.store(
-            ComputeThreadPoolMaxThreads(thread_core_coefficient));
-        LOG_INFO("Init thread pool:{}", name_)
-            << " with min worker num:" << min_threads_size_
-            << " and max worker num:" << max_threads_size_.load();
-        Init();
-    }
+    explicit ThreadPool(const float thread_core_coefficient, std::string name);
 
-    ~ThreadPool() {
-        ShutDown();
-    }
+    ThreadPool(std::shared_ptr<TaskScheduler> scheduler,
+               int task_class,
+               std::string name);
 
     ThreadPool(const ThreadPool&) = delete;
     ThreadPool(ThreadPool&&) = delete;
@@ -117,119 +108,32 @@ class ThreadPool {
     operator=(ThreadPool&&) = delete;
 
     void
-    Init();
-
-    void
-    ShutDown();
+    ShutDown() {
+        scheduler_->ShutDown();
+    }
 
+    // Workers able to run tasks of this pool.
     size_t
     GetThreadNum() {
-        std::lock_guard<std::mutex> lock(mutex_);
-        return current_threads_size_;
+        return std::min(scheduler_->GetThreadNum(),
+                        scheduler_->GetClassLimit(task_class_));
     }
 
     size_t
     GetMaxThreadNum() {
-        return max_threads_size_.load();
+        return scheduler_->GetMaxThreads(task_class_);
     }
 
     template <typename F, typename... Args>
     auto
     Submit(F&& f, Args&&... args) -> std::future<decltype(f(args...))> {
-        std::function<decltype(f(args...))()> func =
-            std::bind(std::forward<F>(f), std::forward<Args>(args)...);
-        auto task_ptr =
-            std::make_shared<std::packaged_task<decltype(f(args...))()>>(func);
-
-        auto enqueue_time = std::chrono::steady_clock::now();
-        auto* queue_metric = metric_queue_duration_;
-        auto* execute_metric = metric_execute_duration_;
-        std::function<void()> wrap_func = [task_ptr,
-                                           enqueue_time,
-                                           queue_metric,
-                                           execute_metric]() {
-            auto execute_start = std::chrono::steady_clock::now();
-            if (queue_metric) {
-                queue_metric->Observe(
-                    std::chrono::duration<double>(execute_start - enqueue_time)
-                        .count());
-            }
-            auto observe_execute = [&]() {
-                if (execute_metric) {
-                    execute_metric->Observe(
-                        std::chrono::duration<double>(
-                            std::chrono::steady_clock::now() - execute_start)
-                            .count());
-                }
-            };
-            try {
-                (*task_ptr)();
-            } catch (...) {
-                observe_execute();
-                throw;
-            }
-            observe_execute();
-        };
-
-        auto future = task_ptr->get_future();
-
-        std::unique_lock<std::mutex> lock(mutex_);
-        work_queue_.enqueue(std::move(wrap_func));
-
-        if (idle_threads_size_ > 0) {
-            condition_lock_.notify_one();
-        }
-        if (work_queue_.size() > static_cast<size_t>(idle_threads_size_) &&
-            current_threads_size_ < max_threads_size_.load()) {
-            // Dynamic increase thread number
-            try {
-                if (worker_spawn_hook_for_test_) {
-                    worker_spawn_hook_for_test_();
-                }
-                threads_.emplace_back(&ThreadPool::Worker, this);
-                current_threads_size_++;
-            } catch (const std::exception& e) {
-                LOG_WARN(
-                    "Failed to expand thread pool {}: {}", name_, e.what());
-            } catch (...) {
-                LOG_WARN("Failed to expand thread pool {}", name_);
-            }
-        }
-        lock.unlock();
-
-        try {
-            if (metric_submitted_) {
-                metric_submitted_->Increment();
-            }
-            if (metric_queue_depth_) {
-                metric_queue_depth_->Set(work_queue_.size());
-            }
-        } catch (const std::exception& e) {
-            LOG_WARN("Failed to update thread pool {} submit metrics: {}",
-                     name_,
-                     e.what());
-        } catch (...) {
-            LOG_WARN("Failed to update thread pool {} submit metrics", name_);
-        }
-
-        return future;
+        return scheduler_->Submit(
+            task_class_, std::forward<F>(f), std::forward<Args>(args)...);
     }
 
-    void
-    Worker();
-
-    void
-    FinishThreads();
-
     void
     Resize(int new_size) {
-        //no need to hold mutex here as we don't require
-        //max_threads_size to take effect instantly, just guaranteed atomic
-        new_size = ClampThreadPoolMaxThreads(new_size);
-        max_threads_size_.store(new_size);
-        if (metric_capacity_) {
-            metric_capacity_->Set(new_size);
-        }
+        scheduler_->Resize(task_class_, ClampThreadPoolMaxThreads(new_size));
     }
 
     void
@@ -240,59 +144,30 @@ class ThreadPool {
                prometheus::Counter* submitted,
                prometheus::Counter* completed,
                prometheus::Histogram* queue_duration,
-               prometheus::Histogram* execute_duration) {
-        std::lock_guard<std::mutex> lock(mutex_);
-        metric_capacity_ = capacity;
-        metric_active_ = active;
-        metric_idle_ = idle;
-        metric_queue_depth_ = queue_depth;
-        metric_submitted_ = submitted;
-        metric_completed_ = completed;
-        metric_queue_duration_ = queue_duration;
-        metric_execute_duration_ = execute_duration;
-        if (metric_capacity_) {
-            metric_capacity_->Set(max_threads_size_.load());
-        }
-        if (metric_active_) {
-            metric_active_->Set(current_threads_size_ - idle_threads_size_);
-        }
-        if (metric_idle_) {
-            metric_idle_->Set(idle_threads_size_);
-        }
-        if (metric_queue_depth_) {
-            metric_queue_depth_->Set(work_queue_.size());
-        }
+               prometheus::Histogram* execute_duration,
+               prometheus::Counter* stolen = nullptr) {
+        TaskScheduler::Metrics metrics;
+        metrics.capacity = capacity;
+        metrics.active = active;
+        metrics.idle = idle;
+        metrics.queue_depth = queue_depth;
+        metrics.submitted = submitted;
+        metrics.completed = completed;
+        metrics.stolen = stolen;
+        metrics.queue_duration = queue_duration;
+        metrics.execute_duration = execute_duration;
+        scheduler_->SetMetrics(task_class_, metrics);
     }
 
- public:
-    int min_threads_size_;
-    int idle_threads_size_;
-    int current_threads_size_;
-    std::atomic<int> max_threads_size_;
-    bool shutdown_;
-    static constexpr size_t WAIT_SECONDS = 2;
-    SafeQueue<std::function<void()>> work_queue_;
-    std::list<std::thread> threads_;
-    SafeQueue<std::thread::id> need_finish_threads_;
-    std::mutex mutex_;
-    std::condition_variable condition_lock_;
-    std::string name_;
-
-    // Prometheus metrics (set via SetMetrics, nullptr if not wired)
-    prometheus::Gauge* metric_capacity_{nullptr};
-    prometheus::Gauge* metric_active_{nullptr};
-    prometheus::Gauge* metric_idle_{nullptr};
-    prometheus::Gauge* metric_queue_depth_{nullptr};
-    prometheus::Counter* metric_submitted_{nullptr};
-    prometheus::Counter* metric_completed_{nullptr};
-    prometheus::Histogram* metric_queue_duration_{nullptr};
-    prometheus::Histogram* metric_execute_duration_{nullptr};
-
  private:
     friend class ThreadPoolTest_WorkerSpawnFailureDoesNotFailQueuedTask_Test;
 
+    std::shared_ptr<TaskScheduler> scheduler_;
+    const int task_class_;
+    const std::string name_;
+
     // Deterministic test seam for worker-spawn failure coverage.
-    std::function<void()> worker_spawn_hook_for_test_;
+    std::function<void()>& worker_spawn_hook_for_test_;
 };
 
 }  // namespace milvus
@@ -52,8 +52,18 @@ UpdateLoadOverheadControllers(int64_t executor_workers) {
     return memory_updated && file_updated;
 }
 
+// Most HIGH and LOW load tasks that run at once. HIGH may borrow the shares
+// of MIDDLE and LOW, and LOW still runs its own share next to a borrowing
+// HIGH, so this is GetClassLimit(HIGH) + GetClassLimit(LOW) rather than the
+// two shares.
+int64_t
+LoadExecutorWorkers(int64_t high, int64_t middle, int64_t low) {
+    return high + middle + low + low;
+}
+
 }  // namespace
 
+std::shared_ptr<TaskScheduler> ThreadPools::scheduler_;
 std::map<ThreadPoolPriority, std::unique_ptr<ThreadPool>>
     ThreadPools::thread_pool_map;
 std::shared_mutex ThreadPools::mutex_;
@@ -76,21 +86,23 @@ ThreadPools::GetThreadPool(milvus::ThreadPoolPriority priority) {
     if (iter != thread_pool_map.end()) {
         return *(iter->second);
     } else {
-        float coefficient = 1.0;
-        switch (priority) {
-            case milvus::ThreadPoolPriority::HIGH:
-                coefficient = HIGH_PRIORITY_THREAD_CORE_COEFFICIENT.load();
-                break;
-            case milvus::ThreadPoolPriority::MIDDLE:
-                coefficient = MIDDLE_PRIORITY_THREAD_CORE_COEFFICIENT.load();
-                break;
-            default:
-                coefficient = LOW_PRIORITY_THREAD_CORE_COEFFICIENT.load();
-                break;
+        if (scheduler_ == nullptr) {
+            // one worker pool for every priority, indexed by the priority
+            scheduler_ = std::make_shared<TaskScheduler>(
+                "SEGC_POOL",
+                std::vector<int>{
+                    ComputeThreadPoolMaxThreads(
+                        HIGH_PRIORITY_THREAD_CORE_COEFFICIENT.load()),
+                    ComputeThreadPoolMaxThreads(
+                        MIDDLE_PRIORITY_THREAD_CORE_COEFFICIENT.load()),
+                    ComputeThreadPoolMaxThreads(
+                        LOW_PRIORITY_THREAD_CORE_COEFFICIENT.load())});
         }
         std::string name = name_map()[priority];
         auto result = thread_pool_map.emplace(
-            priority, std::make_unique<ThreadPool>(coefficient, name));
+            priority,
+            std::make_unique<ThreadPool>(
+                scheduler_, static_cast<int>(priority), name));
         auto& pool = *(result.first->second);
         switch (priority) {
             case HIGH:
@@ -103,7 +115,8 @@ ThreadPools::GetThreadPool(milvus::ThreadPoolPriority priority) {
                     &monitor::internal_storage_pool_task_completed_total_high,
                     &monitor::internal_storage_pool_queue_duration_seconds_high,
                     &monitor::
-                        internal_storage_pool_execute_duration_seconds_high);
+                        internal_storage_pool_execute_duration_seconds_high,
+                    &monitor::internal_storage_pool_task_stolen_total_high);
                 break;
             case MIDDLE:
                 pool.SetMetrics(
@@ -116,7 +129,8 @@ ThreadPools::GetThreadPool(milvus::ThreadPoolPriority priority) {
                     &monitor::
                         internal_storage_pool_queue_duration_seconds_middle,
                     &monitor::
-                        internal_storage_pool_execute_duration_seconds_middle);
+                        internal_storage_pool_execute_duration_seconds_middle,
+                    &monitor::internal_storage_pool_task_stolen_total_middle);
                 break;
             case LOW:
                 pool.SetMetrics(
@@ -128,7 +142,8 @@ ThreadPools::GetThreadPool(milvus::ThreadPoolPriority priority) {
                     &monitor::internal_storage_pool_task_completed_total_low,
                     &monitor::internal_storage_pool_queue_duration_seconds_low,
                     &monitor::
-                        internal_storage_pool_execute_duration_seconds_low);
+                        internal_storage_pool_execute_duration_seconds_low,
+                    &monitor::internal_storage_pool_task_stolen_total_low);
                 break;
         }
         return pool;
@@ -144,8 +159,6 @@ ThreadPools::ResizeThreadPool(milvus::ThreadPoolPriority priority,
         LOG_ERROR("Failed to resize threadPool, size:{}", size);
         return;
     }
-    auto is_load_pool = priority == ThreadPoolPriority::HIGH ||
-                        priority == ThreadPoolPriority::LOW;
     ThreadPool* pool = nullptr;
     {
         std::unique_lock<std::shared_mutex> lock(mutex_);
@@ -157,12 +170,16 @@ ThreadPools::ResizeThreadPool(milvus::ThreadPoolPriority priority,
         pool = iter->second.get();
     }
     size = ClampThreadPoolMaxThreads(size);
-    auto old_size = pool->GetMaxThreadNum();
-    auto old_load_workers =
-        is_load_pool ? GetLoadExecutorWorkers() : int64_t{0};
+    // HIGH borrows the MIDDLE share too, so every pool bounds the load tasks
+    auto old_load_workers = GetLoadExecutorWorkers();
+    auto share = [&](ThreadPoolPriority p) -> int64_t {
+        return p == priority ? size
+                             : scheduler_->GetMaxThreads(static_cast<int>(p));
+    };
     auto new_load_workers =
-        is_load_pool ? old_load_workers - static_cast<int64_t>(old_size) + size
-                     : old_load_workers;
+        LoadExecutorWorkers(share(ThreadPoolPriority::HIGH),
+                            share(ThreadPoolPriority::MIDDLE),
+                            share(ThreadPoolPriority::LOW));
     if (new_load_workers > old_load_workers &&
         !UpdateLoadOverheadControllers(new_load_workers)) {
         LOG_ERROR(
@@ -174,11 +191,9 @@ ThreadPools::ResizeThreadPool(milvus::ThreadPoolPriority priority,
     }
 
     pool->Resize(size);
-    if (is_load_pool) {
-        load_executor_workers_.store(new_load_workers);
-    }
+    load_executor_workers_.store(new_load_workers);
 
-    if (is_load_pool && new_load_workers <= old_load_workers &&
+    if (new_load_workers <= old_load_workers &&
         !UpdateLoadOverheadControllers(new_load_workers)) {
         LOG_ERROR(
             "Failed to update load overhead groups after resizing "
@@ -197,9 +212,11 @@ ThreadPools::GetLoadExecutorWorkers() {
     }
 
     auto& high = GetThreadPool(ThreadPoolPriority::HIGH);
+    auto& middle = GetThreadPool(ThreadPoolPriority::MIDDLE);
     auto& low = GetThreadPool(ThreadPoolPriority::LOW);
-    auto initial_workers = static_cast<int64_t>(high.GetMaxThreadNum()) +
-                           static_cast<int64_t>(low.GetMaxThreadNum());
+    auto initial_workers = LoadExecutorWorkers(high.GetMaxThreadNum(),
+                                               middle.GetMaxThreadNum(),
+                                               low.GetMaxThreadNum());
     if (load_executor_workers_.compare_exchange_strong(cached_workers,
                                                        initial_workers)) {
         return initial_workers;
@@ -78,6 +78,8 @@ class ThreadPools {
         return name_map;
     }
 
+    // shared by the pools, a priority is a task class of it
+    static std::shared_ptr<TaskScheduler> scheduler_;
     static std::map<ThreadPoolPriority, std::unique_ptr<ThreadPool>>
         thread_pool_map;
     static std::shared_mutex mutex_;
@@ -9,11 +9,16 @@
 // is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express
 // or implied. See the License for the specific language governing permissions and limitations under the License
 
+#include <atomic>
 #include <chrono>
+#include <functional>
 #include <future>
 #include <gtest/gtest.h>
 #include <memory>
+#include <thread>
+#include <vector>
 
+#include <folly/ScopeGuard.h>
 #include "gtest/gtest.h"
 #include "storage/ThreadPool.h"
 #include "storage/ThreadPools.h"
@@ -29,14 +34,40 @@ struct ThreadPoolsTestAccess {
 
 }  // namespace milvus
 
+namespace {
+
+// HIGH borrows the MIDDLE and LOW shares, LOW keeps its own share next to it
+int64_t
+ExpectedLoadExecutorWorkers() {
+    auto share = [](milvus::ThreadPoolPriority priority) -> int64_t {
+        return milvus::ThreadPools::GetThreadPool(priority).GetMaxThreadNum();
+    };
+    return share(milvus::ThreadPoolPriority::HIGH) +
+           share(milvus::ThreadPoolPriority::MIDDLE) +
+           2 * share(milvus::ThreadPoolPriority::LOW);
+}
+
+bool
+WaitFor(const std::function<bool()>& condition) {
+    auto deadline =
+        std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (!condition()) {
+        if (std::chrono::steady_clock::now() > deadline) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+}  // namespace
+
 TEST(ThreadPool, ThreadNum) {
     auto& threadPool =
         milvus::ThreadPools::GetThreadPool(milvus::ThreadPoolPriority::HIGH);
-    auto& lowThreadPool =
-        milvus::ThreadPools::GetThreadPool(milvus::ThreadPoolPriority::LOW);
     auto max_thread_num = threadPool.GetMaxThreadNum();
     ASSERT_EQ(milvus::ThreadPools::GetLoadExecutorWorkers(),
-              max_thread_num + lowThreadPool.GetMaxThreadNum());
+              ExpectedLoadExecutorWorkers());
     milvus::ThreadPools::ResizeThreadPool(milvus::ThreadPoolPriority::HIGH,
                                           0.0);
     ASSERT_EQ(threadPool.GetMaxThreadNum(), max_thread_num);
@@ -47,14 +78,83 @@ TEST(ThreadPool, ThreadNum) {
                                           2.0);
     ASSERT_EQ(threadPool.GetMaxThreadNum(), 2.0 * milvus::CPU_NUM);
     ASSERT_EQ(milvus::ThreadPools::GetLoadExecutorWorkers(),
-              threadPool.GetMaxThreadNum() + lowThreadPool.GetMaxThreadNum());
+              ExpectedLoadExecutorWorkers());
 
     milvus::ThreadPools::ResizeThreadPool(
         milvus::ThreadPoolPriority::HIGH,
         static_cast<float>(max_thread_num) / milvus::CPU_NUM);
     ASSERT_EQ(threadPool.GetMaxThreadNum(), max_thread_num);
     ASSERT_EQ(milvus::ThreadPools::GetLoadExecutorWorkers(),
-              max_thread_num + lowThreadPool.GetMaxThreadNum());
+              ExpectedLoadExecutorWorkers());
+
+    // resizing MIDDLE changes how many HIGH load tasks run at once
+    auto& middleThreadPool =
+        milvus::ThreadPools::GetThreadPool(milvus::ThreadPoolPriority::MIDDLE);
+    auto middle_thread_num = middleThreadPool.GetMaxThreadNum();
+    milvus::ThreadPools::ResizeThreadPool(
+        milvus::ThreadPoolPriority::MIDDLE,
+        static_cast<float>(middle_thread_num + 1) / milvus::CPU_NUM);
+    ASSERT_EQ(milvus::ThreadPools::GetLoadExecutorWorkers(),
+              ExpectedLoadExecutorWorkers());
+    milvus::ThreadPools::ResizeThreadPool(
+        milvus::ThreadPoolPriority::MIDDLE,
+        static_cast<float>(middle_thread_num) / milvus::CPU_NUM);
+    ASSERT_EQ(middleThreadPool.GetMaxThreadNum(), middle_thread_num);
+    ASSERT_EQ(milvus::ThreadPools::GetLoadExecutorWorkers(),
+              ExpectedLoadExecutorWorkers());
+}
+
+TEST(ThreadPool, LoadExecutorWorkersMatchRunningLoadTasks) {
+    using milvus::ThreadPoolPriority;
+    using milvus::ThreadPools;
+    auto threads = [](ThreadPoolPriority priority) {
+        return ThreadPools::GetThreadPool(priority).GetMaxThreadNum();
+    };
+    auto resize = [](ThreadPoolPriority priority, int num_threads) {
+        ThreadPools::ResizeThreadPool(
+            priority, static_cast<float>(num_threads) / milvus::CPU_NUM);
+    };
+    auto high_threads = threads(ThreadPoolPriority::HIGH);
+    auto middle_threads = threads(ThreadPoolPriority::MIDDLE);
+    auto low_threads = threads(ThreadPoolPriority::LOW);
+    auto restore = folly::makeGuard([&]() {
+        resize(ThreadPoolPriority::HIGH, high_threads);
+        resize(ThreadPoolPriority::MIDDLE, middle_threads);
+        resize(ThreadPoolPriority::LOW, low_threads);
+    });
+    resize(ThreadPoolPriority::HIGH, 2);
+    resize(ThreadPoolPriority::MIDDLE, 1);
+    resize(ThreadPoolPriority::LOW, 1);
+    auto& high = ThreadPools::GetThreadPool(ThreadPoolPriority::HIGH);
+    auto& low = ThreadPools::GetThreadPool(ThreadPoolPriority::LOW);
+
+    std::atomic<int> running{0};
+    std::promise<void> release;
+    auto released = release.get_future().share();
+    auto task = [&running, released]() {
+        running.fetch_add(1);
+        released.wait();
+        running.fetch_sub(1);
+    };
+    std::vector<std::future<void>> futures;
+
+    // HIGH borrows the idle MIDDLE and LOW shares
+    for (int i = 0; i < 8; i++) {
+        futures.push_back(high.Submit(task));
+    }
+    EXPECT_TRUE(WaitFor([&]() { return running.load() == 4; }));
+    // LOW still runs its own share next to the borrowing HIGH tasks
+    for (int i = 0; i < 4; i++) {
+        futures.push_back(low.Submit(task));
+    }
+    EXPECT_TRUE(WaitFor([&]() { return running.load() == 5; }));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(running.load(), ThreadPools::GetLoadExecutorWorkers());
+
+    release.set_value();
+    for (auto& future : futures) {
+        future.get();
+    }
 }
 
 TEST(ThreadPool, LoadExecutorWorkerCountUsesCacheAfterInitialization) {
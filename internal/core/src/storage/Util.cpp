@@ -1058,6 +1058,59 @@ GetObjectData(ChunkManager* remote_chunk_manager,
     return futures;
 }
 
+void
+ProcessObjectDataPipelined(
+    ChunkManager* remote_chunk_manager,
+    const std::vector<std::string>& remote_files,
+    int64_t inflight_budget_bytes,
+    const std::function<void(std::unique_ptr<DataCodec>)>& processor,
+    milvus::ThreadPoolPriority priority) {
+    std::deque<std::future<std::unique_ptr<DataCodec>>> inflight;
+    size_t next_file = 0;
+    int64_t seen_bytes = 0;
+    int64_t seen_files = 0;
+    auto estimated_file_bytes = [&]() -> int64_t {
+        if (seen_files == 0) {
+            return std::max<int64_t>(FILE_SLICE_SIZE.load(), 1);
+        }
+        return std::max<int64_t>(seen_bytes / seen_files, 1);
+    };
+    // bytes of the file handed to the processor, they stay in memory until
+    // it returns and count against the budget like the downloads do
+    int64_t processing_bytes = 0;
+    auto refill = [&]() {
+        while (next_file < remote_files.size() &&
+               ((inflight.empty() && processing_bytes == 0) ||
+                processing_bytes + static_cast<int64_t>(inflight.size() + 1) *
+                                       estimated_file_bytes() <=
+                    inflight_budget_bytes)) {
+            auto futures = GetObjectData(
+                remote_chunk_manager, {remote_files[next_file]}, priority);
+            inflight.emplace_back(std::move(futures.front()));
+            ++next_file;
+        }
+    };
+
+    try {
+        refill();
+        while (!inflight.empty()) {
+            auto codec = inflight.front().get();
+            inflight.pop_front();
+            processing_bytes = codec->PayloadSize();
+            seen_bytes += processing_bytes;
+            ++seen_files;
+            // the next downloads run while this file is being processed
+            refill();
+            processor(std::move(codec));
+            processing_bytes = 0;
+            refill();
+        }
+    } catch (...) {
+        DrainFutures(inflight);
+        throw;
+    }
+}
+
 std::map<std::string, int64_t>
 PutIndexData(ChunkManager* remote_chunk_manager,
              const std::vector<const uint8_t*>& data_slices,
@@ -208,6 +208,20 @@ GetObjectData(
     bool is_field_data = true,
     std::optional<proto::schema::TypeSchema> array_type = std::nullopt);
 
+// Download and decode remote_files on the thread pool and hand the codecs to
+// processor in file order, while later files keep downloading. Downloads are
+// admitted as long as their estimated decoded size fits in
+// inflight_budget_bytes (the estimate starts at FILE_SLICE_SIZE per file and
+// then follows the average payload seen so far); one file is always admitted.
+// On exception, waits for every in-flight download before rethrowing.
+void
+ProcessObjectDataPipelined(
+    ChunkManager* remote_chunk_manager,
+    const std::vector<std::string>& remote_files,
+    int64_t inflight_budget_bytes,
+    const std::function<void(std::unique_ptr<DataCodec>)>& processor,
+    milvus::ThreadPoolPriority priority = milvus::ThreadPoolPriority::HIGH);
+
 // Helper function to wait for all futures and collect exceptions
 // This ensures all background threads complete before rethrowing exception
 inline void
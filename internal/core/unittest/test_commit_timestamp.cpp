@@ -311,6 +311,63 @@ class CommitTimestampV2TestAccess {
         std::lock_guard<std::mutex> reopen_guard(segment->reopen_mutex_);
         segment->PublishStateOnline(std::move(next));
     }
+
+    // Publish a raw timestamp column split into chunks of `chunk_rows` rows
+    // over `buf`, and drop the resident TimestampData, so every timestamp
+    // reader has to go through the column (the evictable-column shape).
+    static void
+    PublishChunkedTimestampColumnOnly(ChunkedSegmentSealedImpl* segment,
+                                      char* buf,
+                                      const std::vector<int64_t>& chunk_rows) {
+        static const FieldMeta ts_field_meta(FieldName("Timestamp"),
+                                             TimestampFieldID,
+                                             DataType::INT64,
+                                             /*nullable=*/false,
+                                             /*default_value=*/std::nullopt);
+        auto mmap_guard = std::make_shared<ChunkMmapGuard>(nullptr, 0, "");
+        std::vector<std::unique_ptr<Chunk>> chunks;
+        char* chunk_buf = buf;
+        for (auto rows : chunk_rows) {
+            const auto size = static_cast<uint64_t>(rows) * sizeof(Timestamp);
+            chunks.emplace_back(
+                std::make_unique<FixedWidthChunk>(rows,
+                                                  /*dim=*/1,
+                                                  chunk_buf,
+                                                  size,
+                                                  sizeof(Timestamp),
+                                                  /*nullable=*/false,
+                                                  mmap_guard));
+            chunk_buf += size;
+        }
+        auto translator = std::make_unique<TestChunkTranslator>(
+            chunk_rows, "ts_chunked_test", std::move(chunks));
+        auto slot =
+            cachinglayer::Manager::GetInstance().CreateCacheSlot<milvus::Chunk>(
+                std::move(translator), nullptr);
+        auto column =
+            std::make_shared<ChunkedColumn>(std::move(slot), ts_field_meta);
+        auto current = segment->CapturePublishedState();
+        auto runtime = segment->CloneRuntimeResourceState(current->runtime);
+        runtime->fields.insert_or_assign(TimestampFieldID, std::move(column));
+        runtime->timestamps = nullptr;
+        auto next = segment->ClonePublishedState(current);
+        next->runtime = segment->ToConstRuntimeState(std::move(runtime));
+        segment->NormalizePublishedState(*next);
+        std::lock_guard<std::mutex> reopen_guard(segment->reopen_mutex_);
+        segment->PublishStateOnline(std::move(next));
+    }
+
+    static std::vector<Timestamp>
+    ReadTimestamps(ChunkedSegmentSealedImpl* segment,
+                   const std::vector<int64_t>& offsets) {
+        std::vector<Timestamp> out(offsets.size(), 0);
+        segment->ReadTimestamps(offsets.data(),
+                                static_cast<int64_t>(offsets.size()),
+                                out.data(),
+                                segment->CapturePublishedState()->runtime,
+                                std::nullopt);
+        return out;
+    }
 };
 
 }  // namespace milvus::segcore
@@ -539,3 +596,49 @@ TEST(CommitTimestamp, NormalSegment_BehaviorUnchanged) {
             << ": all rows TTL-expired";
     }
 }
+
+// ReadTimestamps on the column path: offsets spanning several chunks, in
+// arbitrary order and with repeats, come back in the caller's order.
+TEST(CommitTimestamp, ReadTimestampsFromChunkedColumn) {
+    auto schema = std::make_shared<Schema>();
+    auto pk = schema->AddDebugField("pk", DataType::INT64);
+    schema->AddDebugField(
+        "vec", DataType::VECTOR_FLOAT, 16, knowhere::metric::L2);
+    schema->set_primary_field_id(pk);
+
+    constexpr int64_t N = 10;
+    constexpr Timestamp T_raw = 7000;
+    auto dataset = DataGen(schema, N, /*seed=*/42, /*ts_offset=*/1000);
+    auto seg = CreateSealedWithFieldDataLoaded(schema, dataset);
+    auto* impl = dynamic_cast<ChunkedSegmentSealedImpl*>(seg.get());
+    ASSERT_NE(impl, nullptr);
+
+    std::vector<char> ts_buf(N * sizeof(Timestamp));
+    auto* ts_view = reinterpret_cast<Timestamp*>(ts_buf.data());
+    for (int64_t i = 0; i < N; ++i) {
+        ts_view[i] = T_raw + i;
+    }
+    CommitTimestampV2TestAccess::PublishChunkedTimestampColumnOnly(
+        impl, ts_buf.data(), {3, 4, 3});
+
+    for (const auto& offsets :
+         {std::vector<int64_t>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9},
+          std::vector<int64_t>{9, 0, 5, 3, 3, 8, 1, 6}}) {
+        auto out = CommitTimestampV2TestAccess::ReadTimestamps(impl, offsets);
+        ASSERT_EQ(out.size(), offsets.size());
+        for (size_t i = 0; i < offsets.size(); ++i) {
+            EXPECT_EQ(out[i], T_raw + offsets[i]) << "offset " << offsets[i];
+        }
+
+        std::vector<Timestamp> subscripted(offsets.size(), 0);
+        seg->bulk_subscript(/*op_ctx=*/nullptr,
+                            SystemFieldType::Timestamp,
+                            offsets.data(),
+                            static_cast<int64_t>(offsets.size()),
+                            subscripted.data());
+        EXPECT_EQ(subscripted, out);
+    }
+
+    // the column is dropped before the segment
+    seg.reset();
+}
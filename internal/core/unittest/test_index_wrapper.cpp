@@ -17,8 +17,10 @@
 #include <nlohmann/json.hpp>
 #include <algorithm>
 #include <cstdint>
+#include <cstring>
 #include <map>
 #include <memory>
+#include <numeric>
 #include <string>
 #include <tuple>
 #include <utility>
@@ -47,6 +49,8 @@
 #include "pb/index_cgo_msg.pb.h"
 #include "segcore/Collection.h"
 #include "storage/FileManager.h"
+#include "storage/InsertData.h"
+#include "storage/PayloadReader.h"
 #include "storage/Types.h"
 #include "storage/Util.h"
 #include "test_utils/Constants.h"
@@ -365,3 +369,71 @@ TEST(VectorMemIndexTest, LoadMmapSlicedValidData) {
         EXPECT_EQ(loaded_index.IsRowValid(i), valid_data[i]) << i;
     }
 }
+
+// Build() of a dense index streams every binlog into one buffer; the index
+// must see all of them, in binlog order.
+TEST(VectorMemIndexTest, BuildStreamsRawDataFromBinlogs) {
+    constexpr int64_t kFiles = 3;
+    constexpr int64_t kRowsPerFile = 100;
+    constexpr int64_t kDim = 4;
+    constexpr int64_t kRows = kFiles * kRowsPerFile;
+
+    auto storage_config = get_default_local_storage_config();
+    auto chunk_manager = storage::CreateChunkManager(storage_config);
+    auto fs = storage::InitArrowFileSystem(storage_config);
+    storage::FieldDataMeta field_data_meta{1, 2, 3, 100};
+    storage::IndexMeta index_meta{3, 100, 50151, 1};
+
+    std::vector<float> expected;
+    std::vector<std::string> insert_files;
+    for (int64_t f = 0; f < kFiles; ++f) {
+        std::vector<float> data(kRowsPerFile * kDim);
+        for (size_t i = 0; i < data.size(); ++i) {
+            data[i] = static_cast<float>(f * 10000 + i);
+        }
+        expected.insert(expected.end(), data.begin(), data.end());
+        auto field_data = storage::CreateFieldData(
+            DataType::VECTOR_FLOAT, DataType::NONE, false, kDim);
+        field_data->FillFieldData(data.data(), kRowsPerFile);
+        auto payload_reader =
+            std::make_shared<storage::PayloadReader>(field_data);
+        storage::InsertData insert_data(payload_reader);
+        insert_data.SetFieldDataMeta(field_data_meta);
+        insert_data.SetTimestamps(0, 100);
+        auto serialized = insert_data.Serialize(storage::Remote);
+        // the paths sort in a different order than they are listed
+        auto path = TestLocalPath + "stream_build_raw_data/" +
+                    std::to_string(f + 1);
+        chunk_manager->Write(path, serialized.data(), serialized.size());
+        insert_files.push_back(path);
+    }
+    std::reverse(insert_files.begin(), insert_files.end());
+
+    storage::FileManagerContext file_manager_context(
+        field_data_meta, index_meta, chunk_manager, fs);
+    index::VectorMemIndex<float> index(
+        DataType::NONE,
+        knowhere::IndexEnum::INDEX_FAISS_IDMAP,
+        knowhere::metric::L2,
+        knowhere::Version::GetCurrentVersion().VersionNumber(),
+        true,
+        file_manager_context);
+
+    Config config{{knowhere::meta::METRIC_TYPE, knowhere::metric::L2},
+                  {knowhere::meta::DIM, std::to_string(kDim)}};
+    config[INSERT_FILES_KEY] = insert_files;
+    index.Build(config);
+
+    ASSERT_EQ(index.Count(), kRows);
+    ASSERT_TRUE(index.HasRawData());
+    std::vector<int64_t> ids(kRows);
+    std::iota(ids.begin(), ids.end(), 0);
+    auto ids_ds = GenIdsDataset(kRows, ids.data());
+    auto vectors = index.GetVector(ids_ds);
+    ASSERT_EQ(vectors.size(), expected.size() * sizeof(float));
+    EXPECT_EQ(std::memcmp(vectors.data(), expected.data(), vectors.size()), 0);
+
+    for (auto& path : insert_files) {
+        chunk_manager->Remove(path);
+    }
+}
@@ -12,7 +12,9 @@
 #include <gtest/gtest.h>
 #include <algorithm>
 #include <map>
+#include <optional>
 #include <set>
+#include <string>
 #include <unordered_map>
 #include <vector>
 #include "common/Utils.h"
@@ -20,10 +22,15 @@
 #include "segcore/SegmentSealed.h"
 #include "plan/PlanNode.h"
 #include "plan/PlanNodeIdGenerator.h"
+#include "test_utils/cachinglayer_test_utils.h"
 #include "test_utils/storage_test_utils.h"
 #include "exec/expression/function/FunctionFactory.h"
 #include "exec/operator/query-agg/CountAggregateBase.h"
 #include "exec/HashTable.h"
+#include "exec/operator/query-agg/GroupingSet.h"
+#include "exec/operator/AggregationNode.h"
+#include "index/BitmapIndex.h"
+#include "index/ScalarIndexSort.h"
 #include "exec/VectorHasher.h"
 #include "pb/plan.pb.h"
 #include "query/PlanImpl.h"
@@ -881,6 +888,408 @@ TEST(QueryAggElementLevel, GroupByPkCountStarUsesLogicalRows) {
     EXPECT_EQ(counts_by_pk.at(30), 2);
 }
 
+TEST(QueryAggSortedInput, GroupByPkStreamsGroupsAndPushesDownLimit) {
+    auto schema = std::make_shared<Schema>();
+    schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, 16, knowhere::metric::L2);
+    auto pk_fid = schema->AddDebugField("id", DataType::INT64);
+    auto value_fid = schema->AddDebugField("value", DataType::INT64);
+    schema->set_primary_field_id(pk_fid);
+
+    // inserted in descending pk order, the pk index yields ascending order
+    constexpr int64_t N = 50;
+    auto raw_data = DataGen(schema, N);
+    std::vector<int64_t> pks(N);
+    std::vector<int64_t> values(N);
+    for (int64_t i = 0; i < N; i++) {
+        pks[i] = 1000 - 3 * i;
+        values[i] = i;
+    }
+    SetInt64FieldData(raw_data, pk_fid, pks);
+    SetInt64FieldData(raw_data, value_fid, values);
+    auto segment = CreateSealedWithFieldDataLoaded(schema, raw_data);
+
+    auto run = [&](int64_t limit, bool order_by_pk, bool ascending) {
+        proto::plan::PlanNode plan_node;
+        auto* query = plan_node.mutable_query();
+        query->set_limit(limit);
+        query->add_group_by_field_ids(pk_fid.get());
+        auto* aggregate = query->add_aggregates();
+        aggregate->set_op(proto::plan::sum);
+        aggregate->set_field_id(value_fid.get());
+        if (order_by_pk) {
+            auto* order_by = query->add_order_by_fields();
+            order_by->set_field_id(pk_fid.get());
+            order_by->set_ascending(ascending);
+        }
+
+        auto parser = milvus::query::ProtoParser(schema);
+        auto plan = parser.CreateRetrievePlan(plan_node);
+        auto node = plan->plan_node_->plannodes_;
+        if (order_by_pk) {
+            node = node->sources()[0];
+        }
+        auto agg_node =
+            std::dynamic_pointer_cast<const plan::AggregationNode>(node);
+        EXPECT_NE(agg_node, nullptr);
+        if (agg_node) {
+            EXPECT_TRUE(agg_node->InputSortedByKeys());
+            EXPECT_EQ(agg_node->GroupLimit(),
+                      order_by_pk && ascending ? limit : -1);
+        }
+
+        auto retrieve_results = segment->Retrieve(
+            nullptr, plan.get(), MAX_TIMESTAMP, DEFAULT_MAX_OUTPUT_SIZE, false);
+        EXPECT_EQ(retrieve_results->fields_data_size(), 2);
+        const auto& pk_data =
+            retrieve_results->fields_data(0).scalars().long_data().data();
+        const auto& sum_data =
+            retrieve_results->fields_data(1).scalars().long_data().data();
+        EXPECT_EQ(pk_data.size(), sum_data.size());
+        std::vector<std::pair<int64_t, int64_t>> groups;
+        for (int i = 0; i < pk_data.size(); i++) {
+            groups.emplace_back(pk_data.Get(i), sum_data.Get(i));
+        }
+        return groups;
+    };
+
+    auto groups = run(100, false, true);
+    ASSERT_EQ(groups.size(), N);
+    std::sort(groups.begin(), groups.end());
+    for (int64_t i = 0; i < N; i++) {
+        EXPECT_EQ(groups[i].first, pks[N - 1 - i]);
+        EXPECT_EQ(groups[i].second, values[N - 1 - i]);
+    }
+
+    groups = run(7, true, true);
+    ASSERT_EQ(groups.size(), 7);
+    for (int64_t i = 0; i < 7; i++) {
+        EXPECT_EQ(groups[i].first, pks[N - 1 - i]);
+        EXPECT_EQ(groups[i].second, values[N - 1 - i]);
+    }
+
+    groups = run(7, true, false);
+    ASSERT_EQ(groups.size(), 7);
+    for (int64_t i = 0; i < 7; i++) {
+        EXPECT_EQ(groups[i].first, pks[i]);
+        EXPECT_EQ(groups[i].second, values[i]);
+    }
+}
+
+TEST(QueryAggSortedInput, PkGroupLimitFetchesOnlyLeadingGroups) {
+    auto schema = std::make_shared<Schema>();
+    schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, 16, knowhere::metric::L2);
+    auto pk_fid = schema->AddDebugField("id", DataType::INT64);
+    schema->set_primary_field_id(pk_fid);
+
+    // every pk is held by two rows of the sealed segment
+    constexpr int64_t N = 40;
+    auto raw_data = DataGen(schema, N);
+    std::vector<int64_t> pks(N);
+    for (int64_t i = 0; i < N; i++) {
+        pks[i] = 100 - i / 2;
+    }
+    SetInt64FieldData(raw_data, pk_fid, pks);
+    auto segment = CreateSealedWithFieldDataLoaded(schema, raw_data);
+
+    // count(*) over the ProjectNode output is the number of rows it fetched
+    auto fetched_rows = [&](int64_t pk_group_limit) {
+        std::vector<milvus::plan::PlanNodePtr> sources;
+        PlanNodePtr mvcc_node = std::make_shared<milvus::plan::MvccNode>(
+            milvus::plan::GetNextPlanNodeId(), sources);
+        sources = std::vector<milvus::plan::PlanNodePtr>{mvcc_node};
+        PlanNodePtr project_node = std::make_shared<milvus::plan::ProjectNode>(
+            milvus::plan::GetNextPlanNodeId(),
+            std::vector<FieldId>{pk_fid},
+            std::vector<std::string>{"id"},
+            std::vector<DataType>{DataType::INT64},
+            sources,
+            pk_group_limit);
+        sources = std::vector<milvus::plan::PlanNodePtr>{project_node};
+
+        std::string agg_name = "count";
+        std::vector<plan::AggregationNode::Aggregate> aggregates;
+        auto call = std::make_shared<const expr::CallExpr>(
+            agg_name, std::vector<expr::TypedExprPtr>{}, nullptr);
+        aggregates.emplace_back(plan::AggregationNode::Aggregate{call});
+        aggregates.back().resultType_ =
+            GetAggResultType(agg_name, DataType::NONE);
+        PlanNodePtr agg_node = std::make_shared<plan::AggregationNode>(
+            milvus::plan::GetNextPlanNodeId(),
+            std::vector<expr::FieldAccessTypeExprPtr>{},
+            std::vector<std::string>{agg_name},
+            std::move(aggregates),
+            sources);
+
+        auto retrieve_plan = createRetrievePlan(schema, agg_node, N);
+        auto retrieve_results = segment->Retrieve(nullptr,
+                                                  retrieve_plan.get(),
+                                                  MAX_TIMESTAMP,
+                                                  DEFAULT_MAX_OUTPUT_SIZE,
+                                                  false);
+        EXPECT_EQ(retrieve_results->fields_data_size(), 1);
+        return retrieve_results->fields_data(0).scalars().long_data().data(0);
+    };
+
+    EXPECT_EQ(fetched_rows(-1), N);
+    // both rows of each of the three smallest pks, none of the fourth
+    EXPECT_EQ(fetched_rows(3), 6);
+    EXPECT_EQ(fetched_rows(N), N);
+}
+
+TEST(QueryAggSortedInput, StreamingGroupingSetSpansInputsAndStopsAtLimit) {
+    auto make_input = [](const std::vector<int64_t>& keys) {
+        auto key_col = std::make_shared<milvus::ColumnVector>(DataType::INT64,
+                                                              keys.size());
+        std::copy(keys.begin(),
+                  keys.end(),
+                  reinterpret_cast<int64_t*>(key_col->GetRawData()));
+        auto value_col = std::make_shared<milvus::ColumnVector>(
+            DataType::INT64, keys.size());
+        return std::make_shared<milvus::RowVector>(
+            std::vector<milvus::VectorPtr>{key_col, value_col});
+    };
+    auto make_grouping_set = [](int64_t group_limit) {
+        std::vector<std::unique_ptr<milvus::exec::VectorHasher>> hashers;
+        hashers.push_back(
+            milvus::exec::VectorHasher::create(DataType::INT64, 0));
+        std::vector<milvus::exec::AggregateInfo> aggregates(1);
+        aggregates[0].function_ =
+            std::make_unique<milvus::exec::CountAggregate>();
+        aggregates[0].input_column_idxes_ = {1};
+        aggregates[0].output_ = 1;
+        return std::make_unique<milvus::exec::GroupingSet>(
+            nullptr,
+            std::move(hashers),
+            std::move(aggregates),
+            true,
+            group_limit);
+    };
+    auto output_type = std::make_shared<const RowType>(
+        std::vector<std::string>{"key", "count"},
+        std::vector<DataType>{DataType::INT64, DataType::INT64});
+    auto extract = [&](milvus::exec::GroupingSet& grouping_set,
+                       bool no_more_input) {
+        auto result = std::make_shared<milvus::RowVector>(output_type, 0);
+        std::vector<std::pair<int64_t, int64_t>> groups;
+        if (grouping_set.getStreamingOutput(result, no_more_input)) {
+            auto keys = std::dynamic_pointer_cast<milvus::ColumnVector>(
+                result->child(0));
+            auto counts = std::dynamic_pointer_cast<milvus::ColumnVector>(
+                result->child(1));
+            for (size_t i = 0; i < result->size(); i++) {
+                groups.emplace_back(keys->ValueAt<int64_t>(i),
+                                    counts->ValueAt<int64_t>(i));
+            }
+        }
+        return groups;
+    };
+    using Groups = std::vector<std::pair<int64_t, int64_t>>;
+
+    // the last group stays open until a later key or the end of input
+    auto unlimited = make_grouping_set(-1);
+    ASSERT_TRUE(unlimited->isStreaming());
+    unlimited->addInput(make_input({1, 1, 2, 2, 2}));
+    EXPECT_EQ(extract(*unlimited, false), (Groups{{1, 2}}));
+    unlimited->addInput(make_input({2, 3}));
+    EXPECT_EQ(extract(*unlimited, false), (Groups{{2, 4}}));
+    unlimited->addInput(make_input({3, 3, 4}));
+    EXPECT_EQ(extract(*unlimited, false), (Groups{{3, 3}}));
+    EXPECT_EQ(extract(*unlimited, true), (Groups{{4, 1}}));
+    EXPECT_EQ(extract(*unlimited, true), Groups{});
+
+    // rows past the second group are dropped, later input is ignored
+    auto limited = make_grouping_set(2);
+    limited->addInput(make_input({1, 1, 2, 2, 2}));
+    EXPECT_EQ(extract(*limited, false), (Groups{{1, 2}}));
+    limited->addInput(make_input({2, 3, 3}));
+    EXPECT_EQ(extract(*limited, false), (Groups{{2, 4}}));
+    limited->addInput(make_input({4}));
+    EXPECT_EQ(extract(*limited, true), Groups{});
+}
+
+TEST(QueryAggIndex, CountMinMaxFromScalarIndexesMatchRawScan) {
+    auto schema = std::make_shared<Schema>();
+    schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, 16, knowhere::metric::L2);
+    auto pk_fid = schema->AddDebugField("id", DataType::INT64);
+    auto category_fid =
+        schema->AddDebugField("category", DataType::INT64, true);
+    auto score_fid = schema->AddDebugField("score", DataType::INT64);
+    schema->set_primary_field_id(pk_fid);
+
+    constexpr int64_t N = 2000;
+    auto raw_data = DataGen(schema, N);
+    std::vector<int64_t> categories(N);
+    std::vector<int64_t> scores(N);
+    for (int64_t i = 0; i < N; i++) {
+        categories[i] = (i % 7) * 10;
+        scores[i] = (i * 7919) % 10007 - 5000;
+    }
+    SetInt64FieldData(raw_data, category_fid, categories);
+    SetInt64FieldData(raw_data, score_fid, scores);
+    auto category_valid = raw_data.get_col_valid(category_fid);
+
+    auto raw_segment = CreateSealedWithFieldDataLoaded(schema, raw_data);
+    auto indexed_segment = CreateSealedWithFieldDataLoaded(schema, raw_data);
+    segcore::LoadIndexInfo load_index_info;
+    auto category_index = std::make_unique<index::BitmapIndex<int64_t>>();
+    category_index->Build(N, categories.data(), category_valid.data());
+    load_index_info.field_id = category_fid.get();
+    load_index_info.field_type = DataType::INT64;
+    load_index_info.index_params = GenIndexParams(category_index.get());
+    load_index_info.cache_index =
+        CreateTestCacheIndex("category", std::move(category_index));
+    indexed_segment->LoadIndex(load_index_info);
+    auto score_index = index::CreateScalarIndexSort<int64_t>();
+    score_index->Build(N, scores.data(), nullptr);
+    load_index_info.field_id = score_fid.get();
+    load_index_info.index_params = GenIndexParams(score_index.get());
+    load_index_info.cache_index =
+        CreateTestCacheIndex("score", std::move(score_index));
+    indexed_segment->LoadIndex(load_index_info);
+
+    using Aggregates =
+        std::vector<std::pair<proto::plan::AggregateOp, FieldId>>;
+    // rows of the result as strings, sorted
+    auto run = [&](const segcore::SegmentSealed* segment,
+                   std::optional<FieldId> group_by,
+                   const Aggregates& aggregates,
+                   std::optional<int64_t> min_score) {
+        proto::plan::PlanNode plan_node;
+        auto* query = plan_node.mutable_query();
+        query->set_limit(100);
+        if (group_by.has_value()) {
+            query->add_group_by_field_ids(group_by->get());
+        }
+        for (const auto& [op, field_id] : aggregates) {
+            auto* aggregate = query->add_aggregates();
+            aggregate->set_op(op);
+            aggregate->set_field_id(field_id.get());
+        }
+        if (min_score.has_value()) {
+            auto* unary_range =
+                query->mutable_predicates()->mutable_unary_range_expr();
+            auto* column_info = unary_range->mutable_column_info();
+            column_info->set_field_id(score_fid.get());
+            column_info->set_data_type(proto::schema::DataType::Int64);
+            unary_range->set_op(proto::plan::OpType::GreaterThan);
+            unary_range->mutable_value()->set_int64_val(min_score.value());
+        }
+        auto parser = milvus::query::ProtoParser(schema);
+        auto plan = parser.CreateRetrievePlan(plan_node);
+        auto agg_node = std::dynamic_pointer_cast<const plan::AggregationNode>(
+            plan->plan_node_->plannodes_);
+        EXPECT_NE(agg_node, nullptr);
+        if (agg_node) {
+            EXPECT_TRUE(
+                exec::PhyAggregationNode::MayAnswerFromIndex(*agg_node));
+        }
+
+        auto retrieve_results = segment->Retrieve(
+            nullptr, plan.get(), MAX_TIMESTAMP, DEFAULT_MAX_OUTPUT_SIZE, false);
+        std::vector<std::vector<std::string>> rows;
+        for (int f = 0; f < retrieve_results->fields_data_size(); f++) {
+            const auto& field_data = retrieve_results->fields_data(f);
+            const auto& values = field_data.scalars().long_data().data();
+            rows.resize(values.size());
+            for (int i = 0; i < values.size(); i++) {
+                bool is_null = field_data.valid_data_size() > 0 &&
+                               !field_data.valid_data(i);
+                rows[i].push_back(is_null ? "null"
+                                          : std::to_string(values.Get(i)));
+            }
+        }
+        std::sort(rows.begin(), rows.end());
+        return rows;
+    };
+
+    const Aggregates grouped = {{proto::plan::count, FieldId(0)},
+                                {proto::plan::count, category_fid},
+                                {proto::plan::min, category_fid},
+                                {proto::plan::max, category_fid}};
+    const Aggregates global = {{proto::plan::count, category_fid},
+                               {proto::plan::min, score_fid},
+                               {proto::plan::max, score_fid},
+                               {proto::plan::max, category_fid},
+                               {proto::plan::count, FieldId(0)}};
+    for (std::optional<int64_t> min_score :
+         {std::optional<int64_t>(), std::optional<int64_t>(0),
+          std::optional<int64_t>(1000000)}) {
+        auto expected =
+            run(raw_segment.get(), category_fid, grouped, min_score);
+        EXPECT_EQ(
+            run(indexed_segment.get(), category_fid, grouped, min_score),
+            expected);
+        expected = run(raw_segment.get(), std::nullopt, global, min_score);
+        ASSERT_EQ(expected.size(), 1);
+        EXPECT_EQ(run(indexed_segment.get(), std::nullopt, global, min_score),
+                  expected);
+    }
+
+    // group counts, the null group included
+    std::map<std::string, int64_t> expected_counts;
+    for (int64_t i = 0; i < N; i++) {
+        expected_counts[category_valid[i] ? std::to_string(categories[i])
+                                          : "null"]++;
+    }
+    auto groups = run(indexed_segment.get(), category_fid, grouped, {});
+    ASSERT_EQ(groups.size(), expected_counts.size());
+    for (const auto& group : groups) {
+        EXPECT_EQ(group[1], std::to_string(expected_counts.at(group[0])));
+        EXPECT_EQ(group[2], group[0] == "null" ? "0" : group[1]);
+        EXPECT_EQ(group[3], group[0]);
+        EXPECT_EQ(group[4], group[0]);
+    }
+}
+
+TEST(QueryAggIndex, MinMaxIgnoresRowsInsertedAfterQueryTimestamp) {
+    auto schema = std::make_shared<Schema>();
+    schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, 16, knowhere::metric::L2);
+    auto pk_fid = schema->AddDebugField("id", DataType::INT64);
+    auto score_fid = schema->AddDebugField("score", DataType::INT64);
+    schema->set_primary_field_id(pk_fid);
+
+    // row i is inserted at ts_offset + i, the later rows hold the extremes
+    constexpr int64_t N = 100;
+    constexpr Timestamp ts_offset = 1000;
+    auto raw_data = DataGen(schema, N, /*seed=*/42, ts_offset);
+    std::vector<int64_t> scores(N);
+    for (int64_t i = 0; i < N; i++) {
+        scores[i] = i < N / 2 ? i : (i % 2 == 0 ? -i : 1000 + i);
+    }
+    SetInt64FieldData(raw_data, score_fid, scores);
+    auto segment = CreateSealedWithFieldDataLoaded(schema, raw_data);
+
+    proto::plan::PlanNode plan_node;
+    auto* query = plan_node.mutable_query();
+    query->set_limit(100);
+    for (auto op : {proto::plan::min, proto::plan::max}) {
+        auto* aggregate = query->add_aggregates();
+        aggregate->set_op(op);
+        aggregate->set_field_id(score_fid.get());
+    }
+    auto parser = milvus::query::ProtoParser(schema);
+    auto plan = parser.CreateRetrievePlan(plan_node);
+
+    auto min_max = [&](Timestamp timestamp) {
+        auto retrieve_results = segment->Retrieve(
+            nullptr, plan.get(), timestamp, DEFAULT_MAX_OUTPUT_SIZE, false);
+        EXPECT_EQ(retrieve_results->fields_data_size(), 2);
+        return std::make_pair(
+            retrieve_results->fields_data(0).scalars().long_data().data(0),
+            retrieve_results->fields_data(1).scalars().long_data().data(0));
+    };
+
+    ASSERT_LT(segment->get_active_count(ts_offset + N / 2 - 1),
+              segment->get_row_count());
+    EXPECT_EQ(min_max(ts_offset + N / 2 - 1),
+              std::make_pair(int64_t{0}, N / 2 - 1));
+    EXPECT_EQ(min_max(MAX_TIMESTAMP), std::make_pair(-(N - 2), 1000 + N - 1));
+}
+
 // Test aggregation through segment->Retrieve() API to cover
 // fillDataArrayFromColumnVector and bitmap unpacking logic
 TEST_P(QueryAggTest, RetrieveAggregationWithValidityBitmap) {
@@ -71,6 +71,7 @@
 #include "mmap/ChunkedColumnGroup.h"
 #include "pb/common.pb.h"
 #include "pb/schema.pb.h"
+#include "query/ExecPlanNodeVisitor.h"
 #include "query/Plan.h"
 #include "query/PlanImpl.h"
 #include "query/Utils.h"
@@ -1392,6 +1393,177 @@ TEST(Sealed, Delete) {
                     reinterpret_cast<const Timestamp*>(new_timestamps.data()));
 }
 
+// Deletes on a pk-sorted segment go through the sorted merge-join; the
+// batch is unsorted, repeats pks and misses some, and every pk has two rows.
+TEST(Sealed, DeleteSortedByPk) {
+    for (auto pk_type : {DataType::INT64, DataType::VARCHAR}) {
+        auto schema = std::make_shared<Schema>();
+        auto pk = pk_type == DataType::INT64
+                      ? schema->AddDebugField("pk", DataType::INT64)
+                      : schema->AddDebugField("pk", DataType::VARCHAR);
+        schema->AddDebugField(
+            "vec", DataType::VECTOR_FLOAT, 4, knowhere::metric::L2);
+        schema->set_primary_field_id(pk);
+
+        int64_t N = 20;
+        auto dataset =
+            DataGen(schema, N, /*seed=*/42, /*ts_offset=*/0, /*repeat=*/2);
+        auto segment = CreateSealedSegment(schema,
+                                           empty_index_meta,
+                                           /*segment_id=*/0,
+                                           SegcoreConfig::default_config(),
+                                           /*is_sorted_by_pk=*/true);
+        LoadGeneratedDataIntoSegment(dataset, segment.get());
+
+        std::vector<int64_t> picked{14, 2, 14, 0, 19};
+        auto ids = std::make_unique<IdArray>();
+        std::vector<bool> expected(N, false);
+        if (pk_type == DataType::INT64) {
+            auto pks = dataset.get_col<int64_t>(pk);
+            for (auto row : picked) {
+                ids->mutable_int_id()->add_data(pks[row]);
+            }
+            ids->mutable_int_id()->add_data(pks[N - 1] + 100);
+            for (int64_t i = 0; i < N; ++i) {
+                for (auto row : picked) {
+                    expected[i] = expected[i] || pks[i] == pks[row];
+                }
+            }
+        } else {
+            auto pks = dataset.get_col<std::string>(pk);
+            for (auto row : picked) {
+                ids->mutable_str_id()->add_data(pks[row]);
+            }
+            ids->mutable_str_id()->add_data("not_a_pk");
+            for (int64_t i = 0; i < N; ++i) {
+                for (auto row : picked) {
+                    expected[i] = expected[i] || pks[i] == pks[row];
+                }
+            }
+        }
+        int64_t count = picked.size() + 1;
+        auto tss = GenTss(count, 100);
+        auto status = segment->Delete(count, ids.get(), tss.data());
+        ASSERT_TRUE(status.ok());
+
+        BitsetType bitset(N, false);
+        auto bitset_view = BitsetTypeView(bitset);
+        segment->mask_with_delete(bitset_view, N, 1000);
+        for (int64_t i = 0; i < N; ++i) {
+            EXPECT_EQ(bitset[i], expected[i]) << "row " << i;
+        }
+    }
+}
+
+// A time-travel query only evaluates, masks and searches the rows inserted
+// up to its timestamp.
+TEST(Sealed, ActiveCountBoundedByTimestamp) {
+    auto schema = std::make_shared<Schema>();
+    auto dim = 4;
+    auto fakevec_id = schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, dim, knowhere::metric::L2);
+    auto counter_id = schema->AddDebugField("counter", DataType::INT64);
+    schema->set_primary_field_id(counter_id);
+
+    int64_t N = 100;
+    Timestamp ts_offset = 1000;
+    // row i is inserted at ts_offset + i
+    auto dataset = DataGen(schema, N, /*seed=*/42, ts_offset);
+    auto segment = CreateSealedWithFieldDataLoaded(schema, dataset);
+
+    EXPECT_EQ(segment->get_active_count(ts_offset - 1), 0);
+    EXPECT_EQ(segment->get_active_count(ts_offset), 1);
+    EXPECT_EQ(segment->get_active_count(ts_offset + 49), 50);
+    EXPECT_EQ(segment->get_active_count(ts_offset + N - 1), N);
+    EXPECT_EQ(segment->get_active_count(MAX_TIMESTAMP), N);
+
+    Timestamp query_ts = ts_offset + 49;
+    auto active_count = segment->get_active_count(query_ts);
+    BitsetType bitset(active_count, false);
+    BitsetTypeView bitset_view(bitset);
+    segment->mask_with_timestamps(bitset_view, query_ts, 0);
+    EXPECT_TRUE(bitset.none());
+
+    ScopedSchemaHandle handle(*schema);
+    auto plan_str =
+        handle.ParseSearch("", "fakevec", 10, "L2", "{\"nprobe\": 10}", 3);
+    auto plan =
+        CreateSearchPlanByExpr(schema, plan_str.data(), plan_str.size());
+    auto vec_col = dataset.get_col<float>(fakevec_id);
+    // the last rows are invisible at query_ts
+    auto query_ptr = vec_col.data() + (N - 2) * dim;
+    auto ph_group_raw = CreatePlaceholderGroupFromBlob(2, dim, query_ptr);
+    auto ph_group =
+        ParsePlaceholderGroup(plan.get(), ph_group_raw.SerializeAsString());
+    auto sr = segment->Search(plan.get(), ph_group.get(), query_ts);
+    ASSERT_FALSE(sr->seg_offsets_.empty());
+    for (auto offset : sr->seg_offsets_) {
+        EXPECT_LT(offset, active_count);
+    }
+}
+
+// A pk filter at a timestamp inside the segment only marks the rows visible
+// then, its bitmap is shorter than the segment. Every pk has two rows, the
+// rows of one of them straddle the last visible row.
+TEST(Sealed, PkFilterAtTimestampInsideSegment) {
+    for (auto sorted_by_pk : {false, true}) {
+        auto schema = std::make_shared<Schema>();
+        auto pk = schema->AddDebugField("pk", DataType::INT64);
+        schema->AddDebugField(
+            "vec", DataType::VECTOR_FLOAT, 4, knowhere::metric::L2);
+        schema->set_primary_field_id(pk);
+
+        int64_t N = 100;
+        Timestamp ts_offset = 1000;
+        // row i is inserted at ts_offset + i and has pk i / 2
+        auto dataset =
+            DataGen(schema, N, /*seed=*/42, ts_offset, /*repeat=*/2);
+        auto segment = CreateSealedSegment(schema,
+                                           empty_index_meta,
+                                           /*segment_id=*/0,
+                                           SegcoreConfig::default_config(),
+                                           sorted_by_pk);
+        LoadGeneratedDataIntoSegment(dataset, segment.get());
+        auto pks = dataset.get_col<int64_t>(pk);
+
+        Timestamp query_ts = ts_offset + 48;
+        auto active_count = segment->get_active_count(query_ts);
+        ASSERT_EQ(active_count, 49);
+
+        std::vector<std::pair<std::string, std::function<bool(int64_t)>>>
+            testcases = {
+                {fmt::format("pk in [{}, {}, {}]", pks[10], pks[48], pks[90]),
+                 [&](int64_t v) {
+                     return v == pks[10] || v == pks[48] || v == pks[90];
+                 }},
+                {fmt::format("pk == {}", pks[48]),
+                 [&](int64_t v) { return v == pks[48]; }},
+                {fmt::format("pk >= {}", pks[20]),
+                 [&](int64_t v) { return v >= pks[20]; }},
+                {fmt::format("pk <= {}", pks[90]),
+                 [&](int64_t v) { return v <= pks[90]; }},
+                {fmt::format("pk > {} and pk < {}", pks[40], pks[90]),
+                 [&](int64_t v) { return v > pks[40] && v < pks[90]; }},
+            };
+        ScopedSchemaHandle handle(*schema);
+        for (const auto& [expr, ref] : testcases) {
+            auto plan_str = handle.ParseSearch(
+                expr, "vec", 10, "L2", "{\"nprobe\": 10}", 3);
+            auto plan = CreateSearchPlanByExpr(
+                schema, plan_str.data(), plan_str.size());
+            auto bitset = ExecuteQueryExpr(
+                plan->plan_node_->plannodes_->sources()[0]->sources()[0],
+                segment.get(),
+                active_count,
+                query_ts);
+            ASSERT_EQ(bitset.size(), active_count) << expr;
+            for (int64_t i = 0; i < active_count; ++i) {
+                EXPECT_EQ(bitset[i], ref(pks[i])) << expr << " row " << i;
+            }
+        }
+    }
+}
+
 TEST(Sealed, OverlapDelete) {
     auto dim = 4;
     auto N = 10;
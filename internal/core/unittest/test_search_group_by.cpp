@@ -536,6 +536,46 @@ TEST(GroupBY, SealedData) {
     }
 }
 
+TEST(GroupBY, SealedBatchGetMatchesPerRowGet) {
+    int dim = 64;
+    auto schema = std::make_shared<Schema>();
+    schema->AddDebugField(
+        "fakevec", DataType::VECTOR_FLOAT, dim, knowhere::metric::L2);
+    auto int8_fid = schema->AddDebugField("int8", DataType::INT8, true);
+    auto int64_fid = schema->AddDebugField("int64", DataType::INT64);
+    auto str_fid = schema->AddDebugField("string1", DataType::VARCHAR);
+    auto bool_fid = schema->AddDebugField("bool", DataType::BOOL);
+    schema->set_primary_field_id(str_fid);
+    size_t N = 100;
+
+    auto raw_data = DataGen(schema, N, 42, 0, 20, 10, 1, false, false);
+    auto segment = CreateSealedWithFieldDataLoaded(schema, raw_data);
+
+    OpContext op_context;
+    MultiFieldDataGetter getter(
+        &op_context, *segment, {int8_fid, int64_fid, str_fid, bool_fid});
+
+    // unordered offsets with duplicates, as produced by a vector iterator
+    std::vector<int64_t> offsets;
+    for (int64_t i = 0; i < static_cast<int64_t>(N); ++i) {
+        offsets.push_back((i * 37) % N);
+    }
+    offsets.push_back(offsets.front());
+
+    std::vector<CompositeGroupKey> batch_keys;
+    getter.GetBatchInto(offsets.data(), offsets.size(), batch_keys);
+    ASSERT_EQ(batch_keys.size(), offsets.size());
+    for (size_t i = 0; i < offsets.size(); ++i) {
+        ASSERT_EQ(batch_keys[i], getter.Get(offsets[i]))
+            << "mismatch at offset " << offsets[i];
+    }
+
+    // reusing the output vector must not leak values of the previous batch
+    getter.GetBatchInto(offsets.data(), 3, batch_keys);
+    ASSERT_EQ(batch_keys.size(), 3);
+    ASSERT_EQ(batch_keys[0].Size(), 4);
+}
+
 TEST(GroupBY, ElementLevelKeepsElementIndices) {
     int dim = 4;
     auto schema = std::make_shared<Schema>();
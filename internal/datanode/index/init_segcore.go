@@ -59,6 +59,8 @@ func InitSegcore(nodeID int64) error {
 	C.SetIndexSliceSize(cIndexSliceSize)
 	cLoadTransientBudgetBytes := C.int64_t(paramtable.Get().CommonCfg.LoadTransientBudgetBytes.GetAsInt64())
 	C.SetLoadTransientBudgetBytes(cLoadTransientBudgetBytes)
+	cRawDataCacheInflightBytes := C.int64_t(paramtable.Get().CommonCfg.RawDataCacheInflightBytes.GetAsInt64())
+	C.SetRawDataCacheInflightBytes(cRawDataCacheInflightBytes)
 
 	// set up thread pool for different priorities
 	cHighPriorityThreadCoreCoefficient := C.float(paramtable.Get().CommonCfg.HighPriorityThreadCoreCoefficient.GetAsFloat())
@@ -73,6 +75,9 @@ func InitSegcore(nodeID int64) error {
 	cCPUNum := C.int(hardware.GetCPUNum())
 	C.InitCpuNum(cCPUNum)
 
+	cKmeansMiniBatchEnabled := C.bool(paramtable.Get().DataCoordCfg.ClusteringCompactionMiniBatchKmeans.GetAsBool())
+	C.SetDefaultKmeansMiniBatchEnable(cKmeansMiniBatchEnabled)
+
 	cKnowhereThreadPoolSize := C.uint32_t(hardware.GetCPUNum() * paramtable.DefaultKnowhereThreadPoolNumRatioInBuild)
 	if paramtable.GetRole() == typeutil.StandaloneRole {
 		threadPoolSize := int(float64(hardware.GetCPUNum()) * paramtable.Get().CommonCfg.BuildIndexThreadPoolRatio.GetAsFloat())
@@ -679,7 +679,7 @@ func (mgr *segmentManager) Remove(ctx context.Context, segmentID typeutil.Unique
 	}
 
 	if sealed != nil {
-		mgr.release(ctx, sealed)
+		mgr.release(ctx, sealed, WithRemoveChunkFiles())
 	}
 
 	return removeGrowing, removeSealed
@@ -752,7 +752,7 @@ func (mgr *segmentManager) RemoveBy(ctx context.Context, filters ...SegmentFilte
 		return true
 	}, filters...)
 	for _, s := range removeSegments {
-		mgr.release(ctx, s)
+		mgr.release(ctx, s, WithRemoveChunkFiles())
 	}
 	return removeGrowing, removeSealed
 }
@@ -788,12 +788,12 @@ func (mgr *segmentManager) registerReleaseCallback(callback func(s Segment)) {
 	mgr.releaseCallback = callback
 }
 
-func (mgr *segmentManager) release(ctx context.Context, segment Segment) {
+func (mgr *segmentManager) release(ctx context.Context, segment Segment, opts ...releaseOption) {
 	if mgr.releaseCallback != nil {
 		mgr.releaseCallback(segment)
 		mlog.Info(ctx, "remove segment from cache", mlog.FieldSegmentID(segment.ID()))
 	}
-	segment.Release(ctx)
+	segment.Release(ctx, opts...)
 
 	metrics.QueryNodeNumSegments.WithLabelValues(
 		paramtable.GetStringNodeID(),
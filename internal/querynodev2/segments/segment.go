@@ -1323,6 +1323,9 @@ const (
 
 type releaseOptions struct {
 	Scope ReleaseScope
+	// remove the persistent chunk files of the segment, set when the node
+	// releases it for good rather than on shutdown
+	RemoveChunkFiles bool
 }
 
 func newReleaseOptions() *releaseOptions {
@@ -1339,6 +1342,12 @@ func WithReleaseScope(scope ReleaseScope) releaseOption {
 	}
 }
 
+func WithRemoveChunkFiles() releaseOption {
+	return func(options *releaseOptions) {
+		options.RemoveChunkFiles = true
+	}
+}
+
 func (s *LocalSegment) Release(ctx context.Context, opts ...releaseOption) {
 	options := newReleaseOptions()
 	for _, opt := range opts {
@@ -1373,6 +1382,9 @@ func (s *LocalSegment) Release(ctx context.Context, opts ...releaseOption) {
 
 	GetDynamicPool().Submit(func() (any, error) {
 		C.DeleteSegment(ptr)
+		if options.RemoveChunkFiles && s.segmentType == SegmentTypeSealed {
+			C.RemoveSegmentPersistentChunkFiles(C.int64_t(s.ID()))
+		}
 		return nil, nil
 	}).Await()
 
@@ -604,6 +604,15 @@ func SetupCoreConfigChangelCallback() {
 			return nil
 		})
 
+		paramtable.Get().CommonCfg.RawDataCacheInflightBytes.RegisterCallback(func(ctx context.Context, key, oldValue, newValue string) error {
+			bytes, err := strconv.ParseInt(newValue, 10, 64)
+			if err != nil {
+				return err
+			}
+			UpdateRawDataCacheInflightBytes(bytes)
+			return nil
+		})
+
 		paramtable.Get().QueryNodeCfg.KnowhereThreadPoolSize.RegisterCallback(func(ctx context.Context, key, oldValue, newValue string) error {
 			factor, err := strconv.ParseFloat(newValue, 64)
 			if err != nil {
@@ -717,6 +726,15 @@ func SetupCoreConfigChangelCallback() {
 			return nil
 		})
 
+		paramtable.Get().DataCoordCfg.ClusteringCompactionMiniBatchKmeans.RegisterCallback(func(ctx context.Context, key, oldValue, newValue string) error {
+			enable, err := strconv.ParseBool(newValue)
+			if err != nil {
+				return err
+			}
+			UpdateDefaultKmeansMiniBatchEnable(enable)
+			return nil
+		})
+
 		paramtable.Get().LogCfg.Level.RegisterCallback(func(ctx context.Context, key, oldValue, newValue string) error {
 			return UpdateLogLevel(newValue)
 		})
@@ -739,6 +757,78 @@ func SetupCoreConfigChangelCallback() {
 			return nil
 		})
 
+		paramtable.Get().QueryNodeCfg.PreparedGeometryCacheCapacity.RegisterCallback(func(ctx context.Context, key, oldValue, newValue string) error {
+			capacity, err := strconv.Atoi(newValue)
+			if err != nil {
+				return err
+			}
+			UpdatePreparedGeometryCacheCapacity(capacity)
+			return nil
+		})
+
+		paramtable.Get().QueryNodeCfg.EnableChunkEncoding.RegisterCallback(func(ctx context.Context, key, oldValue, newValue string) error {
+			enable, err := strconv.ParseBool(newValue)
+			if err != nil {
+				return err
+			}
+			UpdateDefaultChunkEncodingEnable(enable)
+			return nil
+		})
+
+		paramtable.Get().QueryNodeCfg.EnablePersistentChunkFile.RegisterCallback(func(ctx context.Context, key, oldValue, newValue string) error {
+			enable, err := strconv.ParseBool(newValue)
+			if err != nil {
+				return err
+			}
+			UpdateDefaultPersistentChunkFileEnable(enable)
+			return nil
+		})
+
+		paramtable.Get().QueryNodeCfg.PersistentChunkFileDiskLimit.RegisterCallback(func(ctx context.Context, key, oldValue, newValue string) error {
+			bytes, err := strconv.ParseInt(newValue, 10, 64)
+			if err != nil {
+				return err
+			}
+			UpdatePersistentChunkFileDiskLimit(bytes)
+			return nil
+		})
+
+		paramtable.Get().QueryNodeCfg.EnableNumaAwareExecutor.RegisterCallback(func(ctx context.Context, key, oldValue, newValue string) error {
+			enable, err := strconv.ParseBool(newValue)
+			if err != nil {
+				return err
+			}
+			UpdateDefaultNumaAwareExecutorEnable(enable)
+			return nil
+		})
+
+		paramtable.Get().QueryNodeCfg.EnableFusedRangeConjunct.RegisterCallback(func(ctx context.Context, key, oldValue, newValue string) error {
+			enable, err := strconv.ParseBool(newValue)
+			if err != nil {
+				return err
+			}
+			UpdateDefaultFusedRangeConjunctEnable(enable)
+			return nil
+		})
+
+		paramtable.Get().QueryNodeCfg.SplitColumnGroupsForTake.RegisterCallback(func(ctx context.Context, key, oldValue, newValue string) error {
+			enable, err := strconv.ParseBool(newValue)
+			if err != nil {
+				return err
+			}
+			C.SegcoreSetSplitColumnGroupsForTake(C.bool(enable))
+			return nil
+		})
+
+		paramtable.Get().QueryNodeCfg.TakeCacheBytesPerSegment.RegisterCallback(func(ctx context.Context, key, oldValue, newValue string) error {
+			bytes, err := strconv.ParseInt(newValue, 10, 64)
+			if err != nil {
+				return err
+			}
+			C.SegcoreSetTakeCacheBytesPerSegment(C.int64_t(bytes))
+			return nil
+		})
+
 		paramtable.Get().QueryNodeCfg.EnableLatestDeleteSnapshotOptimization.RegisterCallback(func(ctx context.Context, key, oldValue, newValue string) error {
 			enable, err := strconv.ParseBool(newValue)
 			if err != nil {
@@ -143,6 +143,30 @@ func doInitQueryNodeOnce(ctx context.Context) error {
 	cDeleteDumpBatchSize := C.int64_t(paramtable.Get().QueryNodeCfg.DeleteDumpBatchSize.GetAsInt64())
 	C.SetDefaultDeleteDumpBatchSize(cDeleteDumpBatchSize)
 
+	cPreparedGeometryCacheCapacity := C.int64_t(paramtable.Get().QueryNodeCfg.PreparedGeometryCacheCapacity.GetAsInt64())
+	C.SetPreparedGeometryCacheCapacity(cPreparedGeometryCacheCapacity)
+
+	cChunkEncodingEnabled := C.bool(paramtable.Get().QueryNodeCfg.EnableChunkEncoding.GetAsBool())
+	C.SetDefaultChunkEncodingEnable(cChunkEncodingEnabled)
+
+	cPersistentChunkFileEnabled := C.bool(paramtable.Get().QueryNodeCfg.EnablePersistentChunkFile.GetAsBool())
+	C.SetDefaultPersistentChunkFileEnable(cPersistentChunkFileEnabled)
+
+	cPersistentChunkFileDiskLimit := C.int64_t(paramtable.Get().QueryNodeCfg.PersistentChunkFileDiskLimit.GetAsInt64())
+	C.SetPersistentChunkFileDiskLimit(cPersistentChunkFileDiskLimit)
+
+	cNumaAwareExecutorEnabled := C.bool(paramtable.Get().QueryNodeCfg.EnableNumaAwareExecutor.GetAsBool())
+	C.SetDefaultNumaAwareExecutorEnable(cNumaAwareExecutorEnabled)
+
+	cFusedRangeConjunctEnabled := C.bool(paramtable.Get().QueryNodeCfg.EnableFusedRangeConjunct.GetAsBool())
+	C.SetDefaultFusedRangeConjunctEnable(cFusedRangeConjunctEnabled)
+
+	cSplitColumnGroupsForTake := C.bool(paramtable.Get().QueryNodeCfg.SplitColumnGroupsForTake.GetAsBool())
+	C.SegcoreSetSplitColumnGroupsForTake(cSplitColumnGroupsForTake)
+
+	cTakeCacheBytesPerSegment := C.int64_t(paramtable.Get().QueryNodeCfg.TakeCacheBytesPerSegment.GetAsInt64())
+	C.SegcoreSetTakeCacheBytesPerSegment(cTakeCacheBytesPerSegment)
+
 	cEnableLatestDeleteSnapshotOptimization := C.bool(paramtable.Get().QueryNodeCfg.EnableLatestDeleteSnapshotOptimization.GetAsBool())
 	C.SetEnableLatestDeleteSnapshotOptimization(cEnableLatestDeleteSnapshotOptimization)
 
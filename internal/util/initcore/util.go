@@ -55,6 +55,10 @@ func UpdateLoadTransientBudgetBytes(bytes int64) {
 	C.SetLoadTransientBudgetBytes(C.int64_t(bytes))
 }
 
+func UpdateRawDataCacheInflightBytes(bytes int64) {
+	C.SetRawDataCacheInflightBytes(C.int64_t(bytes))
+}
+
 func UpdateHighPriorityThreadCoreCoefficient(coefficient float64) {
 	C.SetHighPriorityThreadCoreCoefficient(C.float(coefficient))
 }
@@ -79,6 +83,30 @@ func UpdateDefaultDeleteDumpBatchSize(size int) {
 	C.SetDefaultDeleteDumpBatchSize(C.int64_t(size))
 }
 
+func UpdatePreparedGeometryCacheCapacity(capacity int) {
+	C.SetPreparedGeometryCacheCapacity(C.int64_t(capacity))
+}
+
+func UpdateDefaultChunkEncodingEnable(enable bool) {
+	C.SetDefaultChunkEncodingEnable(C.bool(enable))
+}
+
+func UpdateDefaultPersistentChunkFileEnable(enable bool) {
+	C.SetDefaultPersistentChunkFileEnable(C.bool(enable))
+}
+
+func UpdatePersistentChunkFileDiskLimit(bytes int64) {
+	C.SetPersistentChunkFileDiskLimit(C.int64_t(bytes))
+}
+
+func UpdateDefaultNumaAwareExecutorEnable(enable bool) {
+	C.SetDefaultNumaAwareExecutorEnable(C.bool(enable))
+}
+
+func UpdateDefaultFusedRangeConjunctEnable(enable bool) {
+	C.SetDefaultFusedRangeConjunctEnable(C.bool(enable))
+}
+
 func UpdateDefaultOptimizeExprEnable(enable bool) {
 	C.SetDefaultOptimizeExprEnable(C.bool(enable))
 }
@@ -268,3 +296,7 @@ func UpdateDefaultEnableParquetStatsSkipIndex(enable bool) {
 func UpdateEnableLatestDeleteSnapshotOptimization(enable bool) {
 	C.SetEnableLatestDeleteSnapshotOptimization(C.bool(enable))
 }
+
+func UpdateDefaultKmeansMiniBatchEnable(enable bool) {
+	C.SetDefaultKmeansMiniBatchEnable(C.bool(enable))
+}
@@ -243,6 +243,7 @@ type commonConfig struct {
 
 	IndexSliceSize                      ParamItem `refreshable:"false"`
 	LoadTransientBudgetBytes            ParamItem `refreshable:"true"`
+	RawDataCacheInflightBytes           ParamItem `refreshable:"true"`
 	HighPriorityThreadCoreCoefficient   ParamItem `refreshable:"true"`
 	MiddlePriorityThreadCoreCoefficient ParamItem `refreshable:"true"`
 	LowPriorityThreadCoreCoefficient    ParamItem `refreshable:"true"`
@@ -597,6 +598,17 @@ This configuration is only used by querynode and indexnode, it selects CPU instr
 	}
 	p.LoadTransientBudgetBytes.Init(base.mgr)
 
+	p.RawDataCacheInflightBytes = ParamItem{
+		Key:          "common.rawDataCacheInflightBytes",
+		Version:      "3.0.0",
+		DefaultValue: "134217728",
+		Doc: `Decoded binlog bytes a disk index build keeps in memory while it ` +
+			`caches raw data to local disk, including the binlog being written. ` +
+			`Downloads run ahead of the disk writes within this budget.`,
+		Export: true,
+	}
+	p.RawDataCacheInflightBytes.Init(base.mgr)
+
 	p.EnableMaterializedView = ParamItem{
 		Key:          "common.materializedView.enabled",
 		Version:      "2.4.6",
@@ -4030,6 +4042,28 @@ type queryNodeConfig struct {
 	// delete snapshot dump batch size
 	DeleteDumpBatchSize ParamItem `refreshable:"false"`
 
+	// prepared GIS query geometries cached per thread
+	PreparedGeometryCacheCapacity ParamItem `refreshable:"true"`
+
+	// lightweight encodings of mmap'd sealed chunks
+	EnableChunkEncoding ParamItem `refreshable:"true"`
+
+	// sealed chunk files kept on local disk across evictions and restarts
+	EnablePersistentChunkFile    ParamItem `refreshable:"true"`
+	PersistentChunkFileDiskLimit ParamItem `refreshable:"true"`
+
+	// per NUMA node search and load executors
+	EnableNumaAwareExecutor ParamItem `refreshable:"true"`
+
+	// one pass evaluation of range conjunctions
+	EnableFusedRangeConjunct ParamItem `refreshable:"true"`
+
+	// per field cells for segments taking output fields
+	SplitColumnGroupsForTake ParamItem `refreshable:"true"`
+
+	// output rows fetched by take() cached per sealed segment
+	TakeCacheBytesPerSegment ParamItem `refreshable:"true"`
+
 	// delete snapshot optimization
 	EnableLatestDeleteSnapshotOptimization ParamItem `refreshable:"true"`
 
@@ -5328,6 +5362,78 @@ user-task-polling:
 	}
 	p.DeleteDumpBatchSize.Init(base.mgr)
 
+	p.PreparedGeometryCacheCapacity = ParamItem{
+		Key:          "queryNode.segcore.preparedGeometryCacheCapacity",
+		Version:      "3.0.0",
+		DefaultValue: "2048",
+		Doc:          "Number of prepared GIS query geometries cached per search thread. Should cover the distinct geometries of the workload, otherwise they are parsed and prepared again on every segment.",
+		Export:       true,
+	}
+	p.PreparedGeometryCacheCapacity.Init(base.mgr)
+
+	p.EnableChunkEncoding = ParamItem{
+		Key:          "queryNode.segcore.enableChunkEncoding",
+		Version:      "3.0.0",
+		DefaultValue: "false",
+		Doc:          "Keep a frame-of-reference, dictionary or run-length encoding of mmap'd sealed chunks in memory and evaluate range filters on it, so the raw pages of the column are not faulted in. Applies to segments loaded afterwards.",
+		Export:       true,
+	}
+	p.EnableChunkEncoding.Init(base.mgr)
+
+	p.EnablePersistentChunkFile = ParamItem{
+		Key:          "queryNode.segcore.enablePersistentChunkFile",
+		Version:      "3.0.0",
+		DefaultValue: "false",
+		Doc:          "Keep the mmap'd chunk files of sealed segments on local disk with a checksummed trailer, so a cell evicted from the cache or loaded again after a restart maps its file instead of fetching and decoding the binlogs. The files of a segment are removed when the node releases it but kept across a restart, and files no cell maps count against the disk resource of the caching layer. Applies to cells loaded afterwards.",
+		Export:       true,
+	}
+	p.EnablePersistentChunkFile.Init(base.mgr)
+
+	p.PersistentChunkFileDiskLimit = ParamItem{
+		Key:          "queryNode.segcore.persistentChunkFileDiskLimit",
+		Version:      "3.0.0",
+		DefaultValue: "68719476736",
+		Doc:          "Bytes of persistent chunk files kept under the local mmap directory, the least recently used files are removed beyond it. Default 64 GiB.",
+		Export:       true,
+	}
+	p.PersistentChunkFileDiskLimit.Init(base.mgr)
+
+	p.EnableNumaAwareExecutor = ParamItem{
+		Key:          "queryNode.segcore.enableNumaAwareExecutor",
+		Version:      "3.0.0",
+		DefaultValue: "false",
+		Doc:          "On a multi-socket node, give every NUMA node its own search and load executor with threads pinned to its CPUs, and run the work on a segment on the executor of the node holding its memory. Has no effect on a single NUMA node.",
+		Export:       true,
+	}
+	p.EnableNumaAwareExecutor.Init(base.mgr)
+
+	p.EnableFusedRangeConjunct = ParamItem{
+		Key:          "queryNode.segcore.enableFusedRangeConjunct",
+		Version:      "3.0.0",
+		DefaultValue: "true",
+		Doc:          "Evaluate an AND of range and comparison filters on numeric fields in one pass over each batch, instead of one pass and one bitmap per filter.",
+		Export:       true,
+	}
+	p.EnableFusedRangeConjunct.Init(base.mgr)
+
+	p.SplitColumnGroupsForTake = ParamItem{
+		Key:          "queryNode.segcore.splitColumnGroupsForTake",
+		Version:      "3.0.0",
+		DefaultValue: "false",
+		Doc:          "Load each field of a manifest column group into its own cells for segments that take output fields with take(), so a filter only fetches the columns it reads. Opens one chunk reader per field at load time. Applies to segments loaded afterwards.",
+		Export:       true,
+	}
+	p.SplitColumnGroupsForTake.Init(base.mgr)
+
+	p.TakeCacheBytesPerSegment = ParamItem{
+		Key:          "queryNode.segcore.takeCacheBytesPerSegment",
+		Version:      "3.0.0",
+		DefaultValue: "0",
+		Doc:          "Byte budget per sealed segment for rows fetched by take() for output fields of external and storage v2 segments, so hot entities are not read from remote storage again. The cached bytes are charged to the caching layer as memory it can't evict. 0 disables the cache. Applies to segments loaded afterwards.",
+		Export:       true,
+	}
+	p.TakeCacheBytesPerSegment.Init(base.mgr)
+
 	p.EnableLatestDeleteSnapshotOptimization = ParamItem{
 		Key:          "queryNode.segcore.enableLatestDeleteSnapshotOptimization",
 		Version:      "2.6.11",
@@ -5686,6 +5792,7 @@ type dataCoordConfig struct {
 	ClusteringCompactionMinClusterSizeRatio    ParamItem `refreshable:"true"`
 	ClusteringCompactionMaxClusterSizeRatio    ParamItem `refreshable:"true"`
 	ClusteringCompactionMaxClusterSize         ParamItem `refreshable:"true"`
+	ClusteringCompactionMiniBatchKmeans        ParamItem `refreshable:"true"`
 
 	// LevelZero Segment
 	LevelZeroCompactionTriggerMinSize        ParamItem `refreshable:"true"`
@@ -6585,6 +6692,15 @@ Layout 1 is additionally gated on no QueryNode still reporting an older release
 	}
 	p.ClusteringCompactionMaxClusterSize.Init(base.mgr)
 
+	p.ClusteringCompactionMiniBatchKmeans = ParamItem{
+		Key:          "dataCoord.compaction.clustering.miniBatchKmeans",
+		Version:      "3.0.0",
+		DefaultValue: "false",
+		Doc:          "when the data exceeds the Kmeans train size, refine the sampled centroids with mini-batch Kmeans over the rows left out of the sample",
+		Export:       true,
+	}
+	p.ClusteringCompactionMiniBatchKmeans.Init(base.mgr)
+
 	p.EnableGarbageCollection = ParamItem{
 		Key:          "dataCoord.enableGarbageCollection",
 		Version:      "2.0.0",